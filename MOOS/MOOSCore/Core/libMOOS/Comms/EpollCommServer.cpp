@@ -0,0 +1,452 @@
+/**
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of 
+//   Applications and Libraries for Mobile Robotics Research 
+//   Copyright (C) Paul Newman
+//    
+//   This software was written by Paul Newman at MIT 2001-2002 and 
+//   the University of Oxford 2003-2013 
+//   
+//   email: pnewman@robots.ox.ac.uk. 
+//              
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Lesser Public License v2.1
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/lgpl.txt
+//          
+//   This program is distributed in the hope that it will be useful, 
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of 
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+//
+////////////////////////////////////////////////////////////////////////////
+**/
+
+
+
+
+
+/*
+ * EpollCommServer.cpp
+ *
+ * socket IO for many clients on a few threads
+ */
+
+
+#include "MOOS/libMOOS/Utils/MOOSException.h"
+#include "MOOS/libMOOS/Comms/XPCTcpSocket.h"
+#include "MOOS/libMOOS/Comms/EpollCommServer.h"
+#include "MOOS/libMOOS/Utils/ConsoleColours.h"
+#include "MOOS/libMOOS/Utils/ThreadPriority.h"
+#include "MOOS/libMOOS/Utils/MOOSScopedLock.h"
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/signal.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+#include <algorithm>
+
+//most we read from a socket each time it is readable - more means
+//fewer system calls but a busy client hogging its IO thread
+#define EPOLL_READ_CHUNK 65536
+
+//most events handled per wait
+#define EPOLL_MAX_EVENTS 64
+
+namespace MOOS
+{
+
+EpollCommServer::EpollCommServer()
+{
+    SetIOThreads(2);
+}
+
+EpollCommServer::~EpollCommServer()
+{
+    Stop();
+
+    for(unsigned int i = 0;i<m_IOThreads.size();i++)
+        delete m_IOThreads[i];
+}
+
+bool EpollCommServer::SetIOThreads(unsigned int nThreads)
+{
+    if(m_ServerThread.IsThreadRunning())
+        return MOOSFail("EpollCommServer::SetIOThreads() must be called before Run()");
+
+    if(nThreads==0)
+        nThreads = 1;
+
+    while(m_IOThreads.size()>nThreads)
+    {
+        delete m_IOThreads.back();
+        m_IOThreads.pop_back();
+    }
+
+    while(m_IOThreads.size()<nThreads)
+        m_IOThreads.push_back(new IOThread(m_bBoostIOThreads));
+
+    return true;
+}
+
+bool EpollCommServer::ServerLoop()
+{
+    for(unsigned int i = 0;i<m_IOThreads.size();i++)
+    {
+        m_IOThreads[i]->_bBoost = m_bBoostIOThreads;
+        if(!m_IOThreads[i]->_Thread.Start())
+            return MOOSFail("EpollCommServer::ServerLoop() failed to start IO thread");
+    }
+
+    return BASE::ServerLoop();
+}
+
+bool EpollCommServer::Stop()
+{
+    //clients go first - they need their IO threads to let go of them
+    bool bResult = BASE::Stop();
+
+    for(unsigned int i = 0;i<m_IOThreads.size();i++)
+    {
+        if(m_IOThreads[i]->_Thread.IsThreadRunning())
+            m_IOThreads[i]->_Thread.Stop();
+    }
+
+    return bResult;
+}
+
+ThreadedCommServer::ClientThread * EpollCommServer::NewClientThread(const std::string & sName,
+        XPCTcpSocket & ClientSocket,
+        SHARED_PKT_QUEUE & SharedDataIncoming,
+        bool bAsync,
+        double dfConsolidationPeriodMS)
+{
+    //give the new client to the least busy IO thread
+    IOThread * pIO = m_IOThreads.front();
+    for(unsigned int i = 1;i<m_IOThreads.size();i++)
+    {
+        if(m_IOThreads[i]->GetClientCount()<pIO->GetClientCount())
+            pIO = m_IOThreads[i];
+    }
+
+    return new EpollClient(sName,
+            ClientSocket,
+            SharedDataIncoming,
+            bAsync,
+            dfConsolidationPeriodMS,
+            m_dfClientTimeout,
+            pIO);
+}
+
+
+
+EpollCommServer::IOThread::IOThread(bool bBoost):_bBoost(bBoost)
+{
+    _nEpoll = epoll_create(EPOLL_MAX_EVENTS);
+    if(_nEpoll<0)
+        throw CMOOSException("EpollCommServer::IOThread failed to create epoll set");
+
+    _Thread.Initialise(RunEntry,this);
+    _Thread.Name("EpollCommServer::IOThread");
+}
+
+EpollCommServer::IOThread::~IOThread()
+{
+    _Thread.Stop();
+    close(_nEpoll);
+}
+
+unsigned int EpollCommServer::IOThread::GetClientCount()
+{
+    MOOS::ScopedLock L(_Lock);
+    return _Clients.size();
+}
+
+bool EpollCommServer::IOThread::Add(EpollClient * pClient)
+{
+    MOOS::ScopedLock L(_Lock);
+
+    struct epoll_event Event;
+    Event.events = EPOLLIN;
+    Event.data.ptr = pClient;
+    if(epoll_ctl(_nEpoll,EPOLL_CTL_ADD,pClient->GetSocket().iGetSocketFd(),&Event)!=0)
+        return MOOSFail("EpollCommServer::IOThread::Add() failed to watch socket");
+
+    _Clients.insert(pClient);
+    return true;
+}
+
+bool EpollCommServer::IOThread::Remove(EpollClient * pClient)
+{
+    MOOS::ScopedLock L(_Lock);
+
+    //it may well have gone already if the client hung up
+    epoll_ctl(_nEpoll,EPOLL_CTL_DEL,pClient->GetSocket().iGetSocketFd(),NULL);
+
+    _Clients.erase(pClient);
+    return true;
+}
+
+void EpollCommServer::IOThread::Ready(SHARED_PKT_QUEUE & Queue, const ClientThreadSharedData & SD)
+{
+    _Ready.push_back(std::make_pair(&Queue,SD));
+}
+
+bool EpollCommServer::IOThread::Run()
+{
+    //ignore broken pipes as is standard for network apps
+    signal(SIGPIPE,SIG_IGN);
+
+    if(_bBoost)
+        MOOS::BoostThisThread();
+
+    struct epoll_event Events[EPOLL_MAX_EVENTS];
+    double dfLastTimeoutCheck = MOOSLocalTime();
+
+    while(!_Thread.IsQuitRequested())
+    {
+        int nEvents = epoll_wait(_nEpoll,Events,EPOLL_MAX_EVENTS,500);
+        if(nEvents<0 && errno!=EINTR)
+            return MOOSFail("EpollCommServer::IOThread epoll_wait failed");
+
+        std::vector<std::pair<SHARED_PKT_QUEUE*,ClientThreadSharedData> > Ready;
+        {
+            MOOS::ScopedLock L(_Lock);
+
+            for(int i = 0;i<nEvents;i++)
+            {
+                EpollClient * pClient = (EpollClient*)Events[i].data.ptr;
+
+                //removed since epoll_wait returned?
+                if(_Clients.find(pClient)==_Clients.end() || pClient->IsClosed())
+                    continue;
+
+                bool bOK = true;
+                unsigned int nFlags = Events[i].events;
+
+                if(nFlags & EPOLLIN)
+                    bOK = pClient->OnReadable();
+                else if(nFlags & (EPOLLERR | EPOLLHUP))
+                    bOK = false;
+
+                if(bOK && (nFlags & EPOLLOUT))
+                    bOK = pClient->OnWritable();
+
+                if(!bOK)
+                    pClient->Close();
+            }
+
+            //look for silent clients
+            double dfNow = MOOSLocalTime();
+            if(dfNow-dfLastTimeoutCheck>1.0)
+            {
+                dfLastTimeoutCheck = dfNow;
+                std::set<EpollClient*>::iterator q;
+                for(q = _Clients.begin();q!=_Clients.end();q++)
+                {
+                    EpollClient * pClient = *q;
+                    if(!pClient->IsClosed() && dfNow-pClient->GetLastReadTime()>pClient->GetClientTimeout())
+                    {
+                        std::cout<<MOOS::ConsoleColours::Red();
+                        std::cout<<"Disconnecting \""<<pClient->GetName()<<"\" after "<<pClient->GetClientTimeout()<<" seconds of silence\n";
+                        std::cout<<MOOS::ConsoleColours::reset();
+                        pClient->Close();
+                    }
+                }
+            }
+
+            Ready.swap(_Ready);
+        }
+
+        //and now, without holding the lock, hand over what we have
+        for(unsigned int i = 0;i<Ready.size();i++)
+            Ready[i].first->Push(Ready[i].second);
+    }
+
+    return true;
+}
+
+
+
+EpollCommServer::EpollClient::EpollClient(const std::string & sName,
+        XPCTcpSocket & ClientSocket,
+        SHARED_PKT_QUEUE & SharedDataIncoming,
+        bool bAsync,
+        double dfConsolidationPeriodMS,
+        double dfClientTimeout,
+        IOThread * pIO):
+            ClientThread(sName,ClientSocket,SharedDataIncoming,bAsync,
+                    dfConsolidationPeriodMS,dfClientTimeout,false),
+            _pIO(pIO),
+            _Rx(sName,ClientThreadSharedData::PKT_READ),
+            _nTxSent(0),
+            _dfLastRead(MOOSLocalTime()),
+            _bClosed(false)
+{
+}
+
+EpollCommServer::EpollClient::~EpollClient()
+{
+    Kill();
+}
+
+bool EpollCommServer::EpollClient::Start()
+{
+    int nFd = _ClientSocket.iGetSocketFd();
+    int nFlags = fcntl(nFd,F_GETFL,0);
+    if(nFlags<0 || fcntl(nFd,F_SETFL,nFlags | O_NONBLOCK)<0)
+        return MOOSFail("EpollCommServer::EpollClient::Start() cannot make socket non-blocking");
+
+    _dfLastRead = MOOSLocalTime();
+    return _pIO->Add(this);
+}
+
+bool EpollCommServer::EpollClient::Kill()
+{
+    _pIO->Remove(this);
+
+    MOOS::ScopedLock L(_OutLock);
+    _bClosed = true;
+    return true;
+}
+
+void EpollCommServer::EpollClient::Close()
+{
+    {
+        MOOS::ScopedLock L(_OutLock);
+        if(_bClosed)
+            return;
+        _bClosed = true;
+    }
+
+    //we hold the IO thread's lock so can do this directly
+    epoll_ctl(_pIO->_nEpoll,EPOLL_CTL_DEL,_ClientSocket.iGetSocketFd(),NULL);
+
+    ClientThreadSharedData SD(_sClientName,ClientThreadSharedData::CONNECTION_CLOSED);
+    _pIO->Ready(_SharedDataIncoming,SD);
+}
+
+bool EpollCommServer::EpollClient::OnReadable()
+{
+    unsigned char Buffer[EPOLL_READ_CHUNK];
+
+    int nRead = recv(_ClientSocket.iGetSocketFd(),Buffer,sizeof(Buffer),0);
+    if(nRead==0)
+        return false;
+
+    if(nRead<0)
+        return errno==EAGAIN || errno==EWOULDBLOCK || errno==EINTR;
+
+    _ClientSocket.SetReadTime(MOOS::Time());
+    _dfLastRead = MOOSLocalTime();
+
+    //carve the bytes up into packets - any one read may hold the end
+    //of one packet, several whole ones and the start of another
+    unsigned char * pData = Buffer;
+    while(nRead>0)
+    {
+        int nRqd = _Rx._pPkt->GetBytesRequired();
+        if(nRqd<=0)
+        {
+            MOOSTrace("EpollCommServer: corrupt packet header from %s\n",_sClientName.c_str());
+            return false;
+        }
+
+        int nTake = std::min(nRqd,nRead);
+        _Rx._pPkt->Fill(pData,nTake);
+        pData+=nTake;
+        nRead-=nTake;
+
+        if(_Rx._pPkt->GetBytesRequired()==0)
+        {
+            _pIO->Ready(_SharedDataIncoming,_Rx);
+            _Rx = ClientThreadSharedData(_sClientName,ClientThreadSharedData::PKT_READ);
+        }
+    }
+
+    return true;
+}
+
+bool EpollCommServer::EpollClient::SendToClient(ClientThreadSharedData & OutGoing)
+{
+    MOOS::ScopedLock L(_OutLock);
+
+    if(_bClosed)
+        return false;
+
+    unsigned char * pData = OutGoing._pPkt->Stream();
+    int nData = OutGoing._pPkt->GetStreamLength();
+
+    //if nothing is waiting try to send it all now
+    if(_TxBacklog.empty())
+    {
+        int nSent = send(_ClientSocket.iGetSocketFd(),pData,nData,MSG_NOSIGNAL);
+        if(nSent<0)
+        {
+            if(errno!=EAGAIN && errno!=EWOULDBLOCK && errno!=EINTR)
+                return false; //the IO thread will hear about this
+            nSent = 0;
+        }
+
+        if(nSent==nData)
+            return true;
+
+        pData+=nSent;
+        nData-=nSent;
+
+        _TxBacklog.assign(pData,pData+nData);
+        _nTxSent = 0;
+        return WatchWrites(true);
+    }
+
+    //otherwise join the back of the queue
+    _TxBacklog.insert(_TxBacklog.end(),pData,pData+nData);
+    return true;
+}
+
+bool EpollCommServer::EpollClient::OnWritable()
+{
+    MOOS::ScopedLock L(_OutLock);
+
+    if(_TxBacklog.empty())
+        return WatchWrites(false);
+
+    int nSent = send(_ClientSocket.iGetSocketFd(),
+            &_TxBacklog[_nTxSent],
+            _TxBacklog.size()-_nTxSent,
+            MSG_NOSIGNAL);
+
+    if(nSent<0)
+        return errno==EAGAIN || errno==EWOULDBLOCK || errno==EINTR;
+
+    _nTxSent+=nSent;
+    if(_nTxSent==_TxBacklog.size())
+    {
+        _TxBacklog.clear();
+        _nTxSent = 0;
+        return WatchWrites(false);
+    }
+
+    //don't let what has gone pile up at the front
+    if(_nTxSent>_TxBacklog.size()/2)
+    {
+        _TxBacklog.erase(_TxBacklog.begin(),_TxBacklog.begin()+_nTxSent);
+        _nTxSent = 0;
+    }
+
+    return true;
+}
+
+bool EpollCommServer::EpollClient::WatchWrites(bool bWatch)
+{
+    struct epoll_event Event;
+    Event.events = bWatch ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+    Event.data.ptr = this;
+    return epoll_ctl(_pIO->_nEpoll,EPOLL_CTL_MOD,_ClientSocket.iGetSocketFd(),&Event)==0;
+}
+
+}
@@ -37,6 +37,10 @@
 #include <iostream>
 #include <cstring>
 
+#ifdef MOOS_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
 
 using namespace std;
 
@@ -122,6 +126,10 @@ bool CMOOSCommPkt::Fill(unsigned char *InData, int nData) {
             if (!IsLittleEndian()) {
                 m_nMsgLen = SwapByteOrder<int> (m_nMsgLen);
             }
+
+            //make room for the rest now rather than a chunk at a time
+            if (m_nMsgLen > m_nStreamSpace)
+                InflateTo(m_nMsgLen);
         }
     }
 
@@ -161,136 +169,319 @@ bool CMOOSCommPkt::Serialize(MOOSMSG_LIST &List,
                              bool bToStream,
                              bool bNoNULL,
                              double * pdfPktTime) {
+    if (bToStream) {
+        return Encode(List, NULL, 0);
+    } else {
+        return Decode(List, NULL, bNoNULL, pdfPktTime);
+    }
+}
+
+bool CMOOSCommPkt::Serialize(MOOSMSG_LIST &List,
+                             MOOS::PktDictionary & Dictionary,
+                             bool bToStream,
+                             unsigned int nCompressAbove,
+                             bool bNoNULL,
+                             double * pdfPktTime) {
+    if (bToStream) {
+        return Encode(List, &Dictionary, nCompressAbove);
+    } else {
+        return Decode(List, &Dictionary, bNoNULL, pdfPktTime);
+    }
+}
+
+bool CMOOSCommPkt::SupportsCompression() {
+#ifdef MOOS_HAVE_ZLIB
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool CMOOSCommPkt::Encode(MOOSMSG_LIST &List,
+                          MOOS::PktDictionary * pDictionary,
+                          unsigned int nCompressAbove) {
     //note +1 is for indicator regarding compressed or not compressed
     unsigned int nHeaderSize = 2 * sizeof(int) + 1;
 
-    if (bToStream) {
+    m_nMsgLen = 0;
+    m_nByteCount = 0;
+    m_nMsgsSerialised = 0;
+
+    //lets figure out how much space we need?
+    unsigned int nBufferSize = nHeaderSize; //some head room
+    MOOSMSG_LIST::iterator p;
+    for (p = List.begin(); p != List.end(); p++) {
+        nBufferSize += pDictionary == NULL
+                                   ? p->GetSizeInBytesWhenSerialised()
+                                   : p->GetMaxSizeInBytesWhenCompact();
+    }
+
+    InflateTo(nBufferSize);
+
+    m_pNextData = m_pStream + nHeaderSize;
+    m_nByteCount += nHeaderSize;
+
+    for (p = List.begin(); p != List.end(); p++)
+    {
 
-        m_nMsgLen = 0;
-        m_nByteCount = 0;
-        m_nMsgsSerialised = 0;
+        m_nMsgsSerialised++;
 
-        //lets figure out how much space we need?
-        unsigned int nBufferSize = nHeaderSize; //some head room
-        MOOSMSG_LIST::iterator p;
-        for (p = List.begin(); p != List.end(); p++) {
-            nBufferSize += p->GetSizeInBytesWhenSerialised();
+        int nCopied = pDictionary == NULL
+                    ? p->Serialize(m_pNextData, nBufferSize - m_nByteCount)
+                    : p->SerializeCompact(m_pNextData, nBufferSize - m_nByteCount, *pDictionary);
+
+        if (nCopied == -1) {
+            std::cerr << "big problem failed serialisation: "
+                    << "CMOOSCommPkt::Serialize()" << "\n";  // Was: __PRETTY_FUNCTION__ which only exists in GCC
+
+            return false;
         }
 
-        InflateTo(nBufferSize);
+        m_pNextData += nCopied;
+        m_nByteCount += nCopied;
 
-        m_pNextData = m_pStream + nHeaderSize;
-        m_nByteCount += nHeaderSize;
+    }
 
-        for (p = List.begin(); p != List.end(); p++)
-        {
+    unsigned char cFlags = pDictionary == NULL ? 0 : MOOS_PKT_COMPACT;
 
-            m_nMsgsSerialised++;
+    if (nCompressAbove > 0 &&
+            m_nByteCount > (int) nCompressAbove &&
+            Compress(nHeaderSize)) {
+        cFlags |= MOOS_PKT_COMPRESSED;
+    }
 
-            int nCopied = p->Serialize(m_pNextData, nBufferSize - m_nByteCount);
+    //finally write how many bytes we have written at the start
+    //look for need to swap byte order if required
+    m_pNextData = m_pStream;
+    int nBC = IsLittleEndian()
+                               ? m_nByteCount
+                               : SwapByteOrder<int> (m_nByteCount);
+
+    memcpy((void*) m_pNextData, (void*) (&nBC), sizeof(m_nByteCount));
+    m_pNextData += sizeof(m_nByteCount);
+
+    //and then how many messages are included
+    //look for need to swap byte order if required
+    int nMessages = List.size();
+    nMessages = IsLittleEndian()
+                                 ? nMessages
+                                 : SwapByteOrder<int> (nMessages);
+    memcpy((void*) m_pNextData, (void*) (&nMessages), sizeof(nMessages));
+    m_pNextData += sizeof(nMessages);
+
+    //and is this a compressed (or compact) message or not?
+    *m_pNextData = cFlags;
+    m_pNextData += 1;
 
-            if (nCopied == -1) {
-                std::cerr << "big problem failed serialisation: "
-                        << "CMOOSCommPkt::Serialize()" << "\n";  // Was: __PRETTY_FUNCTION__ which only exists in GCC
+    //here at the last moment we can fill in our totalm length for safe keeping
+    m_nMsgLen = m_nByteCount;
 
-                return false;
-            }
+    return true;
+}
 
-            m_pNextData += nCopied;
-            m_nByteCount += nCopied;
+bool CMOOSCommPkt::Decode(MOOSMSG_LIST &List,
+                          MOOS::PktDictionary * pDictionary,
+                          bool bNoNULL,
+                          double * pdfPktTime) {
+    m_pNextData = m_pStream;
+    m_nMsgLen = 0;
+    m_nByteCount = 0;
 
-        }
+    //first figure out the length of the message
+    //look to swap byte order as required
+    memcpy((void*) (&m_nMsgLen), (void*) m_pNextData, sizeof(m_nMsgLen));
+    m_nMsgLen = IsLittleEndian()
+                                 ? m_nMsgLen
+                                 : SwapByteOrder<int> (m_nMsgLen);
+    m_pNextData += sizeof(m_nMsgLen);
+    m_nByteCount += sizeof(m_nMsgLen);
+
+    int nSpaceFree = m_nMsgLen - sizeof(m_nMsgLen);
+
+    //now figure out how many messages are packed in this packet
+    //look to swap byte order as required
+    int nMessages = 0;
+    memcpy((void*) (&nMessages), (void*) m_pNextData, sizeof(nMessages));
+    nMessages = IsLittleEndian()
+                                 ? nMessages
+                                 : SwapByteOrder<int> (nMessages);
+    m_pNextData += sizeof(nMessages);
+    nSpaceFree -= sizeof(nMessages);
+    m_nByteCount += sizeof(nMessages);
+
+    //now account for one byte of compression indication
+    unsigned char cFlags = *m_pNextData;
+    m_pNextData += sizeof(unsigned char);
+    nSpaceFree -= sizeof(unsigned char);
+    m_nByteCount += sizeof(unsigned char);
+
+    if ((cFlags & MOOS_PKT_COMPACT) && pDictionary == NULL) {
+        std::cerr << "CMOOSCommPkt::Serialize() compact packet received "
+                << "on a connection which did not negotiate it\n";
+        return false;
+    }
 
-        unsigned char bCompressed = 0;
+    //a compressed body is unpacked somewhere else and read from there
+    unsigned char * pData = m_pNextData;
+    int nCompressedSize = nSpaceFree;
+    if (cFlags & MOOS_PKT_COMPRESSED) {
+        if (!Decompress(m_pNextData, nSpaceFree)) {
+            return false;
+        }
+        pData = &m_Scratch[0];
+        nSpaceFree = m_Scratch.size();
+    }
 
-        //finally write how many bytes we have written at the start
-        //look for need to swap byte order if required
-        m_pNextData = m_pStream;
-        int nBC = IsLittleEndian()
-                                   ? m_nByteCount
-                                   : SwapByteOrder<int> (m_nByteCount);
+    for (int i = 0; i < nMessages; i++) {
 
-        memcpy((void*) m_pNextData, (void*) (&nBC), sizeof(m_nByteCount));
-        m_pNextData += sizeof(m_nByteCount);
+        CMOOSMsg Msg;
+        int nUsed = (cFlags & MOOS_PKT_COMPACT)
+                  ? Msg.SerializeCompact(pData, nSpaceFree, *pDictionary, false)
+                  : Msg.Serialize(pData, nSpaceFree, false);
 
-        //and then how many messages are included
-        //look for need to swap byte order if required
-        int nMessages = List.size();
-        nMessages = IsLittleEndian()
-                                     ? nMessages
-                                     : SwapByteOrder<int> (nMessages);
-        memcpy((void*) m_pNextData, (void*) (&nMessages), sizeof(nMessages));
-        m_pNextData += sizeof(nMessages);
+        if (nUsed != -1) {
+            //allows us to not store NULL messages
+            bool bOmit = bNoNULL && (Msg.m_cMsgType == MOOS_NULL_MSG);
 
-        //and is this a compressed message or not?
-        *m_pNextData = bCompressed;
-        m_pNextData += 1;
+            if (Msg.m_cMsgType == MOOS_NULL_MSG && pdfPktTime != NULL && i
+                    == 0) {
+                *pdfPktTime = Msg.GetDouble();
+            }
 
-    } else {
+            if (!bOmit) {
+                List.push_back(Msg);
+            }
 
-        m_pNextData = m_pStream;
-        m_nMsgLen = 0;
-        m_nByteCount = 0;
-
-        //first figure out the length of the message
-        //look to swap byte order as required
-        memcpy((void*) (&m_nMsgLen), (void*) m_pNextData, sizeof(m_nMsgLen));
-        m_nMsgLen = IsLittleEndian()
-                                     ? m_nMsgLen
-                                     : SwapByteOrder<int> (m_nMsgLen);
-        m_pNextData += sizeof(m_nMsgLen);
-        m_nByteCount += sizeof(m_nMsgLen);
-
-        int nSpaceFree = m_nMsgLen - sizeof(m_nMsgLen);
-
-        //now figure out how many messages are packed in this packet
-        //look to swap byte order as required
-        int nMessages = 0;
-        memcpy((void*) (&nMessages), (void*) m_pNextData, sizeof(nMessages));
-        nMessages = IsLittleEndian()
-                                     ? nMessages
-                                     : SwapByteOrder<int> (nMessages);
-        m_pNextData += sizeof(nMessages);
-        nSpaceFree -= sizeof(nMessages);
-        m_nByteCount += sizeof(nMessages);
-
-        //now account for one byet of compression indication
-        m_pNextData += sizeof(unsigned char);
-        nSpaceFree -= sizeof(unsigned char);
-        m_nByteCount += sizeof(unsigned char);
-
-        for (int i = 0; i < nMessages; i++) {
-
-            CMOOSMsg Msg;
-            int nUsed = Msg.Serialize(m_pNextData, nSpaceFree, false);
-
-            if (nUsed != -1) {
-                //allows us to not store NULL messages
-                bool bOmit = bNoNULL && (Msg.m_cMsgType == MOOS_NULL_MSG);
-
-                if (Msg.m_cMsgType == MOOS_NULL_MSG && pdfPktTime != NULL && i
-                        == 0) {
-                    *pdfPktTime = Msg.GetDouble();
-                }
-
-                if (!bOmit) {
-                    List.push_back(Msg);
-                }
-
-                m_pNextData += nUsed;
+            pData += nUsed;
+            nSpaceFree -= nUsed;
+            if (!(cFlags & MOOS_PKT_COMPRESSED)) {
                 m_nByteCount += nUsed;
-                nSpaceFree -= nUsed;
-
-            } else {
-                //bad news...
-                break;
             }
+
+        } else {
+            //bad news...
+            break;
         }
     }
 
+    if (cFlags & MOOS_PKT_COMPRESSED) {
+        m_nByteCount += nCompressedSize;
+    }
+    m_pNextData = m_pStream + m_nByteCount;
+
     //here at the last moment we can fill in our totalm length for safe keeping
     m_nMsgLen = m_nByteCount;
 
     return true;
 }
 
+/** squash everything after the header. The body becomes the uncompressed
+size followed by the zlib stream. Returns false (and leaves things alone)
+if that would not save anything */
+bool CMOOSCommPkt::Compress(unsigned int nHeaderSize) {
+#ifdef MOOS_HAVE_ZLIB
+    uLong nRaw = m_nByteCount - nHeaderSize;
+    uLongf nZipped = compressBound(nRaw);
+    m_Scratch.resize(nZipped);
+
+    if (compress2(&m_Scratch[0], &nZipped, m_pStream + nHeaderSize, nRaw,
+            Z_BEST_SPEED) != Z_OK) {
+        return false;
+    }
+
+    if (nZipped + sizeof(int) >= nRaw) {
+        return false;
+    }
+
+    int nRawSize = IsLittleEndian()
+                                    ? (int) nRaw
+                                    : SwapByteOrder<int> ((int) nRaw);
+    m_pNextData = m_pStream + nHeaderSize;
+    memcpy((void*) m_pNextData, (void*) (&nRawSize), sizeof(nRawSize));
+    m_pNextData += sizeof(nRawSize);
+    memcpy(m_pNextData, &m_Scratch[0], nZipped);
+    m_pNextData += nZipped;
+
+    m_nByteCount = nHeaderSize + sizeof(nRawSize) + nZipped;
+
+    return true;
+#else
+    MOOS::DeliberatelyNotUsed(nHeaderSize);
+    return false;
+#endif
+}
+
+bool CMOOSCommPkt::Decompress(unsigned char * pData, int nData) {
+#ifdef MOOS_HAVE_ZLIB
+    int nRawSize = 0;
+    if (nData < (int) sizeof(nRawSize)) {
+        return false;
+    }
+    memcpy((void*) (&nRawSize), (void*) pData, sizeof(nRawSize));
+    nRawSize = IsLittleEndian()
+                                ? nRawSize
+                                : SwapByteOrder<int> (nRawSize);
+
+    //don't let a corrupt or hostile size make us allocate
+    int nZipped = nData - (int) sizeof(nRawSize);
+    if (nRawSize <= 0 || nRawSize / MOOS_PKT_MAX_INFLATION > nZipped) {
+        std::cerr << "CMOOSCommPkt::Serialize() compressed packet claims an "
+                << "impossible size (" << nRawSize << " bytes)\n";
+        return false;
+    }
+
+    m_Scratch.resize(nRawSize);
+    uLongf nUnzipped = nRawSize;
+    if (uncompress(&m_Scratch[0], &nUnzipped, pData + sizeof(nRawSize),
+            nZipped) != Z_OK || (int) nUnzipped != nRawSize) {
+        std::cerr << "CMOOSCommPkt::Serialize() failed to decompress packet\n";
+        return false;
+    }
+    m_Scratch.resize(nUnzipped);
+
+    return true;
+#else
+    MOOS::DeliberatelyNotUsed(pData);
+    MOOS::DeliberatelyNotUsed(nData);
+    std::cerr << "CMOOSCommPkt::Serialize() compressed packet received but "
+            << "this library was built without zlib\n";
+    return false;
+#endif
+}
+
+
+namespace MOOS
+{
+
+PktDictionary::PktDictionary(unsigned int nMaxEntries) :
+    m_nMaxEntries(nMaxEntries) {
+}
+
+int PktDictionary::Find(const std::string & sStr) const {
+    std::map<std::string, unsigned int>::const_iterator q = m_IDs.find(sStr);
+    return q == m_IDs.end() ? -1 : (int) q->second;
+}
+
+bool PktDictionary::Get(unsigned int nID, std::string & sStr) const {
+    if (nID >= m_Strings.size()) {
+        return false;
+    }
+    sStr = m_Strings[nID];
+    return true;
+}
+
+bool PktDictionary::Add(const std::string & sStr) {
+    if (sStr.size() > MOOS_PKT_DICTIONARY_MAX_STRING ||
+            m_Strings.size() >= m_nMaxEntries) {
+        return false;
+    }
+    m_IDs[sStr] = m_Strings.size();
+    m_Strings.push_back(sStr);
+    return true;
+}
+
+unsigned int PktDictionary::Size() const {
+    return m_Strings.size();
+}
+
+}
@@ -128,6 +128,7 @@ CMOOSCommServer::CMOOSCommServer()
     m_pfnDisconnectCallBack = NULL;
     m_pfnConnectCallBack = NULL;
 	m_pfnFetchAllMailCallBack = NULL;
+	m_pfnCollectPendingMailCallBack = NULL;
     m_sCommunityName = "#1";
     m_bQuiet  = false;
 	m_bDisableNameLookUp = true;
@@ -883,6 +884,16 @@ void CMOOSCommServer::SetOnFetchAllMailCallBack(bool (*pfn)(const std::string  &
 
 }
 
+void CMOOSCommServer::SetOnCollectPendingMailCallBack(bool (*pfn)(std::vector<std::string> & Clients,void * pParam),void * pParam)
+{
+    //address of function to invoke (static)
+	m_pfnCollectPendingMailCallBack = pfn;
+
+	//store the parameter to pass with the invocation
+	m_pCollectPendingMailCallBackParam = pParam;
+
+}
+
 bool CMOOSCommServer::IsUniqueName(string &sClientName)
 {
     SOCKETFD_2_CLIENT_NAME_MAP::iterator p;
@@ -34,6 +34,8 @@
 #include "MOOS/libMOOS/Utils/MOOSException.h"
 #include "MOOS/libMOOS/Utils/MOOSPlaybackStatus.h"
 #include "MOOS/libMOOS/Comms/MOOSMsg.h"
+#include "MOOS/libMOOS/Comms/MOOSCommPkt.h"
+#include "MOOS/libMOOS/Thirdparty/PocoBits/AtomicCounter.h"
 
 #include <iostream>
 #include <sstream>
@@ -44,6 +46,34 @@
 
 using namespace std;
 
+namespace MOOS
+{
+    /** what all copies of a shared message have in common - the string
+    payload and the whole message in serialised form. Never changes once
+    built*/
+    class MsgPayload
+    {
+    public:
+        MsgPayload():m_nReferences(1){};
+        std::string m_sVal;
+        std::vector<unsigned char> m_Serialised;
+        Poco::AtomicCounter m_nReferences;
+    };
+}
+
+static MOOS::MsgPayload * AcquirePayload(MOOS::MsgPayload * pPayload)
+{
+    if(pPayload!=NULL)
+        ++pPayload->m_nReferences;
+    return pPayload;
+}
+
+static void ReleasePayload(MOOS::MsgPayload * pPayload)
+{
+    if(pPayload!=NULL && --pPayload->m_nReferences==0)
+        delete pPayload;
+}
+
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
@@ -51,6 +81,7 @@ using namespace std;
 
 CMOOSMsg::CMOOSMsg()
 {
+    m_pShared = NULL;
     m_cMsgType=MOOS_NULL_MSG;
     m_cDataType=MOOS_DOUBLE;
     m_dfTime = -1;
@@ -63,11 +94,136 @@ CMOOSMsg::CMOOSMsg()
 
 CMOOSMsg::~CMOOSMsg()
 {
+    ReleasePayload(m_pShared);
+}
+
+CMOOSMsg::CMOOSMsg(const CMOOSMsg & M)
+    : m_cMsgType(M.m_cMsgType),
+      m_cDataType(M.m_cDataType),
+      m_sKey(M.m_sKey),
+      m_nID(M.m_nID),
+      m_dfTime(M.m_dfTime),
+      m_dfVal(M.m_dfVal),
+      m_dfVal2(M.m_dfVal2),
+      m_sVal(M.m_sVal),
+      m_sSrc(M.m_sSrc),
+      m_sSrcAux(M.m_sSrcAux),
+      m_sOriginatingCommunity(M.m_sOriginatingCommunity),
+      m_pSerializeBufferStart(NULL),
+      m_pSerializeBuffer(NULL),
+      m_nSerializeBufferLen(0),
+      m_nLength(M.m_nLength),
+      m_pShared(AcquirePayload(M.m_pShared))
+{
+}
+
+CMOOSMsg & CMOOSMsg::operator =(const CMOOSMsg & M)
+{
+    if(this!=&M)
+    {
+        MOOS::MsgPayload * pShared = AcquirePayload(M.m_pShared);
+        ReleasePayload(m_pShared);
+        m_pShared = pShared;
+
+        m_cMsgType = M.m_cMsgType;
+        m_cDataType = M.m_cDataType;
+        m_sKey = M.m_sKey;
+        m_nID = M.m_nID;
+        m_dfTime = M.m_dfTime;
+        m_dfVal = M.m_dfVal;
+        m_dfVal2 = M.m_dfVal2;
+        m_sVal = M.m_sVal;
+        m_sSrc = M.m_sSrc;
+        m_sSrcAux = M.m_sSrcAux;
+        m_sOriginatingCommunity = M.m_sOriginatingCommunity;
+        m_nLength = M.m_nLength;
+    }
+    return *this;
+}
+
+#if __cplusplus >= 201103L
+CMOOSMsg::CMOOSMsg(CMOOSMsg && M)
+    : m_cMsgType(M.m_cMsgType),
+      m_cDataType(M.m_cDataType),
+      m_sKey(std::move(M.m_sKey)),
+      m_nID(M.m_nID),
+      m_dfTime(M.m_dfTime),
+      m_dfVal(M.m_dfVal),
+      m_dfVal2(M.m_dfVal2),
+      m_sVal(std::move(M.m_sVal)),
+      m_sSrc(std::move(M.m_sSrc)),
+      m_sSrcAux(std::move(M.m_sSrcAux)),
+      m_sOriginatingCommunity(std::move(M.m_sOriginatingCommunity)),
+      m_pSerializeBufferStart(NULL),
+      m_pSerializeBuffer(NULL),
+      m_nSerializeBufferLen(0),
+      m_nLength(M.m_nLength),
+      m_pShared(M.m_pShared)
+{
+    M.m_pShared = NULL;
+}
 
+CMOOSMsg & CMOOSMsg::operator =(CMOOSMsg && M)
+{
+    if(this!=&M)
+    {
+        ReleasePayload(m_pShared);
+        m_pShared = M.m_pShared;
+        M.m_pShared = NULL;
+
+        m_cMsgType = M.m_cMsgType;
+        m_cDataType = M.m_cDataType;
+        m_sKey = std::move(M.m_sKey);
+        m_nID = M.m_nID;
+        m_dfTime = M.m_dfTime;
+        m_dfVal = M.m_dfVal;
+        m_dfVal2 = M.m_dfVal2;
+        m_sVal = std::move(M.m_sVal);
+        m_sSrc = std::move(M.m_sSrc);
+        m_sSrcAux = std::move(M.m_sSrcAux);
+        m_sOriginatingCommunity = std::move(M.m_sOriginatingCommunity);
+        m_nLength = M.m_nLength;
+    }
+    return *this;
+}
+#endif
+
+void CMOOSMsg::Share()
+{
+    if(m_pShared!=NULL)
+        return;
+
+    //serialise once, now, on behalf of every copy yet to be made
+    MOOS::MsgPayload * pShared = new MOOS::MsgPayload;
+    pShared->m_Serialised.resize(GetSizeInBytesWhenSerialised());
+    if(Serialize(&pShared->m_Serialised[0],pShared->m_Serialised.size())==-1)
+    {
+        delete pShared;
+        return;
+    }
+
+    pShared->m_sVal.swap(m_sVal);
+    m_pShared = pShared;
+}
+
+void CMOOSMsg::Unshare()
+{
+    if(m_pShared==NULL)
+        return;
+
+    m_sVal = m_pShared->m_sVal;
+    ReleasePayload(m_pShared);
+    m_pShared = NULL;
+}
+
+const std::string & CMOOSMsg::GetPayload() const
+{
+    return m_pShared!=NULL ? m_pShared->m_sVal : m_sVal;
 }
 
 CMOOSMsg::CMOOSMsg(char cMsgType,const std::string  & sKey,double dfVal,double dfTime)
 {
+    m_pShared = NULL;
     m_cMsgType = cMsgType;
     m_dfVal = dfVal;
     m_dfVal2 = -1;
@@ -89,6 +245,7 @@ CMOOSMsg::CMOOSMsg(char cMsgType,const std::string  & sKey,double dfVal,double d
 
 CMOOSMsg::CMOOSMsg(char cMsgType,const std::string & sKey,const std::string &sVal,double dfTime)
 {
+    m_pShared = NULL;
     m_cMsgType = cMsgType;
     m_dfVal = -1;
     m_dfVal2 = -1;
@@ -111,6 +268,7 @@ CMOOSMsg::CMOOSMsg(char cMsgType,const std::string & sKey,const std::string &sVa
 
 CMOOSMsg::CMOOSMsg(char cMsgType,const std::string &sKey,  unsigned int nDataSize,const void* Data,double dfTime)
 {
+    m_pShared = NULL;
     m_cMsgType = cMsgType;
     m_dfVal = -1;
     m_dfVal2 = -1;
@@ -148,6 +306,7 @@ bool CMOOSMsg::operator == (const CMOOSMsg & M) const
 
 void CMOOSMsg::MarkAsBinary()
 {
+    Unshare();
 	m_cDataType=MOOS_BINARY_STRING;
 }
 
@@ -348,7 +507,7 @@ unsigned int CMOOSMsg::GetSizeInBytesWhenSerialised() const
 #endif
             sizeof(int)+m_sOriginatingCommunity.size()+
             sizeof(int)+m_sKey.size()+
-            sizeof(int)+m_sVal.size();
+            sizeof(int)+GetPayload().size();
 
     unsigned int nDouble = 3*sizeof(double);
 
@@ -360,7 +519,20 @@ unsigned int CMOOSMsg::GetSizeInBytesWhenSerialised() const
 int CMOOSMsg::Serialize(unsigned char *pBuffer, int nLen, bool bToStream)
 {
 
-    if(bToStream)
+    if(bToStream && m_pShared!=NULL)
+    {
+        //this has been done before on behalf of every copy of this message
+        int nSize = m_pShared->m_Serialised.size();
+        if(nSize>nLen)
+        {
+            MOOSTrace("exception : CMOOSMsg::Serialize failed: Out Of Space\n ");
+            MOOSTrace("perhaps accummulated messages exceeded available buffer space of %d bytes\n", nLen);
+            return -1;
+        }
+        memcpy(pBuffer,&m_pShared->m_Serialised[0],nSize);
+        m_nLength = nSize;
+    }
+    else if(bToStream)
     {
         try
         {
@@ -429,6 +601,8 @@ int CMOOSMsg::Serialize(unsigned char *pBuffer, int nLen, bool bToStream)
     else
     {
         //this is extracting from a stream....
+        ReleasePayload(m_pShared);
+        m_pShared = NULL;
 
         try
         {
@@ -499,6 +673,212 @@ bool CMOOSMsg::CanSerialiseN(int N)
     return      (m_pSerializeBuffer-m_pSerializeBufferStart)+N<=m_nSerializeBufferLen;
 }
 
+//the compact wire format. After the message and data types comes a byte
+//saying which of the optional fields follow. Small numbers are varints
+//and strings are written in full or as their id in a PktDictionary
+#define COMPACT_HAS_ID      0x01
+#define COMPACT_HAS_VAL     0x02
+#define COMPACT_HAS_VAL2    0x04
+#define COMPACT_HAS_STRING  0x08
+
+//how a string is written: literal, literal to be interned, or id+2
+#define COMPACT_LITERAL     0
+#define COMPACT_DEFINE      1
+
+static bool PutVarInt(unsigned char * & pBuffer,unsigned char * pEnd,unsigned int nVal)
+{
+    do
+    {
+        if(pBuffer==pEnd)
+            return false;
+        unsigned char c = nVal & 0x7F;
+        nVal >>= 7;
+        *pBuffer++ = nVal ? (c | 0x80) : c;
+    }while(nVal);
+
+    return true;
+}
+
+static bool GetVarInt(unsigned char * & pBuffer,unsigned char * pEnd,unsigned int & nVal)
+{
+    nVal = 0;
+    for(int nShift = 0;nShift<35;nShift+=7)
+    {
+        if(pBuffer==pEnd)
+            return false;
+        unsigned char c = *pBuffer++;
+        nVal |= (unsigned int)(c & 0x7F)<<nShift;
+        if(!(c & 0x80))
+            return true;
+    }
+    return false;
+}
+
+static bool PutCompactDouble(unsigned char * & pBuffer,unsigned char * pEnd,double dfVal)
+{
+    if(pEnd-pBuffer<(int)sizeof(double))
+        return false;
+    CopyToBufferAsLittleEndian<double>(dfVal,pBuffer);
+    pBuffer+=sizeof(double);
+    return true;
+}
+
+static bool GetCompactDouble(unsigned char * & pBuffer,unsigned char * pEnd,double & dfVal)
+{
+    if(pEnd-pBuffer<(int)sizeof(double))
+        return false;
+    dfVal = CopyFromBufferAsLittleEndian<double>(pBuffer);
+    pBuffer+=sizeof(double);
+    return true;
+}
+
+static bool PutLiteral(unsigned char * & pBuffer,unsigned char * pEnd,const std::string & sVal)
+{
+    if(!PutVarInt(pBuffer,pEnd,sVal.size()) || pEnd-pBuffer<(int)sVal.size())
+        return false;
+    memcpy(pBuffer,sVal.data(),sVal.size());
+    pBuffer+=sVal.size();
+    return true;
+}
+
+static bool GetLiteral(unsigned char * & pBuffer,unsigned char * pEnd,std::string & sVal)
+{
+    unsigned int nSize;
+    if(!GetVarInt(pBuffer,pEnd,nSize) || pEnd-pBuffer<(int)nSize)
+        return false;
+    sVal.assign((const char *)pBuffer,nSize);
+    pBuffer+=nSize;
+    return true;
+}
+
+static bool PutInterned(unsigned char * & pBuffer,unsigned char * pEnd,const std::string & sVal,MOOS::PktDictionary & Dictionary)
+{
+    int nID = Dictionary.Find(sVal);
+    if(nID>=0)
+        return PutVarInt(pBuffer,pEnd,nID+2);
+
+    unsigned int nCode = Dictionary.Add(sVal) ? COMPACT_DEFINE : COMPACT_LITERAL;
+    return PutVarInt(pBuffer,pEnd,nCode) && PutLiteral(pBuffer,pEnd,sVal);
+}
+
+static bool GetInterned(unsigned char * & pBuffer,unsigned char * pEnd,std::string & sVal,MOOS::PktDictionary & Dictionary)
+{
+    unsigned int nCode;
+    if(!GetVarInt(pBuffer,pEnd,nCode))
+        return false;
+
+    if(nCode>COMPACT_DEFINE)
+        return Dictionary.Get(nCode-2,sVal);
+
+    if(!GetLiteral(pBuffer,pEnd,sVal))
+        return false;
+
+    return nCode==COMPACT_LITERAL || Dictionary.Add(sVal);
+}
+
+unsigned int CMOOSMsg::GetMaxSizeInBytesWhenCompact() const
+{
+    //three type bytes, a varint ID and each string's code and length
+    unsigned int nHeader = 3+5+5*(5+5);
+    unsigned int nString = m_sSrc.size()+
+            m_sSrcAux.size()+
+            m_sOriginatingCommunity.size()+
+            m_sKey.size()+
+            GetPayload().size();
+
+    unsigned int nDouble = 3*sizeof(double);
+
+    return nHeader+nString+nDouble;
+}
+
+int CMOOSMsg::SerializeCompact(unsigned char *pBuffer, int nLen, MOOS::PktDictionary & Dictionary, bool bToStream)
+{
+    unsigned char * pNext = pBuffer;
+    unsigned char * pEnd = pBuffer+nLen;
+
+    if(nLen<3)
+    {
+        MOOSTrace("exception : CMOOSMsg::SerializeCompact failed: Out Of Space\n ");
+        return -1;
+    }
+
+    if(bToStream)
+    {
+        const std::string & sVal = GetPayload();
+
+        unsigned char cFields = 0;
+        if(m_nID!=-1)
+            cFields|=COMPACT_HAS_ID;
+        if(m_dfVal!=-1)
+            cFields|=COMPACT_HAS_VAL;
+        if(m_dfVal2!=-1)
+            cFields|=COMPACT_HAS_VAL2;
+        if(!sVal.empty())
+            cFields|=COMPACT_HAS_STRING;
+
+        *pNext++ = m_cMsgType;
+        *pNext++ = m_cDataType;
+        *pNext++ = cFields;
+
+        //zig zag so small negative IDs stay small
+        unsigned int nID = ((unsigned int)m_nID<<1)^(unsigned int)(m_nID>>31);
+
+        bool bOK = (!(cFields & COMPACT_HAS_ID) || PutVarInt(pNext,pEnd,nID)) &&
+                PutInterned(pNext,pEnd,m_sSrc,Dictionary) &&
+                PutInterned(pNext,pEnd,m_sSrcAux,Dictionary) &&
+                PutInterned(pNext,pEnd,m_sOriginatingCommunity,Dictionary) &&
+                PutInterned(pNext,pEnd,m_sKey,Dictionary) &&
+                PutCompactDouble(pNext,pEnd,m_dfTime) &&
+                (!(cFields & COMPACT_HAS_VAL) || PutCompactDouble(pNext,pEnd,m_dfVal)) &&
+                (!(cFields & COMPACT_HAS_VAL2) || PutCompactDouble(pNext,pEnd,m_dfVal2)) &&
+                (!(cFields & COMPACT_HAS_STRING) || PutLiteral(pNext,pEnd,sVal));
+
+        if(!bOK)
+        {
+            MOOSTrace("exception : CMOOSMsg::SerializeCompact failed: Out Of Space\n ");
+            return -1;
+        }
+    }
+    else
+    {
+        //this is extracting from a stream....
+        ReleasePayload(m_pShared);
+        m_pShared = NULL;
+
+        m_cMsgType = *pNext++;
+        m_cDataType = *pNext++;
+        unsigned char cFields = *pNext++;
+
+        m_nID = -1;
+        m_dfVal = -1;
+        m_dfVal2 = -1;
+        m_sVal.clear();
+
+        unsigned int nID = 0;
+        bool bOK = (!(cFields & COMPACT_HAS_ID) || GetVarInt(pNext,pEnd,nID)) &&
+                GetInterned(pNext,pEnd,m_sSrc,Dictionary) &&
+                GetInterned(pNext,pEnd,m_sSrcAux,Dictionary) &&
+                GetInterned(pNext,pEnd,m_sOriginatingCommunity,Dictionary) &&
+                GetInterned(pNext,pEnd,m_sKey,Dictionary) &&
+                GetCompactDouble(pNext,pEnd,m_dfTime) &&
+                (!(cFields & COMPACT_HAS_VAL) || GetCompactDouble(pNext,pEnd,m_dfVal)) &&
+                (!(cFields & COMPACT_HAS_VAL2) || GetCompactDouble(pNext,pEnd,m_dfVal2)) &&
+                (!(cFields & COMPACT_HAS_STRING) || GetLiteral(pNext,pEnd,m_sVal));
+
+        if(!bOK)
+        {
+            MOOSTrace("exception : CMOOSMsg::SerializeCompact failed: truncated or unknown message\n ");
+            return -1;
+        }
+
+        if(cFields & COMPACT_HAS_ID)
+            m_nID = (int)(nID>>1)^-(int)(nID & 1);
+    }
+
+    m_nLength = pNext-pBuffer;
+    return m_nLength;
+}
+
 bool CMOOSMsg::IsType(char cType) const
 {
     return m_cMsgType==cType;
@@ -520,10 +900,10 @@ void CMOOSMsg::Trace()
         MOOSTrace("Data=%f ",m_dfVal);
         break;
     case MOOS_STRING:
-        MOOSTrace("Data=%s ",m_sVal.c_str());
+        MOOSTrace("Data=%s ",GetPayload().c_str());
         break;
 	case MOOS_BINARY_STRING:
-			MOOSTrace("Data=%.3f KB of binary	data ",m_sVal.size()/1000.0);
+			MOOSTrace("Data=%.3f KB of binary	data ",GetPayload().size()/1000.0);
 			break;
 			
     }
@@ -587,11 +967,11 @@ string CMOOSMsg::GetAsString(int nFieldWidth/*=12*/, int nNumDP/*=5*/)
         }
 		else if(IsDataType(MOOS_BINARY_STRING))
 		{
-			os<<"BINARY DATA ["<<m_sVal.size()/1000.0<<" kB]";//<<ends;
+			os<<"BINARY DATA ["<<GetPayload().size()/1000.0<<" kB]";//<<ends;
 		}
         else 
         {
-            os<<m_sVal;//.c_str()<<ends;
+            os<<GetPayload();//.c_str()<<ends;
         }
     }
     else
@@ -607,7 +987,7 @@ unsigned int CMOOSMsg::GetBinaryDataSize()
 	if(!IsBinary())
 		return 0;
 	else
-		return m_sVal.size();
+		return GetPayload().size();
 }
 
 bool CMOOSMsg::GetBinaryData(std::vector<unsigned char > &v)
@@ -619,7 +999,8 @@ bool CMOOSMsg::GetBinaryData(std::vector<unsigned char > &v)
 	{
 	    v.resize(GetBinaryDataSize());
 	}
-	std::copy(m_sVal.begin(),m_sVal.end(),v.begin());
+	const std::string & sVal = GetPayload();
+	std::copy(sVal.begin(),sVal.end(),v.begin());
 	return true;
 }
 
@@ -635,8 +1016,10 @@ unsigned char * CMOOSMsg::GetBinaryData()
 {
 	if(!IsBinary())
 		return NULL;
-	else
-		return (unsigned char*)(&m_sVal[0]);
+
+	//the caller may write through this so it needs its own copy
+	Unshare();
+	return (unsigned char*)(&m_sVal[0]);
 }
 
 
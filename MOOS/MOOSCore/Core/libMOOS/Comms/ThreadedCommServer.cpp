@@ -41,6 +41,7 @@
 #include "MOOS/libMOOS/Utils/ConsoleColours.h"
 #include "MOOS/libMOOS/Utils/ThreadPrint.h"
 #include "MOOS/libMOOS/Utils/ThreadPriority.h"
+#include "MOOS/libMOOS/Utils/MOOSScopedLock.h"
 #include <iomanip>
 #include <iterator>
 #include <algorithm>
@@ -75,7 +76,42 @@ ThreadedCommServer::~ThreadedCommServer()
     // TODO Auto-generated destructor stub
     Stop();
 
+    for(unsigned int i = 0;i<m_DispatchThreads.size();i++)
+        delete m_DispatchThreads[i];
 }
+
+bool ThreadedCommServer::SetDispatchThreads(unsigned int nThreads)
+{
+    if(m_ServerThread.IsThreadRunning())
+        return MOOSFail("ThreadedCommServer::SetDispatchThreads() must be called before Run()");
+
+    if(nThreads==0)
+        nThreads = 1;
+
+    //the main server thread is always the first dispatcher
+    while(m_DispatchThreads.size()+1<nThreads)
+        m_DispatchThreads.push_back(new DispatchThread(this));
+
+    return true;
+}
+
+ThreadedCommServer::SHARED_PKT_QUEUE & ThreadedCommServer::GetIncomingList(const std::string & sClient)
+{
+    if(m_DispatchThreads.empty())
+        return m_SharedDataListFromClient;
+
+    //pin clients to dispatchers by name
+    unsigned int nHash = 5381;
+    for(std::string::const_iterator q = sClient.begin();q!=sClient.end();q++)
+        nHash = nHash*33+(unsigned char)(*q);
+
+    unsigned int n = nHash%(m_DispatchThreads.size()+1);
+    if(n==0)
+        return m_SharedDataListFromClient;
+
+    return m_DispatchThreads[n-1]->_Incoming;
+}
+
 bool ThreadedCommServer::Stop()
 {
 
@@ -92,11 +128,24 @@ bool ThreadedCommServer::Stop()
    }
 
 
+   //client threads (and any IO threads feeding them) may be blocked pushing
+   //onto a full work queue - release them before their consumers go away
+   m_SharedDataListFromClient.Close();
+   for(unsigned int i = 0;i<m_DispatchThreads.size();i++)
+       m_DispatchThreads[i]->_Incoming.Close();
+
    //then pull the plug on the loop which will spot clients disconnecting
    if(m_ServerThread.IsThreadRunning())
        m_ServerThread.Stop();
 
+   for(unsigned int i = 0;i<m_DispatchThreads.size();i++)
+   {
+       if(m_DispatchThreads[i]->_Thread.IsThreadRunning())
+           m_DispatchThreads[i]->_Thread.Stop();
+   }
+
    //now shut down each of the client threads in turn
+    MOOS::ScopedLock L(m_ClientThreadsLock);
     std::map<std::string,ClientThread*>::iterator q;
     for(q=m_ClientThreads.begin();q!=m_ClientThreads.end();q++)
     {
@@ -141,6 +190,7 @@ bool ThreadedCommServer::OnNewClient(XPCTcpSocket * pNewClient,char * sName)
  */
 bool ThreadedCommServer::AddAndStartClientThread(XPCTcpSocket & NewClientSocket,const std::string & sName)
 {
+    MOOS::ScopedLock L(m_ClientThreadsLock);
 
     std::map<std::string,ClientThread*>::iterator q = m_ClientThreads.find(sName);
 
@@ -184,13 +234,11 @@ bool ThreadedCommServer::AddAndStartClientThread(XPCTcpSocket & NewClientSocket,
     }
 
 
-    ClientThread* pNewClientThread =  new  ClientThread(sName,
+    ClientThread* pNewClientThread =  NewClientThread(sName,
     		NewClientSocket,
-    		m_SharedDataListFromClient,
+    		GetIncomingList(sName),
     		bAsync,
-    		dfConsolidationTime,
-    		m_dfClientTimeout,
-    		m_bBoostIOThreads);
+    		dfConsolidationTime);
 
     //add to map
     m_ClientThreads[sName] = pNewClientThread;
@@ -201,6 +249,21 @@ bool ThreadedCommServer::AddAndStartClientThread(XPCTcpSocket & NewClientSocket,
 
 }
 
+ThreadedCommServer::ClientThread * ThreadedCommServer::NewClientThread(const std::string & sName,
+        XPCTcpSocket & ClientSocket,
+        SHARED_PKT_QUEUE & SharedDataIncoming,
+        bool bAsync,
+        double dfConsolidationPeriodMS)
+{
+    return new ClientThread(sName,
+            ClientSocket,
+            SharedDataIncoming,
+            bAsync,
+            dfConsolidationPeriodMS,
+            m_dfClientTimeout,
+            m_bBoostIOThreads);
+}
+
 /**
  * This is the main loop - it looks for complete Pkt being placed in the incoming list
  * and invokes a handler
@@ -214,24 +277,47 @@ bool ThreadedCommServer::ServerLoop()
 	m_Auditor.SetQuiet(m_bQuiet);
     m_Auditor.Run("localhost",m_nAuditPort);
 
+    //Stop() closes the work queues - open them again in case we are restarting
+    m_SharedDataListFromClient.Open();
+    for(unsigned int i = 0;i<m_DispatchThreads.size();i++)
+        m_DispatchThreads[i]->_Incoming.Open();
+
+    //start any additional dispatchers - this thread serves as the first
+    for(unsigned int i = 0;i<m_DispatchThreads.size();i++)
+    {
+        if(!m_DispatchThreads[i]->_Thread.Start())
+            return MOOSFail("ThreadedCommServer::ServerLoop() failed to start dispatch thread");
+    }
+
+    return DispatchLoop(m_SharedDataListFromClient,m_ServerThread);
+}
+
+/**
+ * pull complete Pkts off a work list and invoke a handler. Run by the main
+ * server thread and by each additional dispatch thread
+ * @return true on exit
+ */
+bool ThreadedCommServer::DispatchLoop(SHARED_PKT_QUEUE & Incoming, CMOOSThread & Thread)
+{
     if(m_bBoostIOThreads)
     {
     	MOOS::BoostThisThread();
     }
 
 	//eternally look at our incoming work list....
-	while(!m_ServerThread.IsQuitRequested())
+	while(!Thread.IsQuitRequested())
     {
         ClientThreadSharedData SDFromClient;
 
        
-        if(m_SharedDataListFromClient.IsEmpty())
+        if(Incoming.IsEmpty())
         {
-            if(!m_SharedDataListFromClient.WaitForPush(1000))
+            if(!Incoming.WaitForPush(1000))
                 continue;
         }
 
-        m_SharedDataListFromClient.Pull(SDFromClient);
+        if(!Incoming.Pull(SDFromClient))
+            continue;
 
         switch(SDFromClient._Status)
         {
@@ -280,13 +366,18 @@ bool ThreadedCommServer::ProcessClient(ClientThreadSharedData &SDFromClient,MOOS
             std::string sWho = SDFromClient._sClientName;
 
             //first find the client object
-			std::map<std::string,ClientThread*>::iterator q = m_ClientThreads.find(sWho);
-			if(q == m_ClientThreads.end())
+			ClientThread* pClient = NULL;
+			std::map<std::string,ClientThread*>::iterator q;
 			{
-			   return MOOSFail("logical error - FIX ME!");
-			}
+				MOOS::ScopedLock L(m_ClientThreadsLock);
+				q = m_ClientThreads.find(sWho);
+				if(q == m_ClientThreads.end())
+				{
+				   return MOOSFail("logical error - FIX ME!");
+				}
 
-			ClientThread* pClient = q->second;
+				pClient = q->second;
+			}
 
             if(m_bQuiet)
                 InhibitMOOSTraceInThisThread(false);
@@ -374,22 +465,18 @@ bool ThreadedCommServer::ProcessClient(ClientThreadSharedData &SDFromClient,MOOS
             }
 
             //send packet back to client...
-            ClientThreadSharedData SDDownStream(sWho,ClientThreadSharedData::PKT_WRITE);
-
             if(!MsgLstTx.empty())
             {
             	unsigned int nMessages = MsgLstTx.size();
-				//stuff reply message into a packet
-				SDDownStream._pPkt->Serialize(MsgLstTx,true);
+
+				//stuff reply message into a packet and add it to the work load
+				unsigned int nBytes = pClient->PackAndSendToClient(MsgLstTx);
 
 				Auditor.AddStatistic(sWho,
-									SDDownStream._pPkt->GetStreamLength(),
+									nBytes,
 									nMessages,
 									MOOS::Time(),
 									false);
-
-				//add it to the work load
-				pClient->SendToClient(SDDownStream);
             }
 
             //was there ever a notification? If not just continue
@@ -398,45 +485,34 @@ bool ThreadedCommServer::ProcessClient(ClientThreadSharedData &SDFromClient,MOOS
 
             //and here if we have any new fancy asynchronous clients
             //w can send them mail as well...
-            for(q=m_ClientThreads.begin();q!=m_ClientThreads.end();q++)
-            {
-            	ClientThread* pClient = q->second;
-            	if(m_pfnFetchAllMailCallBack!=NULL && pClient->IsAsynchronous())
-            	{
-            		//OK this client can handle unsolicited pushes of data
-            		MsgLstTx.clear();
-            		if((*m_pfnFetchAllMailCallBack)(q->first,MsgLstTx,m_pFetchAllMailCallBackParam))
-                    {
-                    	//any pending mail?
-                    	if(MsgLstTx.size()==0)
-                    		continue;
-
-                    	//gPrinter.Print("sending message to "+q->first);
+            if(m_pfnFetchAllMailCallBack==NULL)
+                return true;
 
-        				//std::cerr<<"*pushing*  "<<MsgLstTx.size()<<" messages for "<<sWho<<"\n";
+            MOOS::ScopedLock L(m_ClientThreadsLock);
 
+            if(m_pfnCollectPendingMailCallBack!=NULL)
+            {
+                //only visit the clients who have been sent something. Any
+                //number of notifications (from any dispatcher) to the same
+                //client since it was last visited are sent as one packet
+                std::vector<std::string> Pending;
+                (*m_pfnCollectPendingMailCallBack)(Pending,m_pCollectPendingMailCallBackParam);
 
-                    	ClientThreadSharedData SDAdditionalDownStream(sWho,
-                    			ClientThreadSharedData::PKT_WRITE);
-
-                    	//stuff all notifications into a packet
-                    	unsigned int nMessages = MsgLstTx.size();
-                    	SDAdditionalDownStream._pPkt->Serialize(MsgLstTx,true);
-
-
-                        Auditor.AddStatistic(q->first,
-                        		SDAdditionalDownStream._pPkt->GetStreamLength(),
-                        		nMessages,
-                        		MOOS::Time(),
-                        		false);
-
-                        //add it to the work load of this client
-                        pClient->SendToClient(SDAdditionalDownStream);
-
-                    }
-            	}
+                for(unsigned int i = 0;i<Pending.size();i++)
+                {
+                    q = m_ClientThreads.find(Pending[i]);
+                    if(q!=m_ClientThreads.end() && q->second->IsAsynchronous())
+                        PushMail(q->first,q->second,Auditor);
+                }
+            }
+            else
+            {
+                for(q=m_ClientThreads.begin();q!=m_ClientThreads.end();q++)
+                {
+                    if(q->second->IsAsynchronous())
+                        PushMail(q->first,q->second,Auditor);
+                }
             }
-
 
         }
     }
@@ -450,6 +526,35 @@ bool ThreadedCommServer::ProcessClient(ClientThreadSharedData &SDFromClient,MOOS
 
 }
 
+/**
+ * send whatever mail is waiting for an asynchronous client
+ * @return true if anything was sent
+ */
+bool ThreadedCommServer::PushMail(const std::string & sWho, ClientThread * pClient, MOOS::ServerAudit & Auditor)
+{
+    //OK this client can handle unsolicited pushes of data
+    MOOSMSG_LIST MsgLstTx;
+    if(!(*m_pfnFetchAllMailCallBack)(sWho,MsgLstTx,m_pFetchAllMailCallBackParam))
+        return false;
+
+    //any pending mail?
+    if(MsgLstTx.empty())
+        return false;
+
+    //stuff all notifications into a packet and add it to
+    //the work load of this client
+    unsigned int nMessages = MsgLstTx.size();
+    unsigned int nBytes = pClient->PackAndSendToClient(MsgLstTx);
+
+    Auditor.AddStatistic(sWho,
+            nBytes,
+            nMessages,
+            MOOS::Time(),
+            false);
+
+    return true;
+}
+
 bool ThreadedCommServer::ProcessClient()
 {
 	return BASE::ProcessClient();
@@ -465,10 +570,12 @@ bool ThreadedCommServer::OnClientDisconnect(ClientThreadSharedData &SD)
 
 
     //we need to get the socket this thread is working on
+    m_ClientThreadsLock.Lock();
     std::map<std::string,ClientThread*>::iterator q = m_ClientThreads.find(SD._sClientName);
 
     //we need to point the base class focus socket at this
     m_pFocusSocket = &(q->second->GetSocket());
+    m_ClientThreadsLock.UnLock();
 
     //now we can stop and clean up the thread
     StopAndCleanUpClientThread(SD._sClientName);
@@ -502,6 +609,8 @@ bool ThreadedCommServer::StopAndCleanUpClientThread(std::string sName)
 
 
 
+    MOOS::ScopedLock L(m_ClientThreadsLock);
+
 	//use this name to get the thread which is doing our work
     std::map<std::string,ClientThread*>::iterator q = m_ClientThreads.find(sName);
 
@@ -537,13 +646,26 @@ bool ThreadedCommServer::TimerLoop()
 
 
 
+ThreadedCommServer::DispatchThread::DispatchThread(ThreadedCommServer * pServer):
+    _pServer(pServer)
+{
+    _Thread.Initialise(RunEntry,this);
+    _Thread.Name("ThreadedCommServer::DispatchThread");
+}
+
+bool ThreadedCommServer::DispatchThread::Run()
+{
+    return _pServer->DispatchLoop(_Incoming,_Thread);
+}
+
+
 ThreadedCommServer::ClientThread::~ClientThread()
 {
 	Kill();
 }
 
 
-ThreadedCommServer::ClientThread::ClientThread(const std::string & sName, XPCTcpSocket & ClientSocket,SHARED_PKT_LIST & SharedDataIncoming, bool bAsync, double dfConsolidationPeriodMS,double dfClientTimeout, bool bBoost ):
+ThreadedCommServer::ClientThread::ClientThread(const std::string & sName, XPCTcpSocket & ClientSocket,SHARED_PKT_QUEUE & SharedDataIncoming, bool bAsync, double dfConsolidationPeriodMS,double dfClientTimeout, bool bBoost ):
             _sClientName(sName),
             _ClientSocket(ClientSocket),
             _SharedDataIncoming(SharedDataIncoming),
@@ -732,6 +854,17 @@ bool ThreadedCommServer::ClientThread::SendToClient(ClientThreadSharedData & Out
     return true;
 }
 
+unsigned int ThreadedCommServer::ClientThread::PackAndSendToClient(MOOSMSG_LIST & Msgs)
+{
+    ClientThreadSharedData SDDownStream(_sClientName,ClientThreadSharedData::PKT_WRITE);
+
+    SDDownStream._pPkt->Serialize(Msgs,true);
+
+    SendToClient(SDDownStream);
+
+    return SDDownStream._pPkt->GetStreamLength();
+}
+
 bool ThreadedCommServer::ClientThread::AsynchronousWriteLoop()
 {
 
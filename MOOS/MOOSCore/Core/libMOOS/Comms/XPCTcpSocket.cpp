@@ -36,6 +36,7 @@
 #pragma warning(disable:4127) // conditional expression is constant
 #else
 #include <sys/time.h>
+#include <poll.h>
 #endif
 
 #include <string>
@@ -259,6 +260,38 @@ void XPCTcpSocket::vBindSocket()
 int XPCTcpSocket::iReadMessageWithTimeOut(void *_vMessage, int _iMessageSize, double dfTimeOut,int _iOption)
 {
     int iNumBytes = 0;
+
+#ifndef _WIN32
+    //poll rather than select - select cannot watch descriptors beyond
+    //FD_SETSIZE and a DB serving hundreds of clients soon has them
+    if(dfTimeOut<1)
+    {
+        dfTimeOut=1.0;
+    }
+
+    struct pollfd PollFd;
+    PollFd.fd = iGetSocketFd();
+    PollFd.events = POLLIN;
+    PollFd.revents = 0;
+
+    switch(poll(&PollFd,1,1000*(int)dfTimeOut))
+    {
+    case -1:
+        iNumBytes=-1;
+        break;
+
+    case 0:
+        //timeout...nothing to read
+        iNumBytes = 0;
+        break;
+
+    default:
+        //something to do read (or a hang up which the read will report)
+        return iRecieveMessage(_vMessage,_iMessageSize,_iOption);
+    }
+
+    return iNumBytes;
+#else
     
     struct timeval timeout;        // The timeout value for the select system call
     fd_set fdset;                // Set of "watched" file descriptors
@@ -322,6 +355,7 @@ int XPCTcpSocket::iReadMessageWithTimeOut(void *_vMessage, int _iMessageSize, do
     FD_ZERO(&fdset);
     
     return iNumBytes;
+#endif
 }
 
 void XPCTcpSocket::vSetNoDelay(int _iToggle)
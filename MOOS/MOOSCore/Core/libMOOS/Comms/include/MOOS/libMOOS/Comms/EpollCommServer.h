@@ -0,0 +1,178 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Lesser Public License v2.1
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/lgpl.txt
+//
+//   This program is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+/*
+ * EpollCommServer.h
+ *
+ * a ThreadedCommServer which does the socket IO for all of its clients on a
+ * small pool of threads using epoll (linux only) rather than on a thread
+ * (or two) per client.
+ */
+
+#ifndef EPOLLCOMMSERVER_H_
+#define EPOLLCOMMSERVER_H_
+
+#include "MOOS/libMOOS/Comms/ThreadedCommServer.h"
+#include <set>
+
+namespace MOOS
+{
+
+class EpollCommServer : public ThreadedCommServer
+{
+public:
+    EpollCommServer();
+    virtual ~EpollCommServer();
+
+    /**
+     * how many threads should do the socket IO for all the clients. Clients
+     * are shared between them as they connect. Must be called before Run()
+     * @param nThreads number of IO threads (default 2)
+     * @return true on success
+     */
+    bool SetIOThreads(unsigned int nThreads);
+
+    virtual bool Stop();
+
+private:
+    typedef ThreadedCommServer BASE;
+
+protected:
+
+    class IOThread;
+
+    /**
+     * stands in for a ClientThread but owns no threads. An IOThread reads
+     * from its socket as data arrives and reassembles packets from however
+     * many bytes turn up. Replies are written straight away without
+     * blocking and whatever the socket won't take is left for the IOThread
+     * to finish when the socket is writable again.
+     */
+    class EpollClient : public ClientThread
+    {
+    public:
+        EpollClient(const std::string & sName,
+                XPCTcpSocket & ClientSocket,
+                SHARED_PKT_QUEUE & SharedDataIncoming,
+                bool bAsync,
+                double dfConsolidationPeriodMS,
+                double dfClientTimeout,
+                IOThread * pIO);
+
+        virtual ~EpollClient();
+
+        /** hand the socket to our IOThread */
+        virtual bool Start();
+
+        /** take the socket away from our IOThread. Once this returns
+         * the IOThread will not touch this object again */
+        virtual bool Kill();
+
+        /** write a packet or queue what the socket won't take */
+        virtual bool SendToClient(ClientThreadSharedData & OutGoing);
+
+        /** called by the IOThread when there is data to read
+         * @return false if the client has gone */
+        bool OnReadable();
+
+        /** called by the IOThread when the socket will take more data
+         * @return false if the client has gone */
+        bool OnWritable();
+
+        /** stop watching the socket and tell the server the client has gone */
+        void Close();
+
+        bool IsClosed(){return _bClosed;};
+
+        double GetLastReadTime(){return _dfLastRead;};
+
+        double GetClientTimeout(){return _dfClientTimeout;};
+
+        const std::string & GetName(){return _sClientName;};
+
+    protected:
+        bool WatchWrites(bool bWatch);
+
+        IOThread * _pIO;
+
+        //the packet being reassembled
+        ClientThreadSharedData _Rx;
+
+        //bytes the socket would not take yet
+        std::vector<unsigned char> _TxBacklog;
+        unsigned int _nTxSent;
+
+        //guards the backlog and _bClosed
+        CMOOSLock _OutLock;
+
+        double _dfLastRead;
+        bool _bClosed;
+    };
+
+    /**
+     * one of a small pool of threads each of which waits on an epoll set
+     * for its share of the clients' sockets
+     */
+    class IOThread
+    {
+    public:
+        IOThread(bool bBoost);
+        ~IOThread();
+
+        static bool RunEntry(void * pParam) {  return  ( (IOThread*)pParam) -> Run();}
+        bool Run();
+
+        bool Add(EpollClient * pClient);
+        bool Remove(EpollClient * pClient);
+
+        /** queue something for a dispatcher. Called with _Lock held so the
+         * data is only pushed once _Lock is released - a full queue must
+         * not stop a dispatcher from killing a client */
+        void Ready(SHARED_PKT_QUEUE & Queue, const ClientThreadSharedData & SD);
+
+        unsigned int GetClientCount();
+
+        CMOOSThread _Thread;
+        int _nEpoll;
+        bool _bBoost;
+
+        //held while events are handled so clients can be removed safely
+        CMOOSLock _Lock;
+        std::set<EpollClient*> _Clients;
+        std::vector<std::pair<SHARED_PKT_QUEUE*,ClientThreadSharedData> > _Ready;
+    };
+
+    virtual ClientThread * NewClientThread(const std::string & sName,
+            XPCTcpSocket & ClientSocket,
+            SHARED_PKT_QUEUE & SharedDataIncoming,
+            bool bAsync,
+            double dfConsolidationPeriodMS);
+
+    virtual bool ServerLoop();
+
+    std::vector<IOThread*> m_IOThreads;
+};
+
+}
+
+#endif /* EPOLLCOMMSERVER_H_ */
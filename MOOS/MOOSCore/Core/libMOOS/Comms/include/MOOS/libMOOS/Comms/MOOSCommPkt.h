@@ -32,6 +32,10 @@
 
 #include "MOOS/libMOOS/Comms/CommsTypes.h"
 
+#include <map>
+#include <string>
+#include <vector>
+
 ///////////////////////////////////////////////////////////////////////////////////
 //Here we define the current protocol string for this version of the library
 //if and when the wire protocol changes change the MOOS_PROTOCOL_STRING name
@@ -41,6 +45,55 @@
 #define MOOS_PROTOCOL_STRING "ELKS CAN'T DANCE 2/8/10"
 #define MOOS_PKT_DEFAULT_SPACE 32768
 
+//bits of the flags byte that follows the header of every packet. Old
+//libraries always write 0 and ignore it when reading so neither may be set
+//unless the other end is known to read the compact wire format
+#define MOOS_PKT_COMPRESSED 0x01
+#define MOOS_PKT_COMPACT 0x02
+
+//compact wire format packets bigger than this are compressed (if zlib is available)
+#define MOOS_PKT_COMPRESS_ABOVE 1024
+
+//deflate can not shrink data by more than about 1032:1 so a compressed body
+//claiming to unpack to more than this many times its size is bogus
+#define MOOS_PKT_MAX_INFLATION 1032
+
+//how many strings, and how long, a compact wire format connection will intern
+#define MOOS_PKT_DICTIONARY_SIZE 4096
+#define MOOS_PKT_DICTIONARY_MAX_STRING 128
+
+namespace MOOS
+{
+
+/** The strings (keys, sources, community names) which have crossed one
+direction of a connection speaking the compact wire format, and the small
+integer each was given. The sender and the receiver each keep one and, because
+they see the same strings in the same order, build identical tables. */
+class PktDictionary
+{
+public:
+    PktDictionary(unsigned int nMaxEntries = MOOS_PKT_DICTIONARY_SIZE);
+
+    /** the id of sStr or -1 if it has not been seen (sending side)*/
+    int Find(const std::string & sStr) const;
+
+    /** the string with id nID (receiving side) */
+    bool Get(unsigned int nID, std::string & sStr) const;
+
+    /** give sStr the next id. Returns false if it is too long or the
+    dictionary is full - in which case it is sent in full every time */
+    bool Add(const std::string & sStr);
+
+    unsigned int Size() const;
+
+protected:
+    unsigned int m_nMaxEntries;
+    std::map<std::string,unsigned int> m_IDs;
+    std::vector<std::string> m_Strings;
+};
+
+}
+
 
 /** This class is part of MOOS's internal transport mechanism. It any number of CMOOSMsg's
 can be packed into a CMOOSCommPkt and sent in one lump between a CMOOSCommServer and CMOOSCommClient
@@ -56,6 +109,21 @@ public:
      */
     bool    Serialize(MOOSMSG_LIST & List, bool bToStream = true, bool bNoNULL =false,double * pdfPktTime=NULL);
 
+    /**
+     * serialise to or from a list of CMOOSMsgs using the compact wire format.
+     * Only for a peer known to read it - no client or server negotiates it
+     * yet. Strings are interned in Dictionary (keep one per direction for
+     * the life of the connection) and packets bigger than nCompressAbove
+     * bytes are compressed (0 means never). Any packet can be read this
+     * way - its flags say how it was written.
+     */
+    bool    Serialize(MOOSMSG_LIST & List, MOOS::PktDictionary & Dictionary, bool bToStream = true, unsigned int nCompressAbove = MOOS_PKT_COMPRESS_ABOVE, bool bNoNULL =false,double * pdfPktTime=NULL);
+
+    /**
+     * true if this library was built with zlib and so can compress packets
+     */
+    static bool SupportsCompression();
+
     /**
      * return length of serialised stream
      */
@@ -75,6 +143,13 @@ public:
 
 protected:
     bool InflateTo(unsigned int nNewStreamSize);
+
+    bool Encode(MOOSMSG_LIST & List, MOOS::PktDictionary * pDictionary, unsigned int nCompressAbove);
+    bool Decode(MOOSMSG_LIST & List, MOOS::PktDictionary * pDictionary, bool bNoNULL, double * pdfPktTime);
+
+    bool Compress(unsigned int nHeaderSize);
+    bool Decompress(unsigned char * pData, int nData);
+
     int m_nByteCount;
     int m_nMsgLen;
 
@@ -92,6 +167,9 @@ protected:
 	//how many messages are serialsied
 	unsigned int m_nMsgsSerialised;
 
+	//somewhere to (de)compress into
+	std::vector<unsigned char > m_Scratch;
+
 };
 
 #endif
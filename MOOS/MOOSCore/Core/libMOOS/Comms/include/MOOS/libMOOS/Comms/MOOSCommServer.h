@@ -55,6 +55,7 @@ class XPCTcpSocket;
 #include <list>
 #include <map>
 #include <set>
+#include <vector>
 
 /** This class is the MOOS Comms Server. It lies at the heart of the communications
 architecture and typically is of no interest to the component developer. It maintains a list of all
@@ -105,6 +106,15 @@ public:
 	*/
     void SetOnFetchAllMailCallBack(bool (*pfn)(const std::string  & sClient,MOOSMSG_LIST & MsgListTx,void * pParam),void * pParam);
 
+    /**
+	* Set up the callback which names the clients who have had mail
+	* put in their box since it was last called. When set only these
+	* clients are sent mail after a notification rather than all of them
+	* @param pfn
+	* @param pParam
+	*/
+    void SetOnCollectPendingMailCallBack(bool (*pfn)(std::vector<std::string> & Clients,void * pParam),void * pParam);
+
     /** This function is the listen loop called from one of the two server threads. It is responsible
     for accepting a coonection and creating a new client socket.    */
     virtual bool ListenLoop();
@@ -248,6 +258,14 @@ protected:
 	@see SetOnFetchAllMailCallBack */
     void * m_pFetchAllMailCallBackParam;
 
+    /** user supplied callback naming clients with new mail
+	@see SetOnCollectPendingMailCallBack */
+	bool (*m_pfnCollectPendingMailCallBack)(std::vector<std::string> & Clients,void * pCaller);
+
+	/** place holder for the address of the object passed back to the user during a CollectPendingMail callback
+	@see SetOnCollectPendingMailCallBack */
+    void * m_pCollectPendingMailCallBackParam;
+
 
 
     /** Listen socket (bound to port address supplied in constructor) */
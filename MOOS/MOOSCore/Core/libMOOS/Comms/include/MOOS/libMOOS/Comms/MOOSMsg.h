@@ -35,6 +35,11 @@
 #include <string>
 #include <vector>
 
+namespace MOOS
+{
+    class MsgPayload;
+    class PktDictionary;
+}
 
 //MESSAGE TYPES
 #define MOOS_NOTIFY 'N'
@@ -86,6 +91,31 @@ public:
     /** specialised construction for binary data*/
     CMOOSMsg(char cMsgType,const std::string &sKey,  unsigned int nDataSize,const void* Data,double dfTime=-1);
 
+    /** copy construction and assignment - copies of a shared message
+    refer to the same payload (see Share())*/
+    CMOOSMsg(const CMOOSMsg & M);
+    CMOOSMsg & operator =(const CMOOSMsg & M);
+
+#if __cplusplus >= 201103L
+    CMOOSMsg(CMOOSMsg && M);
+    CMOOSMsg & operator =(CMOOSMsg && M);
+#endif
+
+    /** Freeze this message so that all subsequent copies of it share one
+    reference counted copy of its string payload and of its serialised form,
+    rather than each owning (and later serialising) their own. This is what
+    the MOOSDB does before handing a notification to many subscribers. A
+    shared message is immutable - its payload is only available through
+    GetString() and friends (m_sVal is left empty) and any change to its
+    public members must be preceded by a call to Unshare()*/
+    void Share();
+
+    /** give this message back its own private copy of the payload */
+    void Unshare();
+
+    /** is this message sharing its payload with other copies of it?*/
+    bool IsShared() const {return m_pShared!=NULL;}
+
     /** equality operator */
     bool operator ==(const CMOOSMsg & M) const;
 	
@@ -142,7 +172,7 @@ public:
     double GetDoubleAux()const {return m_dfVal2;};
 
     /**return string value of message*/
-    std::string GetString()const {return m_sVal;};
+    std::string GetString()const {return GetPayload();};
 
     /**return the name of the message*/
     std::string GetKey()const {return m_sKey;};
@@ -152,10 +182,10 @@ public:
     /**return the name of the process (as registered with the DB) which
     posted this notification*/
     std::string GetSource()const {return m_sSrc;};
-    void SetSource(const std::string & sSrc) { m_sSrc=sSrc;};
+    void SetSource(const std::string & sSrc) { Unshare(); m_sSrc=sSrc;};
 
     std::string GetSourceAux()const {return m_sSrcAux;};
-	void SetSourceAux(const std::string & sSrcAux){m_sSrcAux = sSrcAux;}
+	void SetSourceAux(const std::string & sSrcAux){Unshare(); m_sSrcAux = sSrcAux;}
 
     /**return the name of the MOOS community in which the orginator lives*/
     std::string GetCommunity()const {return m_sOriginatingCommunity;};
@@ -167,8 +197,8 @@ public:
     void Trace();
 
     /** set the Double value */
-    void SetDouble(double dfD){m_dfVal = dfD;}
-    void SetDoubleAux(double dfD){m_dfVal2 = dfD;}
+    void SetDouble(double dfD){Unshare(); m_dfVal = dfD;}
+    void SetDoubleAux(double dfD){Unshare(); m_dfVal2 = dfD;}
 
     /**what type of message is this? Notification,Command,Register etc*/
     char m_cMsgType;
@@ -212,6 +242,13 @@ public:
     //return size of Msg in bytes when serialised
     unsigned int GetSizeInBytesWhenSerialised() const;
 
+    //serialise this message into/outof a character buffer using the compact
+    //wire format in which strings are interned in Dictionary
+    int SerializeCompact(unsigned char * pBuffer,int nLen,MOOS::PktDictionary & Dictionary,bool bToStream=true);
+
+    //return the most bytes SerializeCompact() could need for this message
+    unsigned int GetMaxSizeInBytesWhenCompact() const;
+
 
 
 private:
@@ -233,6 +270,12 @@ private:
 
     bool CanSerialiseN(int N);
 
+    //the string payload wherever it currently lives
+    const std::string & GetPayload() const;
+
+    //payload and serialised image shared between copies (NULL if not shared)
+    MOOS::MsgPayload * m_pShared;
+
 };
 
 #endif // !defined(AFX_MOOSMSG_H__B6540645_B7DA_420D_B212_96E9845BB39F__INCLUDED_)
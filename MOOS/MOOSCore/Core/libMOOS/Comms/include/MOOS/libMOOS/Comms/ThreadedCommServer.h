@@ -34,6 +34,8 @@
 
 #include "MOOS/libMOOS/Comms/MOOSCommServer.h"
 #include "MOOS/libMOOS/Utils/SafeList.h"
+#include "MOOS/libMOOS/Utils/RingQueue.h"
+#include "MOOS/libMOOS/Utils/MOOSLock.h"
 #include "MOOS/libMOOS/Thirdparty/PocoBits/SharedPtr.h"
 
 namespace MOOS
@@ -79,6 +81,16 @@ public:
     ThreadedCommServer();
     virtual ~ThreadedCommServer();
 
+    /**
+     * process client packets on nThreads threads rather than one. Each client
+     * is always handled by the same thread so its packets are processed in
+     * the order they arrive. If nThreads>1 the call backs supplied by the
+     * owner must be thread safe. Must be called before Run()
+     * @param nThreads number of dispatch threads (default 1)
+     * @return true on success
+     */
+    bool SetDispatchThreads(unsigned int nThreads);
+
 private:
     typedef CMOOSCommServer BASE;
 
@@ -86,6 +98,11 @@ private:
 protected:
     typedef SafeList<ClientThreadSharedData> SHARED_PKT_LIST;
 
+    //the work queues client threads feed the dispatchers through - these are
+    //busy and many threads push to them so they are lock free. A full queue
+    //makes the client threads wait (and so the clients) which is what we want
+    typedef RingQueue<ClientThreadSharedData> SHARED_PKT_QUEUE;
+
 
     /**
      * This is a class which handles the Reading and Writing of fully formed MOOSCommPkts
@@ -110,7 +127,7 @@ protected:
          */
         ClientThread(const std::string & sName,
         		XPCTcpSocket & ClientSocket,
-        		SHARED_PKT_LIST & SharedDataIncoming,
+        		SHARED_PKT_QUEUE & SharedDataIncoming,
         		bool bAsync,
         		double dfConsolidationPeriodMS,
         		double dfClientTimeout,
@@ -143,7 +160,15 @@ protected:
          * @param OutGoing an object which was orginally collected from _SharedDataIncoming
          * @return tru on success
          */
-        bool SendToClient(ClientThreadSharedData & OutGoing);
+        virtual bool SendToClient(ClientThreadSharedData & OutGoing);
+
+        /**
+         * pack messages into a packet and queue it for sending. May be
+         * called from any dispatch thread.
+         * @param Msgs messages to send
+         * @return size of the packet in bytes
+         */
+        unsigned int PackAndSendToClient(MOOSMSG_LIST & Msgs);
 
 
         bool HandleClientWrite();
@@ -157,9 +182,9 @@ protected:
 
         double GetConsolidationTime();
 
-        bool Kill();
+        virtual bool Kill();
 
-        bool Start();
+        virtual bool Start();
 
     protected:
 
@@ -178,7 +203,7 @@ protected:
         XPCTcpSocket & _ClientSocket;
 
         //note that this a reference to a list given to us (we don't own it) at construction
-        ThreadedCommServer::SHARED_PKT_LIST &  _SharedDataIncoming;
+        ThreadedCommServer::SHARED_PKT_QUEUE &  _SharedDataIncoming;
 
         //note that this one we own - its private to us
         ThreadedCommServer::SHARED_PKT_LIST _SharedDataOutgoing;
@@ -203,6 +228,29 @@ protected:
     };
 
 
+    /**
+     * an additional thread (beyond the main server thread) which handles the
+     * packets from its share of the clients
+     */
+    class DispatchThread
+    {
+    public:
+        DispatchThread(ThreadedCommServer * pServer);
+
+        static bool RunEntry(void * pParam) {  return  ( (DispatchThread*)pParam) -> Run();}
+        bool Run();
+
+        CMOOSThread _Thread;
+        SHARED_PKT_QUEUE _Incoming;
+        ThreadedCommServer * _pServer;
+    };
+
+    /** pull packets off a work list and process them until Thread is asked to quit */
+    bool DispatchLoop(SHARED_PKT_QUEUE & Incoming, CMOOSThread & Thread);
+
+    /** the work list onto which the packets of client sClient are placed */
+    SHARED_PKT_QUEUE & GetIncomingList(const std::string & sClient);
+
     /** Called when a new client connects. Performs handshaking and adds new socket to m_ClientSocketList
     @param pNewClient pointer to the new socket created in ListenLoop;
     @see ListenLoop*/
@@ -220,10 +268,21 @@ protected:
 
     virtual bool AddAndStartClientThread(XPCTcpSocket & NewClientSocket,const std::string & sName);
 
+    /** make the object which will look after a newly connected client. Servers
+     * which do their socket IO differently return their own kind of ClientThread */
+    virtual ClientThread * NewClientThread(const std::string & sName,
+            XPCTcpSocket & ClientSocket,
+            SHARED_PKT_QUEUE & SharedDataIncoming,
+            bool bAsync,
+            double dfConsolidationPeriodMS);
+
     virtual bool ProcessClient(ClientThreadSharedData &SD, MOOS::ServerAudit & Auditor);
 
     virtual bool ProcessClient();
 
+    /** send an asynchronous client whatever mail is waiting for it */
+    bool PushMail(const std::string & sWho, ClientThread * pClient, MOOS::ServerAudit & Auditor);
+
     bool StopAndCleanUpClientThread(std::string sName);
 
     virtual bool Stop();
@@ -231,10 +290,16 @@ protected:
     protected:
 
 		//all connected clients will push the received Pkts into this list....
-		SafeList<ClientThreadSharedData> m_SharedDataListFromClient;
+		SHARED_PKT_QUEUE m_SharedDataListFromClient;
 
 		std::map<std::string,ClientThread*> m_ClientThreads;
 
+		//guards m_ClientThreads which is used by all dispatch threads
+		CMOOSLock m_ClientThreadsLock;
+
+		//additional dispatch threads (the main server thread is the first)
+		std::vector<DispatchThread*> m_DispatchThreads;
+
 
 };
 
@@ -40,6 +40,10 @@
 #include "MOOS/libMOOS/MOOSVersion.h"
 #include "MOOS/libMOOS/GitVersion.h"
 #include "MOOS/libMOOS/DB/MOOSDBLogger.h"
+#include "MOOS/libMOOS/Utils/MOOSScopedLock.h"
+#ifdef MOOS_HAVE_EPOLL
+#include "MOOS/libMOOS/Comms/EpollCommServer.h"
+#endif
 
 
 
@@ -53,6 +57,9 @@
 #include <iterator>
 using namespace std;
 
+//notifications smaller than this are cheaper to copy than to share
+#define SHARED_PAYLOAD_MIN_BYTES 256
+
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
@@ -73,6 +80,15 @@ bool CMOOSDB::OnFetchAllMailCallBack(const std::string & sWho,MOOSMSG_LIST & Msg
     return pMe->OnFetchAllMail(sWho,MsgListTx);
 }
 
+bool CMOOSDB::OnCollectPendingMailCallBack(std::vector<std::string> & Clients, void * pParam)
+{
+    //cast to this
+    CMOOSDB* pMe = (CMOOSDB*)(pParam);
+
+    //call
+    return pMe->OnCollectPendingMail(Clients);
+}
+
 bool CMOOSDB::OnDisconnectCallBack(string & sClient, void * pParam)
 {
     CMOOSDB* pMe = (CMOOSDB*)(pParam);
@@ -100,6 +116,10 @@ CMOOSDB::CMOOSDB()
     
     m_bQuiet = false;
 
+    m_nDispatchThreads = 1;
+
+    m_bSharedPayloads = true;
+
     //make our own variable called DB_TIME
     {
         CMOOSDBVar NewVar("DB_TIME");
@@ -196,6 +216,9 @@ CMOOSDB::~CMOOSDB()
 {
     if(m_pCommServer.get()!=NULL)
         m_pCommServer->Stop();
+
+    for(unsigned int i = 0;i<m_Shards.size();i++)
+        delete m_Shards[i];
 }
 
 
@@ -227,6 +250,9 @@ void PrintHelpAndExit()
 	std::cout<<"-d    (--dns)                      run with dns lookup\n";
 	std::cout<<"-s    (--single_threaded)          run as a single thread (legacy mode)\n";
 	std::cout<<"-b    (--moos_boost)               boost priority of communications\n";
+	std::cout<<"--dispatch_threads=<positive_int>  process clients on this many threads\n";
+	std::cout<<"-e    (--epoll)                    do client socket IO with epoll on a few threads\n";
+	std::cout<<"--io_threads=<positive_int>        epoll IO threads (implies --epoll, default 2)\n";
 	std::cout<<"--moos_timeout=<positive_float>    specify client timeout\n";
 	std::cout<<"--response=<string-list>           specify tolerable client latencies in ms\n";
 	std::cout<<"--warning_latency=<positive_float>    specify latency above which warning is issued in ms\n";
@@ -366,6 +392,26 @@ bool CMOOSDB::Run(int argc,  char * argv[] )
     //are we being asked to be old skool and use a single thread?
     bool bSingleThreaded = P.GetFlag("-s","--single_threaded");
 
+    ///////////////////////////////////////////////////////////
+    //how many threads should process client traffic?
+    int nDispatchThreads = m_nDispatchThreads;
+    m_MissionReader.GetValue("DispatchThreads",nDispatchThreads);
+    P.GetVariable("--dispatch_threads",nDispatchThreads);
+    if(nDispatchThreads>0)
+        SetDispatchThreads(nDispatchThreads);
+
+    ///////////////////////////////////////////////////////////
+    //should a few epoll threads do all the socket IO rather
+    //than a thread per client?
+    bool bEpoll = P.GetFlag("-e","--epoll");
+    int nIOThreads = 0;
+    m_MissionReader.GetValue("IOThreads",nIOThreads);
+    P.GetVariable("--io_threads",nIOThreads);
+    if(nIOThreads>0)
+        bEpoll = true;
+    else
+        nIOThreads = 2;
+
 
     //is the community name being specified on the cli?
 	unsigned int nAuditPort=9020;
@@ -423,7 +469,44 @@ bool CMOOSDB::Run(int argc,  char * argv[] )
     else
     {
         //std::cerr<<MOOS::ConsoleColours::green()<<"running in multi-threaded mode\n"<<MOOS::ConsoleColours::reset();
-		m_pCommServer = std::auto_ptr<CMOOSCommServer> (new MOOS::ThreadedCommServer);
+        MOOS::ThreadedCommServer * pServer = NULL;
+
+        if(bEpoll)
+        {
+#ifdef MOOS_HAVE_EPOLL
+            MOOS::EpollCommServer * pEpollServer = new MOOS::EpollCommServer;
+            pEpollServer->SetIOThreads(nIOThreads);
+            pServer = pEpollServer;
+
+            if(!m_bQuiet)
+                std::cout<<"client socket IO on "<<nIOThreads<<" epoll threads\n";
+#else
+            std::cout<<MOOS::ConsoleColours::yellow()<<"warning : epoll is not available on this platform - using a thread per client\n"<<MOOS::ConsoleColours::reset();
+#endif
+        }
+
+        if(pServer==NULL)
+            pServer = new MOOS::ThreadedCommServer;
+
+        if(m_nDispatchThreads>1)
+        {
+            //split the variable table so that the dispatch threads
+            //rarely contend for the same lock
+            unsigned int nShards = 4*m_nDispatchThreads;
+            for(unsigned int i = 0;i<nShards;i++)
+                m_Shards.push_back(new DBShard);
+
+            DBVAR_MAP::iterator p;
+            for(p = m_VarMap.begin();p!=m_VarMap.end();p++)
+                m_Shards[ShardOf(p->first)]->m_Index[p->first] = &(p->second);
+
+            pServer->SetDispatchThreads(m_nDispatchThreads);
+
+            if(!m_bQuiet)
+                std::cout<<"dispatching clients on "<<m_nDispatchThreads<<" threads ("<<nShards<<" shards)\n";
+        }
+
+		m_pCommServer = std::auto_ptr<CMOOSCommServer> (pServer);
     }
 
     m_pCommServer->SetQuiet(m_bQuiet);
@@ -436,6 +519,8 @@ bool CMOOSDB::Run(int argc,  char * argv[] )
 
     m_pCommServer->SetOnFetchAllMailCallBack(OnFetchAllMailCallBack,this);
 
+    m_pCommServer->SetOnCollectPendingMailCallBack(OnCollectPendingMailCallBack,this);
+
     m_pCommServer->SetClientTimeout(dfClientTimeout);
 
     m_pCommServer->SetWarningLatencyMS(dfWarningLatencyMS);
@@ -462,6 +547,56 @@ bool CMOOSDB::IsRunning()
 }
 
 
+bool CMOOSDB::SetDispatchThreads(unsigned int nThreads)
+{
+    if(m_pCommServer.get()!=NULL)
+        return MOOSFail("CMOOSDB::SetDispatchThreads() must be called before Run()");
+
+    m_nDispatchThreads = nThreads>0 ? nThreads : 1;
+    return true;
+}
+
+bool CMOOSDB::SetSharedPayloads(bool bShare)
+{
+    m_bSharedPayloads = bShare;
+    return true;
+}
+
+unsigned int CMOOSDB::ShardOf(const std::string & sVar)
+{
+    //djb2 - cheap and good enough to spread variable names
+    unsigned int nHash = 5381;
+    for(std::string::const_iterator q = sVar.begin();q!=sVar.end();q++)
+        nHash = nHash*33+(unsigned char)(*q);
+
+    return nHash%m_Shards.size();
+}
+
+void CMOOSDB::LockShard(const std::string & sVar)
+{
+    if(IsSharded())
+        m_Shards[ShardOf(sVar)]->m_Lock.Lock();
+}
+
+void CMOOSDB::UnLockShard(const std::string & sVar)
+{
+    if(IsSharded())
+        m_Shards[ShardOf(sVar)]->m_Lock.UnLock();
+}
+
+void CMOOSDB::LockAllShards()
+{
+    //always in the same order so two callers cannot deadlock
+    for(unsigned int i = 0;i<m_Shards.size();i++)
+        m_Shards[i]->m_Lock.Lock();
+}
+
+void CMOOSDB::UnLockAllShards()
+{
+    for(unsigned int i = m_Shards.size();i>0;i--)
+        m_Shards[i-1]->m_Lock.UnLock();
+}
+
 bool CMOOSDB::SetQuiet(bool bQuiet)
 {
     m_bQuiet = bQuiet;
@@ -581,34 +716,60 @@ bool CMOOSDB::OnRxPkt(const std::string & sClient,MOOSMSG_LIST & MsgListRx,MOOSM
     
     for(p = MsgListRx.begin();p!=MsgListRx.end();p++)
     {
-        ProcessMsg(*p,MsgListTx);
+        if(!IsSharded())
+        {
+            ProcessMsg(*p,MsgListTx);
+        }
+        else if(p->IsType(MOOS_NOTIFY))
+        {
+            //a notification only touches its own variable
+            LockShard(p->GetKey());
+            ProcessMsg(*p,MsgListTx);
+            UnLockShard(p->GetKey());
+        }
+        else
+        {
+            //(un)registrations and server requests may touch anything
+            LockAllShards();
+            ProcessMsg(*p,MsgListTx);
+            UnLockAllShards();
+        }
     }
     
 
     double dfNow = MOOS::Time();
     if(dfNow-m_dfSummaryTime>2.0)
     {
-        m_dfSummaryTime = dfNow;
+        LockAllShards();
 
-        //good spot to update our internal time
-        UpdateDBTimeVars();
+        //another dispatch thread may have got here first
+        if(dfNow-m_dfSummaryTime>2.0)
+        {
+            m_dfSummaryTime = dfNow;
+
+            //good spot to update our internal time
+            UpdateDBTimeVars();
 
-        //and send clients an occasional membersip list
-        UpdateDBClientsVar();
+            //and send clients an occasional membersip list
+            UpdateDBClientsVar();
 
-        //update a db summary var once in a while
-        UpdateSummaryVar();
+            //update a db summary var once in a while
+            UpdateSummaryVar();
 
-        //update quality of service summary
-        UpdateQoSVar();
+            //update quality of service summary
+            UpdateQoSVar();
 
-        //update variable which publishes who is reading and writing what
-        UpdateReadWriteSummaryVar();
+            //update variable which publishes who is reading and writing what
+            UpdateReadWriteSummaryVar();
+        }
+
+        UnLockAllShards();
     }
 
     if(!MsgListRx.empty())
     {
-        
+        MOOS::ScopedLock L(m_HeldMailLock);
+
         //now we fill in the packet with our replies to THIS CLIENT
         MOOSMSG_LIST_STRING_MAP::iterator q = m_HeldMailMap.find(sClient);
         
@@ -650,6 +811,8 @@ bool CMOOSDB::OnRxPkt(const std::string & sClient,MOOSMSG_LIST & MsgListRx,MOOSM
 
 bool CMOOSDB::OnFetchAllMail(const std::string & sWho,MOOSMSG_LIST & MsgListTx)
 {
+	MOOS::ScopedLock L(m_HeldMailLock);
+
 	MOOSMSG_LIST_STRING_MAP::iterator q = m_HeldMailMap.find(sWho);
 	if(q!=m_HeldMailMap.end())
 	{
@@ -664,6 +827,16 @@ bool CMOOSDB::OnFetchAllMail(const std::string & sWho,MOOSMSG_LIST & MsgListTx)
 	return true;
 }
 
+bool CMOOSDB::OnCollectPendingMail(std::vector<std::string> & Clients)
+{
+	MOOS::ScopedLock L(m_HeldMailLock);
+
+	Clients.assign(m_PendingMailClients.begin(),m_PendingMailClients.end());
+	m_PendingMailClients.clear();
+
+	return true;
+}
+
 /** This functions decides what needs to be done on a message by message basis */
 bool CMOOSDB::ProcessMsg(CMOOSMsg &MsgRx,MOOSMSG_LIST & MsgListTx)
 {
@@ -803,6 +976,19 @@ bool CMOOSDB::OnNotify(CMOOSMsg &Msg)
         //of changes in this variable?
         REGISTER_INFO_MAP::iterator p;
         
+        //the Msg we were passed has all the information we require already
+        Msg.m_cMsgType = MOOS_NOTIFY;
+
+        //if a sizeable payload is going to more than one place let all the
+        //copies share it and have it serialised once, here, rather than per
+        //client. For small messages the copies are cheaper than sharing.
+        if(m_bSharedPayloads &&
+           rVar.m_Subscribers.size()>1 &&
+           Msg.IsString() &&
+           Msg.GetSizeInBytesWhenSerialised()>=SHARED_PAYLOAD_MIN_BYTES)
+        {
+            Msg.Share();
+        }
         
         for(p = rVar.m_Subscribers.begin();p!=rVar.m_Subscribers.end();p++)
         {
@@ -815,10 +1001,6 @@ bool CMOOSDB::OnNotify(CMOOSMsg &Msg)
                 
                 string  & sClient = p->second.m_sClientName;
                 
-                //the Msg we were passed has all the information we require already
-                Msg.m_cMsgType = MOOS_NOTIFY;
-                
-                
                 AddMessageToClientBox(sClient,Msg);
                 
 
@@ -848,6 +1030,11 @@ bool CMOOSDB::OnNotify(CMOOSMsg &Msg)
 in they shall be informed of the change by stuffing this msg into a return packet */
 bool    CMOOSDB::AddMessageToClientBox(const string &sClient,CMOOSMsg & Msg)
 {
+    //make the copy before taking the lock other dispatch threads need
+    MOOSMSG_LIST NewMail(1,Msg);
+
+    MOOS::ScopedLock L(m_HeldMailLock);
+
     MOOSMSG_LIST_STRING_MAP::iterator q = m_HeldMailMap.find(sClient);
     
     if(q==m_HeldMailMap.end())
@@ -864,8 +1051,12 @@ bool    CMOOSDB::AddMessageToClientBox(const string &sClient,CMOOSMsg & Msg)
     
     //q->second is now a reference to a list of messages that will be
     //sent to sClient the next time it calls into the database...
-    
-    q->second.push_back(Msg);
+
+    //a box which already had mail in it has already been noted
+    if(q->second.empty())
+        m_PendingMailClients.insert(sClient);
+
+    q->second.splice(q->second.end(),NewMail);
     
     //MOOSTrace("%d messages held for client %s\n",q->second.size(),sClient.c_str());
 
@@ -1019,6 +1210,19 @@ and if not make one and then return a reference to it.
 */
 CMOOSDBVar & CMOOSDB::GetOrMakeVar(CMOOSMsg &Msg)
 {    
+    //when sharded the caller holds the lock of the shard owning this
+    //variable so we can use its index. Only making a new variable needs
+    //the (rarely taken) lock on the main table
+    DBShard * pShard = NULL;
+    if(IsSharded())
+    {
+        pShard = m_Shards[ShardOf(Msg.m_sKey)];
+        DBVAR_SHARD_INDEX::iterator s = pShard->m_Index.find(Msg.m_sKey);
+        if(s!=pShard->m_Index.end())
+            return *(s->second);
+
+        m_VarMapLock.Lock();
+    }
     
     //look up this variable name
     DBVAR_MAP::iterator p = m_VarMap.find(Msg.m_sKey);
@@ -1074,6 +1278,12 @@ CMOOSDBVar & CMOOSDB::GetOrMakeVar(CMOOSMsg &Msg)
 
     //ok we know what you are talking about
     CMOOSDBVar & rVar = p->second;
+
+    if(pShard!=NULL)
+    {
+        pShard->m_Index[Msg.m_sKey] = &rVar;
+        m_VarMapLock.UnLock();
+    }
     
     //return the reference
     return rVar;
@@ -1088,7 +1298,9 @@ bool CMOOSDB::OnConnect(string &sClient)
     CMOOSMsg DBC(MOOS_NOTIFY,"DB_EVENT",MOOSFormat("connected=%s",sClient.c_str()));
     DBC.m_sOriginatingCommunity = m_sCommunityName;
     DBC.m_sSrc = m_sDBName;
+    LockShard(DBC.GetKey());
     OnNotify(DBC);
+    UnLockShard(DBC.GetKey());
 
 
     return true;
@@ -1102,6 +1314,8 @@ bool CMOOSDB::OnDisconnect(string &sClient)
         std::cout<<MOOS::ConsoleColours::yellow()<<sClient<<" is leaving...           ";
     }
     
+    LockAllShards();
+
     DBVAR_MAP::iterator p;
     
     for(p=m_VarMap.begin();p!=m_VarMap.end();p++)
@@ -1115,7 +1329,10 @@ bool CMOOSDB::OnDisconnect(string &sClient)
     	m_ClientFilters[sClient].clear();
     }
     
+    m_HeldMailLock.Lock();
     m_HeldMailMap.erase(sClient);
+    m_PendingMailClients.erase(sClient);
+    m_HeldMailLock.UnLock();
     
     if(!m_bQuiet)
         std::cout<<MOOS::ConsoleColours::Green()<<"[OK]\n"<<MOOS::ConsoleColours::reset();
@@ -1129,6 +1346,8 @@ bool CMOOSDB::OnDisconnect(string &sClient)
     DBC.m_sSrc = m_sDBName;
     OnNotify(DBC);
 
+    UnLockAllShards();
+
     return true;
 }
 
@@ -1386,6 +1605,7 @@ bool CMOOSDB::OnClearRequested(CMOOSMsg &Msg, MOOSMSG_LIST &MsgTxList)
     MOOSTrace("done\n");
     
     
+    m_HeldMailLock.Lock();
     MOOSTrace("    Removing %d existing notification queues...",m_HeldMailMap.size());
     MOOSMSG_LIST_STRING_MAP::iterator q;
     
@@ -1394,6 +1614,7 @@ bool CMOOSDB::OnClearRequested(CMOOSMsg &Msg, MOOSMSG_LIST &MsgTxList)
         MOOSMSG_LIST & rList = q->second;
         rList.clear();
     }
+    m_HeldMailLock.UnLock();
     MOOSTrace("done\n");
     
     //MOOSTrace("    resetting DB start Time...done\n");
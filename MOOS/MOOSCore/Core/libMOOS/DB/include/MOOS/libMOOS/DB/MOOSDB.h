@@ -31,6 +31,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <memory>
 
 #include "MOOS/libMOOS/Utils/ProcessConfigReader.h"
@@ -39,6 +40,7 @@
 #include "MOOS/libMOOS/Comms/MOOSMsg.h"
 #include "MOOS/libMOOS/Comms/ThreadedCommServer.h"
 #include "MOOS/libMOOS/Comms/SuicidalSleeper.h"
+#include "MOOS/libMOOS/Utils/MOOSLock.h"
 
 #include "MOOS/libMOOS/DB/MOOSDBVar.h"
 #include "MOOS/libMOOS/DB/MOOSDBHTTPServer.h"
@@ -61,6 +63,18 @@
 typedef HASH_MAP_TYPE<std::string,MOOSMSG_LIST> MOOSMSG_LIST_STRING_MAP;
 typedef HASH_MAP_TYPE<std::string,CMOOSDBVar> DBVAR_MAP;
 
+//the per shard variable index is a genuine hash map where one is available
+#if defined(HAVE_STD_UNORDERED_MAP) && __cplusplus >= 201103L
+	#include <unordered_map>
+	#define SHARD_MAP_TYPE std::unordered_map
+#elif defined(HAVE_TR1_UNORDERED_MAP)
+	#include <tr1/unordered_map>
+	#define SHARD_MAP_TYPE std::tr1::unordered_map
+#else
+	#define SHARD_MAP_TYPE std::map
+#endif
+typedef SHARD_MAP_TYPE<std::string,CMOOSDBVar*> DBVAR_SHARD_INDEX;
+
 
 #define DEFAULT_MOOS_SERVER_PORT 9000
 
@@ -86,14 +100,33 @@ public:
 
     static bool OnFetchAllMailCallBack(const std::string & sWho,MOOSMSG_LIST & MsgListTx, void * pParam);
 
+    static bool OnCollectPendingMailCallBack(std::vector<std::string> & Clients, void * pParam);
+
     /** called internally when a MOOSPkt (a collection of MOOSMsg's ) is
     received by the server */
     bool OnRxPkt(const std::string & sClient,MOOSMSG_LIST & MsgLstRx,MOOSMSG_LIST & MsgLstTx);
 
     bool OnFetchAllMail(const std::string & sWho,MOOSMSG_LIST & MsgListTx);
 
+    /** names of the clients whose mail box has gone from empty to not empty
+    since this was last called */
+    bool OnCollectPendingMail(std::vector<std::string> & Clients);
+
     bool SetQuiet(bool bQuiet);
 
+    /** process clients on nThreads threads (must be called before Run). When
+    nThreads>1 the variable table is split into hash partitioned shards each
+    with its own lock so notifications of different variables can be handled
+    concurrently. Each client is served by one thread so per variable ordering
+    of its notifications is preserved */
+    bool SetDispatchThreads(unsigned int nThreads);
+
+    /** when true (the default) a large string notification destined for more
+    than one subscriber is frozen before it is handed out so that all their
+    copies share one payload and one serialised image of it (see
+    CMOOSMsg::Share) */
+    bool SetSharedPayloads(bool bShare);
+
     /** called by the owning application to start the DB running. It launches threads
     and returns */
     bool Run(int argc = 0,  char * argv[] =0);
@@ -143,6 +176,24 @@ protected:
     double GetStartTime(){return m_dfStartTime;}
     void OnPrintVersionAndExit();
 
+    /** a shard of the variable table - an index of the variables whose names
+    hash to it. The variables themselves live in m_VarMap */
+    struct DBShard
+    {
+        CMOOSLock m_Lock;
+        DBVAR_SHARD_INDEX m_Index;
+    };
+
+    bool IsSharded(){return !m_Shards.empty();}
+    unsigned int ShardOf(const std::string & sVar);
+    void LockShard(const std::string & sVar);
+    void UnLockShard(const std::string & sVar);
+
+    /** lock every shard - needed by anything touching more than one variable
+    or the client filters. No-ops if the table is not sharded */
+    void LockAllShards();
+    void UnLockAllShards();
+
 private:
     std::string m_sDBName;
     std::string m_sCommunityName;
@@ -158,6 +209,21 @@ private:
     MOOSMSG_LIST_STRING_MAP m_HeldMailMap;
     DBVAR_MAP    m_VarMap;
 
+    unsigned int m_nDispatchThreads;
+    std::vector<DBShard*> m_Shards;
+
+    bool m_bSharedPayloads;
+
+    //guards insertion into m_VarMap when sharded
+    CMOOSLock m_VarMapLock;
+
+    /**clients whose mail box has had something put in it since they were
+    last collected by OnCollectPendingMail*/
+    std::set<std::string> m_PendingMailClients;
+
+    //guards m_HeldMailMap and m_PendingMailClients
+    CMOOSLock m_HeldMailLock;
+
 
 
     HASH_MAP_TYPE<std::string,std::set< MOOS::MsgFilter > > m_ClientFilters;
@@ -0,0 +1,365 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Lesser Public License v2.1
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/lgpl.txtgram is distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+/*
+ * RingQueue.h
+ *
+ * a bounded, lock free alternative to SafeList for the paths where a mutex
+ * and a list node per element are too expensive.
+ */
+
+#ifndef MOOSRINGQUEUE_H_
+#define MOOSRINGQUEUE_H_
+
+#include <list>
+#include <vector>
+#include "MOOS/libMOOS/Thirdparty/PocoBits/Event.h"
+#include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
+
+#if defined(_MSC_VER)
+#include "MOOS/libMOOS/Thirdparty/PocoBits/UnWindows.h"
+#elif !defined(__GNUC__)
+#error "MOOS::RingQueue needs GCC/Clang or MSVC atomic intrinsics"
+#endif
+
+namespace MOOS
+{
+/**
+ * templated, bounded, thread safe and waitable queue built on a ring of
+ * pre-allocated slots. Any number of threads may push and pull - each slot
+ * carries a sequence number which tells a thread whether the slot is free
+ * to be written or ready to be read, so no locks are taken and nothing is
+ * allocated as elements pass through. Elements pushed by one thread are
+ * pulled in the order they were pushed.
+ *
+ * It offers the parts of the SafeList interface which make sense for a
+ * queue so that a SafeList can be swapped for one. The difference is that
+ * it is bounded: Push() waits for space when the queue is full (so a slow
+ * consumer pushes back on its producers) whereas TryPush() returns false.
+ * Close() releases any producer waiting in Push() so that consumers can
+ * be stopped before producers at shutdown.
+ */
+template<class T>
+class RingQueue
+{
+public:
+
+    /**
+     * @param nCapacity number of elements the queue can hold (rounded
+     * up to a power of two)
+     */
+    RingQueue(unsigned int nCapacity = 1024) :
+        _nEnqueue(0), _nDequeue(0), _nSleepers(0), _nClosed(0)
+    {
+        unsigned int nSize = 2;
+        while(nSize<nCapacity)
+            nSize<<=1;
+
+        _nMask = nSize-1;
+        _Slots.resize(nSize);
+        for(unsigned int i = 0;i<nSize;i++)
+            _Slots[i]._nSequence = i;
+    }
+
+    /** add an element, waiting for space if the queue is full
+     * @return false if the queue was closed while full - the element is
+     * dropped */
+    bool Push(const T & Element)
+    {
+        //yield to the consumer for a while before sleeping properly
+        for(unsigned int n = 0;!TryPush(Element);n++)
+        {
+            if(IsClosed())
+                return false;
+            MOOSPause(n<100 ? 0 : 1,false);
+        }
+        return true;
+    }
+
+    /** add an element if there is room for it
+     * @return false if the queue was full */
+    bool TryPush(const T & Element)
+    {
+        Position nPos = Load(_nEnqueue);
+        Slot * pSlot;
+        for(;;)
+        {
+            pSlot = &_Slots[nPos&_nMask];
+            long nDiff = (long)(Load(pSlot->_nSequence)-nPos);
+            if(nDiff==0)
+            {
+                //slot is free - try to claim it
+                if(CompareAndSwap(_nEnqueue,nPos,nPos+1))
+                    break;
+                nPos = Load(_nEnqueue);
+            }
+            else if(nDiff<0)
+            {
+                //slot still holds an element from the last lap
+                return false;
+            }
+            else
+            {
+                //someone beat us to it
+                nPos = Load(_nEnqueue);
+            }
+        }
+
+        pSlot->_Data = Element;
+        Store(pSlot->_nSequence,nPos+1);
+
+        //only pay for the event if a consumer may be asleep
+        Fence();
+        if(Load(_nSleepers)!=0)
+            _PushEvent.set();
+
+        return true;
+    }
+
+    /** take the oldest element
+     * @return false if the queue was empty */
+    bool Pull(T & Element)
+    {
+        Position nPos = Load(_nDequeue);
+        Slot * pSlot;
+        for(;;)
+        {
+            pSlot = &_Slots[nPos&_nMask];
+            long nDiff = (long)(Load(pSlot->_nSequence)-(nPos+1));
+            if(nDiff==0)
+            {
+                if(CompareAndSwap(_nDequeue,nPos,nPos+1))
+                    break;
+                nPos = Load(_nDequeue);
+            }
+            else if(nDiff<0)
+            {
+                return false;
+            }
+            else
+            {
+                nPos = Load(_nDequeue);
+            }
+        }
+
+        Element = pSlot->_Data;
+
+        //don't keep the element alive in the ring
+        pSlot->_Data = _Vacant;
+        Store(pSlot->_nSequence,nPos+_nMask+1);
+
+        return true;
+    }
+
+    /** discard the oldest element */
+    void Pop()
+    {
+        T Element;
+        Pull(Element);
+    }
+
+    /** push every element of a list and empty it. Unlike SafeList this
+     * takes time linear in the number of elements */
+    bool AppendToMeInConstantTime(std::list<T> & ThingToAppend)
+    {
+        typename std::list<T>::iterator q;
+        for(q = ThingToAppend.begin();q!=ThingToAppend.end();q++)
+            Push(*q);
+        ThingToAppend.clear();
+        return true;
+    }
+
+    /** drain everything currently queued onto the end of a list. Unlike
+     * SafeList this takes time linear in the number of elements */
+    bool AppendToOtherInConstantTime(std::list<T> & ThingToAppendTo)
+    {
+        T Element;
+        while(Pull(Element))
+            ThingToAppendTo.push_back(Element);
+        return true;
+    }
+
+    /** wait for the queue to become non empty
+     * @param milliseconds how long to wait, -1 for ever
+     * @return true if there may be something to pull */
+    bool WaitForPush(long milliseconds = -1)
+    {
+        if(!IsEmpty())
+            return true;
+
+        //tell producers we might sleep and then look again so a push
+        //which missed our flag is not missed by us
+        AtomicAdd(_nSleepers,1);
+        bool bResult = !IsEmpty();
+        if(!bResult)
+        {
+            if (milliseconds < 0)
+            {
+                _PushEvent.wait();
+                bResult = true;
+            }
+            else
+            {
+                bResult = _PushEvent.tryWait(milliseconds);
+            }
+        }
+        AtomicAdd(_nSleepers,-1);
+
+        return bResult || !IsEmpty();
+    }
+
+    /** stop Push() waiting for space and wake any consumer waiting in
+     * WaitForPush(). Elements can still be pushed while there is room
+     * and pulled as usual */
+    void Close()
+    {
+        Store(_nClosed,1);
+        _PushEvent.set();
+    }
+
+    /** undo Close() */
+    void Open()
+    {
+        Store(_nClosed,0);
+    }
+
+    bool IsClosed()
+    {
+        return Load(_nClosed)!=0;
+    }
+
+    bool IsEmpty()
+    {
+        Position nPos = Load(_nDequeue);
+        return Load(_Slots[nPos&_nMask]._nSequence)!=nPos+1;
+    }
+
+    /** an estimate of the number of elements queued - exact only when
+     * no one else is pushing or pulling */
+    unsigned int Size()
+    {
+        Position nDequeue = Load(_nDequeue);
+        long nDiff = (long)(Load(_nEnqueue)-nDequeue);
+        return nDiff>0 ? (unsigned int)nDiff : 0;
+    }
+
+    unsigned int Capacity()
+    {
+        return _nMask+1;
+    }
+
+    void Clear()
+    {
+        T Element;
+        while(Pull(Element))
+        {
+        }
+    }
+
+private:
+
+#if defined(_MSC_VER)
+    typedef LONG Position;
+#else
+    typedef unsigned long Position;
+#endif
+
+    struct Slot
+    {
+        volatile Position _nSequence;
+        T _Data;
+    };
+
+    static Position Load(const volatile Position & n)
+    {
+#if defined(_MSC_VER)
+        Position v = n;
+        MemoryBarrier();
+        return v;
+#elif defined(__ATOMIC_ACQUIRE)
+        return __atomic_load_n(&n,__ATOMIC_ACQUIRE);
+#else
+        Position v = n;
+        __sync_synchronize();
+        return v;
+#endif
+    }
+
+    static void Store(volatile Position & n, Position v)
+    {
+#if defined(_MSC_VER)
+        MemoryBarrier();
+        n = v;
+#elif defined(__ATOMIC_RELEASE)
+        __atomic_store_n(&n,v,__ATOMIC_RELEASE);
+#else
+        __sync_synchronize();
+        n = v;
+#endif
+    }
+
+    static bool CompareAndSwap(volatile Position & n, Position Expected, Position Desired)
+    {
+#if defined(_MSC_VER)
+        return InterlockedCompareExchange(&n,Desired,Expected)==Expected;
+#else
+        return __sync_bool_compare_and_swap(&n,Expected,Desired);
+#endif
+    }
+
+    static void AtomicAdd(volatile Position & n, long nDelta)
+    {
+#if defined(_MSC_VER)
+        InterlockedExchangeAdd(&n,nDelta);
+#else
+        __sync_fetch_and_add(&n,(Position)nDelta);
+#endif
+    }
+
+    static void Fence()
+    {
+#if defined(_MSC_VER)
+        MemoryBarrier();
+#else
+        __sync_synchronize();
+#endif
+    }
+
+    //keep the two ends of the queue on separate cache lines
+    volatile Position _nEnqueue;
+    char _Pad0[64];
+    volatile Position _nDequeue;
+    char _Pad1[64];
+    volatile Position _nSleepers;
+    volatile Position _nClosed;
+
+    Position _nMask;
+    std::vector<Slot> _Slots;
+    T _Vacant;
+    Poco::Event _PushEvent;
+
+    //not copyable
+    RingQueue(const RingQueue &);
+    RingQueue & operator=(const RingQueue &);
+};
+}
+
+#endif /* MOOSRINGQUEUE_H_ */
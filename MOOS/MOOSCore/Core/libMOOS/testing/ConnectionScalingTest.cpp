@@ -0,0 +1,267 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Lesser Public License v2.1
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/lgpl.txt distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+
+
+
+
+/*
+ * ConnectionScalingTest.cpp
+ *
+ * connects more and more clients to a MOOSDB over real sockets and measures
+ * how the thread per client server and the epoll server cope: how many
+ * threads the process needs, how long connecting takes and how quickly every
+ * client can get a notification through the DB and back again.
+ */
+#include "MOOS/libMOOS/DB/MOOSDB.h"
+#include "MOOS/libMOOS/Comms/MOOSCommObject.h"
+#include "MOOS/libMOOS/Comms/MOOSCommPkt.h"
+#include "MOOS/libMOOS/Comms/XPCTcpSocket.h"
+#include "MOOS/libMOOS/Utils/CommandLineParser.h"
+#include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <vector>
+
+
+static void PrintHelp()
+{
+	std::cerr<<"MOOSDB connection scaling benchmark\n\n";
+	std::cerr<<"--port=<int>          first port to run the DB on (default 9500)\n";
+	std::cerr<<"--clients=<list>      client counts to try (default 16,64,256,512)\n";
+	std::cerr<<"--rounds=<int>        notifications each client sends (default 50)\n";
+	std::cerr<<"--io_threads=<int>    epoll IO threads (default 2)\n";
+	exit(0);
+}
+
+//a bare bones asynchronous client that does its own handshaking
+class ScaleClient : public CMOOSCommObject
+{
+public:
+	ScaleClient():m_pSocket(NULL){};
+	~ScaleClient()
+	{
+		if(m_pSocket!=NULL)
+		{
+			m_pSocket->vCloseSocket();
+			delete m_pSocket;
+		}
+	}
+
+	bool Connect(int nPort,const std::string & sName)
+	{
+		m_sName = sName;
+		m_pSocket = new XPCTcpSocket((long int)nPort);
+		m_pSocket->vConnect("localhost");
+
+		m_pSocket->iSendMessage((void*)MOOS_PROTOCOL_STRING, MOOS_PROTOCOL_STRING_BUFFER_SIZE);
+
+		CMOOSMsg Msg(MOOS_DATA,"asynchronous",sName);
+		SendMsg(m_pSocket,Msg);
+
+		CMOOSMsg WelcomeMsg;
+		return ReadMsg(m_pSocket,WelcomeMsg,5) && WelcomeMsg.IsType(MOOS_WELCOME);
+	}
+
+	bool Send(const CMOOSMsg & M)
+	{
+		MOOSMSG_LIST Msgs;
+		Msgs.push_back(M);
+		Msgs.back().m_sSrc = m_sName;
+
+		CMOOSCommPkt Pkt;
+		Pkt.Serialize(Msgs,true);
+		return SendPkt(m_pSocket,Pkt);
+	}
+
+	//wait for a particular value of a variable to come back
+	bool WaitFor(const std::string & sVar,double dfValue)
+	{
+		for(;;)
+		{
+			CMOOSCommPkt Pkt;
+			MOOSMSG_LIST Msgs;
+			if(!ReadPkt(m_pSocket,Pkt,5) || !Pkt.Serialize(Msgs,false))
+				return false;
+
+			for(MOOSMSG_LIST::iterator q = Msgs.begin();q!=Msgs.end();q++)
+			{
+				if(q->IsName(sVar) && q->GetDouble()==dfValue)
+					return true;
+			}
+		}
+	}
+
+	XPCTcpSocket * m_pSocket;
+	std::string m_sName;
+};
+
+
+//how many threads does this process have right now?
+static int CountThreads()
+{
+	std::ifstream Status("/proc/self/status");
+	std::string sLine;
+	while(std::getline(Status,sLine))
+	{
+		if(sLine.find("Threads:")==0)
+			return atoi(sLine.substr(8).c_str());
+	}
+	return -1;
+}
+
+
+bool RunTrial(int nPort, bool bEpoll, unsigned int nIOThreads,
+		unsigned int nClients, unsigned int nRounds)
+{
+	CMOOSDB DB;
+	DB.SetQuiet(true);
+
+	std::string sPort = MOOSFormat("--moos_port=%d",nPort);
+	std::string sIOThreads = MOOSFormat("--io_threads=%d",nIOThreads);
+	std::vector<char*> DBArgs;
+	DBArgs.push_back((char*)"connection_scaling_test");
+	DBArgs.push_back((char*)sPort.c_str());
+	DBArgs.push_back((char*)"--moos_suicide_disable");
+
+	//the DB takes its time over each new client so don't let the
+	//first ones time out while the last are connecting
+	DBArgs.push_back((char*)"--moos_timeout=600");
+
+	//and a full round of hundreds of clients is expected to take a while
+	DBArgs.push_back((char*)"--warning_latency=5000");
+	if(bEpoll)
+		DBArgs.push_back((char*)sIOThreads.c_str());
+	int nThreadsBefore = CountThreads();
+
+	DB.Run(DBArgs.size(),&DBArgs[0]);
+
+	//give the server a moment to start listening
+	MOOSPause(500);
+
+	//connect everyone
+	std::vector<ScaleClient*> Clients;
+	double dfStart = MOOS::Time();
+	for(unsigned int i = 0;i<nClients;i++)
+	{
+		Clients.push_back(new ScaleClient);
+		if(!Clients.back()->Connect(nPort,MOOSFormat("scale_%d",i)))
+			return MOOSFail("client %d failed to connect",i);
+	}
+	double dfConnect = MOOS::Time()-dfStart;
+
+	//each client listens to its own variable and to one they all share
+	for(unsigned int i = 0;i<nClients;i++)
+	{
+		Clients[i]->Send(CMOOSMsg(MOOS_REGISTER,MOOSFormat("SCALE_%d",i),0.0));
+		Clients[i]->Send(CMOOSMsg(MOOS_REGISTER,"SCALE_ALL",0.0));
+	}
+	MOOSPause(500);
+
+	int nThreads = CountThreads()-nThreadsBefore;
+
+	//everyone writes and then everyone waits to hear their write echoed
+	unsigned int nLost = 0;
+	dfStart = MOOS::Time();
+	for(unsigned int r = 1;r<=nRounds;r++)
+	{
+		for(unsigned int i = 0;i<nClients;i++)
+			Clients[i]->Send(CMOOSMsg(MOOS_NOTIFY,MOOSFormat("SCALE_%d",i),(double)r,MOOS::Time()));
+
+		for(unsigned int i = 0;i<nClients;i++)
+		{
+			if(!Clients[i]->WaitFor(MOOSFormat("SCALE_%d",i),(double)r))
+				nLost++;
+		}
+	}
+	double dfElapsed = MOOS::Time()-dfStart;
+
+	//one write fills every mail box and every client must be pushed it
+	Clients[0]->Send(CMOOSMsg(MOOS_NOTIFY,"SCALE_ALL",1.0,MOOS::Time()));
+	for(unsigned int i = 0;i<nClients;i++)
+	{
+		if(!Clients[i]->WaitFor("SCALE_ALL",1.0))
+			nLost++;
+	}
+
+	for(unsigned int i = 0;i<Clients.size();i++)
+		delete Clients[i];
+
+	std::cout<<std::setw(10)<<(bEpoll ? "epoll" : "threaded")
+			<<std::setw(10)<<nClients
+			<<std::setw(10)<<nThreads
+			<<std::setw(14)<<std::fixed<<std::setprecision(2)<<1000.0*dfConnect/nClients
+			<<std::setw(14)<<1000.0*dfElapsed/nRounds
+			<<std::setw(14)<<std::setprecision(0)<<nClients*nRounds/dfElapsed
+			<<std::setw(8)<<nLost<<"\n";
+
+	return nLost==0;
+}
+
+
+int main(int argc, char * argv[])
+{
+	MOOS::CommandLineParser P(argc,argv);
+
+	if(P.GetFlag("-h","--help"))
+		PrintHelp();
+
+	int nPort = 9500;
+	std::string sClients = "16,64,256,512";
+	unsigned int nRounds = 50;
+	unsigned int nIOThreads = 2;
+
+	P.GetVariable("--port",nPort);
+	P.GetVariable("--clients",sClients);
+	P.GetVariable("--rounds",nRounds);
+	P.GetVariable("--io_threads",nIOThreads);
+
+	std::cout<<"each client writes "<<nRounds<<" times and waits to hear itself\n\n";
+	std::cout<<std::setw(10)<<"server"
+			<<std::setw(10)<<"clients"
+			<<std::setw(10)<<"threads"
+			<<std::setw(14)<<"connect ms"
+			<<std::setw(14)<<"round ms"
+			<<std::setw(14)<<"echoes/s"
+			<<std::setw(8)<<"lost"<<"\n";
+
+	bool bOK = true;
+	while(!sClients.empty())
+	{
+		unsigned int nClients = atoi(MOOSChomp(sClients,",").c_str());
+		if(nClients==0)
+			continue;
+
+		//a thread per client server selects on each client's socket and both
+		//ends of every connection are in this process
+		if(2*nClients+64<FD_SETSIZE)
+			bOK = RunTrial(nPort++,false,nIOThreads,nClients,nRounds) && bOK;
+		else
+			std::cout<<std::setw(10)<<"threaded"<<std::setw(10)<<nClients<<"   (too many sockets for select)\n";
+#ifdef MOOS_HAVE_EPOLL
+		bOK = RunTrial(nPort++,true,nIOThreads,nClients,nRounds) && bOK;
+#endif
+	}
+
+	return bOK ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Lesser Public License v2.1
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/lgpl.txt distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+
+
+
+
+/*
+ * DBFanOutTest.cpp
+ *
+ * measures what it costs the MOOSDB to deliver one large notification to many
+ * subscribers - from the publisher's packet arriving to every subscriber's
+ * reply packet being serialised - with and without shared message payloads.
+ * Reports the DB CPU time and the number of bytes allocated (and so copied)
+ * per notification, and checks every subscriber receives the right bytes.
+ */
+#include "MOOS/libMOOS/DB/MOOSDB.h"
+#include "MOOS/libMOOS/Comms/MOOSCommPkt.h"
+#include "MOOS/libMOOS/Utils/CommandLineParser.h"
+#include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+
+//count every byte anybody asks for
+static volatile unsigned long gnBytesAllocated = 0;
+
+void * operator new(std::size_t nSize)
+{
+	gnBytesAllocated+=nSize;
+	void * p = std::malloc(nSize ? nSize : 1);
+	if(p==NULL)
+		throw std::bad_alloc();
+	return p;
+}
+
+void operator delete(void * p) throw()
+{
+	std::free(p);
+}
+
+
+static void PrintHelp()
+{
+	std::cerr<<"MOOSDB notification fan-out benchmark\n\n";
+	std::cerr<<"--port=<int>          first port to run the DB on (default 9200)\n";
+	std::cerr<<"--subscribers=<int>   number of clients subscribing to the variable (default 64)\n";
+	std::cerr<<"--size=<int>          size of the string payload in bytes (default 8192)\n";
+	std::cerr<<"--notifications=<int> number of notifications to publish (default 2000)\n";
+	exit(0);
+}
+
+
+bool RunTrial(int nPort, bool bShared, unsigned int nSubscribers,
+		unsigned int nSize, unsigned int nNotifications,
+		unsigned long & nBytesAllocated)
+{
+	CMOOSDB DB;
+	DB.SetQuiet(true);
+	DB.SetSharedPayloads(bShared);
+
+	std::string sPort = MOOSFormat("--moos_port=%d",nPort);
+	char * DBArgs[] = {(char*)"db_fanout_test",
+			(char*)sPort.c_str(),
+			(char*)"--moos_suicide_disable"};
+	DB.Run(3,DBArgs);
+
+	std::vector<std::string> Subscribers;
+	for(unsigned int i = 0;i<nSubscribers;i++)
+	{
+		Subscribers.push_back(MOOSFormat("sub_%d",i));
+
+		MOOSMSG_LIST Rx,Tx;
+		CMOOSMsg M(MOOS_REGISTER,"BENCH_SUMMARY",0.0);
+		M.m_sSrc = Subscribers.back();
+		Rx.push_back(M);
+		DB.OnRxPkt(Subscribers.back(),Rx,Tx);
+	}
+
+	//something like an IVPHELM_SUMMARY or APPCAST
+	std::string sPayload(nSize,'x');
+
+	unsigned long nBadDeliveries = 0;
+	nBytesAllocated = 0;
+	std::clock_t nCPU = 0;
+
+	for(unsigned int n = 0;n<nNotifications;n++)
+	{
+		sPayload[n%nSize] = 'a'+n%26;
+
+		//what arrives from the publisher (unpacking it is not DB work)
+		MOOSMSG_LIST Rx;
+		CMOOSMsg M(MOOS_NOTIFY,"BENCH_SUMMARY",sPayload,MOOS::Time());
+		M.m_sSrc = "publisher";
+		Rx.push_back(M);
+
+		std::vector<CMOOSCommPkt> Pkts(nSubscribers);
+
+		unsigned long nBytesBefore = gnBytesAllocated;
+		std::clock_t nStart = std::clock();
+
+		MOOSMSG_LIST Tx;
+		DB.OnRxPkt("publisher",Rx,Tx);
+
+		//and now every subscriber collects its mail as ProcessClient would
+		for(unsigned int i = 0;i<nSubscribers;i++)
+		{
+			MOOSMSG_LIST Mail;
+			DB.OnFetchAllMail(Subscribers[i],Mail);
+			Pkts[i].Serialize(Mail,true);
+		}
+
+		nCPU+=std::clock()-nStart;
+		nBytesAllocated+=gnBytesAllocated-nBytesBefore;
+
+		//what did they get?
+		for(unsigned int i = 0;i<nSubscribers;i++)
+		{
+			MOOSMSG_LIST Mail;
+			Pkts[i].Serialize(Mail,false);
+			if(Mail.size()!=1 || Mail.front().GetString()!=sPayload)
+				nBadDeliveries++;
+		}
+	}
+
+	double dfCPU = double(nCPU)/CLOCKS_PER_SEC;
+	std::cout<<std::setw(10)<<(bShared ? "shared" : "copied")
+			<<std::setw(16)<<std::fixed<<std::setprecision(1)<<1e6*dfCPU/nNotifications
+			<<std::setw(16)<<std::setprecision(1)<<nBytesAllocated/1024.0/nNotifications
+			<<std::setw(16)<<nBadDeliveries<<"\n";
+
+	return nBadDeliveries==0;
+}
+
+
+int main(int argc, char * argv[])
+{
+	MOOS::CommandLineParser P(argc,argv);
+
+	if(P.GetFlag("-h","--help"))
+		PrintHelp();
+
+	int nPort = 9200;
+	unsigned int nSubscribers = 64;
+	unsigned int nSize = 8192;
+	unsigned int nNotifications = 2000;
+
+	P.GetVariable("--port",nPort);
+	P.GetVariable("--subscribers",nSubscribers);
+	P.GetVariable("--size",nSize);
+	P.GetVariable("--notifications",nNotifications);
+
+	if(nSize==0)
+		nSize = 1;
+
+	std::cout<<nNotifications<<" notifications of "<<nSize<<" bytes to "
+			<<nSubscribers<<" subscribers\n\n";
+	std::cout<<std::setw(10)<<"payload"
+			<<std::setw(16)<<"CPU us/notify"
+			<<std::setw(16)<<"kB alloc/notify"
+			<<std::setw(16)<<"bad deliveries"<<"\n";
+
+	unsigned long nCopiedBytes = 0;
+	unsigned long nSharedBytes = 0;
+	bool bOK = RunTrial(nPort,false,nSubscribers,nSize,nNotifications,nCopiedBytes);
+	bOK = RunTrial(nPort+1,true,nSubscribers,nSize,nNotifications,nSharedBytes) && bOK;
+
+	//with more than one subscriber sharing the payload must save copying it
+	if(nSubscribers>1 && nSharedBytes>=nCopiedBytes)
+	{
+		std::cout<<"shared payloads did not allocate less than copied ones\n";
+		bOK = false;
+	}
+
+	return bOK ? 0 : 1;
+}
@@ -0,0 +1,258 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Lesser Public License v2.1
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/lgpl.txt distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+
+
+
+
+/*
+ * DBThroughputTest.cpp
+ *
+ * measures how many notifications a MOOSDB can absorb and fan out when its
+ * client traffic is processed by one or by several dispatch threads. The DB
+ * is run in process and its packet handler is driven directly by one thread
+ * per dispatcher - exactly as ThreadedCommServer does - so that the numbers
+ * reflect DB work rather than the network. Also checks that every subscriber
+ * sees the values of each variable in the order they were written.
+ */
+#include "MOOS/libMOOS/DB/MOOSDB.h"
+#include "MOOS/libMOOS/Utils/CommandLineParser.h"
+#include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
+#include "MOOS/libMOOS/Utils/MOOSThread.h"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <map>
+
+
+static void PrintHelp()
+{
+	std::cerr<<"MOOSDB notification throughput benchmark\n\n";
+	std::cerr<<"--port=<int>          first port to run the DB on (default 9100)\n";
+	std::cerr<<"--threads=<int>       dispatch threads to compare against 1 (default 4)\n";
+	std::cerr<<"--publishers=<int>    number of publishing clients (default 32)\n";
+	std::cerr<<"--subscribers=<int>   number of clients subscribing to everything (default 4)\n";
+	std::cerr<<"--vars=<int>          variables written by each publisher (default 16)\n";
+	std::cerr<<"--duration=<double>   seconds to run each trial (default 3)\n";
+	exit(0);
+}
+
+//what a simulated client knows about itself
+struct BenchClient
+{
+	std::string m_sName;
+	std::vector<std::string> m_Vars;
+	bool m_bSubscriber;
+	double m_dfValue;
+	std::map<std::string,double> m_LastValue;
+};
+
+//one of these per dispatch thread - it services its own share of the clients
+class Dispatcher
+{
+public:
+	Dispatcher():m_pDB(NULL),m_dfDuration(0),m_nWritten(0),m_nDelivered(0),m_nOutOfOrder(0)
+	{
+		m_Thread.Initialise(RunEntry,this);
+	}
+
+	static bool RunEntry(void * pParam) {return ((Dispatcher*)pParam)->Run();}
+
+	bool Run()
+	{
+		double dfStart = MOOS::Time();
+		while(MOOS::Time()-dfStart<m_dfDuration)
+		{
+			for(unsigned int i = 0;i<m_Clients.size();i++)
+				Service(m_Clients[i]);
+		}
+
+		//one last collection of mail
+		for(unsigned int i = 0;i<m_Clients.size();i++)
+		{
+			if(m_Clients[i].m_bSubscriber)
+				Service(m_Clients[i]);
+		}
+		return true;
+	}
+
+	void Service(BenchClient & C)
+	{
+		MOOSMSG_LIST Rx,Tx;
+		if(C.m_bSubscriber)
+		{
+			m_pDB->OnFetchAllMail(C.m_sName,Tx);
+		}
+		else
+		{
+			C.m_dfValue+=1.0;
+			for(unsigned int j = 0;j<C.m_Vars.size();j++)
+			{
+				CMOOSMsg M(MOOS_NOTIFY,C.m_Vars[j],C.m_dfValue,MOOS::Time());
+				M.m_sSrc = C.m_sName;
+				Rx.push_back(M);
+			}
+			m_pDB->OnRxPkt(C.m_sName,Rx,Tx);
+			m_nWritten+=Rx.size();
+		}
+
+		for(MOOSMSG_LIST::iterator q = Tx.begin();q!=Tx.end();q++)
+		{
+			if(q->GetKey().find("BENCH_")!=0)
+				continue;
+
+			//values written to each variable increase monotonically
+			std::map<std::string,double>::iterator p = C.m_LastValue.find(q->GetKey());
+			if(p!=C.m_LastValue.end() && q->GetDouble()<=p->second)
+				m_nOutOfOrder++;
+
+			C.m_LastValue[q->GetKey()] = q->GetDouble();
+			m_nDelivered++;
+		}
+	}
+
+	CMOOSThread m_Thread;
+	CMOOSDB * m_pDB;
+	double m_dfDuration;
+	std::vector<BenchClient> m_Clients;
+	unsigned long m_nWritten;
+	unsigned long m_nDelivered;
+	unsigned long m_nOutOfOrder;
+};
+
+
+bool RunTrial(int nPort, unsigned int nThreads, unsigned int nPublishers,
+		unsigned int nSubscribers, unsigned int nVars, double dfDuration)
+{
+	CMOOSDB DB;
+	DB.SetQuiet(true);
+	DB.SetDispatchThreads(nThreads);
+
+	std::string sPort = MOOSFormat("--moos_port=%d",nPort);
+	char * DBArgs[] = {(char*)"db_throughput_test",
+			(char*)sPort.c_str(),
+			(char*)"--moos_suicide_disable"};
+	DB.Run(3,DBArgs);
+
+	std::vector<Dispatcher*> Dispatchers;
+	for(unsigned int i = 0;i<nThreads;i++)
+		Dispatchers.push_back(new Dispatcher);
+
+	//deal the clients out across dispatchers like the comms server does
+	std::vector<std::string> AllVars;
+	for(unsigned int i = 0;i<nPublishers;i++)
+	{
+		BenchClient C;
+		C.m_sName = MOOSFormat("pub_%d",i);
+		C.m_bSubscriber = false;
+		C.m_dfValue = 0;
+		for(unsigned int j = 0;j<nVars;j++)
+		{
+			C.m_Vars.push_back(MOOSFormat("BENCH_%d_%d",i,j));
+			AllVars.push_back(C.m_Vars.back());
+		}
+		Dispatchers[i%nThreads]->m_Clients.push_back(C);
+	}
+
+	for(unsigned int i = 0;i<nSubscribers;i++)
+	{
+		BenchClient C;
+		C.m_sName = MOOSFormat("sub_%d",i);
+		C.m_bSubscriber = true;
+		C.m_dfValue = 0;
+		Dispatchers[i%nThreads]->m_Clients.push_back(C);
+
+		//subscribe to everything
+		MOOSMSG_LIST Rx,Tx;
+		for(unsigned int j = 0;j<AllVars.size();j++)
+		{
+			CMOOSMsg M(MOOS_REGISTER,AllVars[j],0.0);
+			M.m_sSrc = C.m_sName;
+			Rx.push_back(M);
+		}
+		DB.OnRxPkt(C.m_sName,Rx,Tx);
+	}
+
+	double dfStart = MOOS::Time();
+	for(unsigned int i = 0;i<nThreads;i++)
+	{
+		Dispatchers[i]->m_pDB = &DB;
+		Dispatchers[i]->m_dfDuration = dfDuration;
+		Dispatchers[i]->m_Thread.Start();
+	}
+
+	unsigned long nWritten = 0;
+	unsigned long nDelivered = 0;
+	unsigned long nOutOfOrder = 0;
+	for(unsigned int i = 0;i<nThreads;i++)
+	{
+		Dispatchers[i]->m_Thread.Stop();
+		nWritten+=Dispatchers[i]->m_nWritten;
+		nDelivered+=Dispatchers[i]->m_nDelivered;
+		nOutOfOrder+=Dispatchers[i]->m_nOutOfOrder;
+		delete Dispatchers[i];
+	}
+	double dfElapsed = MOOS::Time()-dfStart;
+
+	std::cout<<std::setw(8)<<nThreads
+			<<std::setw(14)<<std::fixed<<std::setprecision(0)<<nWritten/dfElapsed
+			<<std::setw(14)<<nDelivered/dfElapsed
+			<<std::setw(14)<<nOutOfOrder<<"\n";
+
+	return nOutOfOrder==0;
+}
+
+
+int main(int argc, char * argv[])
+{
+	MOOS::CommandLineParser P(argc,argv);
+
+	if(P.GetFlag("-h","--help"))
+		PrintHelp();
+
+	int nPort = 9100;
+	unsigned int nThreads = 4;
+	unsigned int nPublishers = 32;
+	unsigned int nSubscribers = 4;
+	unsigned int nVars = 16;
+	double dfDuration = 3;
+
+	P.GetVariable("--port",nPort);
+	P.GetVariable("--threads",nThreads);
+	P.GetVariable("--publishers",nPublishers);
+	P.GetVariable("--subscribers",nSubscribers);
+	P.GetVariable("--vars",nVars);
+	P.GetVariable("--duration",dfDuration);
+
+	std::cout<<nPublishers<<" publishers x "<<nVars<<" vars, "
+			<<nSubscribers<<" subscribers to everything\n\n";
+	std::cout<<std::setw(8)<<"threads"
+			<<std::setw(14)<<"written/s"
+			<<std::setw(14)<<"delivered/s"
+			<<std::setw(14)<<"out-of-order"<<"\n";
+
+	bool bOK = RunTrial(nPort,1,nPublishers,nSubscribers,nVars,dfDuration);
+	if(nThreads>1)
+		bOK = RunTrial(nPort+1,nThreads,nPublishers,nSubscribers,nVars,dfDuration) && bOK;
+
+	return bOK ? 0 : 1;
+}
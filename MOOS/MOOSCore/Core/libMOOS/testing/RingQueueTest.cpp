@@ -0,0 +1,212 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Lesser Public License v2.1
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/lgpl.txt distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+
+
+
+
+/*
+ * RingQueueTest.cpp
+ *
+ * compares the lock free MOOS::RingQueue with MOOS::SafeList when several
+ * threads push messages at one consumer which waits and pulls them - the
+ * way client threads feed a dispatcher in ThreadedCommServer. Also checks
+ * that every producer's messages come out in the order they went in.
+ */
+#include "MOOS/libMOOS/Utils/SafeList.h"
+#include "MOOS/libMOOS/Utils/RingQueue.h"
+#include "MOOS/libMOOS/Utils/CommandLineParser.h"
+#include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
+#include "MOOS/libMOOS/Utils/MOOSThread.h"
+#include "MOOS/libMOOS/Comms/MOOSMsg.h"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+
+static void PrintHelp()
+{
+	std::cerr<<"SafeList vs RingQueue producer/consumer benchmark\n\n";
+	std::cerr<<"--producers=<int>     threads pushing at once (default 4)\n";
+	std::cerr<<"--messages=<int>      messages pushed by each producer (default 200000)\n";
+	std::cerr<<"--capacity=<int>      ring queue capacity (default 1024)\n";
+	exit(0);
+}
+
+//one of these per pushing thread
+template<class Q>
+class Producer
+{
+public:
+	Producer():m_pQueue(NULL),m_nID(0),m_nMessages(0)
+	{
+		m_Thread.Initialise(RunEntry,this);
+	}
+
+	static bool RunEntry(void * pParam) {return ((Producer*)pParam)->Run();}
+
+	bool Run()
+	{
+		CMOOSMsg M(MOOS_NOTIFY,"RING_TEST",0.0);
+		M.m_sSrc = MOOSFormat("producer_%d",m_nID);
+		for(unsigned int i = 0;i<m_nMessages;i++)
+		{
+			M.m_dfVal = i;
+			M.m_dfVal2 = m_nID;
+			m_pQueue->Push(M);
+		}
+		return true;
+	}
+
+	CMOOSThread m_Thread;
+	Q * m_pQueue;
+	unsigned int m_nID;
+	unsigned int m_nMessages;
+};
+
+
+template<class Q>
+bool RunTrial(const std::string & sName, Q & Queue,
+		unsigned int nProducers, unsigned int nMessages)
+{
+	std::vector<Producer<Q>*> Producers;
+	for(unsigned int i = 0;i<nProducers;i++)
+	{
+		Producers.push_back(new Producer<Q>);
+		Producers[i]->m_pQueue = &Queue;
+		Producers[i]->m_nID = i;
+		Producers[i]->m_nMessages = nMessages;
+	}
+
+	std::vector<double> Next(nProducers,0.0);
+	unsigned long nOutOfOrder = 0;
+	unsigned long nPulled = 0;
+	unsigned long nTotal = (unsigned long)nProducers*nMessages;
+
+	double dfStart = MOOS::Time();
+	for(unsigned int i = 0;i<nProducers;i++)
+		Producers[i]->m_Thread.Start();
+
+	//consume exactly as a dispatch thread does
+	CMOOSMsg M;
+	while(nPulled<nTotal)
+	{
+		if(Queue.IsEmpty())
+		{
+			if(!Queue.WaitForPush(1000))
+				continue;
+		}
+
+		if(!Queue.Pull(M))
+			continue;
+
+		unsigned int nID = (unsigned int)M.m_dfVal2;
+		if(M.m_dfVal!=Next[nID])
+			nOutOfOrder++;
+		Next[nID] = M.m_dfVal+1;
+		nPulled++;
+	}
+	double dfElapsed = MOOS::Time()-dfStart;
+
+	for(unsigned int i = 0;i<nProducers;i++)
+	{
+		Producers[i]->m_Thread.Stop();
+		delete Producers[i];
+	}
+
+	std::cout<<std::setw(12)<<sName
+			<<std::setw(14)<<std::fixed<<std::setprecision(0)<<nPulled/dfElapsed
+			<<std::setw(14)<<std::setprecision(1)<<1e9*dfElapsed/nPulled
+			<<std::setw(14)<<nOutOfOrder<<"\n";
+
+	return nOutOfOrder==0 && Queue.IsEmpty();
+}
+
+
+//a producer stuck pushing onto a full queue must be let go by Close()
+//otherwise a server which stops its consumers first can never shut down
+bool TestClose()
+{
+	MOOS::RingQueue<CMOOSMsg> Full(2);
+	CMOOSMsg M(MOOS_NOTIFY,"RING_TEST",0.0);
+	while(Full.TryPush(M))
+	{
+	}
+
+	Producer<MOOS::RingQueue<CMOOSMsg> > Stuck;
+	Stuck.m_pQueue = &Full;
+	Stuck.m_nMessages = 10;
+	Stuck.m_Thread.Start();
+
+	MOOSPause(100);
+	bool bStillPushing = Stuck.m_Thread.IsThreadRunning();
+
+	Full.Close();
+	for(unsigned int n = 0;n<200 && Stuck.m_Thread.IsThreadRunning();n++)
+		MOOSPause(10);
+	bool bReleased = !Stuck.m_Thread.IsThreadRunning();
+
+	std::cout<<"\nClose() releases a blocked Push(): "<<(bReleased ? "yes" : "NO")<<"\n";
+
+	if(!bReleased)
+		return false;
+
+	Stuck.m_Thread.Stop();
+	return bStillPushing && Full.Size()==Full.Capacity();
+}
+
+
+int main(int argc, char * argv[])
+{
+	MOOS::CommandLineParser P(argc,argv);
+
+	if(P.GetFlag("-h","--help"))
+		PrintHelp();
+
+	unsigned int nProducers = 4;
+	unsigned int nMessages = 200000;
+	unsigned int nCapacity = 1024;
+
+	P.GetVariable("--producers",nProducers);
+	P.GetVariable("--messages",nMessages);
+	P.GetVariable("--capacity",nCapacity);
+
+	std::cout<<nProducers<<" producers x "<<nMessages<<" messages\n\n";
+	std::cout<<std::setw(12)<<"queue"
+			<<std::setw(14)<<"msgs/s"
+			<<std::setw(14)<<"ns/msg"
+			<<std::setw(14)<<"out-of-order"<<"\n";
+
+	MOOS::SafeList<CMOOSMsg> List;
+	bool bOK = RunTrial("SafeList",List,nProducers,nMessages);
+
+	MOOS::RingQueue<CMOOSMsg> Ring(nCapacity);
+	bOK = RunTrial("RingQueue",Ring,nProducers,nMessages) && bOK;
+
+	//a queue which is always full exercises the push back on producers
+	MOOS::RingQueue<CMOOSMsg> Tiny(2);
+	bOK = RunTrial("RingQueue(2)",Tiny,nProducers,nMessages/10) && bOK;
+
+	bOK = TestClose() && bOK;
+
+	return bOK ? 0 : 1;
+}
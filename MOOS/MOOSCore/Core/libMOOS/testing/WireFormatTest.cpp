@@ -0,0 +1,230 @@
+///////////////////////////////////////////////////////////////////////////
+//
+//   This file is part of the MOOS project
+//
+//   MOOS : Mission Oriented Operating Suite A suit of
+//   Applications and Libraries for Mobile Robotics Research
+//   Copyright (C) Paul Newman
+//
+//   This software was written by Paul Newman at MIT 2001-2002 and
+//   the University of Oxford 2003-2013
+//
+//   email: pnewman@robots.ox.ac.uk.
+//
+//   This source code and the accompanying materials
+//   are made available under the terms of the GNU Lesser Public License v2.1
+//   which accompanies this distribution, and is available at
+//   http://www.gnu.org/licenses/lgpl.txt distributed in the hope that it will be useful,
+//   but WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+////////////////////////////////////////////////////////////////////////////
+
+
+
+
+/*
+ * WireFormatTest.cpp
+ *
+ * packs a stream of NODE_REPORT like notifications into CMOOSCommPkts in the
+ * original wire format, the compact wire format and the compact wire format
+ * with compression, reads each packet back as the far end of a connection
+ * would and checks every message survives - and measures how many bytes each
+ * format puts on the wire.
+ */
+#include "MOOS/libMOOS/Comms/MOOSCommPkt.h"
+#include "MOOS/libMOOS/Utils/CommandLineParser.h"
+#include "MOOS/libMOOS/Utils/MOOSUtilityFunctions.h"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+
+
+static void PrintHelp()
+{
+	std::cerr<<"CMOOSCommPkt wire format test\n\n";
+	std::cerr<<"--notifications=<int> number of notifications to send (default 2000)\n";
+	std::cerr<<"--batch=<int>         notifications per packet (default 8)\n";
+	exit(0);
+}
+
+//one direction of a connection: what the sender packs is copied byte for
+//byte into a fresh packet, as ReadPkt would fill it, and unpacked
+class WireLink
+{
+public:
+	WireLink(bool bCompact,unsigned int nCompressAbove):
+		m_bCompact(bCompact),m_nCompressAbove(nCompressAbove),m_nBytes(0){};
+
+	bool Send(MOOSMSG_LIST & Msgs, MOOSMSG_LIST & Received)
+	{
+		CMOOSCommPkt Tx;
+		if(m_bCompact)
+			Tx.Serialize(Msgs,m_TxDictionary,true,m_nCompressAbove);
+		else
+			Tx.Serialize(Msgs,true);
+		m_nBytes+=Tx.GetStreamLength();
+
+		std::vector<unsigned char> Bytes(Tx.Stream(),Tx.Stream()+Tx.GetStreamLength());
+		CMOOSCommPkt Rx;
+		Rx.Fill(&Bytes[0],Bytes.size());
+
+		//the compact reader takes any packet, its flags say how it was written
+		return Rx.Serialize(Received,m_RxDictionary,false);
+	}
+
+	bool m_bCompact;
+	unsigned int m_nCompressAbove;
+	unsigned long m_nBytes;
+	MOOS::PktDictionary m_TxDictionary;
+	MOOS::PktDictionary m_RxDictionary;
+};
+
+
+std::string NodeReport(unsigned int n)
+{
+	unsigned int nVehicle = n%8;
+	return MOOSFormat("NAME=vehicle_%d,X=%.2f,Y=%.2f,SPD=%.2f,HDG=%.2f,DEP=0,"
+			"LAT=43.82%05d,LON=-70.33%05d,TYPE=KAYAK,GROUP=survey,MODE=DRIVE,"
+			"ALLSTOP=clear,INDEX=%d,TIME=%.2f,LENGTH=4",
+			nVehicle,10.0*nVehicle+0.37*n,-5.0*nVehicle+0.11*n,1.5+0.01*(n%50),
+			(n*7)%360*1.0,n%100000,(n*3)%100000,n,1500000000.0+n*0.25);
+}
+
+
+bool SameMessage(const CMOOSMsg & A, const CMOOSMsg & B)
+{
+	return A.GetKey()==B.GetKey() &&
+			A.GetType()==B.GetType() &&
+			A.GetString()==B.GetString() &&
+			A.GetDouble()==B.GetDouble() &&
+			A.GetTime()==B.GetTime() &&
+			A.GetSource()==B.GetSource() &&
+			A.GetSourceAux()==B.GetSourceAux() &&
+			A.GetCommunity()==B.GetCommunity();
+}
+
+
+bool RunTrial(const std::string & sLabel,bool bCompact,unsigned int nCompressAbove,
+		unsigned int nNotifications,unsigned int nBatch,double & dfBytesPerNotify)
+{
+	WireLink Link(bCompact,nCompressAbove);
+
+	unsigned int nReceived = 0;
+	unsigned int nBad = 0;
+
+	for(unsigned int n = 0;n<nNotifications;n+=nBatch)
+	{
+		MOOSMSG_LIST Mail;
+		for(unsigned int j = n;j<n+nBatch && j<nNotifications;j++)
+		{
+			CMOOSMsg M(MOOS_NOTIFY,"NODE_REPORT",NodeReport(j),1500000000.0+j*0.25);
+			M.m_sSrc = MOOSFormat("pNodeReporter_%d",j%8);
+			M.m_sSrcAux = "pNodeReporter";
+			M.m_sOriginatingCommunity = MOOSFormat("vehicle_%d",j%8);
+			Mail.push_back(M);
+		}
+
+		MOOSMSG_LIST Rx;
+		if(!Link.Send(Mail,Rx))
+			return MOOSFail("%s packet could not be read",sLabel.c_str());
+
+		if(Rx.size()!=Mail.size())
+			nBad+=Mail.size();
+
+		MOOSMSG_LIST::iterator q = Rx.begin();
+		for(MOOSMSG_LIST::iterator p = Mail.begin();p!=Mail.end() && q!=Rx.end();p++,q++)
+		{
+			if(!SameMessage(*p,*q))
+				nBad++;
+			nReceived++;
+		}
+	}
+
+	dfBytesPerNotify = double(Link.m_nBytes)/nNotifications;
+	std::cout<<std::setw(16)<<sLabel
+			<<std::setw(16)<<std::fixed<<std::setprecision(1)<<dfBytesPerNotify
+			<<std::setw(16)<<nBad<<"\n";
+
+	return nBad==0 && nReceived==nNotifications;
+}
+
+
+//a compressed packet whose body claims to unpack to an absurd size must be
+//refused rather than have the reader allocate that much
+bool TestBogusCompressedSize()
+{
+	MOOS::PktDictionary TxDictionary;
+	MOOSMSG_LIST Mail;
+	for(unsigned int n = 0;n<64;n++)
+		Mail.push_back(CMOOSMsg(MOOS_NOTIFY,"NODE_REPORT",NodeReport(n),0.0));
+
+	CMOOSCommPkt Tx;
+	Tx.Serialize(Mail,TxDictionary,true,1);
+
+	//the uncompressed size follows the length, message count and flags
+	unsigned int nSizeAt = 2*sizeof(int)+1;
+	std::vector<unsigned char> Bytes(Tx.Stream(),Tx.Stream()+Tx.GetStreamLength());
+	if(!(Bytes[nSizeAt-1] & MOOS_PKT_COMPRESSED))
+		return MOOSFail("test packet was not compressed");
+
+	int nBogus = 0x7fffffff;
+	if(!IsLittleEndian())
+		nBogus = SwapByteOrder<int>(nBogus);
+	memcpy(&Bytes[nSizeAt],&nBogus,sizeof(nBogus));
+
+	CMOOSCommPkt Rx;
+	Rx.Fill(&Bytes[0],Bytes.size());
+
+	MOOS::PktDictionary RxDictionary;
+	MOOSMSG_LIST Received;
+	bool bRefused = !Rx.Serialize(Received,RxDictionary,false);
+
+	std::cout<<"\nbogus uncompressed size refused: "<<(bRefused ? "yes" : "NO")<<"\n";
+	return bRefused;
+}
+
+
+int main(int argc, char * argv[])
+{
+	MOOS::CommandLineParser P(argc,argv);
+
+	if(P.GetFlag("-h","--help"))
+		PrintHelp();
+
+	unsigned int nNotifications = 2000;
+	unsigned int nBatch = 8;
+
+	P.GetVariable("--notifications",nNotifications);
+	P.GetVariable("--batch",nBatch);
+
+	if(nBatch==0)
+		nBatch = 1;
+	if(nNotifications==0)
+		nNotifications = 1;
+
+	std::cout<<nNotifications<<" NODE_REPORTs in packets of "<<nBatch<<"\n\n";
+	std::cout<<std::setw(16)<<"wire format"
+			<<std::setw(16)<<"bytes/notify"
+			<<std::setw(16)<<"bad deliveries"<<"\n";
+
+	double dfOriginal,dfCompact,dfCompressed;
+	bool bOK = RunTrial("original",false,0,nNotifications,nBatch,dfOriginal);
+	bOK = RunTrial("compact",true,0,nNotifications,nBatch,dfCompact) && bOK;
+
+	//interning the key, sources and community must save bytes
+	if(dfCompact>=dfOriginal)
+		bOK = MOOSFail("the compact wire format is no smaller than the original");
+
+	if(CMOOSCommPkt::SupportsCompression())
+	{
+		bOK = RunTrial("compressed",true,MOOS_PKT_COMPRESS_ABOVE,nNotifications,nBatch,dfCompressed) && bOK;
+		if(nBatch*dfCompact>MOOS_PKT_COMPRESS_ABOVE && dfCompressed>=dfCompact)
+			bOK = MOOSFail("compressing big compact packets did not make them smaller");
+		bOK = TestBogusCompressedSize() && bOK;
+	}
+
+	return bOK ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: ALogReader.h                                         */
+/*    DATE:                                                      */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef ALOG_READER_HEADER
+#define ALOG_READER_HEADER
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include "ALogEntry.h"
+
+//----------------------------------------------------------------
+// ALogLineView: One line of an alog file, held as pointers into the
+// reader's buffer rather than copied. The fields follow the rules
+// of getTimeStamp(), getVarName() etc. in LogUtils. A view is only
+// valid until the next call to ALogReader::nextLine().
+
+class ALogLineView
+{
+ public:
+  ALogLineView() {clear();}
+  ~ALogLineView() {}
+
+  void clear();
+  void set(const char *line, unsigned int len);
+
+  const char*  line() const     {return(m_line);}
+  unsigned int length() const   {return(m_len);}
+  bool         isEmpty() const  {return(m_len == 0);}
+  bool         isComment() const {return((m_len > 0) && (m_line[0]=='%'));}
+  bool         beginsWithDigit() const;
+
+  bool varIs(const std::string&) const;
+  bool getTimeVal(double&) const;
+
+  std::string getLine() const      {return(std::string(m_line, m_len));}
+  std::string getTimeStamp() const {return(std::string(m_line, m_tlen));}
+  std::string getVarName() const   {return(std::string(m_line+m_vix, m_vlen));}
+  std::string getSourceName() const;
+  std::string getSourceNameNoAux() const;
+  std::string getDataEntry() const {return(std::string(m_line+m_dix, m_dlen));}
+
+ protected:
+  const char*  m_line;
+  unsigned int m_len;
+
+  // Each field is an offset into m_line and a length. The time
+  // stamp always begins at offset zero.
+  unsigned int m_tlen;
+  unsigned int m_vix, m_vlen;
+  unsigned int m_six, m_slen;
+  unsigned int m_dix, m_dlen;
+};
+
+//----------------------------------------------------------------
+// ALogReader: Reads an alog file line by line without a call per
+// character. The file is memory mapped where supported, otherwise
+// read in large blocks.
+
+class ALogReader
+{
+ public:
+  ALogReader();
+  ~ALogReader();
+
+  bool open(const std::string& filename);
+  void close();
+  bool isOpen() const      {return(m_open);}
+  bool isMapped() const    {return(m_map != 0);}
+  void setUseMMap(bool v)  {m_use_mmap=v;}
+
+  // The whole file when memory mapped, e.g., for handing parts of
+  // it to several threads. Zero when not mapped.
+  const char* mapData() const {return(m_map);}
+  size_t      mapSize() const {return(m_map_size);}
+
+  bool nextLine(ALogLineView&);
+  bool nextLines(const char*& beg, size_t& len, size_t amt);
+  void release(const char* beg, size_t len);
+
+  // Drop-in replacements for the FILE* based functions in LogUtils
+  std::string getNextRawLine();
+  ALogEntry   getNextRawALogEntry(bool allstrings=false);
+
+ protected:
+  bool nextLine(const char*& line, unsigned int& len);
+  bool refill();
+
+ private: // Not copyable, the reader owns its mapping or buffer
+  ALogReader(const ALogReader&);
+  ALogReader& operator=(const ALogReader&);
+
+ protected:
+  bool   m_open;
+  bool   m_use_mmap;
+
+  // Memory mapped mode
+  char*  m_map;
+  size_t m_map_size;
+  size_t m_map_pos;
+
+  // Block read mode
+  FILE*             m_file;
+  std::vector<char> m_buff;
+  size_t            m_buff_beg;
+  size_t            m_buff_end;
+  bool              m_file_eof;
+};
+
+#endif
@@ -0,0 +1,53 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin, Henrik Schmidt, and John Leonard   */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: ALogScanner.h                                        */
+/*    DATE: June 3rd, 2008                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef ALOG_SCANNER_HEADER
+#define ALOG_SCANNER_HEADER
+
+#include <vector>
+#include <map>
+#include <string>
+#include "ScanReport.h"
+#include "ALogReader.h"
+
+class ALogScanner
+{
+ public:
+  ALogScanner() {}
+  ~ALogScanner() {}
+
+  bool       openALogFile(std::string);
+  ScanReport scan();
+
+ private:
+  ALogReader m_reader;
+};
+
+#endif 
+
+
+
+
+
+
+
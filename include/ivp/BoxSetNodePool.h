@@ -0,0 +1,55 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: BoxSetNodePool.h                                     */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+ 
+#ifndef BOXSETNODE_POOL_HEADER
+#define BOXSETNODE_POOL_HEADER
+
+#include "BoxSetNode.h"
+
+// A free-list of BoxSetNodes. A BoxSet given a pool takes its nodes
+// from the pool and returns them when removed, rather than going to
+// the heap each time. Once warmed up to the high-water mark of nodes
+// in use, a pool allows repeated filling and emptying of BoxSets 
+// with no further heap allocations, e.g., during the IvP solve.
+
+class BoxSetNodePool {
+public:
+  BoxSetNodePool();
+  ~BoxSetNodePool();
+
+  BoxSetNode* getBSN(IvPBox*);
+  void        putBSN(BoxSetNode*);
+  void        reserve(unsigned int);
+
+  unsigned int getFreeCount() const  {return(m_free_count);}
+  unsigned int getAllocCount() const {return(m_alloc_count);}
+
+private:
+  BoxSetNode   *m_free;
+  unsigned int  m_free_count;
+  unsigned int  m_alloc_count;
+};
+
+#endif
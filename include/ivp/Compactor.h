@@ -0,0 +1,54 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: Compactor.h                                          */
+/*    DATE: June 13, 2004                                        */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef COMPACTOR_HEADER
+#define COMPACTOR_HEADER
+
+#include "IvPBox.h" 
+
+class Compactor {
+public:
+  Compactor() {}
+  virtual ~Compactor() {}
+
+  virtual bool   compact(IvPBox*)       = 0;
+  virtual double maxVal(IvPBox*, bool*) = 0;
+};
+#endif
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
@@ -0,0 +1,57 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: CompactorNull.h                                      */
+/*    DATE: June 13, 2004                                        */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef COMPACTOR_NULL_HEADER
+#define COMPACTOR_NULL_HEADER
+
+#include "Compactor.h"
+
+class CompactorNull: public Compactor {
+public:
+  CompactorNull() {}
+  virtual ~CompactorNull() {}
+
+  bool compact(IvPBox*) 
+    {return(true);}
+
+  double maxVal(IvPBox *b, bool *ok)
+    {*ok=true; return(b->maxVal());}
+};
+#endif
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
@@ -0,0 +1,215 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin, Henrik Schmidt, and John Leonard   */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: HelmReport.h                                         */
+/*    DATE: Sep 26th, 2006                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef HELM_REPORT_HEADER
+#define HELM_REPORT_HEADER
+
+#include <map>
+#include <vector>
+#include <list>
+#include <deque>
+#include <string>
+#include "IvPDomain.h"
+
+// A message of the report. For a report of the function made by a
+// behavior, only the numbers are kept. The text is made only if the
+// messages are asked for.
+struct HelmReportMsg
+{
+  std::string text;
+  bool        bhv_msg;
+  bool        produced;
+  double      cpu_time;
+  double      pcs;
+  double      pwt;
+};
+
+class HelmReport {
+public:
+  HelmReport();
+  ~HelmReport() {}
+
+  void  initialize();
+  void  clear(bool clear_completed=false);
+  void  addMsg(const std::string& str);
+  void  addBhvMsg(const std::string& descriptor, double cpu_time,
+		  double pcs, double pwt);
+  void  addBhvMsg(const std::string& descriptor);
+  void  setHaltMsg(const std::string& str) {m_halt_message = str;}
+  
+  void  clearActiveBHVs();
+  void  addActiveBHV(const std::string& descriptor, double time,
+		     double pwt, int pcs, double cpu,
+		     const std::string& update_summary, 
+		     unsigned int ipfs, double wall=0);
+
+  void  clearRunningBHVs();
+  void  addRunningBHV(const std::string& descriptor, double time,
+		      const std::string& update_summary);
+
+  void  clearIdleBHVs();
+  void  addIdleBHV(const std::string& descriptor, double time,
+		   const std::string& updated_summary);
+
+  void  clearCompletedBHVs();
+  void  addCompletedBHV(const std::string& descriptor, double time,
+			const std::string& update_summary);
+
+  void  setModeSummary(const std::string& s) {m_modes=s;}
+  void  setIvPDomain(const IvPDomain &dom);
+  void  setTimeUTC(double v)                 {m_time_utc = v;}
+  void  setWarningCount(unsigned int v)      {m_warning_count = v;}
+  void  setHalted(bool v)                    {m_halted=v;}
+  void  setIteration(unsigned int iter)      {m_iteration=iter;}
+  void  setOFNUM(unsigned int ofnum)         {m_ofnum=ofnum;}
+  void  setCreateTime(double t)              {m_create_time=t;}
+  void  setSolveTime(double t)               {m_solve_time=t;}
+  void  setMaxLoopTime(double t)             {m_max_loop_time=t;}
+  void  setMaxCreateTime(double t)           {m_max_create_time=t;}
+  void  setMaxSolveTime(double t)            {m_max_solve_time=t;}
+  void  setOFCacheHits(unsigned int v)       {m_ofcache_hits=v;}
+  void  setOFCacheMisses(unsigned int v)     {m_ofcache_misses=v;}
+
+  void  clearDecisions();
+  void  addDecision(const std::string &var, double val);
+
+  // Getters
+  unsigned int getWarnings()   const  {return(m_warning_count);}
+  unsigned int getIteration()  const  {return(m_iteration);}
+  unsigned int getOFNUM()      const  {return(m_ofnum);}
+  double       getTimeUTC()    const  {return(m_time_utc);}
+  double       getCreateTime() const  {return(m_create_time);}
+  double       getSolveTime()  const  {return(m_solve_time);}
+  double       getLoopTime()   const  {return(m_solve_time+m_create_time);}
+  bool         getHalted()     const  {return(m_halted);}
+  double       getMaxLoopTime() const {return(m_max_loop_time);}
+  double       getMaxSolveTime()  const {return(m_max_solve_time);}
+  double       getMaxCreateTime() const {return(m_max_create_time);}
+  unsigned int getOFCacheHits()   const {return(m_ofcache_hits);}
+  unsigned int getOFCacheMisses() const {return(m_ofcache_misses);}
+
+  double       getDecision(const std::string&) const;
+  bool         hasDecision(const std::string&) const;
+
+  bool         changedBehaviors(const HelmReport&) const;
+  bool         changedActiveBHVs(const HelmReport&) const;
+  bool         changedRunningBHVs(const HelmReport&) const;
+  bool         changedIdleBHVs(const HelmReport&) const;
+  bool         changedCompletedBHVs(const HelmReport&) const;
+
+  std::string  getModeSummary()      const {return(m_modes);}
+  std::string  getHaltMsg()          const {return(m_halt_message);}
+  std::vector<std::string> getMsgs() const;
+
+  // Serialization Helper Methods
+  std::string  getDecisionSummary()    const;
+  std::string  getActiveBehaviors(bool full=true)    const;
+  std::string  getRunningBehaviors(bool full=true)   const;
+  std::string  getIdleBehaviors(bool full=true)      const;
+  std::string  getCompletedBehaviors(bool full=true) const;
+  std::string  getDomainString()       const;
+  std::string  timeInState(double, double) const;
+
+  // Serialization Methods
+  std::string  getReportAsString() const;
+  std::string  getReportAsString(const HelmReport&, bool full=false) const;
+
+  // Formatted Summary
+  std::list<std::string> formattedSummary(double, bool=false) const;
+
+  // Debugging
+  void print() const;
+
+protected:
+  bool  sameActiveBHVs(const HelmReport&, bool full) const;
+  bool  sameRunningBHVs(const HelmReport&, bool full) const;
+  bool  sameIdleBHVs(const HelmReport&, bool full) const;
+  bool  sameCompletedBHVs(const HelmReport&, bool full) const;
+  bool  sameDecisions(const HelmReport&) const;
+  void  clearText(int ix);
+
+protected:
+
+  std::vector<std::string>  m_bhvs_running_desc;   // Running Behaviors
+  std::vector<double>       m_bhvs_running_time;
+  std::vector<std::string>  m_bhvs_running_upds;
+  
+  std::vector<std::string>  m_bhvs_idle_desc;      // Idle Behaviors
+  std::vector<double>       m_bhvs_idle_time;
+  std::vector<std::string>  m_bhvs_idle_upds;
+  
+  std::deque<std::string>   m_bhvs_completed_desc; // Completed Behaviors
+  std::deque<double>        m_bhvs_completed_time;
+  std::deque<std::string>   m_bhvs_completed_upds;
+  
+  std::vector<std::string>  m_bhvs_active_desc;    // Active Behaviors
+  std::vector<double>       m_bhvs_active_time;
+  std::vector<std::string>  m_bhvs_active_upds;
+  std::vector<double>       m_bhvs_active_pwt;
+  std::vector<double>       m_bhvs_active_cpu;
+  std::vector<double>       m_bhvs_active_wall;
+  std::vector<int>          m_bhvs_active_pcs;
+  std::vector<unsigned int> m_bhvs_active_ipfs;
+
+
+  std::vector<HelmReportMsg>    m_messages;
+  std::map<std::string, double> m_decisions;  // +
+
+  std::string   m_halt_message;    // +
+  std::string   m_modes;           // +
+  
+  unsigned int  m_warning_count;   // +
+  double        m_time_utc;        // +
+  unsigned int  m_iteration;       // +
+  unsigned int  m_ofnum;           // +
+  double        m_create_time;     // + 
+  double        m_solve_time;      // + 
+  bool          m_halted;          // +
+
+  double        m_max_create_time;
+  double        m_max_solve_time;
+  double        m_max_loop_time;
+
+  unsigned int  m_ofcache_hits;    // Cumulative behavior IPF cache hits
+  unsigned int  m_ofcache_misses;
+
+  IvPDomain     m_domain;          // referenced for varbalk info
+
+  // The serialized parts of the report, made only when first asked
+  // for, and kept until the part is changed. Kept also in a copy, so
+  // a report compared against on the next iteration is not redone.
+  enum {TXT_ACTIVE, TXT_ACTIVE_LIST, TXT_RUNNING, TXT_RUNNING_LIST,
+	TXT_IDLE, TXT_IDLE_LIST, TXT_COMPLETED, TXT_COMPLETED_LIST, 
+	TXT_DECISIONS, TXT_DOMAIN, TXT_COUNT};
+
+  mutable std::string m_text[TXT_COUNT];
+  mutable bool        m_text_ok[TXT_COUNT];
+};
+
+#endif
+
+
+
+
+
+
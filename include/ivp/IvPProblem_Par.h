@@ -0,0 +1,133 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: IvPProblem_Par.h                                     */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+ 
+#ifndef IVPPROBLEM_PAR_HEADER
+#define IVPPROBLEM_PAR_HEADER
+
+#include <vector>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+#include "IvPProblem.h"
+
+class IvPProblem_Par;
+
+// Per-thread search state. Each worker owns its own node boxes,
+// candidate lists and grid index scratch space so that the shared
+// objective functions and grids are only ever read.
+class IvPParWorker {
+public:
+  IvPParWorker() {problem=0; index=0; ixbuf=0;}
+
+  IvPProblem_Par*                    problem;
+  unsigned int                       index;
+  std::vector<IvPBox*>               node_box;
+  std::vector<std::vector<IvPBox*> > level_boxes;
+  long*                              ixbuf;
+
+  bool    have_local;
+  double  local_wt;
+  IvPBox* local_box;
+};
+
+// One thread of the pool. It lives as long as the problem and
+// searches with the worker of the same index on each solve.
+class IvPParThread {
+public:
+  IvPParThread() {problem=0; index=0; seen=0;}
+
+  IvPProblem_Par* problem;
+  unsigned int    index;
+  unsigned long   seen;     // Last solve generation handled
+#ifndef _WIN32
+  pthread_t       tid;
+#endif
+};
+
+class IvPProblem_Par: public IvPProblem {
+public:
+  IvPProblem_Par(unsigned int threads=2, Compactor *c=0);
+  ~IvPProblem_Par();
+
+  bool solve(const IvPBox *isolbox=0);
+
+  void         setThreads(unsigned int v) {m_threads=v;}
+  unsigned int getThreads() const         {return(m_threads);}
+
+  // Workers are handed first-level subtrees by index. Public only so
+  // the thread entry point can reach it.
+  void   workerLoop(IvPParWorker&);
+  void   poolLoop(IvPParThread&);
+
+protected:
+  unsigned int startPool(unsigned int);
+  void   stopPool();
+  void   runPool(unsigned int);
+  void   clearWorkers();
+
+  void   solveSubtree(int, IvPParWorker&);
+  void   solveRecurseMT(int, IvPParWorker&);
+  double upperCheapBoundMT(int, IvPBox*, IvPParWorker&);
+
+  void   raiseSharedBound(double);
+  double getSharedBound() const;
+  int    claimNextSubtree();
+
+  void   mergeSubtreeResults();
+  void   clearSubtreeResults();
+
+protected:
+  unsigned int m_threads;
+
+  // Shared among workers without locks. The bound is only raised,
+  // via compare-and-swap, and is only used for strict pruning.
+  double       m_shared_wt;
+  int          m_next_subtree;
+  int          m_subtree_count;
+
+  // Best solution found within each first-level subtree, indexed by
+  // the box index in m_ofs[0]. Merged in index order after the
+  // search so the decision matches the serial solver.
+  std::vector<double>  m_subtree_wt;
+  std::vector<IvPBox*> m_subtree_box;
+
+  // Threads are started on the first parallel solve and kept until
+  // the problem is deleted. On each solve the calling thread is
+  // worker zero and pool thread i runs worker i, if i is in use.
+  std::vector<IvPParWorker>  m_workers;
+  std::vector<long>          m_ixbufs;
+  std::vector<IvPParThread*> m_pool;
+#ifndef _WIN32
+  pthread_mutex_t m_pool_mutex;
+  pthread_cond_t  m_pool_start;   // Signalled when a solve begins
+  pthread_cond_t  m_pool_done;    // Signalled as threads finish
+#endif
+  unsigned long   m_pool_generation;
+  unsigned int    m_pool_workers;  // Workers in use this solve
+  unsigned int    m_pool_busy;     // Pool threads not yet finished
+  bool            m_pool_quit;
+};  
+
+#endif
@@ -0,0 +1,123 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin, Henrik Schmidt, and John Leonard   */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: LogicCondition.h                                     */
+/*    DATE: October 2006                                         */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifdef _WIN32
+#pragma warning(disable : 4786)
+#pragma warning(disable : 4503)
+#endif
+
+#ifndef LOGIC_CONDITION_HEADER
+#define LOGIC_CONDITION_HEADER
+
+#include <string>
+#include <vector>
+#include "ParseNode.h"
+
+// A variable of a condition. As in ParseNode, a variable set with a
+// string value may not then be set with a double, and vice versa.
+struct LogicVar
+{
+  std::string name;
+  std::string sval;    // As given
+  std::string sval_x;  // As compared: stripped of any quotes
+  double      dval;    // The double value, or sval_x if a number
+  bool        sval_isnum;
+  bool        sval_set;
+  bool        dval_set;
+};
+
+// One step of a compiled condition, in postfix order
+enum LogicOpcode  {LOP_CMP, LOP_AND, LOP_OR, LOP_NOT, LOP_FALSE};
+enum LogicRelOp   {LREL_EQ, LREL_FIELD_EQ, LREL_NE, LREL_LT, LREL_LE, 
+		   LREL_GT, LREL_GE, LREL_NONE};
+enum LogicOperand {LOPD_VAR, LOPD_STRING, LOPD_DOUBLE};
+
+struct LogicInstr
+{
+  LogicOpcode  opcode;
+  LogicRelOp   relop;
+  unsigned int left_var;
+  LogicOperand right_type;
+  unsigned int right_var;
+  std::string  right_sval;  // Literal, stripped of any quotes
+  double       right_dval;  // Literal double, or right_sval if a number
+  bool         right_isnum;
+};
+
+class LogicCondition {
+public:
+  LogicCondition();
+  
+  LogicCondition(const LogicCondition&);
+
+  ~LogicCondition();
+  
+  const LogicCondition &operator=(const LogicCondition&);
+
+  bool setCondition(const std::string&);
+  void setAllowDoubleEquals(bool v) {m_allow_dblequals=v;}
+
+  std::string getRawCondition() const {
+    if(m_node) 
+      return(m_node->getRawCondition());
+    else
+      return("");
+  }
+  
+  std::vector<std::string> getVarNames() const;
+  
+  void clearVarVals();
+  void setVarVal(const std::string& var, const std::string& val);
+  void setVarVal(const std::string& var, double val);
+
+  // Variables by index, for callers that resolve the names once
+  unsigned int getVarCount() const {return(m_vars.size());}
+  int  getVarIndex(const std::string&) const;
+  void setVarValByIx(unsigned int ix, const std::string& val);
+  void setVarValByIx(unsigned int ix, double val);
+
+  bool eval() const;
+  
+  void print() const;
+
+protected:
+  bool compile();
+  bool compileNode(const ParseNode*);
+  bool evalCompare(const LogicInstr&) const;
+
+protected:
+  ParseNode *m_node;
+
+  bool  m_allow_dblequals;
+
+  // The condition compiled by setCondition(). The result of eval()
+  // is kept until a variable takes on a new value.
+  std::vector<LogicVar>   m_vars;
+  std::vector<LogicInstr> m_program;
+
+  mutable std::vector<char> m_stack;
+  mutable bool m_result_known;
+  mutable bool m_result;
+};
+
+#endif
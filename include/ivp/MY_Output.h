@@ -0,0 +1,50 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin, Henrik Schmidt, and John Leonard   */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: MY_Output.h                                          */
+/*    DATE: December 2004                                        */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef MY_FLTK_OUTPUT_HEADER
+#define MY_FLTK_OUTPUT_HEADER
+
+#include <FL/Fl.H>
+#include <FL/Fl_Output.H>
+
+class MY_Output : public Fl_Output {
+public:
+  MY_Output(int x, int y, int w, int h, const char *l=0) :
+    Fl_Output(x, y, w, h, l) {}
+
+  int  handle(int event) {return(0);}
+};
+#endif
+
+
+
+
+
+
+
+
+
+
+
+
+
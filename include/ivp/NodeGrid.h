@@ -0,0 +1,71 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: NodeGrid.h                                           */
+/*    DATE:                                                      */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef NODE_GRID_HEADER
+#define NODE_GRID_HEADER
+
+#include <string>
+#include <vector>
+#include <map>
+
+// A uniform grid over the most recent x,y positions of a set of
+// named nodes. Rebuilt once per iteration by apps that do pairwise
+// checks (uFldCollisionDetect, uFldNodeComms) so that only nodes 
+// within a given range of one another need be considered.
+
+class NodeGrid
+{
+public:
+  NodeGrid(double cell_size=100);
+  ~NodeGrid() {}
+
+  void   clear();
+  bool   setCellSize(double);
+  void   addNode(const std::string& name, double x, double y);
+
+  // Names of all nodes within range of x,y, in insertion order
+  std::vector<std::string> getNodesWithin(double x, double y, 
+					  double range) const;
+
+  void   getNodesWithin(double x, double y, double range, 
+			std::vector<std::string>& names) const;
+  
+  double getCellSize() const {return(m_cell_size);}
+  unsigned int size() const  {return(m_names.size());}
+  unsigned int cells() const {return(m_cells.size());}
+
+protected:
+  int    cellIndex(double) const;
+
+protected:
+  double m_cell_size;
+
+  std::vector<std::string> m_names;
+  std::vector<double>      m_xpos;
+  std::vector<double>      m_ypos;
+
+  // Keyed on (column, row). Values are indices into the vectors above
+  std::map<std::pair<int,int>, std::vector<unsigned int> > m_cells;
+};
+
+#endif 
@@ -0,0 +1,66 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin, Henrik Schmidt, and John Leonard   */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: RT_AutoPeak.h                                        */
+/*    DATE: June 21, 2008                                        */
+/*    NOTE: "RT_" stands for "Reflector Tool"                    */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifdef _WIN32
+#pragma warning(disable : 4786)
+#pragma warning(disable : 4503)
+#endif
+#ifndef RT_AUTOPEAK_HEADER
+#define RT_AUTOPEAK_HEADER
+
+#include "PDMap.h"
+#include "PQueue.h"
+
+class Regressor;
+class RT_AutoPeak {
+public:
+  RT_AutoPeak(Regressor*);
+  virtual ~RT_AutoPeak() {}
+
+public: 
+  PDMap* create(PDMap*, int max_more_pcs=-1);
+
+protected:
+  Regressor* m_regressor;
+};
+
+#endif
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
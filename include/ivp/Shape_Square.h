@@ -0,0 +1,42 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin, Henrik Schmidt, and John Leonard   */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: Shape_Square.h                                       */
+/*    DATE: July 6th 2008                                        */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+double g_squareBody[]=
+{
+   10.0,   10.0, 
+  -10.0,  10.0, 
+  -10.0,  -10.0, 
+  10.0,  -10.0, 
+  10.0,   10.0, 
+};
+
+double       g_squareCtrX     = 0.0;
+double       g_squareCtrY     = 0.0;
+unsigned int g_squareBodySize = 5;
+double       g_squareWidth    = 20;
+
+
+
+
+
+
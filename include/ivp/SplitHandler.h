@@ -0,0 +1,141 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin, Henrik Schmidt, and John Leonard   */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: SplitHandler.h                                       */
+/*    DATE: Feb 2nd, 2015                                        */
+/*****************************************************************/
+
+#ifndef ALOG_SPLIT_HANDLER_HEADER
+#define ALOG_SPLIT_HANDLER_HEADER
+
+#include <vector>
+#include <string>
+#include <map>
+#include <set>
+#include <list>
+#include <cstdio>
+#include "ALogReader.h"
+
+//----------------------------------------------------------------
+// SplitVarData: What one chunk of the alog file holds for one
+// variable: the lines to write to its klog file, whether any value 
+// is non-numeric, and the sources that posted it.
+
+struct SplitVarData
+{
+  SplitVarData() {is_string=false;}
+
+  std::string           lines;
+  bool                  is_string;
+  std::set<std::string> srcs;
+};
+
+//----------------------------------------------------------------
+// SplitChunk: A run of whole lines of the alog file, split by one
+// worker thread, and the results kept until merged in file order.
+
+struct SplitChunk
+{
+  SplitChunk() {blog_file=0; clear();}
+  void clear();
+
+  const char* beg;
+  const char* end;
+  std::string data;   // Owned copy of the lines if file not mapped
+  std::vector<const char*> skips;  // LOGSTART lines, not split
+
+  // Helm iteration as of the chunk start, if known, else as of the
+  // first IVPHELM_ITER in the chunk. BHV_IPF lines needing it before
+  // then are held in pending until the chunk is merged.
+  bool        iter_known;
+  std::string helm_iter;
+  std::vector<std::string> pending;
+
+  std::map<std::string, SplitVarData> vars;
+  std::set<std::string> bhv_names;
+
+  std::string time_min;
+  std::string time_max;
+  std::string vname;
+  std::vector<std::string> vtypes;   // NODE_REPORT_LOCAL type and
+  std::vector<std::string> vlengths; // length, up to first type
+
+  // Binary log (.blog) holding MOOS_BINARY_STRING postings
+  FILE*       blog_file;
+  std::string blog_name;
+};
+
+class SplitHandler
+{
+ public:
+  SplitHandler(std::string);
+  ~SplitHandler() {}
+
+  bool handle();
+  bool handlePreCheckALogFile();
+  void setVerbose(bool v)          {m_verbose=v;}
+  void setDirectory(std::string s) {m_given_dir=s;}
+  void setThreads(unsigned int v)  {m_threads=(v>0)?v:1;}
+  void setMaxOpenFiles(unsigned int v) {m_max_open=(v>0)?v:1;}
+  
+ protected:
+  bool handlePreCheckSplitDir();
+  bool handleMakeSplitFiles();
+  bool handleMakeSplitSummary();
+
+  bool readChunk(ALogReader&, SplitChunk&);
+  void splitChunks(std::vector<SplitChunk>&, unsigned int count);
+  void splitLine(const ALogLineView&, SplitChunk&) const;
+  void splitHelmLine(const ALogLineView&, SplitChunk&) const;
+  void addLine(SplitChunk&, const std::string& var, 
+	       const ALogLineView&, const std::string& line) const;
+  bool mergeChunk(SplitChunk&);
+  bool mergeResults(const SplitChunk&);
+
+  bool writeKLog(const std::string& var, const std::string& lines);
+  bool flushKLog(const std::string& var);
+  bool closeKLogs();
+
+  std::string readBinaryEntry(const std::string&, SplitChunk&) const;
+
+ public: // Called on the worker threads
+  void splitChunk(SplitChunk&) const;
+  
+ protected: // Config variables
+  std::string  m_alog_file;
+  std::string  m_given_dir;
+  bool         m_verbose;
+  unsigned int m_threads;
+  unsigned int m_max_open;
+  unsigned int m_chunk_size;
+  unsigned int m_klog_buff_size;
+
+ protected: // State variables
+  std::string m_basedir;
+  std::string m_logstart;
+  std::string m_time_min;
+  std::string m_time_max;
+  std::string m_vname;
+  std::string m_vtype;
+  std::string m_vlength;
+
+  bool m_alog_file_confirmed;
+
+  bool m_split_dir_prior;
+
+  std::string m_curr_helm_iter;
+
+  // Each map key is a MOOS variable name. Lines are buffered per 
+  // variable and at most m_max_open klog files are kept open.
+  std::map<std::string, std::string> m_klog_buff;
+  std::map<std::string, FILE*>       m_file_ptr;
+  std::list<std::string>             m_open_order;
+  std::map<std::string, std::string> m_var_type;
+  std::map<std::string, std::set<std::string> > m_var_srcs;
+
+  // Keep track of all unique bhv names for summary file
+  std::set<std::string> m_bhv_names;
+};
+
+#endif
+
@@ -0,0 +1,121 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: StrView.h                                            */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef STR_VIEW_HEADER
+#define STR_VIEW_HEADER
+
+#include <string>
+
+//----------------------------------------------------------------
+// StrView: A read-only view of part of a string, a pointer and a
+// length, for parsing without making copies. The viewed string must
+// outlive the view. The functions mirror those in MBUtils of the
+// same name, e.g., stripBlankEnds() removes blanks and tabs.
+
+class StrView
+{
+ public:
+  StrView() : m_str(""), m_len(0) {}
+  StrView(const char *str, unsigned int len) : m_str(str), m_len(len) {}
+  StrView(const std::string& str) : m_str(str.c_str()), m_len(str.size()) {}
+  StrView(const char *str);
+
+  const char*  data() const   {return(m_str);}
+  unsigned int length() const {return(m_len);}
+  bool         empty() const  {return(m_len == 0);}
+  char operator[](unsigned int ix) const {return(m_str[ix]);}
+
+  std::string str() const {return(std::string(m_str, m_len));}
+
+  bool operator==(const StrView&) const;
+  bool operator!=(const StrView& sv) const {return(!(*this == sv));}
+  bool equalsNoCase(const StrView&) const;
+
+  bool contains(char) const;
+  int  find(char c, unsigned int start=0) const;
+
+  StrView substr(unsigned int ix, unsigned int len) const;
+  StrView stripBlankEnds() const;
+  StrView biteString(char);
+  StrView biteStringX(char);
+
+  // As isNumber() then atof(), false if not a number
+  bool   toDouble(double&) const;
+  // As atof(), zero if no number leads the view
+  double atof() const;
+
+ protected:
+  const char*  m_str;
+  unsigned int m_len;
+};
+
+//----------------------------------------------------------------
+// StrSplitter: The tokens of parseString(str, sep) in turn, as views
+// into str. With protect set, a separator within double quotes or
+// curly braces is skipped over, as in parseStringQ(str, sep).
+//   Example: StrSplitter splitter(str, ',');
+//            StrView tok;
+//            while(splitter.next(tok))  ...
+
+class StrSplitter
+{
+ public:
+  StrSplitter(const StrView& str, char sep, bool protect=false);
+  ~StrSplitter() {}
+
+  bool next(StrView&);
+
+ protected:
+  StrView      m_str;
+  char         m_sep;
+  bool         m_protect;
+  unsigned int m_pos;
+  bool         m_in_quotes;
+  unsigned int m_brace_count;
+};
+
+//----------------------------------------------------------------
+// StrParamIter: The param=value pairs of a string in turn, as in
+// the common idiom below, but without the vector or any copies. The
+// param and value have their blank ends removed. A token with no
+// equals sign gives the whole token as the param and an empty value.
+//   Legacy:  vector<string> svector = parseString(str, ',');
+//            for(i=0; i<svector.size(); i++) {
+//              string param = biteStringX(svector[i], '=');
+//              string value = svector[i];
+
+class StrParamIter
+{
+ public:
+  StrParamIter(const StrView& str, char sep=',', char eq='=', 
+	       bool protect=false);
+  ~StrParamIter() {}
+
+  bool next(StrView& param, StrView& value);
+
+ protected:
+  StrSplitter m_splitter;
+  char        m_eq;
+};
+
+#endif
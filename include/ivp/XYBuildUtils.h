@@ -0,0 +1,40 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin, Henrik Schmidt, and John Leonard   */
+/*    ORGN: Dept of Mechanical Eng / CSAIL, MIT Cambridge MA     */
+/*    FILE: XYBuildUtils.h                                       */
+/*    DATE: May 16, 2008 Sunday afternoon at Brueggers           */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+ 
+#ifndef XY_BUILD_UTILS_HEADER
+#define XY_BUILD_UTILS_HEADER
+
+#include "XYFormatUtilsPoint.h"
+#include "XYFormatUtilsPoly.h"
+#include "XYFormatUtilsSegl.h"
+
+XYPolygon stringToPoly(std::string s)    {return(string2Poly(s));}
+XYPoint   stringToPoint(std::string s)   {return(string2Point(s));}
+XYSegList stringToSegList(std::string s) {return(string2SegList(s));}
+
+#endif
+
+
+
+
+
@@ -24,6 +24,7 @@
 #include <cstdio>
 #include "LogChecker.h"
 #include "MBUtils.h"
+#include "ALogReader.h"
 
 using namespace std;
 
@@ -155,9 +156,9 @@ bool LogChecker::check(string alogfile, string output_file)
   } 
   
   // Open the alogfile
-  FILE* m_alogfile = fopen(alogfile.c_str(), "r");
+  ALogReader alog_reader;
   // Check if the alogfile was able to be opened
-  if(!m_alogfile) {
+  if(!alog_reader.open(alogfile)) {
     fprintf( stdout, "Input file not found or unable to open.\n");
     fprintf( stdout, "Exiting now.\n");
     return(false);
@@ -184,13 +185,10 @@ bool LogChecker::check(string alogfile, string output_file)
   // Read in lines from the alog file looking for the start condition
   while( !start_satisfied ){
     // Get a ling from the log file
-    ALogEntry entry = getNextRawALogEntry(m_alogfile);
+    ALogEntry entry = alog_reader.getNextRawALogEntry();
     // Check if the end of the file has been reached.
     if(entry.getStatus() == "eof" ){
-      if(m_alogfile){
-	fclose(m_alogfile);
-	m_alogfile = NULL;
-      }
+      alog_reader.close();
       return false;
     } else {
       // A valid entry has been parsed - Update the info buffer
@@ -227,7 +225,7 @@ bool LogChecker::check(string alogfile, string output_file)
   // Read in lines from the alog file looking for the pass/fail flags
   while(!end_satisfied) {
     // Get a ling from the log file
-    ALogEntry entry = getNextRawALogEntry(m_alogfile);
+    ALogEntry entry = alog_reader.getNextRawALogEntry();
     // Check if the end of the file has been reached.
     if(entry.getStatus() == "eof")
       break;
@@ -244,10 +242,7 @@ bool LogChecker::check(string alogfile, string output_file)
   } 
   
   // Close the alog file
-  if(m_alogfile) {
-    fclose(m_alogfile);
-    m_alogfile = NULL;
-  } 
+  alog_reader.close();
   
   // Return true if the pass conditions have been satisfied and the
   // fail conditions have NOT been satisfied
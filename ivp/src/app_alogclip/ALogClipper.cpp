@@ -34,7 +34,6 @@ using namespace std;
 
 ALogClipper::ALogClipper()
 {
-  m_infile  = 0;
   m_outfile = 0;
 
   m_kept_chars          = 0;
@@ -51,73 +50,37 @@ ALogClipper::ALogClipper()
 
 unsigned int ALogClipper::clip(double min_time, double max_time)
 {
-  while(m_infile) {
-    string line = getNextLine();
-
-    string linecopy  = line;    
-    string timestr   = biteString(linecopy, ' ');
-    double timestamp = atof(timestr.c_str());
+  ALogLineView view;
+  while(m_reader.nextLine(view)) {
+    double timestamp = 0;
+    if(!view.getTimeVal(timestamp))
+      timestamp = atof(view.getTimeStamp().c_str());
     
-    if(timestr[0] == '%')
-      writeNextLine(line);
+    if(view.isComment())
+      writeNextLine(view.getLine());
     else if(timestamp < min_time) {
-      m_clipped_chars_front += line.length();
+      m_clipped_chars_front += view.length();
       m_clipped_lines_front += 1;
     }
     else if(timestamp > max_time) {
-      m_clipped_chars_back += line.length();
+      m_clipped_chars_back += view.length();
       m_clipped_lines_back += 1;
     }
     else {
-      m_kept_chars += line.length();
+      m_kept_chars += view.length();
       m_kept_lines += 1;
-      writeNextLine(line);
+      writeNextLine(view.getLine());
     }
   }
 
+  m_reader.close();
   if(m_outfile)
     fclose(m_outfile);
   return(m_clipped_lines_front + m_clipped_lines_back);
 }
 
 //--------------------------------------------------------
-// Procedure: getNextLine
-//     Notes: 
-
-string ALogClipper::getNextLine()
-{
-  if(!m_infile)
-    return("");
-  
-  const int MAX_LINE_LENGTH = 50000;
-
-  int  myint   = '\0';
-  int  buffix  = 0;
-  bool EOL     = false;
-  char buff[MAX_LINE_LENGTH];
-
-  while((!EOL) && (buffix < MAX_LINE_LENGTH)) {
-    myint = fgetc(m_infile);
-    unsigned char mychar = myint;
-    switch(myint) {
-    case EOF:
-      fclose(m_infile);
-      m_infile = 0;
-    case '\n':
-      buff[buffix] = '\0';  // attach terminating NULL
-      EOL = true;
-      break;
-    default:
-      buff[buffix] = mychar;
-      buffix++;
-    }
-  }
-  string str = buff;
-  return(str);
-}
-
-//--------------------------------------------------------
-// Procedure: getNextLine
+// Procedure: writeNextLine
 //     Notes: 
 
 bool ALogClipper::writeNextLine(const string& line)
@@ -135,14 +98,7 @@ bool ALogClipper::writeNextLine(const string& line)
 
 bool ALogClipper::openALogFileRead(string alogfile)
 {
-  if(m_infile)
-    fclose(m_infile);
-
-  m_infile = fopen(alogfile.c_str(), "r");
-  if(!m_infile)
-    return(false);
-  else
-    return(true);
+  return(m_reader.open(alogfile));
 }
 
 //--------------------------------------------------------
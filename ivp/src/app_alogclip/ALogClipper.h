@@ -25,6 +25,8 @@
 #define ALOG_CLIPPER_HEADER
 
 #include <string>
+#include <cstdio>
+#include "ALogReader.h"
 
 class ALogClipper
 {
@@ -39,7 +41,6 @@ class ALogClipper
   unsigned int getDetails(const std::string& statevar);
 
  protected:
-  std::string getNextLine();
   bool        writeNextLine(const std::string& output);
 
   unsigned int m_kept_chars;
@@ -50,8 +51,8 @@ class ALogClipper
   unsigned int m_clipped_lines_back;
 
  private:
-  FILE *m_infile;
-  FILE *m_outfile;
+  ALogReader m_reader;
+  FILE      *m_outfile;
 };
 
 #endif 
@@ -38,7 +38,6 @@ using namespace std;
 
 GrepHandler::GrepHandler()
 {
-  m_file_in  = 0;
   m_file_out = 0;
 
   m_lines_removed  = 0;
@@ -67,8 +66,7 @@ bool GrepHandler::handle(const string& alogfile, const string& new_alogfile)
     return(false);
   }
 
-  m_file_in = fopen(alogfile.c_str(), "r");
-  if(!m_file_in) {
+  if(!m_reader.open(alogfile)) {
     cout << "input not found or unable to open - exiting" << endl;
     return(false);
   }
@@ -101,33 +99,33 @@ bool GrepHandler::handle(const string& alogfile, const string& new_alogfile)
   
   bool done = false;
   while(!done) {
-    string line_raw = getNextRawLine(m_file_in);
-    
-    // Part 1: Check if the line is a comment and handle or ignore
-    if((line_raw.length() > 0) && (line_raw.at(0) == '%')) {
+    ALogLineView line;
+
+    // Part 1: Check for end of file
+    if(!m_reader.nextLine(line))
+      break;
+
+    // Part 2: Check if the line is a comment and handle or ignore
+    if(line.isComment()) {
       if(m_comments_retained)
-	outputLine(line_raw);
+	outputLine(line.getLine());
       continue;
     }
 
-    // Part 2: Check for end of file
-    if(line_raw == "eof") 
-      break;
-
     // Part 3: Handle lines that do not begin with a number (comment
     // lines are already handled above)
-    if(!isNumber(line_raw.substr(0,1))) {
+    if(!line.beginsWithDigit()) {
       if(m_badlines_retained)
-	outputLine(line_raw);
+	outputLine(line.getLine());
       else
-	ignoreLine(line_raw);
+	ignoreLine(line.getLine());
       continue;
     }
 
     // Part 4: If there is a condition, see if it has been met
-    string varname = getVarName(line_raw);
+    string varname = line.getVarName();
     if((m_var_condition != "") && (varname == m_var_condition)) {
-      string varval = getDataEntry(line_raw);
+      string varval = line.getDataEntry();
       if(tolower(varval) == "true")
 	m_var_condition_met = true;
       else
@@ -135,12 +133,12 @@ bool GrepHandler::handle(const string& alogfile, const string& new_alogfile)
     }
 
     if(!m_var_condition_met) {
-      ignoreLine(line_raw, varname);
+      ignoreLine(line.getLine(), varname);
       continue;
     }
       
     // Part 5: Check if this line matches a named var or src
-    string srcname = getSourceNameNoAux(line_raw);
+    string srcname = line.getSourceNameNoAux();
 
     bool match = false;
     for(unsigned int i=0; ((i<m_keys.size()) && !match); i++) {
@@ -153,9 +151,9 @@ bool GrepHandler::handle(const string& alogfile, const string& new_alogfile)
 
     // Part 6: Depending whether a match was made, output or ignore the line
     if(match) 
-      outputLine(line_raw, varname);
+      outputLine(line.getLine(), varname);
     else
-      ignoreLine(line_raw, varname);
+      ignoreLine(line.getLine(), varname);
 
   }
 
@@ -163,9 +161,7 @@ bool GrepHandler::handle(const string& alogfile, const string& new_alogfile)
     fclose(m_file_out);
   m_file_out = 0;
 
-  if(m_file_in)
-    fclose(m_file_in);
-  m_file_in = 0;
+  m_reader.close();
 
   return(true);
 }
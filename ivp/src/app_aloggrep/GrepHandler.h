@@ -27,6 +27,8 @@
 #include <vector>
 #include <string>
 #include <set>
+#include <cstdio>
+#include "ALogReader.h"
 
 class GrepHandler
 {
@@ -67,8 +69,8 @@ class GrepHandler
   std::set<std::string> m_vars_retained;
   std::set<std::string> m_vars_removed;
   
-  FILE *m_file_in;
-  FILE *m_file_out;
+  ALogReader m_reader;
+  FILE      *m_file_out;
 };
 
 #endif
@@ -28,6 +28,7 @@
 #include "HelmReporter.h"
 #include "HelmReportUtils.h"
 #include "LogUtils.h"
+#include "ALogReader.h"
 #include "ColorParse.h"
 
 using namespace std;
@@ -61,8 +62,8 @@ bool HelmReporter::handle(const string& alogfile)
     return(false);
   }
 
-  FILE *file_ptr = fopen(alogfile.c_str(), "r");
-  if(!file_ptr) {
+  ALogReader reader;
+  if(!reader.open(alogfile)) {
     cout << termColor("red");
     cout << "Alog file not found or unable to open - exiting" << endl;
     cout << termColor();
@@ -76,7 +77,9 @@ bool HelmReporter::handle(const string& alogfile)
   bool done = false;
   while(!done) {
     line_count++;
-    string line_raw = getNextRawLine(file_ptr);
+    ALogLineView line;
+    if(!reader.nextLine(line))
+      done = true;
 
     if(m_report_life_events && !m_report_mode_changes && !m_report_bhv_changes) {
       if((line_count % 10000) == 0)
@@ -85,22 +88,15 @@ bool HelmReporter::handle(const string& alogfile)
 	cout << " (" << uintToCommaString(line_count) << ") lines" << endl;
     }
 
-    bool line_is_comment = false;
-    if((line_raw.length() > 0) && (line_raw.at(0) == '%'))
-      line_is_comment = true;
-
-    if(line_raw == "eof") 
-      done = true;
-    
-    if(!done && !line_is_comment) {
-      string varname = getVarName(line_raw);
-      string data = getDataEntry(line_raw);
+    if(!done && !line.isComment()) {
+      string varname = line.getVarName();
+      string data = line.getDataEntry();
       if(varname == "IVPHELM_LIFE_EVENT") { 
 	m_life_events.addLifeEvent(data);
 	life_events++;
       }
       if(m_report_bhv_changes && (varname == "IVPHELM_SUMMARY")) {
-	string tstamp = getTimeStamp(line_raw);
+	string tstamp = line.getTimeStamp();
 	handleNewHelmSummary(data, tstamp);
       }
       if((m_report_mode_changes || m_report_bhv_changes) && 
@@ -110,7 +106,7 @@ bool HelmReporter::handle(const string& alogfile)
       if((m_report_mode_changes || m_report_bhv_changes) && 
 	 (varname == m_mode_var)) {
 	if(data != m_prev_mode_value) {
-	  string tstamp = getTimeStamp(line_raw);
+	  string tstamp = line.getTimeStamp();
 	  cout << "====================================================" << endl;
 	  cout << tstamp << " Mode: " << data << endl;
 	  m_prev_mode_value = data;
@@ -118,9 +114,9 @@ bool HelmReporter::handle(const string& alogfile)
       }
       if(vectorContains(m_watch_vars, varname)) {
 	if(m_var_trunc)
-	  cout << truncString(line_raw, 80) << endl;
+	  cout << truncString(line.getLine(), 80) << endl;
 	else
-	  cout << line_raw << endl;
+	  cout << line.getLine() << endl;
       }
 
     }
@@ -129,8 +125,7 @@ bool HelmReporter::handle(const string& alogfile)
   if(m_report_life_events)
     cout << uintToString(life_events) << " life events." << endl;
 
-  if(file_ptr)
-    fclose(file_ptr);
+  reader.close();
 
   return(true);
 }
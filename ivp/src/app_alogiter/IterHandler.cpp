@@ -37,7 +37,6 @@ using namespace std;
 
 IterHandler::IterHandler()
 {
-  m_file_in  = 0;
 }
 
 //--------------------------------------------------------
@@ -46,31 +45,22 @@ IterHandler::IterHandler()
 
 bool IterHandler::handle(const string& alogfile)
 {
-  m_file_in = fopen(alogfile.c_str(), "r");
-  if(!m_file_in) {
+  if(!m_reader.open(alogfile)) {
     cout << "input not found or unable to open - exiting" << endl;
     return(false);
   }
   
   bool done = false;
   while(!done) {
-    string line_raw = getNextRawLine(m_file_in);
-    
-    bool   line_is_comment = false;
-    if((line_raw.length() > 0) && (line_raw.at(0) == '%'))
-      line_is_comment = true;
-
-    if(line_is_comment)
-      continue;
-
-    if(line_raw == "eof") 
+    ALogLineView line;
+    if(!m_reader.nextLine(line))
       done = true;
-    else {
-      string varname = getVarName(line_raw);
+    else if(!line.isComment()) {
+      string varname = line.getVarName();
 
       if(strEnds(varname, "_ITER_GAP")) {
 	string app_name = findReplace(varname, "_ITER_GAP", "");
-	string data_val = getDataEntry(line_raw);
+	string data_val = line.getDataEntry();
 	double iter_gap = atof(data_val.c_str());
 
 	m_map_app_gap_total[app_name] += iter_gap;
@@ -93,7 +83,7 @@ bool IterHandler::handle(const string& alogfile)
 
       if(strEnds(varname, "_ITER_LEN")) {
 	string app_name = findReplace(varname, "_ITER_LEN", "");
-	string data_val = getDataEntry(line_raw);
+	string data_val = line.getDataEntry();
 	double iter_len = atof(data_val.c_str());
 	m_map_app_len_total[app_name] += iter_len;
 	m_map_app_len_count[app_name]++;
@@ -115,8 +105,7 @@ bool IterHandler::handle(const string& alogfile)
     }
   }
 
-  if(m_file_in)
-    fclose(m_file_in);
+  m_reader.close();
 
   return(true);
 }
@@ -28,6 +28,7 @@
 #include <string>
 #include <set>
 #include <map>
+#include "ALogReader.h"
 
 class IterHandler
 {
@@ -70,7 +71,7 @@ class IterHandler
   std::set<std::string> m_vars_retained;
   std::set<std::string> m_vars_removed;
   
-  FILE *m_file_in;
+  ALogReader m_reader;
 };
 
 #endif
@@ -37,7 +37,6 @@ using namespace std;
 
 FiltHandler::FiltHandler()
 {
-  m_file_in       = 0;
   m_file_out      = 0;
   m_chuck_strings = false;
   m_chuck_numbers = false;
@@ -89,8 +88,7 @@ bool FiltHandler::handle(const string& alogfile, const string& new_alogfile)
     return(false);
   }
 
-  m_file_in = fopen(alogfile.c_str(), "r");
-  if(!m_file_in) {
+  if(!m_reader.open(alogfile)) {
     cout << "input not found or unable to open - exiting now." << endl;
     return(false);
   }
@@ -116,22 +114,22 @@ bool FiltHandler::handle(const string& alogfile, const string& new_alogfile)
   // Begin the filtering line by line by line by line by line by line
   bool done  = false;
   while(!done) {
-    string line_raw = getNextRawLine(m_file_in);
+    ALogLineView line;
 
-    // Part 1: Check if the line is a comment and handle or ignore
-    if((line_raw.length() > 0) && (line_raw.at(0) == '%')) {
+    // Part 1: Check for end of file
+    if(!m_reader.nextLine(line))
+      break;
+
+    // Part 2: Check if the line is a comment and handle or ignore
+    string line_raw = line.getLine();
+    if(line.isComment()) {
       outputLine(line_raw);
       continue;
     }
 
-    // Part 2: Check for end of file
-    if((line_raw == "eof") || (line_raw == "err"))
-      break;
-
-
     // Part 3: Handle lines that do not begin with a number (comment
     // lines are already handled above)
-    if(!isNumber(line_raw.substr(0,1))) {
+    if(!line.beginsWithDigit()) {
       if(m_clean || !m_badlines_retained)
 	ignoreLine(line_raw);
       else
@@ -140,8 +138,8 @@ bool FiltHandler::handle(const string& alogfile, const string& new_alogfile)
     }
     
     // Part 4: Check if this line matches a named var or src
-    string varname = getVarName(line_raw);
-    string srcname = getSourceNameNoAux(line_raw);
+    string varname = line.getVarName();
+    string srcname = line.getSourceNameNoAux();
 
     bool match = false;
     for(unsigned int i=0; (i<m_keys.size()) && !match; i++) {
@@ -158,7 +156,7 @@ bool FiltHandler::handle(const string& alogfile, const string& new_alogfile)
     
     // Part 5: If not filtered out yet, possibly filter out here if 
     // filtering out all string or all doubles
-    string data_field = getDataEntry(line_raw);
+    string data_field = line.getDataEntry();
       
     if((m_chuck_strings && !isNumber(data_field)) ||
        (m_chuck_numbers && isNumber(data_field))) {
@@ -173,9 +171,7 @@ bool FiltHandler::handle(const string& alogfile, const string& new_alogfile)
   if(m_file_out)
     fclose(m_file_out);
   m_file_out = 0;
-  if(m_file_in)
-    fclose(m_file_in);
-  m_file_in = 0;
+  m_reader.close();
 
   return(true);
 }
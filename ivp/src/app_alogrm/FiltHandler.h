@@ -27,6 +27,8 @@
 #include <set>
 #include <vector>
 #include <string>
+#include <cstdio>
+#include "ALogReader.h"
 
 class FiltHandler
 {
@@ -62,8 +64,8 @@ class FiltHandler
   std::set<std::string> m_vars_retained;
   std::set<std::string> m_vars_removed;
 
-  FILE *m_file_in;
-  FILE *m_file_out;
+  ALogReader m_reader;
+  FILE      *m_file_out;
 
   double m_logstart;
 };
@@ -39,7 +39,6 @@ using namespace std;
 
 SortHandler::SortHandler()
 {
-  m_file_in  = 0;
   m_file_out = 0;
 
   m_cache_size  = 1000;
@@ -60,8 +59,7 @@ bool SortHandler::handleSort(const string& alogfile, const string& new_alogfile)
     return(false);
   }
 
-  m_file_in = fopen(alogfile.c_str(), "r");
-  if(!m_file_in) {
+  if(!m_reader.open(alogfile)) {
     cout << "input not found or unable to open - exiting" << endl;
     return(false);
   }
@@ -93,25 +91,25 @@ bool SortHandler::handleSort(const string& alogfile, const string& new_alogfile)
 
     // Step 1: grab the raw line, if any left,  and add to the sorter
     if(!done_reading_raw) {
-      string    line_raw = getNextRawLine(m_file_in);
+      ALogLineView line;
+      if(!m_reader.nextLine(line))
+	done_reading_raw = true;
       
       // Check if line is a comment
-      if((line_raw.length() > 0) && (line_raw.at(0) == '%')) {
+      else if(line.isComment()) {
 	if(m_file_out)
-	  fprintf(m_file_out, "%s\n", line_raw.c_str());
+	  fprintf(m_file_out, "%s\n", line.getLine().c_str());
 	else
-	  cout << line_raw << endl;
+	  cout << line.getLine() << endl;
       }
-
-      else if(line_raw == "eof")
-	done_reading_raw = true;
       else {
-	string    stime = getTimeStamp(line_raw);
-	double    dtime = atof(stime.c_str());
+	double dtime = 0;
+	if(!line.getTimeVal(dtime))
+	  dtime = atof(line.getTimeStamp().c_str());
 
 	ALogEntry entry; 
 	entry.setTimeStamp(dtime);
-	entry.setRawLine(line_raw);
+	entry.setRawLine(line.getLine());
       
 	bool re_sort_noted = sorter.addEntry(entry);
 	if(re_sort_noted)
@@ -137,9 +135,7 @@ bool SortHandler::handleSort(const string& alogfile, const string& new_alogfile)
   if(m_file_out)
     fclose(m_file_out);
   m_file_out = 0;
-  if(m_file_in)
-    fclose(m_file_in);
-  m_file_in = 0;
+  m_reader.close();
 
   return(true);
 }
@@ -149,8 +145,7 @@ bool SortHandler::handleSort(const string& alogfile, const string& new_alogfile)
 
 bool SortHandler::handleCheck(const string& alogfile)
 {
-  m_file_in = fopen(alogfile.c_str(), "r");
-  if(!m_file_in) {
+  if(!m_reader.open(alogfile)) {
     cout << "input not found or unable to open - exiting" << endl;
     return(false);
   }
@@ -160,17 +155,14 @@ bool SortHandler::handleCheck(const string& alogfile)
   bool   first = true;
   bool   done  = false;
   while(!done) {
-    string line_raw = getNextRawLine(m_file_in);
-    
-    bool line_is_comment = false;
-    if((line_raw.length() > 0) && (line_raw.at(0) == '%'))
-      line_is_comment = true;
-
-    if(line_raw == "eof") 
+    ALogLineView line;
+    if(!m_reader.nextLine(line))
       done = true;
-    else if(!line_is_comment) {
-      string timestamp = getTimeStamp(line_raw);
-      double double_timestamp = atof(timestamp.c_str());
+    else if(!line.isComment()) {
+      string line_raw = line.getLine();
+      double double_timestamp = 0;
+      if(!line.getTimeVal(double_timestamp))
+	double_timestamp = atof(line.getTimeStamp().c_str());
       if(first == true) {
 	first = false;
       }
@@ -186,6 +178,7 @@ bool SortHandler::handleCheck(const string& alogfile)
       prev_timestamp = double_timestamp;
     }
   }
+  m_reader.close();
 
   return(true);
 }
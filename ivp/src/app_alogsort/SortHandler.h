@@ -27,6 +27,8 @@
 #include <vector>
 #include <string>
 #include <set>
+#include <cstdio>
+#include "ALogReader.h"
 
 class SortHandler
 {
@@ -47,8 +49,8 @@ class SortHandler
 
   bool  m_file_overwrite;
 
-  FILE *m_file_in;
-  FILE *m_file_out;
+  ALogReader m_reader;
+  FILE      *m_file_out;
 };
 
 #endif
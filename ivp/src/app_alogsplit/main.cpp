@@ -8,7 +8,11 @@
 #include <string>
 #include <cstdlib>
 #include <iostream>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
 #include "MBUtils.h"
+#include "MBTimer.h"
 #include "ReleaseInfo.h"
 #include "SplitHandler.h"
 
@@ -49,16 +53,24 @@ int main(int argc, char *argv[])
     cout << "  -v,--version   Displays the current release version      " << endl;
     cout << "  --verbose      Show output for successful operation      " << endl;
     cout << "  --dir=DIR      Override the default dir with given dir.  " << endl;
+    cout << "  --threads=N    Split with N threads. Default is one per  " << endl;
+    cout << "                 core, up to eight.                        " << endl;
+    cout << "  --max_open=N   Keep at most N klog files open at once.   " << endl;
+    cout << "                 Default is 64.                            " << endl;
     cout << "                                                           " << endl;
     cout << "Further Notes:                                             " << endl;
     cout << "  (1) The order of arguments is irrelevent.                " << endl;
     cout << "  (2) See also: alogscan, alogrm, aloggrep, alogclip, alogview " << endl;
+    cout << "  (3) With --verbose the split time and peak memory use    " << endl;
+    cout << "      (resident set size) are reported.                    " << endl;
     cout << endl;
     return(0);
   }
 
   string alogfile_in;
   string given_dir;
+  int    threads  = 0;
+  int    max_open = 0;
 
   bool verbose = false;
   for(int i=1; i<argc; i++) {
@@ -75,6 +87,10 @@ int main(int argc, char *argv[])
       verbose = true;
     else if(strBegins(sarg, "--dir=")) 
       given_dir = sarg.substr(6);
+    else if(strBegins(sarg, "--threads=")) 
+      threads = atoi(sarg.substr(10).c_str());
+    else if(strBegins(sarg, "--max_open=")) 
+      max_open = atoi(sarg.substr(11).c_str());
   }
   
   if(alogfile_in == "") {
@@ -85,11 +101,33 @@ int main(int argc, char *argv[])
   SplitHandler handler(alogfile_in);
   handler.setVerbose(verbose);
   handler.setDirectory(given_dir);
+  if(threads > 0)
+    handler.setThreads((unsigned int)(threads));
+  if(max_open > 0)
+    handler.setMaxOpenFiles((unsigned int)(max_open));
   
+  MBTimer timer;
+  timer.start();
   bool handled = handler.handle();
+  timer.stop();
   if(!handled)
     return(1);
 
+  if(verbose) {
+    cout << "Split time (secs): " << timer.get_float_wall_time() << endl;
+#ifndef _WIN32
+    // ru_maxrss is in bytes on Mac OS X, kilobytes elsewhere
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) == 0) {
+      double rss_mb = (double)(usage.ru_maxrss) / 1024;
+#ifdef __APPLE__
+      rss_mb = rss_mb / 1024;
+#endif
+      cout << "Peak RSS (MB): " << doubleToString(rss_mb, 1) << endl;
+    }
+#endif
+  }
+
   return(0);
 }
 
@@ -11,6 +11,8 @@
 #include "ALogDataBroker.h"
 #include "MBUtils.h"
 #include "LogUtils.h"
+#include "ALogReader.h"
+#include "KLogCache.h"
 #include "FileBuffer.h"
 #include "Populator_VPlugPlots.h"
 #include "Populator_HelmPlots.h"
@@ -472,10 +474,10 @@ LogPlot ALogDataBroker::getLogPlot(unsigned int mix)
   unsigned int aix = m_mix_alog_ix[mix];
   
     
-  // Part 2: Confirm that the klog file can be found and opened
+  // Part 2: Open the cache of the klog file, built if need be
   string klog = m_base_dirs[aix] + "/" + varname + ".klog";
-  FILE *f = fopen(klog.c_str(), "r");
-  if(!f) {
+  KLogCache cache;
+  if(!cache.open(klog, m_alog_files[aix])) {
     cout << "Could not create LogPlot from " << klog << endl;
     return(logplot);
   }
@@ -483,23 +485,9 @@ LogPlot ALogDataBroker::getLogPlot(unsigned int mix)
   // Part 3: Populate the LogPlot
   logplot.setVarName(varname);
 			
-  bool done = false;
-  while(!done) {
-    
-    string line_raw = getNextRawLine(f);
-    // Check if the line is a comment
-    if((line_raw.length() > 0) && (line_raw.at(0) == '%'))
-      continue;
-    // Check for end of file
-    if(line_raw == "eof") 
-      break;
-
-    // Otherwise handle a normal line
-    string tstamp = getTimeStamp(line_raw);
-    string varval = getDataEntry(line_raw);
-
-    double d_tstamp = atof(tstamp.c_str());
-    double d_varval = atof(varval.c_str());
+  for(unsigned int i=0; i<cache.size(); i++) {
+    double d_tstamp = cache.getTime(i);
+    double d_varval = cache.getDouble(i);
 
     if(d_tstamp < m_pruned_logtmin)
       continue;
@@ -509,9 +497,6 @@ LogPlot ALogDataBroker::getLogPlot(unsigned int mix)
     logplot.setValue(d_tstamp, d_varval);
   }
 
-  if(f)
-    fclose(f);
-
   logplot.applySkew(m_logskew[aix]);
   
   return(logplot);
@@ -539,10 +524,10 @@ VarPlot ALogDataBroker::getVarPlot(unsigned int mix, bool include_source)
 
   unsigned int aix = m_mix_alog_ix[mix];
       
-  // Part 2: Confirm that the klog file can be found and opened
+  // Part 2: Open the cache of the klog file, built if need be
   string klog = m_base_dirs[aix] + "/" + varname + ".klog";
-  FILE *f = fopen(klog.c_str(), "r");
-  if(!f) {
+  KLogCache cache;
+  if(!cache.open(klog, m_alog_files[aix])) {
     cout << "Could not create VarPlot from " << klog << endl;
     return(varplot);
   }
@@ -558,28 +543,16 @@ VarPlot ALogDataBroker::getVarPlot(unsigned int mix, bool include_source)
   bool first_source = true;
   string all_source = "";
   
-  bool done = false;
-  while(!done) {
-    string line_raw = getNextRawLine(f);
-    // Check if the line is a comment
-    if((line_raw.length() > 0) && (line_raw.at(0) == '%'))
-      continue;
-    // Check for end of file
-    if(line_raw == "eof") 
-      break;
-    
-    // Otherwise handle a normal line
-    string tstamp = stripBlankEnds(getTimeStamp(line_raw));
-    string varval = stripBlankEnds(getDataEntry(line_raw));
-
-    double d_tstamp = atof(tstamp.c_str());
+  for(unsigned int i=0; i<cache.size(); i++) {
+    string varval = stripBlankEnds(cache.getString(i));
+    double d_tstamp = cache.getTime(i);
 
     if(is_double) 
       varval = dstringCompact(varval);
 
     string varsrc;
     if(include_source) {
-      varsrc = getSourceName(line_raw);
+      varsrc = cache.getSourceName(i);
       if(first_source) {
 	first_source = false;
 	all_source = varsrc;
@@ -604,8 +577,6 @@ VarPlot ALogDataBroker::getVarPlot(unsigned int mix, bool include_source)
   if(!include_source || uform_source)
     varplot.setSource(all_source);
 
-  if(f)
-    fclose(f);
   return(varplot);
 }
 
@@ -624,10 +595,10 @@ HelmPlot ALogDataBroker::getHelmPlot(unsigned int aix)
     return(hplot);
   }
 
-  // Part 2: Confirm that the IVPHELM_SUMMARY.klog file can be found and opened
+  // Part 2: Open the cache of the IVPHELM_SUMMARY.klog file, built if need be
   string klog = m_base_dirs[aix] + "/IVPHELM_SUMMARY.klog";
-  FILE *f = fopen(klog.c_str(), "r");
-  if(!f) {
+  KLogCache cache;
+  if(!cache.open(klog, m_alog_files[aix])) {
     cout << "Could not create HelmPlot from " << klog << endl;
     return(hplot);
   }
@@ -636,16 +607,12 @@ HelmPlot ALogDataBroker::getHelmPlot(unsigned int aix)
   Populator_HelmPlots populator;
 
   vector<ALogEntry> entries;
-  bool done = false;
-  while(!done) {
-    ALogEntry entry = getNextRawALogEntry(f, true);
+  for(unsigned int i=0; i<cache.size(); i++) {
+    ALogEntry entry = cache.getEntry(i, true);
 
     // Check if the line is a comment
     if(entry.getStatus() == "invalid")
       continue;
-    // Check for end of file
-    if(entry.getStatus() == "eof") 
-      break;
 
     double tstamp = entry.getTimeStamp();
     if(tstamp < m_pruned_logtmin)
@@ -679,10 +646,10 @@ VPlugPlot ALogDataBroker::getVPlugPlot(unsigned int aix)
     return(vplot);
   }
 
-  // Part 2: Confirm that the VISUALS.klog file can be found and opened
+  // Part 2: Open the cache of the VISUALS.klog file, built if need be
   string klog = m_base_dirs[aix] + "/VISUALS.klog";
-  FILE *f = fopen(klog.c_str(), "r");
-  if(!f) {
+  KLogCache cache;
+  if(!cache.open(klog, m_alog_files[aix])) {
     cout << "Could not create VPlugPlot from " << klog << endl;
     return(vplot);
   }
@@ -691,16 +658,12 @@ VPlugPlot ALogDataBroker::getVPlugPlot(unsigned int aix)
   Populator_VPlugPlots populator;
 
   vector<ALogEntry> entries;
-  bool done = false;
-  while(!done) {
-    ALogEntry entry = getNextRawALogEntry(f, true);
+  for(unsigned int i=0; i<cache.size(); i++) {
+    ALogEntry entry = cache.getEntry(i, true);
 
     // Check if the line is a comment
     if(entry.getStatus() == "invalid")
       continue;
-    // Check for end of file
-    if(entry.getStatus() == "eof") 
-      break;
     entries.push_back(entry);
 
     double tstamp = entry.getTimeStamp();
@@ -767,40 +730,34 @@ IPF_Plot ALogDataBroker::getIPFPlot(unsigned int aix, string bhv_name)
 
   // Part 3: Apply the IVPHELM_DOMAIN to the populator
   string domain_klog = m_base_dirs[aix] + "/IVPHELM_DOMAIN.klog";
-  FILE *f1 = fopen(domain_klog.c_str(), "r");
-  if(!f1) {
+  ALogReader domain_reader;
+  if(!domain_reader.open(domain_klog)) {
     cout << "Could not find IVPHELM_DOMAIN from " << domain_klog << endl;
     return(ipf_plot);
   }
-  ALogEntry domain_entry = getNextRawALogEntry(f1);
+  ALogEntry domain_entry = domain_reader.getNextRawALogEntry();
   string status = domain_entry.getStatus();
   if(status != "eof") {
     string domain_str = domain_entry.getStringVal();
     populator.setIvPDomain(domain_str);
   }
-  fclose(f1);
+  domain_reader.close();
 
 
   // Part 4: Apply the BHV_IPF entries for this behavior to the populator
-  // Part 4A: Confirm that the klog file can be found and opened
+  // Part 4A: Open the cache of the klog file, built if need be
   string klog = m_base_dirs[aix] + "/BHV_IPF_" + bhv_name + ".klog";
-  FILE *f = fopen(klog.c_str(), "r");
-  if(!f) {
+  KLogCache cache;
+  if(!cache.open(klog, m_alog_files[aix])) {
     cout << "Could not create IPFPlot from " << klog << endl;
     return(ipf_plot);
   }
 
   // Part 4B: Apply the BHV_IPF entries
   vector<ALogEntry> entries;
-  bool done = false;
-  while(!done) {
-    ALogEntry entry = getNextRawALogEntry(f);
-
-    string entry_status = entry.getStatus();
-    if(entry_status == "eof")
-      done = true;
-    else
-      entries.push_back(entry);
+  for(unsigned int i=0; i<cache.size(); i++) {
+    ALogEntry entry = cache.getEntry(i);
+    entries.push_back(entry);
 
     double tstamp = entry.getTimeStamp();
     if(tstamp < m_pruned_logtmin)
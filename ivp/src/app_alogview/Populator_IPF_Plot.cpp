@@ -42,7 +42,14 @@ bool Populator_IPF_Plot::populateFromEntries(const vector<ALogEntry>& entries)
     if(entries[i].getVarName() == "BHV_IPF") {
       double time_stamp = entries[i].getTimeStamp();
       string var_value  = entries[i].getStringVal();
-      m_demuxer.addMuxPacket(var_value, time_stamp);
+      // B,bhv^iter,hex is a binary IvP function written by alogsplit
+      if(strBegins(var_value, "B,")) {
+	biteString(var_value, ',');
+	biteString(var_value, ',');
+	m_demuxer.addDemuxedString(hexToBinary(var_value), time_stamp);
+      }
+      else
+	m_demuxer.addMuxPacket(var_value, time_stamp);
     }
   }
   
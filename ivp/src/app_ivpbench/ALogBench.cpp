@@ -0,0 +1,375 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: ALogBench.cpp                                        */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include "ALogBench.h"
+#include "ALogReader.h"
+#include "LogUtils.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+
+using namespace std;
+
+//--------------------------------------------------------
+// Procedure: hashStr
+//      Note: FNV-1a, folded into a running value so a single number
+//            stands for everything read in a pass.
+
+static unsigned long long hashStr(unsigned long long hval, const string& str)
+{
+  for(string::size_type i=0; i<str.length(); i++) {
+    hval ^= (unsigned char)(str[i]);
+    hval *= 1099511628211ULL;
+  }
+  hval ^= 0xFF;
+  hval *= 1099511628211ULL;
+  return(hval);
+}
+
+//--------------------------------------------------------
+// Procedure: hashEntry
+
+static unsigned long long hashEntry(unsigned long long hval, 
+				    const ALogEntry& entry)
+{
+  hval = hashStr(hval, entry.getStatus());
+  hval = hashStr(hval, doubleToString(entry.getTimeStamp(), 6));
+  hval = hashStr(hval, entry.getVarName());
+  hval = hashStr(hval, entry.getSource());
+  hval = hashStr(hval, entry.getSrcAux());
+  if(entry.isNumerical())
+    hval = hashStr(hval, doubleToString(entry.getDoubleVal(), 6));
+  else
+    hval = hashStr(hval, entry.getStringVal());
+  return(hval);
+}
+
+//--------------------------------------------------------
+// Constructor
+
+ALogBench::ALogBench()
+{
+  m_generated = false;
+  m_lines     = 500000;
+  m_reps      = 3;
+  m_file_mb   = 0;
+}
+
+//--------------------------------------------------------
+// Procedure: setParam
+
+bool ALogBench::setParam(const string& param, const string& value)
+{
+  if(param == "lines")
+    return(setUIntParam(m_lines, value));
+  else if(param == "reps")
+    return(setUIntParam(m_reps, value));
+  else if((param == "file") && (strEnds(value, ".alog") || 
+				 strEnds(value, ".klog"))) {
+    m_alog_file = value;
+    return(true);
+  }
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: handle
+
+bool ALogBench::handle()
+{
+  clearResults();
+
+  if(m_alog_file == "") {
+    m_alog_file = "alogbench_tmp.alog";
+    m_generated = true;
+    if(!makeALogFile()) {
+      printf("Unable to write %s\n", m_alog_file.c_str());
+      return(false);
+    }
+  }
+
+  FILE *f = fopen(m_alog_file.c_str(), "rb");
+  if(!f) {
+    printf("Unable to open %s\n", m_alog_file.c_str());
+    return(false);
+  }
+  fseek(f, 0, SEEK_END);
+  m_file_mb = (double)(ftell(f)) / (1024 * 1024);
+  fclose(f);
+
+  benchRawLines(true);
+  benchRawLines(false);
+  benchFields();
+  benchEntries();
+
+  if(m_generated)
+    remove(m_alog_file.c_str());
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: makeALogFile
+//   Purpose: A file with the mix of lines seen in a typical vehicle
+//            log: numeric nav postings, node reports, muxed IvP
+//            functions, helm postings with a source aux, values 
+//            with white space, and DB_VARSUMMARY continuation lines.
+
+bool ALogBench::makeALogFile()
+{
+  FILE *f = fopen(m_alog_file.c_str(), "w");
+  if(!f)
+    return(false);
+
+  fprintf(f, "%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\n");
+  fprintf(f, "%%%% LOG FILE:       ./%s\n", m_alog_file.c_str());
+  fprintf(f, "%%%% LOGSTART               1760000000.25\n");
+  fprintf(f, "%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\n");
+
+  unsigned int seed = 12345;
+  double tstamp = 0.25;
+  for(unsigned int i=0; i<m_lines; i++) {
+    seed = (seed * 1103515245) + 12345;
+    unsigned int r = (seed >> 16) & 0x7FFF;
+    tstamp += (double)(r % 50) / 1000.0;
+    double x = (double)(r % 20000) / 10.0 - 1000;
+    switch(r % 8) {
+    case 0:
+      fprintf(f, "%.3f   NAV_X   uSimMarine   %.4f\n", tstamp, x);
+      break;
+    case 1:
+      fprintf(f, "%.3f   NAV_Y   uSimMarine   %.4f\n", tstamp, -x);
+      break;
+    case 2:
+      fprintf(f, "%.3f   NODE_REPORT_LOCAL   pNodeReporter   NAME=alpha,"
+	      "X=%.2f,Y=%.2f,SPD=1.5,HDG=%u,TYPE=kayak,LENGTH=4,"
+	      "TIME=%.2f\n", tstamp, x, -x, r%360, 1760000000.25+tstamp);
+      break;
+    case 3:
+      fprintf(f, "%.3f   BHV_IPF   pHelmIvP:waypt   P,waypt^%u,1,1,"
+	      "H,10,%u:waypt,2,4,1,100,D,course;0;359;360:speed;0;4;21,"
+	      "G,360,21,F,0,89,0,20,0.1,0.2,3,90,179,0,20,0.4,0.5,6\n",
+	      tstamp, i, i);
+      break;
+    case 4:
+      fprintf(f, "%.3f   DESIRED_HEADING   pHelmIvP:%u:waypt   %u\n", 
+	      tstamp, i, r%360);
+      break;
+    case 5:
+      fprintf(f, "%.3f   APPCAST_REQ   uMAC   node=alpha, app=pHelmIvP, "
+	      "duration=3, key=uMAC_%u\n", tstamp, r);
+      break;
+    case 6:
+      fprintf(f, "%.3f\tDB_QOS\tMOOSDB_alpha\t%.2f\n", tstamp, x/100);
+      break;
+    default:
+      fprintf(f, "%.3f   DB_VARSUMMARY   MOOSDB_alpha   NAV_X,NAV_Y\n"
+	      "   continued,summary\n", tstamp);
+    }
+  }
+  fclose(f);
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: benchRawLines
+//   Purpose: Read every line and nothing else.
+
+void ALogBench::benchRawLines(bool mmap)
+{
+  unsigned long long legacy_hash = 0;
+  unsigned long long reader_hash = 0;
+  
+  MBTimer timer1;
+  timer1.start();
+  for(unsigned int k=0; k<m_reps; k++) {
+    unsigned long long hval = 14695981039346656037ULL;
+    FILE *f = fopen(m_alog_file.c_str(), "r");
+    string line = getNextRawLine(f);
+    while(line != "eof") {
+      hval = hashStr(hval, line);
+      line = getNextRawLine(f);
+    }
+    fclose(f);
+    legacy_hash = hval;
+  }
+  timer1.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(unsigned int k=0; k<m_reps; k++) {
+    unsigned long long hval = 14695981039346656037ULL;
+    ALogReader reader;
+    reader.setUseMMap(mmap);
+    reader.open(m_alog_file);
+    string line = reader.getNextRawLine();
+    while(line != "eof") {
+      hval = hashStr(hval, line);
+      line = reader.getNextRawLine();
+    }
+    reader_hash = hval;
+  }
+  timer2.stop();
+
+  string test = mmap ? "raw lines (mmap)" : "raw lines (block read)";
+  addResult(test, timer1.get_float_wall_time() / m_reps,
+	    timer2.get_float_wall_time() / m_reps,
+	    legacy_hash == reader_hash);
+}
+
+//--------------------------------------------------------
+// Procedure: benchFields
+//   Purpose: Read every line and pull out its fields, the pattern
+//            of alogsplit, aloggrep, alogrm and others. The legacy
+//            case scans the line once per field.
+
+void ALogBench::benchFields()
+{
+  unsigned long long legacy_hash = 0;
+  unsigned long long reader_hash = 0;
+  double legacy_tsum = 0;
+  double reader_tsum = 0;
+  
+  MBTimer timer1;
+  timer1.start();
+  for(unsigned int k=0; k<m_reps; k++) {
+    unsigned long long hval = 14695981039346656037ULL;
+    double tsum = 0;
+    FILE *f = fopen(m_alog_file.c_str(), "r");
+    string line = getNextRawLine(f);
+    while(line != "eof") {
+      if((line.length() > 0) && (line.at(0) != '%')) {
+	tsum += atof(getTimeStamp(line).c_str());
+	hval = hashStr(hval, getVarName(line));
+	hval = hashStr(hval, getSourceNameNoAux(line));
+	hval = hashStr(hval, getDataEntry(line));
+      }
+      line = getNextRawLine(f);
+    }
+    fclose(f);
+    legacy_hash = hval;
+    legacy_tsum = tsum;
+  }
+  timer1.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(unsigned int k=0; k<m_reps; k++) {
+    unsigned long long hval = 14695981039346656037ULL;
+    double tsum = 0;
+    ALogReader reader;
+    reader.open(m_alog_file);
+    ALogLineView line;
+    while(reader.nextLine(line)) {
+      if(!line.isEmpty() && !line.isComment()) {
+	double tval = 0;
+	if(!line.getTimeVal(tval))
+	  tval = atof(line.getTimeStamp().c_str());
+	tsum += tval;
+	hval = hashStr(hval, line.getVarName());
+	hval = hashStr(hval, line.getSourceNameNoAux());
+	hval = hashStr(hval, line.getDataEntry());
+      }
+    }
+    reader_hash = hval;
+    reader_tsum = tsum;
+  }
+  timer2.stop();
+
+  addResult("lines and fields", timer1.get_float_wall_time() / m_reps,
+	    timer2.get_float_wall_time() / m_reps,
+	    (legacy_hash == reader_hash) && (legacy_tsum == reader_tsum));
+}
+
+//--------------------------------------------------------
+// Procedure: benchEntries
+//   Purpose: Read every line as an ALogEntry, as alogscan, alogcheck
+//            and alogview do.
+
+void ALogBench::benchEntries()
+{
+  unsigned long long legacy_hash = 0;
+  unsigned long long reader_hash = 0;
+  
+  MBTimer timer1;
+  timer1.start();
+  for(unsigned int k=0; k<m_reps; k++) {
+    unsigned long long hval = 14695981039346656037ULL;
+    FILE *f = fopen(m_alog_file.c_str(), "r");
+    ALogEntry entry = getNextRawALogEntry(f);
+    while(entry.getStatus() != "eof") {
+      hval = hashEntry(hval, entry);
+      entry = getNextRawALogEntry(f);
+    }
+    fclose(f);
+    legacy_hash = hval;
+  }
+  timer1.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(unsigned int k=0; k<m_reps; k++) {
+    unsigned long long hval = 14695981039346656037ULL;
+    ALogReader reader;
+    reader.open(m_alog_file);
+    ALogEntry entry = reader.getNextRawALogEntry();
+    while(entry.getStatus() != "eof") {
+      hval = hashEntry(hval, entry);
+      entry = reader.getNextRawALogEntry();
+    }
+    reader_hash = hval;
+  }
+  timer2.stop();
+
+  addResult("alog entries", timer1.get_float_wall_time() / m_reps,
+	    timer2.get_float_wall_time() / m_reps,
+	    legacy_hash == reader_hash);
+}
+
+//--------------------------------------------------------
+// Procedure: printReport
+
+void ALogBench::printReport()
+{
+  printf("%-24s %11s %11s %9s %9s %8s %6s\n", "Test", "Legacy(ms)", 
+	 "Reader(ms)", "Leg(MB/s)", "Rdr(MB/s)", "Speedup", "Match");
+  printf("%-24s %11s %11s %9s %9s %8s %6s\n", "----", "----------", 
+	 "----------", "---------", "---------", "-------", "-----");
+
+  for(unsigned int i=0; i<m_test.size(); i++) {
+    double speedup = 0;
+    double legacy_mbs = 0;
+    double reader_mbs = 0;
+    if(m_new_time[i] > 0) {
+      speedup = m_old_time[i] / m_new_time[i];
+      reader_mbs = m_file_mb / m_new_time[i];
+    }
+    if(m_old_time[i] > 0)
+      legacy_mbs = m_file_mb / m_old_time[i];
+    printf("%-24s %11.1f %11.1f %9.1f %9.1f %8.2f %6s\n", 
+	   m_test[i].c_str(), m_old_time[i] * 1000, 
+	   m_new_time[i] * 1000, legacy_mbs, reader_mbs, speedup,
+	   boolToString(m_match[i]).c_str());
+  }
+  printf("File: %s  Size: %.1f MB  Reps: %u\n", m_alog_file.c_str(),
+	 m_file_mb, m_reps);
+}
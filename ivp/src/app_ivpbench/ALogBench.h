@@ -0,0 +1,55 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: ALogBench.h                                          */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef ALOG_BENCH_HEADER
+#define ALOG_BENCH_HEADER
+
+#include <vector>
+#include <string>
+#include "BenchModule.h"
+
+class ALogBench : public BenchModule
+{
+ public:
+  ALogBench();
+  ~ALogBench() {}
+
+  bool setParam(const std::string& param, const std::string& value);
+  bool handle();
+  void printReport();
+
+ protected:
+  bool makeALogFile();
+
+  void benchRawLines(bool mmap);
+  void benchFields();
+  void benchEntries();
+
+ protected:
+  std::string  m_alog_file;
+  bool         m_generated;
+  unsigned int m_lines;
+  unsigned int m_reps;
+  double       m_file_mb;
+};
+
+#endif
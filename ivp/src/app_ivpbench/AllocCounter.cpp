@@ -0,0 +1,58 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: AllocCounter.cpp                                     */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <new>
+#include <cstdlib>
+#include "AllocCounter.h"
+
+static unsigned long alloc_count = 0;
+
+//--------------------------------------------------------
+// Procedure: getAllocCount
+
+unsigned long getAllocCount()
+{
+  return(__sync_fetch_and_add(&alloc_count, 0));
+}
+
+//--------------------------------------------------------
+// Procedure: countedAlloc
+
+static void *countedAlloc(std::size_t size)
+{
+  __sync_fetch_and_add(&alloc_count, 1);
+  if(size == 0)
+    size = 1;
+  void *ptr = malloc(size);
+  if(!ptr)
+    throw std::bad_alloc();
+  return(ptr);
+}
+
+//--------------------------------------------------------
+// Replacements for the global allocation functions
+
+void *operator new(std::size_t size)   {return(countedAlloc(size));}
+void *operator new[](std::size_t size) {return(countedAlloc(size));}
+
+void operator delete(void *ptr) throw()   {free(ptr);}
+void operator delete[](void *ptr) throw() {free(ptr);}
@@ -0,0 +1,31 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: AllocCounter.h                                       */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef ALLOC_COUNTER_HEADER
+#define ALLOC_COUNTER_HEADER
+
+// Number of heap allocations (operator new and new[]) made by this 
+// process so far. Global operator new is replaced in AllocCounter.cpp
+// to maintain the count.
+unsigned long getAllocCount();
+
+#endif
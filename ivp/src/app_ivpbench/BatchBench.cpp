@@ -0,0 +1,281 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: BatchBench.cpp                                       */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include "BatchBench.h"
+#include "AOF_Linear.h"
+#include "AOF_Gaussian.h"
+#include "AOF_Waypoint.h"
+#include "AOF_AvoidCollision.h"
+#include "AOF_CutRangeCPA.h"
+#include "OF_Reflector.h"
+#include "FunctionEncoder.h"
+#include "IvPFunction.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+
+using namespace std;
+
+//--------------------------------------------------------
+// Class: PerPointAOF
+//   Purpose: Hands each point of a batch to the given AOF one at a
+//            time, through the default AOF::evalPtBatch(), as was
+//            done for every AOF before the batch overrides.
+
+class PerPointAOF : public AOF
+{
+ public:
+  PerPointAOF(const AOF *aof) : AOF(aof->getDomain()) {m_aof=aof;}
+
+  double evalBox(const IvPBox *b) const 
+  {return(m_aof->evalBox(b));}
+  double evalPoint(const vector<double>& point) const 
+  {return(m_aof->evalPoint(point));}
+
+ protected:
+  const AOF *m_aof;
+};
+
+//--------------------------------------------------------
+// Constructor
+
+BatchBench::BatchBench()
+{
+  m_old_label = "PerPoint";
+  m_new_label = "Batch";
+
+  m_points = 1000000;
+  m_reps   = 3;
+}
+
+//--------------------------------------------------------
+// Procedure: setParam
+
+bool BatchBench::setParam(const string& param, const string& value)
+{
+  if(param == "points")
+    return(setUIntParam(m_points, value));
+  else if(param == "reps")
+    return(setUIntParam(m_reps, value));
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: handle
+//   Purpose: For each AOF with its own evalPtBatch(), compare it
+//            to evaluating the same points one at a time, and 
+//            compare the functions the reflector builds each way.
+
+bool BatchBench::handle()
+{
+  clearResults();
+
+  vector<string> names;
+  names.push_back("Linear");
+  names.push_back("Gaussian");
+  names.push_back("Waypoint");
+  names.push_back("AvoidCollision");
+  names.push_back("CutRangeCPA");
+
+  for(unsigned int i=0; i<names.size(); i++) {
+    AOF *aof = newAOF(names[i]);
+    if(!aof) {
+      printf("Unable to initialize AOF_%s\n", names[i].c_str());
+      return(false);
+    }
+    benchPoints(names[i], aof);
+    benchBuilds(names[i], aof);
+    delete(aof);
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: newAOF
+//   Returns: An initialized AOF of the given kind, or null.
+
+AOF* BatchBench::newAOF(const string& name) const
+{
+  IvPDomain xy_domain;
+  xy_domain.addDomain("x", -100, 100, 201);
+  xy_domain.addDomain("y", -50, 150, 401);
+
+  IvPDomain helm_domain;
+  helm_domain.addDomain("course", 0, 359, 360);
+  helm_domain.addDomain("speed", 0, 4, 41);
+
+  AOF *aof = 0;
+  if(name == "Linear") {
+    aof = new AOF_Linear(xy_domain);
+    aof->setParam("mcoeff", 0.37);
+    aof->setParam("ncoeff", -1.9);
+    aof->setParam("bscalar", 12.5);
+  }
+  else if(name == "Gaussian") {
+    aof = new AOF_Gaussian(xy_domain);
+    aof->setParam("xcent", 23.4);
+    aof->setParam("ycent", 61.7);
+    aof->setParam("sigma", 35);
+    aof->setParam("range", 100);
+  }
+  else if(name == "Waypoint") {
+    aof = new AOF_Waypoint(helm_domain);
+    aof->setParam("osx", 10);
+    aof->setParam("osy", -20);
+    aof->setParam("ptx", 180);
+    aof->setParam("pty", 95);
+    aof->setParam("desired_speed", 2.2);
+  }
+  else if(name == "AvoidCollision") {
+    AOF_AvoidCollision *avd = new AOF_AvoidCollision(helm_domain);
+    avd->setOwnshipParams(10, -20);
+    avd->setContactParams(60, 40, 200, 1.8);
+    avd->setParam("tol", 60);
+    avd->setParam("collision_distance", 10);
+    avd->setParam("all_clear_distance", 75);
+    aof = avd;
+  }
+  else if(name == "CutRangeCPA") {
+    aof = new AOF_CutRangeCPA(helm_domain);
+    aof->setParam("oslat", -20);
+    aof->setParam("oslon", 10);
+    aof->setParam("cnlat", 140);
+    aof->setParam("cnlon", 90);
+    aof->setParam("cncrs", 250);
+    aof->setParam("cnspd", 1.5);
+    aof->setParam("tol", 60);
+    aof->setParam("patience", 50);
+  }
+
+  if(aof && !aof->initialize()) {
+    delete(aof);
+    aof = 0;
+  }
+  return(aof);
+}
+
+//--------------------------------------------------------
+// Procedure: benchPoints
+//   Purpose: Random points over the whole domain, laid out as 
+//            evalPtBatch() takes them: dimension-major indices.
+
+void BatchBench::benchPoints(const string& name, const AOF* aof)
+{
+  IvPDomain domain = aof->getDomain();
+  unsigned int d, dim = domain.size();
+
+  srand(m_points);
+  vector<int> pts(dim * m_points);
+  for(d=0; d<dim; d++)
+    for(unsigned int k=0; k<m_points; k++)
+      pts[(d*m_points)+k] = rand() % domain.getVarPoints(d);
+
+  PerPointAOF per_point(aof);
+  vector<double> per_point_vals(m_points);
+  vector<double> batch_vals(m_points);
+
+  MBTimer timer1;
+  timer1.start();
+  for(unsigned int r=0; r<m_reps; r++)
+    per_point.evalPtBatch(&(pts[0]), m_points, &(per_point_vals[0]));
+  timer1.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(unsigned int r=0; r<m_reps; r++)
+    aof->evalPtBatch(&(pts[0]), m_points, &(batch_vals[0]));
+  timer2.stop();
+
+  addResult(name + " points", timer1.get_float_wall_time() / m_reps,
+	    timer2.get_float_wall_time() / m_reps, 
+	    per_point_vals == batch_vals);
+}
+
+//--------------------------------------------------------
+// Procedure: benchBuilds
+//   Purpose: Build the function with uniform, smart and directed
+//            refinement, evaluating one point at a time and then 
+//            in batches, and check the functions are the same.
+
+void BatchBench::benchBuilds(const string& name, AOF* aof)
+{
+  IvPDomain domain = aof->getDomain();
+  string v0 = domain.getVarName(0);
+  string v1 = domain.getVarName(1);
+  string low0 = doubleToStringX(domain.getVarLow(0));
+  string low1 = doubleToStringX(domain.getVarLow(1));
+  string mid0 = doubleToStringX(domain.getVarLow(0) + 
+				(domain.getVarHigh(0) - domain.getVarLow(0))/4);
+  string mid1 = doubleToStringX(domain.getVarLow(1) + 
+				(domain.getVarHigh(1) - domain.getVarLow(1))/4);
+
+  PerPointAOF per_point(aof);
+  double times[2] = {0, 0};
+  bool   all_match = true;
+  for(unsigned int mode=0; mode<3; mode++) {
+    string ipf_strs[2];
+    for(unsigned int k=0; k<2; k++) {
+      // The smart pieces' PQueue drops a random leaf when full.
+      srand(mode);
+      MBTimer timer;
+      timer.start();
+      OF_Reflector reflector(k ? aof : &per_point, 1);
+      if(mode == 0)
+	reflector.setParam("uniform_piece", "discrete @ " + v0 + ":4," +
+			   v1 + ":3");
+      else if(mode == 1) {
+	reflector.setParam("uniform_amount", "100");
+	reflector.setParam("smart_amount", "400");
+      }
+      else {
+	reflector.setParam("uniform_piece", "discrete @ " + v0 + ":20," +
+			   v1 + ":10");
+	reflector.setParam("refine_region", "native @ " + v0 + ":" + 
+			   low0 + ":" + mid0 + "," + v1 + ":" + low1 + 
+			   ":" + mid1);
+	reflector.setParam("refine_piece", "discrete @ " + v0 + ":2," +
+			   v1 + ":2");
+      }
+      reflector.create();
+      IvPFunction *ipf = reflector.extractIvPFunction();
+      timer.stop();
+      times[k] += timer.get_float_wall_time();
+
+      ipf_strs[k] = ipf ? IvPFunctionToString(ipf) : "";
+      delete(ipf);
+    }
+    if((ipf_strs[0] == "") || (ipf_strs[0] != ipf_strs[1]))
+      all_match = false;
+  }
+
+  addResult(name + " builds", times[0], times[1], all_match);
+}
+
+//--------------------------------------------------------
+// Procedure: printSettings
+
+void BatchBench::printSettings()
+{
+  printf("Points: %u  Reps: %u  Builds: uniform, smart, directed\n",
+	 m_points, m_reps);
+}
@@ -0,0 +1,52 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: BatchBench.h                                         */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef BATCH_BENCH_HEADER
+#define BATCH_BENCH_HEADER
+
+#include <vector>
+#include <string>
+#include "BenchModule.h"
+#include "AOF.h"
+
+class BatchBench : public BenchModule
+{
+ public:
+  BatchBench();
+  ~BatchBench() {}
+
+  bool setParam(const std::string& param, const std::string& value);
+  bool handle();
+
+ protected:
+  void printSettings();
+  AOF* newAOF(const std::string& name) const;
+
+  void benchPoints(const std::string& name, const AOF* aof);
+  void benchBuilds(const std::string& name, AOF* aof);
+
+ protected:
+  unsigned int m_points;
+  unsigned int m_reps;
+};
+
+#endif
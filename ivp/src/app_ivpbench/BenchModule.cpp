@@ -0,0 +1,147 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: BenchModule.cpp                                      */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include "BenchModule.h"
+#include "MBUtils.h"
+
+using namespace std;
+
+//--------------------------------------------------------
+// Constructor
+
+BenchModule::BenchModule()
+{
+  m_old_label = "Ref";
+  m_new_label = "New";
+}
+
+//--------------------------------------------------------
+// Procedure: allPassed
+//   Purpose: True if the reference and current code agreed on every
+//            test.
+
+bool BenchModule::allPassed() const
+{
+  for(unsigned int i=0; i<m_match.size(); i++) {
+    if(!m_match[i])
+      return(false);
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: printReport
+
+void BenchModule::printReport()
+{
+  string old_hdr = m_old_label + "(ms)";
+  string new_hdr = m_new_label + "(ms)";
+
+  printf("%-28s %12s %12s %8s %6s\n", "Test", old_hdr.c_str(), 
+	 new_hdr.c_str(), "Speedup", "Match");
+  printf("%-28s %12s %12s %8s %6s\n", "----", "----------", 
+	 "----------", "-------", "-----");
+
+  for(unsigned int i=0; i<m_test.size(); i++) {
+    if(m_old_time[i] < 0) {
+      printf("%-28s %12s %12.3f %8s %6s\n", m_test[i].c_str(), "-",
+	     m_new_time[i] * 1000, "-", boolToString(m_match[i]).c_str());
+      continue;
+    }
+    double speedup = 0;
+    if(m_new_time[i] > 0)
+      speedup = m_old_time[i] / m_new_time[i];
+    printf("%-28s %12.3f %12.3f %8.2f %6s\n", m_test[i].c_str(), 
+	   m_old_time[i] * 1000, m_new_time[i] * 1000, speedup, 
+	   boolToString(m_match[i]).c_str());
+  }
+  printSettings();
+}
+
+//--------------------------------------------------------
+// Procedure: printChecks
+//   Purpose: Report only whether each test passed, leaving out the
+//            times. Used when run as a test rather than a benchmark.
+
+void BenchModule::printChecks()
+{
+  printf("%-28s %6s\n", "Test", "Pass");
+  printf("%-28s %6s\n", "----", "----");
+  for(unsigned int i=0; i<m_test.size(); i++)
+    printf("%-28s %6s\n", m_test[i].c_str(), 
+	   boolToString(m_match[i]).c_str());
+}
+
+//--------------------------------------------------------
+// Procedure: addResult
+
+void BenchModule::addResult(const string& test, double old_time,
+			    double new_time, bool match)
+{
+  m_test.push_back(test);
+  m_old_time.push_back(old_time);
+  m_new_time.push_back(new_time);
+  m_match.push_back(match);
+}
+
+//--------------------------------------------------------
+// Procedure: clearResults
+
+void BenchModule::clearResults()
+{
+  m_test.clear();
+  m_old_time.clear();
+  m_new_time.clear();
+  m_match.clear();
+}
+
+//--------------------------------------------------------
+// Procedure: setUIntParam
+//   Purpose: Set the given variable if the value is a number of at
+//            least one. Otherwise leave it unchanged.
+
+bool BenchModule::setUIntParam(unsigned int& var, 
+			       const string& value) const
+{
+  int ival = atoi(value.c_str());
+  if(!isNumber(value) || (ival < 1))
+    return(false);
+  var = (unsigned int)(ival);
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: setPosDoubleParam
+//   Purpose: Set the given variable if the value is a positive number.
+//            Otherwise leave it unchanged.
+
+bool BenchModule::setPosDoubleParam(double& var, 
+				    const string& value) const
+{
+  double dval = atof(value.c_str());
+  if(!isNumber(value) || (dval <= 0))
+    return(false);
+  var = dval;
+  return(true);
+}
@@ -0,0 +1,71 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: BenchModule.h                                        */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef BENCH_MODULE_HEADER
+#define BENCH_MODULE_HEADER
+
+#include <vector>
+#include <string>
+
+// A BenchModule checks a piece of the code against a simple
+// reference (brute force, a second API, or a model of the expected
+// behavior) over generated inputs, and times the two. Each result
+// is a named test with the time of the reference and the current
+// code, and whether they agreed. A reference time below zero means
+// the reference is only a check and was not timed.
+
+class BenchModule
+{
+ public:
+  BenchModule();
+  virtual ~BenchModule() {}
+
+  virtual bool setParam(const std::string& param, 
+			const std::string& value) = 0;
+  virtual bool handle() = 0;
+  virtual void printReport();
+  virtual void printChecks();
+  virtual bool allPassed() const;
+
+ protected:
+  virtual void printSettings() {}
+
+  void addResult(const std::string& test, double old_time, 
+		 double new_time, bool match);
+  void clearResults();
+
+  bool setUIntParam(unsigned int& var, const std::string& value) const;
+  bool setPosDoubleParam(double& var, const std::string& value) const;
+
+ protected:
+  // Column headings of the old and new times in the report
+  std::string m_old_label;
+  std::string m_new_label;
+
+  // Results per test
+  std::vector<std::string> m_test;
+  std::vector<double>      m_old_time;
+  std::vector<double>      m_new_time;
+  std::vector<bool>        m_match;
+};
+
+#endif
@@ -0,0 +1,235 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: CPABench.cpp                                         */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include "CPABench.h"
+#include "CPAEngine.h"
+#include "AOF_AvoidCollision.h"
+#include "OF_Reflector.h"
+#include "FunctionEncoder.h"
+#include "BuildUtils.h"
+#include "IvPFunction.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+
+using namespace std;
+
+//--------------------------------------------------------
+// Constructor
+
+CPABench::CPABench()
+{
+  m_old_label = "Direct";
+  m_new_label = "Table";
+
+  m_scenarios = 50;
+  m_reps      = 5;
+  m_tol       = 60;
+
+  // The usual helm decision space
+  m_domain.addDomain("course", 0, 359, 360);
+  m_domain.addDomain("speed", 0, 4, 41);
+}
+
+//--------------------------------------------------------
+// Procedure: setParam
+
+bool CPABench::setParam(const string& param, const string& value)
+{
+  if(param == "scenarios")
+    return(setUIntParam(m_scenarios, value));
+  else if(param == "reps")
+    return(setUIntParam(m_reps, value));
+  else if(param == "tol")
+    return(setPosDoubleParam(m_tol, value));
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: handle
+
+bool CPABench::handle()
+{
+  clearResults();
+  makeScenarios();
+
+  benchEval(false);
+  benchEval(true);
+  benchAvoidCollision();
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: makeScenarios
+//   Purpose: Contacts at random ranges and bearings from ownship,
+//            with every tenth contact on a whole degree heading and
+//            a grid speed, so ownship can match its velocity.
+
+void CPABench::makeScenarios()
+{
+  m_cpa_scenarios.clear();
+  srand(m_scenarios);
+
+  for(unsigned int i=0; i<m_scenarios; i++) {
+    CPAScenario s;
+    s.osx = (rand() % 2000) - 1000;
+    s.osy = (rand() % 2000) - 1000;
+    s.cnx = s.osx + (rand() % 400) - 200;
+    s.cny = s.osy + (rand() % 400) - 200;
+    s.cnh = (double)(rand() % 36000) / 100;
+    s.cnv = (double)(rand() % 500) / 100;
+    if((i % 10) == 0) {
+      s.cnh = rand() % 360;
+      s.cnv = (double)(rand() % 41) / 10;
+    }
+    m_cpa_scenarios.push_back(s);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: benchEval
+//   Purpose: Every point on the course/speed grid plus points
+//            half way between courses, so both the table and the
+//            fall back path are checked. The table time includes
+//            building the table.
+
+void CPABench::benchEval(bool roc_only)
+{
+  unsigned int crs_pts = m_domain.getVarPoints(0);
+  unsigned int spd_pts = m_domain.getVarPoints(1);
+  double crs_low = m_domain.getVarLow(0);
+  double crs_del = m_domain.getVarDelta(0);
+  double spd_low = m_domain.getVarLow(1);
+  double spd_del = m_domain.getVarDelta(1);
+
+  vector<double> results[2];
+  double times[2] = {0, 0};
+
+  for(unsigned int i=0; i<m_cpa_scenarios.size(); i++) {
+    const CPAScenario& s = m_cpa_scenarios[i];
+    for(unsigned int k=0; k<2; k++) {
+      MBTimer timer;
+      timer.start();
+      CPAEngine engine(s.cny, s.cnx, s.cnh, s.cnv, s.osy, s.osx);
+      if(k == 1)
+	engine.setTrigTable(crs_low, crs_del, crs_pts);
+      for(unsigned int r=0; r<m_reps; r++) {
+	for(unsigned int c=0; c<(2*crs_pts); c++) {
+	  double crs = crs_low + (crs_del * (c/2)) + ((c%2) * crs_del/2);
+	  for(unsigned int v=0; v<spd_pts; v++) {
+	    double spd = spd_low + (spd_del * v);
+	    double roc = 0;
+	    double dist = 0;
+	    if(roc_only)
+	      roc = engine.evalROC(crs, spd);
+	    else
+	      dist = engine.evalCPA(crs, spd, m_tol, &roc);
+	    if(r == 0) {
+	      results[k].push_back(dist);
+	      results[k].push_back(roc);
+	    }
+	  }
+	}
+      }
+      timer.stop();
+      times[k] += timer.get_float_wall_time();
+    }
+  }
+
+  string test = roc_only ? "evalROC" : "evalCPA";
+  test += "(x" + uintToString(m_reps) + ")";
+  addResult(test, times[0], times[1], results[0] == results[1]);
+}
+
+//--------------------------------------------------------
+// Class: DirectAvoidCollision
+//   Purpose: An AOF_AvoidCollision that drops the trig table its
+//            CPAEngine is given, as it was before the table.
+
+class DirectAvoidCollision : public AOF_AvoidCollision
+{
+ public:
+  DirectAvoidCollision(IvPDomain domain) : AOF_AvoidCollision(domain) {}
+
+  bool initialize() {
+    bool ok = AOF_AvoidCollision::initialize();
+    m_cpa_engine.clearTables();
+    return(ok);
+  }
+};
+
+//--------------------------------------------------------
+// Procedure: benchAvoidCollision
+//   Purpose: Build the objective function the way BHV_AvoidCollision
+//            does with its default build_info, with and without the
+//            trig table, and compare the resulting functions.
+
+void CPABench::benchAvoidCollision()
+{
+  string build_info = "uniform_grid = discrete @ course:9,speed:6 # ";
+  build_info += "uniform_piece = discrete @ course:3,speed:3";
+
+  vector<string> ipfs[2];
+  double times[2] = {0, 0};
+
+  for(unsigned int i=0; i<m_cpa_scenarios.size(); i++) {
+    const CPAScenario& s = m_cpa_scenarios[i];
+    for(unsigned int k=0; k<2; k++) {
+      MBTimer timer;
+      timer.start();
+      AOF_AvoidCollision *aof = 0;
+      if(k == 0)
+	aof = new DirectAvoidCollision(m_domain);
+      else
+	aof = new AOF_AvoidCollision(m_domain);
+      aof->setOwnshipParams(s.osx, s.osy);
+      aof->setContactParams(s.cnx, s.cny, s.cnh, s.cnv);
+      aof->setParam("tol", m_tol);
+      aof->setParam("collision_distance", 10);
+      aof->setParam("all_clear_distance", 75);
+      aof->initialize();
+
+      OF_Reflector reflector(aof, 1);
+      reflector.create(build_info);
+      IvPFunction *ipf = reflector.extractIvPFunction();
+      timer.stop();
+      times[k] += timer.get_float_wall_time();
+
+      ipfs[k].push_back(ipf ? IvPFunctionToString(ipf) : "");
+      delete(ipf);
+      delete(aof);
+    }
+  }
+
+  addResult("AvoidCollision IvPFunction", times[0], times[1],
+	    ipfs[0] == ipfs[1]);
+}
+
+//--------------------------------------------------------
+// Procedure: printSettings
+
+void CPABench::printSettings()
+{
+  printf("Scenarios: %u  Reps: %u  TimeOnLeg: %g  Domain: %s\n", 
+	 m_scenarios, m_reps, m_tol, domainToString(m_domain).c_str());
+}
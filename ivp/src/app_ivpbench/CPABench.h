@@ -0,0 +1,63 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: CPABench.h                                           */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef CPA_BENCH_HEADER
+#define CPA_BENCH_HEADER
+
+#include <vector>
+#include <string>
+#include "BenchModule.h"
+#include "IvPDomain.h"
+
+// One ownship/contact encounter
+struct CPAScenario
+{
+  double osx, osy;
+  double cnx, cny, cnh, cnv;
+};
+
+class CPABench : public BenchModule
+{
+ public:
+  CPABench();
+  ~CPABench() {}
+
+  bool setParam(const std::string& param, const std::string& value);
+  bool handle();
+
+ protected:
+  void printSettings();
+  void makeScenarios();
+
+  void benchEval(bool roc_only);
+  void benchAvoidCollision();
+
+ protected:
+  unsigned int m_scenarios;
+  unsigned int m_reps;
+  double       m_tol;
+
+  IvPDomain                m_domain;
+  std::vector<CPAScenario> m_cpa_scenarios;
+};
+
+#endif
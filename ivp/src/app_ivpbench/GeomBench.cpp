@@ -0,0 +1,267 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: GeomBench.cpp                                        */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include "GeomBench.h"
+#include "XYConvexGrid.h"
+#include "XYPolygonBuckets.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+
+using namespace std;
+
+//--------------------------------------------------------
+// Constructor
+
+GeomBench::GeomBench()
+{
+  m_old_label = "Linear";
+  m_new_label = "Indexed";
+
+  m_points    = 20000;
+  m_vertices  = 64;
+  m_buckets   = 16;
+  m_reps      = 50;
+  m_cell_size = 10;
+  m_radius    = 500;
+}
+
+//--------------------------------------------------------
+// Procedure: setParam
+
+bool GeomBench::setParam(const string& param, const string& value)
+{
+  if(param == "points")
+    return(setUIntParam(m_points, value));
+  else if(param == "vertices") {
+    if(atoi(value.c_str()) < 3)
+      return(false);
+    return(setUIntParam(m_vertices, value));
+  }
+  else if(param == "buckets")
+    return(setUIntParam(m_buckets, value));
+  else if(param == "reps")
+    return(setUIntParam(m_reps, value));
+  else if(param == "cell_size")
+    return(setPosDoubleParam(m_cell_size, value));
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: handle
+
+bool GeomBench::handle()
+{
+  clearResults();
+
+  makePolygon();
+  if(!m_poly.is_convex()) {
+    printf("Unable to build a convex test polygon\n");
+    return(false);
+  }
+  makePoints();
+
+  benchConvexGrid();
+  benchContains();
+  benchDistToPoly();
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: makePolygon
+//   Purpose: A regular polygon, rotated and placed off the origin
+//            so no edge is aligned with an axis by accident.
+
+void GeomBench::makePolygon()
+{
+  m_poly.clear();
+  for(unsigned int i=0; i<m_vertices; i++) {
+    double rads = ((2 * M_PI * i) / m_vertices) + 0.1234;
+    double x = 1234.5 + (m_radius * cos(rads));
+    double y = -678.9 + (m_radius * sin(rads));
+    m_poly.add_vertex(x, y, false);
+  }
+  m_poly.determine_convexity();
+}
+
+//--------------------------------------------------------
+// Procedure: makePoints
+//   Purpose: Mostly random points around the polygon, plus points
+//            placed exactly on vertices, on edges, and on the lines
+//            between grid cells, where results are most fragile.
+
+void GeomBench::makePoints()
+{
+  m_xpts.clear();
+  m_ypts.clear();
+  srand(m_points);
+
+  double xlow = m_poly.get_vx(0);
+  double ylow = m_poly.get_vy(0);
+  for(unsigned int i=1; i<m_poly.size(); i++) {
+    if(m_poly.get_vx(i) < xlow)  xlow = m_poly.get_vx(i);
+    if(m_poly.get_vy(i) < ylow)  ylow = m_poly.get_vy(i);
+  }
+
+  double span = 3 * m_radius;
+  for(unsigned int i=0; i<m_points; i++) {
+    double x = 1234.5 - (span/2) + (span * ((double)(rand()) / RAND_MAX));
+    double y = -678.9 - (span/2) + (span * ((double)(rand()) / RAND_MAX));
+    unsigned int vix = rand() % m_poly.size();
+    unsigned int nix = (vix + 1) % m_poly.size();
+    int kind = rand() % 10;
+    if(kind == 0) {
+      x = m_poly.get_vx(vix);
+      y = m_poly.get_vy(vix);
+    }
+    else if(kind == 1) {
+      x = (m_poly.get_vx(vix) + m_poly.get_vx(nix)) / 2;
+      y = (m_poly.get_vy(vix) + m_poly.get_vy(nix)) / 2;
+    }
+    else if(kind == 2) {
+      x = xlow + (m_cell_size * floor((x - xlow) / m_cell_size));
+      y = ylow + (m_cell_size * floor((y - ylow) / m_cell_size));
+    }
+    m_xpts.push_back(x);
+    m_ypts.push_back(y);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: benchConvexGrid
+//      Note: The linear case is how pSearchGrid tested each cell 
+//            for every node report.
+
+void GeomBench::benchConvexGrid()
+{
+  XYConvexGrid grid;
+  grid.initialize(m_poly, m_cell_size, 0);
+
+  unsigned int i, ix, r, gsize = grid.size();
+  unsigned int psize = m_xpts.size();
+
+  // The linear scan is slow enough to time in a single pass
+  vector<unsigned int> linear_hits;
+  MBTimer timer1;
+  timer1.start();
+  for(i=0; i<psize; i++) {
+    for(ix=0; ix<gsize; ix++) {
+      if(grid.ptIntersect(ix, m_xpts[i], m_ypts[i]))
+	linear_hits.push_back(ix);
+    }
+    linear_hits.push_back(gsize);  // separator
+  }
+  timer1.stop();
+
+  vector<unsigned int> indexed_hits;
+  MBTimer timer2;
+  timer2.start();
+  for(r=0; r<m_reps; r++) {
+    indexed_hits.clear();
+    for(i=0; i<psize; i++) {
+      vector<unsigned int> cells = grid.ptIntersectCells(m_xpts[i], m_ypts[i]);
+      indexed_hits.insert(indexed_hits.end(), cells.begin(), cells.end());
+      indexed_hits.push_back(gsize);
+    }
+  }
+  timer2.stop();
+
+  string test = "ConvexGrid(" + uintToString(gsize) + " cells)";
+  addResult(test, timer1.get_float_wall_time(), 
+	    timer2.get_float_wall_time() / m_reps, 
+	    linear_hits == indexed_hits);
+}
+
+//--------------------------------------------------------
+// Procedure: benchContains
+
+void GeomBench::benchContains()
+{
+  XYPolygonBuckets buckets;
+  buckets.initialize(m_poly, m_buckets);
+
+  unsigned int i, r, psize = m_xpts.size();
+  vector<bool> linear_res(psize);
+  vector<bool> indexed_res(psize);
+
+  MBTimer timer1;
+  timer1.start();
+  for(r=0; r<m_reps; r++)
+    for(i=0; i<psize; i++)
+      linear_res[i] = m_poly.contains(m_xpts[i], m_ypts[i]);
+  timer1.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(r=0; r<m_reps; r++)
+    for(i=0; i<psize; i++)
+      indexed_res[i] = buckets.contains(m_xpts[i], m_ypts[i]);
+  timer2.stop();
+
+  string test = "Contains(" + uintToString(m_vertices) + " verts)";
+  addResult(test, timer1.get_float_wall_time() / m_reps, 
+	    timer2.get_float_wall_time() / m_reps, 
+	    linear_res == indexed_res);
+}
+
+//--------------------------------------------------------
+// Procedure: benchDistToPoly
+
+void GeomBench::benchDistToPoly()
+{
+  XYPolygonBuckets buckets;
+  buckets.initialize(m_poly, m_buckets);
+
+  unsigned int i, r, psize = m_xpts.size();
+  vector<double> linear_res(psize);
+  vector<double> indexed_res(psize);
+
+  MBTimer timer1;
+  timer1.start();
+  for(r=0; r<m_reps; r++)
+    for(i=0; i<psize; i++)
+      linear_res[i] = m_poly.dist_to_poly(m_xpts[i], m_ypts[i]);
+  timer1.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(r=0; r<m_reps; r++)
+    for(i=0; i<psize; i++)
+      indexed_res[i] = buckets.dist_to_poly(m_xpts[i], m_ypts[i]);
+  timer2.stop();
+
+  string test = "DistToPoly(" + uintToString(m_vertices) + " verts)";
+  addResult(test, timer1.get_float_wall_time() / m_reps, 
+	    timer2.get_float_wall_time() / m_reps, 
+	    linear_res == indexed_res);
+}
+
+//--------------------------------------------------------
+// Procedure: printSettings
+
+void GeomBench::printSettings()
+{
+  printf("Points: %u  Reps: %u  CellSize: %g  Buckets: %u\n", m_points,
+	 m_reps, m_cell_size, m_buckets);
+}
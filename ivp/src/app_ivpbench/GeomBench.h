@@ -0,0 +1,62 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: GeomBench.h                                          */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef GEOM_BENCH_HEADER
+#define GEOM_BENCH_HEADER
+
+#include <vector>
+#include <string>
+#include "BenchModule.h"
+#include "XYPolygon.h"
+
+class GeomBench : public BenchModule
+{
+ public:
+  GeomBench();
+  ~GeomBench() {}
+
+  bool setParam(const std::string& param, const std::string& value);
+  bool handle();
+
+ protected:
+  void printSettings();
+  void makePolygon();
+  void makePoints();
+
+  void benchConvexGrid();
+  void benchContains();
+  void benchDistToPoly();
+
+ protected:
+  unsigned int m_points;
+  unsigned int m_vertices;
+  unsigned int m_buckets;
+  unsigned int m_reps;
+  double       m_cell_size;
+  double       m_radius;
+
+  XYPolygon           m_poly;
+  std::vector<double> m_xpts;
+  std::vector<double> m_ypts;
+};
+
+#endif
@@ -0,0 +1,239 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: HelmParBench.cpp                                     */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cmath>
+#include <cstdio>
+#include "HelmParBench.h"
+#include "HelmEngine.h"
+#include "BehaviorSet.h"
+#include "BehaviorSpec.h"
+#include "InfoBuffer.h"
+#include "VarDataPair.h"
+#include "BuildUtils.h"
+#include "AngleUtils.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+
+using namespace std;
+
+//--------------------------------------------------------
+// Constructor
+
+HelmParBench::HelmParBench()
+{
+  m_old_label = "Serial";
+  m_new_label = "Threads";
+
+  m_contacts = 8;
+  m_iters    = 20;
+  m_threads  = 4;
+
+  // The usual helm decision space
+  m_domain.addDomain("course", 0, 359, 360);
+  m_domain.addDomain("speed", 0, 4, 41);
+}
+
+//--------------------------------------------------------
+// Procedure: setParam
+
+bool HelmParBench::setParam(const string& param, const string& value)
+{
+  if(param == "contacts")
+    return(setUIntParam(m_contacts, value));
+  else if(param == "iters")
+    return(setUIntParam(m_iters, value));
+  else if(param == "bhv_threads")
+    return(setUIntParam(m_threads, value));
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: handle
+
+bool HelmParBench::handle()
+{
+  clearResults();
+  benchProduce();
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: buildBehaviors
+//   Purpose: One BHV_AvoidCollision per contact and one
+//            BHV_ConstantSpeed, all configured with parallel=true,
+//            built as the helm builds them from a .bhv file.
+//      Note: config_ok is set to true if only the avoid collision
+//            behaviors may be produced concurrently, and the helm
+//            was warned that the constant speed behavior may not.
+
+BehaviorSet *HelmParBench::buildBehaviors(bool& config_ok)
+{
+  BehaviorSet *bset = new BehaviorSet;
+  bset->setDomain(m_domain);
+
+  config_ok = true;
+  for(unsigned int k=0; k<=m_contacts; k++) {
+    BehaviorSpec spec;
+    if(k < m_contacts) {
+      string contact = "c" + uintToString(k);
+      spec.setBehaviorKind("BHV_AvoidCollision", 0);
+      spec.addBehaviorConfig("name=avd_" + contact, 1);
+      spec.addBehaviorConfig("contact=" + contact, 2);
+    }
+    else {
+      spec.setBehaviorKind("BHV_ConstantSpeed", 0);
+      spec.addBehaviorConfig("name=const_spd", 1);
+      spec.addBehaviorConfig("speed=2", 2);
+    }
+    spec.addBehaviorConfig("parallel=true", 3);
+
+    SpecBuild sbuild = bset->buildBehaviorFromSpec(spec);
+    if(!sbuild.valid()) {
+      config_ok = false;
+      continue;
+    }
+    bset->addBehavior(sbuild.getIvPBehavior());
+    bool parallel = bset->parallelOK(bset->size()-1);
+    if(parallel != (k < m_contacts))
+      config_ok = false;
+  }
+
+  if(bset->getWarnings().size() != 1)
+    config_ok = false;
+  bset->clearWarnings();
+  return(bset);
+}
+
+//--------------------------------------------------------
+// Procedure: setBuffer
+//   Purpose: Ownship heading north at 2 m/s. The contacts start on
+//            a ring around ownship, each headed at ownship at its
+//            own speed, so each avoid collision behavior builds a
+//            different function on every iteration.
+
+void HelmParBench::setBuffer(InfoBuffer& buffer, unsigned int iter) const
+{
+  double curr_time = 1000 + iter;
+  buffer.setCurrTime(curr_time);
+  buffer.setValue("NAV_X", 0, curr_time);
+  buffer.setValue("NAV_Y", 2.0 * iter, curr_time);
+  buffer.setValue("NAV_HEADING", 0, curr_time);
+  buffer.setValue("NAV_SPEED", 2, curr_time);
+
+  for(unsigned int k=0; k<m_contacts; k++) {
+    double bearing = (360.0 * k) / m_contacts;
+    double range   = 80 + (10 * (k % 5));
+    double heading = angle360(bearing + 180);
+    double speed   = 1 + (k % 3);
+    double rads    = (bearing * M_PI) / 180;
+    double hrads   = (heading * M_PI) / 180;
+    double cnx = (range * sin(rads)) + (speed * iter * sin(hrads));
+    double cny = (range * cos(rads)) + (speed * iter * cos(hrads));
+
+    string prefix = "C" + uintToString(k) + "_NAV_";
+    buffer.setValue(prefix + "X", cnx, curr_time);
+    buffer.setValue(prefix + "Y", cny, curr_time);
+    buffer.setValue(prefix + "HEADING", heading, curr_time);
+    buffer.setValue(prefix + "SPEED", speed, curr_time);
+    buffer.setValue(prefix + "UTC", curr_time, curr_time);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: behaviorPostings
+//   Purpose: All postings of all behaviors, in behavior order, as
+//            the helm collects them after each iteration.
+
+string HelmParBench::behaviorPostings(BehaviorSet *bset) const
+{
+  string postings;
+  for(unsigned int ix=0; ix<bset->size(); ix++) {
+    vector<VarDataPair> msgs = bset->getMessages(ix);
+    for(unsigned int i=0; i<msgs.size(); i++)
+      postings += msgs[i].getPrintable() + "\n";
+  }
+  return(postings);
+}
+
+//--------------------------------------------------------
+// Procedure: benchProduce
+//   Purpose: Run the helm on the same inputs with behaviors produced
+//            serially and on worker threads. The decisions, number
+//            of functions and all behavior postings must agree on
+//            every iteration.
+
+void HelmParBench::benchProduce()
+{
+  bool config_ok[2];
+  InfoBuffer   buffers[2];
+  BehaviorSet *bsets[2];
+  HelmEngine  *engines[2];
+  for(unsigned int k=0; k<2; k++) {
+    bsets[k] = buildBehaviors(config_ok[k]);
+    bsets[k]->connectInfoBuffer(&(buffers[k]));
+    engines[k] = new HelmEngine(m_domain, &(buffers[k]));
+  }
+  engines[1]->setBehaviorThreads(m_threads);
+  addResult("parallel config", -1, 0, config_ok[0] && config_ok[1]);
+
+  bool match = true;
+  bool some_ofs = false;
+  double times[2] = {0, 0};
+  for(unsigned int i=0; i<m_iters; i++) {
+    HelmReport reports[2];
+    string postings[2];
+    for(unsigned int k=0; k<2; k++) {
+      setBuffer(buffers[k], i);
+      MBTimer timer;
+      timer.start();
+      reports[k] = engines[k]->determineNextDecision(bsets[k], 1000 + i);
+      timer.stop();
+      times[k] += timer.get_float_wall_time();
+      postings[k] = behaviorPostings(bsets[k]);
+    }
+    if(reports[0].getHalted() || reports[1].getHalted() ||
+       (reports[0].getDecisionSummary() != reports[1].getDecisionSummary()) ||
+       (reports[0].getOFNUM() != reports[1].getOFNUM()) ||
+       (postings[0] != postings[1])) {
+      printf("Mismatch on iteration %u\n", i);
+      match = false;
+    }
+    if(reports[0].getOFNUM() > 1)
+      some_ofs = true;
+  }
+  addResult("determineNextDecision", times[0], times[1],
+	    match && some_ofs);
+
+  for(unsigned int k=0; k<2; k++) {
+    delete(engines[k]);
+    delete(bsets[k]);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: printSettings
+
+void HelmParBench::printSettings()
+{
+  printf("Contacts: %u  Iters: %u  BhvThreads: %u  Domain: %s\n",
+	 m_contacts, m_iters, m_threads, domainToString(m_domain).c_str());
+}
@@ -0,0 +1,60 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: HelmParBench.h                                       */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef HELM_PAR_BENCH_HEADER
+#define HELM_PAR_BENCH_HEADER
+
+#include <vector>
+#include <string>
+#include "BenchModule.h"
+#include "IvPDomain.h"
+
+class BehaviorSet;
+class InfoBuffer;
+
+class HelmParBench : public BenchModule
+{
+ public:
+  HelmParBench();
+  ~HelmParBench() {}
+
+  bool setParam(const std::string& param, const std::string& value);
+  bool handle();
+
+ protected:
+  void printSettings();
+
+  BehaviorSet *buildBehaviors(bool& config_ok);
+  void         setBuffer(InfoBuffer&, unsigned int iter) const;
+  std::string  behaviorPostings(BehaviorSet*) const;
+
+  void benchProduce();
+
+ protected:
+  unsigned int m_contacts;
+  unsigned int m_iters;
+  unsigned int m_threads;
+
+  IvPDomain    m_domain;
+};
+
+#endif
@@ -0,0 +1,394 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: HelmReportBench.cpp                                  */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include "HelmReportBench.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+
+using namespace std;
+
+//--------------------------------------------------------
+// Constructor
+
+HelmReportBench::HelmReportBench()
+{
+  m_bhvs  = 20;
+  m_iters = 20000;
+}
+
+//--------------------------------------------------------
+// Procedure: setParam
+
+bool HelmReportBench::setParam(const string& param, const string& value)
+{
+  if(param == "bhvs")
+    return(setUIntParam(m_bhvs, value));
+  else if(param == "iters")
+    return(setUIntParam(m_iters, value));
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: handle
+
+bool HelmReportBench::handle()
+{
+  clearResults();
+
+  makeIterations();
+
+  benchBuild();
+  benchIterate(true);
+  benchIterate(false);
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: makeIterations
+//      Note: A mission at 4Hz over the course and speed domain.
+//            Each behavior changes state about every 200 iterations,
+//            and a behavior completes about every 2000 iterations,
+//            going idle on the next iteration.
+
+void HelmReportBench::makeIterations()
+{
+  srand(1);
+
+  m_domain = IvPDomain();
+  m_domain.addDomain("course", 0, 359, 360);
+  m_domain.addDomain("speed", 0, 5, 26);
+
+  m_descriptors.clear();
+  for(unsigned int b=0; b<m_bhvs; b++)
+    m_descriptors.push_back("bhv_" + uintToString(b) + "_waypt");
+
+  BenchBhvState init_state;
+  init_state.state = 'i';
+  init_state.time_entered = 0;
+  init_state.pwt  = 100;
+  init_state.pcs  = 1;
+  init_state.cpu  = 0;
+  init_state.wall = 0;
+  init_state.upds = "0/0";
+  vector<BenchBhvState> bhvs(m_bhvs, init_state);
+  for(unsigned int b=0; b<m_bhvs; b++)
+    bhvs[b].state = "ari"[b % 3];
+
+  m_iterations.clear();
+  unsigned int upd_count = 0;
+  for(unsigned int i=0; i<m_iters; i++) {
+    BenchIteration iter;
+    iter.time_utc    = 1760800000 + (i * 0.25);
+    iter.create_time = (rand() % 100) / 10000.0;
+    iter.solve_time  = (rand() % 100) / 10000.0;
+    iter.course      = rand() % 360;
+    iter.speed       = ((i / 400) % 10) * 0.5;
+    iter.modes       = "MODE@ACTIVE:";
+    iter.modes      += ((i / 1000) % 2) ? "LOITERING" : "SURVEYING";
+
+    for(unsigned int b=0; b<m_bhvs; b++) {
+      BenchBhvState& bhv = bhvs[b];
+      if(bhv.state == 'c')
+	bhv.state = 'i';
+      if((rand() % 200) == 0) {
+	bhv.state = "arri"[rand() % 4];
+	if((rand() % 10) == 0)
+	  bhv.state = 'c';
+	bhv.time_entered = iter.time_utc;
+	bhv.pwt = 100 * (1 + (rand() % 3));
+	bhv.pcs = 1 + (rand() % 40);
+      }
+      if((rand() % 500) == 0) {
+	upd_count++;
+	bhv.upds = uintToString(upd_count) + "/" + uintToString(upd_count);
+      }
+      bhv.cpu  = (rand() % 1000) / 100000.0;
+      bhv.wall = (rand() % 1000) / 100000.0;
+    }
+    iter.bhvs = bhvs;
+    m_iterations.push_back(iter);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: buildReport
+//      Note: What the HelmEngine adds to the report on an iteration.
+//            If eager, each behavior message is made as it goes with
+//            addMsg(), otherwise it is left to addBhvMsg() to make
+//            if asked for.
+
+void HelmReportBench::buildReport(HelmReport& report, unsigned int ix, 
+				  bool eager) const
+{
+  const BenchIteration& iter = m_iterations[ix];
+
+  report.clear();
+  report.setIvPDomain(m_domain);
+  report.setIteration(ix+1);
+  report.setTimeUTC(iter.time_utc);
+  report.setModeSummary(iter.modes);
+
+  unsigned int ipfs = 0;
+  for(unsigned int b=0; b<iter.bhvs.size(); b++) {
+    const BenchBhvState& bhv = iter.bhvs[b];
+    const string& descriptor = m_descriptors[b];
+    bool produced = (bhv.state == 'a');
+
+    string report_line = descriptor;
+    if(eager) {
+      if(produced) {
+	string timestr  = doubleToString(bhv.cpu,2);
+	report_line += " produces obj-function - time:" + timestr;
+	report_line += " pcs: " + doubleToString(bhv.pcs);
+	report_line += " pwt: " + doubleToString(bhv.pwt);
+      }
+      else
+	report_line += " did NOT produce an obj-function";
+      report.addMsg(report_line);
+    }
+    else if(produced)
+      report.addBhvMsg(report_line, bhv.cpu, bhv.pcs, bhv.pwt);
+    else
+      report.addBhvMsg(report_line);
+
+    if(produced) {
+      report.addActiveBHV(descriptor, bhv.time_entered, bhv.pwt, bhv.pcs,
+			  bhv.cpu, bhv.upds, 1, bhv.wall);
+      ipfs++;
+    }
+    if(bhv.state == 'r')
+      report.addRunningBHV(descriptor, bhv.time_entered, bhv.upds);
+    if(bhv.state == 'i')
+      report.addIdleBHV(descriptor, bhv.time_entered, bhv.upds);
+    if(bhv.state == 'c')
+      report.addCompletedBHV(descriptor, bhv.time_entered, bhv.upds);
+  }
+
+  report.addMsg("Number of IvP Functions: " + intToString(ipfs)); 
+  report.setOFNUM(ipfs);
+  report.addDecision("course", iter.course);
+  report.addMsg("DESIRED_COURSE: " + doubleToString(iter.course,2));
+  report.addDecision("speed", iter.speed);
+  report.addMsg("DESIRED_SPEED: " + doubleToString(iter.speed,2));
+
+  report.setCreateTime(iter.create_time);
+  report.setSolveTime(iter.solve_time);
+}
+
+//--------------------------------------------------------
+// Procedure: benchBuild
+//      Note: The report as built by the HelmEngine. The messages 
+//            made by addBhvMsg() must match those made eagerly.
+
+void HelmReportBench::benchBuild()
+{
+  unsigned int i, count = m_iterations.size();
+  unsigned int eager_total = 0;
+  unsigned int new_total = 0;
+
+  HelmReport eager_report;
+  MBTimer timer;
+  timer.start();
+  for(i=0; i<count; i++) {
+    buildReport(eager_report, i, true);
+    eager_total += eager_report.getOFNUM();
+  }
+  timer.stop();
+
+  HelmReport new_report;
+  MBTimer timer2;
+  timer2.start();
+  for(i=0; i<count; i++) {
+    buildReport(new_report, i, false);
+    new_total += new_report.getOFNUM();
+  }
+  timer2.stop();
+
+  bool match = (eager_total == new_total);
+  for(i=0; (i<count) && match; i++) {
+    buildReport(eager_report, i, true);
+    buildReport(new_report, i, false);
+    match = (eager_report.getMsgs() == new_report.getMsgs());
+  }
+
+  addResult("build report", timer.get_float_wall_time(),
+	    timer2.get_float_wall_time(), match);
+}
+
+//--------------------------------------------------------
+// Procedure: benchIterate
+//      Note: All the helm does with the report on an iteration,
+//            with or without posting the summary.
+
+void HelmReportBench::benchIterate(bool summary)
+{
+  vector<string> ref_posts;
+  vector<string> new_posts;
+  ref_posts.reserve(m_iters * 2);
+  new_posts.reserve(m_iters * 2);
+
+  double ref_time = runRef(summary, ref_posts);
+  double new_time = runNew(summary, new_posts);
+
+  bool match = (ref_posts == new_posts);
+  
+  string test = "iterate, summary=" + boolToString(summary);
+  addResult(test, ref_time, new_time, match);
+}
+
+//--------------------------------------------------------
+// Procedure: runRef
+//      Note: The reference: a report and prior report built anew on
+//            each iteration, so no part is ever kept from before,
+//            and each behavior list made to compare with the one
+//            last posted. The helm keeps completed behaviors across
+//            iterations, so each report built anew is first given
+//            those of the iterations before it.
+
+double HelmReportBench::runRef(bool summary, vector<string>& posts)
+{
+  string active_list, running_list, idle_list;
+  vector<BenchIxPair> completed;
+  unsigned int prev_completed = 0;
+
+  MBTimer timer;
+  timer.start();
+  for(unsigned int i=0; i<m_iterations.size(); i++) {
+    unsigned int curr_completed = completed.size();
+
+    HelmReport report;
+    addCompleted(report, completed, curr_completed);
+    buildReport(report, i, true);
+    if(summary) {
+      HelmReport prev_report;
+      if(i > 0) {
+	addCompleted(prev_report, completed, prev_completed);
+	buildReport(prev_report, i-1, true);
+      }
+      posts.push_back(report.getReportAsString(prev_report));
+    }
+
+    string bhvs_active_list = report.getActiveBehaviors(false);
+    if(active_list != bhvs_active_list) {
+      posts.push_back("ACTIVE=" + bhvs_active_list);
+      active_list = bhvs_active_list;
+    }
+    string bhvs_running_list = report.getRunningBehaviors(false);
+    if(running_list != bhvs_running_list) {
+      posts.push_back("RUNNING=" + bhvs_running_list);
+      running_list = bhvs_running_list;
+    }
+    string bhvs_idle_list = report.getIdleBehaviors(false);
+    if(idle_list != bhvs_idle_list) {
+      posts.push_back("IDLE=" + bhvs_idle_list);
+      idle_list = bhvs_idle_list;
+    }
+
+    for(unsigned int b=0; b<m_iterations[i].bhvs.size(); b++)
+      if(m_iterations[i].bhvs[b].state == 'c')
+	completed.push_back(make_pair(i, b));
+    prev_completed = curr_completed;
+  }
+  timer.stop();
+  return(timer.get_float_wall_time());
+}
+
+//--------------------------------------------------------
+// Procedure: addCompleted
+//      Note: Adds the first count of the given completions, each
+//            an iteration and behavior index, as the helm would
+//            have added them.
+
+void HelmReportBench::addCompleted(HelmReport& report, 
+				   const vector<BenchIxPair>& completed,
+				   unsigned int count) const
+{
+  for(unsigned int k=0; (k<count) && (k<completed.size()); k++) {
+    unsigned int ix = completed[k].first;
+    unsigned int b  = completed[k].second;
+    const BenchBhvState& bhv = m_iterations[ix].bhvs[b];
+    report.addCompletedBHV(m_descriptors[b], bhv.time_entered, bhv.upds);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: runNew
+//      Note: As pHelmIvP does on each iteration, keeping the parts
+//            of the prior report and skipping the behavior lists
+//            when no behavior changed state.
+
+double HelmReportBench::runNew(bool summary, vector<string>& posts)
+{
+  HelmReport report;
+  HelmReport prev_report;
+  string active_list, running_list, idle_list;
+
+  MBTimer timer;
+  timer.start();
+  for(unsigned int i=0; i<m_iterations.size(); i++) {
+    buildReport(report, i, false);
+    if(summary)
+      posts.push_back(report.getReportAsString(prev_report));
+
+    if(report.changedActiveBHVs(prev_report)) {
+      string bhvs_active_list = report.getActiveBehaviors(false);
+      if(active_list != bhvs_active_list) {
+	posts.push_back("ACTIVE=" + bhvs_active_list);
+	active_list = bhvs_active_list;
+      }
+    }
+    if(report.changedRunningBHVs(prev_report)) {
+      string bhvs_running_list = report.getRunningBehaviors(false);
+      if(running_list != bhvs_running_list) {
+	posts.push_back("RUNNING=" + bhvs_running_list);
+	running_list = bhvs_running_list;
+      }
+    }
+    if(report.changedIdleBHVs(prev_report)) {
+      string bhvs_idle_list = report.getIdleBehaviors(false);
+      if(idle_list != bhvs_idle_list) {
+	posts.push_back("IDLE=" + bhvs_idle_list);
+	idle_list = bhvs_idle_list;
+      }
+    }
+    prev_report = report;
+  }
+  timer.stop();
+  return(timer.get_float_wall_time());
+}
+
+//--------------------------------------------------------
+// Procedure: printSettings
+
+void HelmReportBench::printSettings()
+{
+  printf("Behaviors: %u  Iterations: %u\n", m_bhvs, m_iters);
+  if(m_iters > 0) {
+    printf("Per iteration (us):");
+    for(unsigned int i=0; i<m_test.size(); i++)
+      printf("  %s: %.1f/%.1f", m_test[i].c_str(), 
+	     m_old_time[i] * 1e6 / m_iters, m_new_time[i] * 1e6 / m_iters);
+    printf("\n");
+  }
+}
@@ -0,0 +1,90 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: HelmReportBench.h                                    */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef HELM_REPORT_BENCH_HEADER
+#define HELM_REPORT_BENCH_HEADER
+
+#include <vector>
+#include <string>
+#include <utility>
+#include "BenchModule.h"
+#include "HelmReport.h"
+
+// The state of one behavior on one iteration of a generated mission
+struct BenchBhvState
+{
+  char         state;   // 'a'ctive, 'r'unning, 'i'dle or 'c'ompleted
+  double       time_entered;
+  double       pwt;
+  int          pcs;
+  double       cpu;
+  double       wall;
+  std::string  upds;
+};
+
+// All the helm does on one iteration that shows in the report
+struct BenchIteration
+{
+  double       time_utc;
+  double       create_time;
+  double       solve_time;
+  double       course;
+  double       speed;
+  std::string  modes;
+  std::vector<BenchBhvState> bhvs;
+};
+
+// An iteration and behavior index
+typedef std::pair<unsigned int, unsigned int> BenchIxPair;
+
+class HelmReportBench : public BenchModule
+{
+ public:
+  HelmReportBench();
+  ~HelmReportBench() {}
+
+  bool setParam(const std::string& param, const std::string& value);
+  bool handle();
+
+ protected:
+  void printSettings();
+  void makeIterations();
+  void buildReport(HelmReport&, unsigned int iter, bool eager) const;
+  void addCompleted(HelmReport&, const std::vector<BenchIxPair>&,
+		    unsigned int count) const;
+
+  void benchBuild();
+  void benchIterate(bool summary);
+
+  double runRef(bool summary, std::vector<std::string>& posts);
+  double runNew(bool summary, std::vector<std::string>& posts);
+
+ protected:
+  unsigned int m_bhvs;
+  unsigned int m_iters;
+
+  IvPDomain                   m_domain;
+  std::vector<std::string>    m_descriptors;
+  std::vector<BenchIteration> m_iterations;
+};
+
+#endif
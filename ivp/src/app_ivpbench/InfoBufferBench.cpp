@@ -0,0 +1,393 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: InfoBufferBench.cpp                                  */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include "InfoBufferBench.h"
+#include "InfoBuffer.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+
+using namespace std;
+
+//--------------------------------------------------------
+// BufferModel: What the queries on one variable should give,
+// kept as plainly as possible as the reference.
+
+struct BufferModel
+{
+  BufferModel() {known=false; has_s=false; has_d=false; dval=0; 
+    time=0; msg_time=0; has_sdeltas=false; has_ddeltas=false;}
+
+  bool   known;
+  bool   has_s;
+  bool   has_d;
+  string sval;
+  double dval;
+  double time;
+  double msg_time;
+
+  bool           has_sdeltas;
+  bool           has_ddeltas;
+  vector<string> sdeltas;
+  vector<double> ddeltas;
+};
+
+//--------------------------------------------------------
+// Procedure: applyOp
+
+static void applyOp(InfoBuffer& buffer, const BufferOp& op, 
+		    const string& var)
+{
+  if(op.kind == 'd')
+    buffer.setValue(var, op.dval, op.msg_time);
+  else if(op.kind == 's')
+    buffer.setValue(var, op.sval, op.msg_time);
+  else if(op.kind == 'c')
+    buffer.clearDeltaVectors();
+  else if(op.kind == 't')
+    buffer.setCurrTime(op.dval);
+}
+
+//--------------------------------------------------------
+// Procedure: applyOp
+//      Note: A value set is known from then on, with the time it
+//            was set, and the message time if given or else the 
+//            same time. It is a delta until the deltas are cleared.
+
+static void applyOp(vector<BufferModel>& models, double& curr_time,
+		    const BufferOp& op)
+{
+  BufferModel& model = models[op.var_ix];
+  if((op.kind == 'd') || (op.kind == 's')) {
+    model.known = true;
+    model.time  = curr_time;
+    model.msg_time = (op.msg_time == 0) ? curr_time : op.msg_time;
+  }
+
+  if(op.kind == 'd') {
+    model.has_d = true;
+    model.dval  = op.dval;
+    model.has_ddeltas = true;
+    model.ddeltas.push_back(op.dval);
+  }
+  else if(op.kind == 's') {
+    model.has_s = true;
+    model.sval  = op.sval;
+    model.has_sdeltas = true;
+    model.sdeltas.push_back(op.sval);
+  }
+  else if(op.kind == 'c') {
+    for(unsigned int i=0; i<models.size(); i++) {
+      models[i].has_sdeltas = false;
+      models[i].has_ddeltas = false;
+      models[i].sdeltas.clear();
+      models[i].ddeltas.clear();
+    }
+  }
+  else if(op.kind == 't')
+    curr_time = op.dval;
+}
+
+//--------------------------------------------------------
+// Procedure: queryVar
+//      Note: Every query by name on the variable, with the results
+//            added in the order made.
+
+static void queryVar(InfoBuffer& buffer, const string& var, 
+		     vector<double>& dres, vector<string>& sres, 
+		     vector<bool>& bres)
+{
+  bool ok;
+  sres.push_back(buffer.sQuery(var, ok));
+  bres.push_back(ok);
+  dres.push_back(buffer.dQuery(var, ok));
+  bres.push_back(ok);
+  dres.push_back(buffer.tQuery(var));
+  dres.push_back(buffer.mtQuery(var, false));
+  bres.push_back(buffer.isKnown(var));
+
+  vector<string> sdeltas = buffer.sQueryDeltas(var, ok);
+  bres.push_back(ok);
+  sres.insert(sres.end(), sdeltas.begin(), sdeltas.end());
+  vector<double> ddeltas = buffer.dQueryDeltas(var, ok);
+  bres.push_back(ok);
+  dres.insert(dres.end(), ddeltas.begin(), ddeltas.end());
+}
+
+//--------------------------------------------------------
+// Procedure: queryVar
+//      Note: What each query of the above should give, in the same
+//            order. An unknown variable has no time, given as -1.
+
+static void queryVar(const BufferModel& model, double curr_time,
+		     vector<double>& dres, vector<string>& sres, 
+		     vector<bool>& bres)
+{
+  sres.push_back(model.has_s ? model.sval : "");
+  bres.push_back(model.has_s);
+  dres.push_back(model.has_d ? model.dval : 0);
+  bres.push_back(model.has_d);
+  dres.push_back(model.known ? (curr_time - model.time) : -1);
+  dres.push_back(model.known ? model.msg_time : -1);
+  bres.push_back(model.known);
+
+  bres.push_back(model.has_sdeltas);
+  sres.insert(sres.end(), model.sdeltas.begin(), model.sdeltas.end());
+  bres.push_back(model.has_ddeltas);
+  dres.insert(dres.end(), model.ddeltas.begin(), model.ddeltas.end());
+}
+
+//--------------------------------------------------------
+// Constructor
+
+InfoBufferBench::InfoBufferBench()
+{
+  m_ops  = 200000;
+  m_vars = 6;
+  m_reps = 3;
+}
+
+//--------------------------------------------------------
+// Procedure: setParam
+
+bool InfoBufferBench::setParam(const string& param, const string& value)
+{
+  if(param == "ops")
+    return(setUIntParam(m_ops, value));
+  else if(param == "vars")
+    return(setUIntParam(m_vars, value));
+  else if(param == "reps")
+    return(setUIntParam(m_reps, value));
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: handle
+
+bool InfoBufferBench::handle()
+{
+  clearResults();
+  makeOps();
+
+  benchOps();
+  benchQueryByID();
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: makeOps
+//      Note: Few variables, so each is set, queried and has its
+//            deltas cleared many times over. Values are set as
+//            both types, with and without a message time.
+
+void InfoBufferBench::makeOps()
+{
+  m_var_names.clear();
+  m_buffer_ops.clear();
+  for(unsigned int i=0; i<m_vars; i++)
+    m_var_names.push_back("VAR_" + uintToString(i));
+
+  srand(3);
+  for(unsigned int i=0; i<m_ops; i++) {
+    BufferOp op;
+    op.var_ix   = rand() % m_vars;
+    op.dval     = 0;
+    op.msg_time = 0;
+
+    int choice = rand() % 10;
+    if(choice < 3) {
+      op.kind = 'd';
+      op.dval = rand() % 100;
+      if((rand() % 2) == 0)
+	op.msg_time = rand() % 50;
+    }
+    else if(choice < 6) {
+      op.kind = 's';
+      op.sval = "s" + intToString(rand() % 20);
+      if((rand() % 2) == 0)
+	op.msg_time = 3;
+    }
+    else if(choice == 6)
+      op.kind = 'c';
+    else if(choice == 7) {
+      op.kind = 't';
+      op.dval = rand() % 1000;
+    }
+    else
+      op.kind = 'q';
+    m_buffer_ops.push_back(op);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: benchOps
+//   Purpose: Time all operations, each followed by queries by name,
+//            and compare every query result with the model.
+
+void InfoBufferBench::benchOps()
+{
+  vector<double> dres, model_dres;
+  vector<string> sres, model_sres;
+  vector<bool>   bres, model_bres;
+  unsigned int i, r, count = m_buffer_ops.size();
+
+  MBTimer timer;
+  timer.start();
+  for(r=0; r<m_reps; r++) {
+    dres.clear();
+    sres.clear();
+    bres.clear();
+    InfoBuffer buffer;
+    for(i=0; i<count; i++) {
+      const string& var = m_var_names[m_buffer_ops[i].var_ix];
+      applyOp(buffer, m_buffer_ops[i], var);
+      queryVar(buffer, var, dres, sres, bres);
+    }
+  }
+  timer.stop();
+
+  vector<BufferModel> models(m_var_names.size());
+  double curr_time = 0;
+  for(i=0; i<count; i++) {
+    applyOp(models, curr_time, m_buffer_ops[i]);
+    queryVar(models[m_buffer_ops[i].var_ix], curr_time, model_dres,
+	     model_sres, model_bres);
+  }
+
+  bool match = ((dres == model_dres) && (sres == model_sres) &&
+		(bres == model_bres));
+  addResult("setValue+query", -1, timer.get_float_wall_time() / m_reps,
+	    match);
+}
+
+//--------------------------------------------------------
+// Procedure: benchQueryByID
+//   Purpose: Time the string and double queries a behavior makes of
+//            its condition variables, by name and by ID.
+
+void InfoBufferBench::benchQueryByID()
+{
+  InfoBuffer buffer;
+  unsigned int i, r, count = m_buffer_ops.size();
+  for(i=0; i<count; i++) {
+    const string& var = m_var_names[m_buffer_ops[i].var_ix];
+    applyOp(buffer, m_buffer_ops[i], var);
+  }
+
+  vector<unsigned int> ids;
+  for(i=0; i<m_var_names.size(); i++)
+    ids.push_back(buffer.getVarID(m_var_names[i]));
+
+  double name_total = 0;
+  double id_total = 0;
+  bool   ok;
+
+  MBTimer timer;
+  timer.start();
+  for(r=0; r<m_reps; r++) {
+    for(i=0; i<count; i++) {
+      const string& var = m_var_names[m_buffer_ops[i].var_ix];
+      name_total += buffer.sQuery(var, ok).size();
+      name_total += buffer.dQuery(var, ok);
+    }
+  }
+  timer.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(r=0; r<m_reps; r++) {
+    for(i=0; i<count; i++) {
+      unsigned int id = ids[m_buffer_ops[i].var_ix];
+      id_total += buffer.sQuery(id, ok).size();
+      id_total += buffer.dQuery(id, ok);
+    }
+  }
+  timer2.stop();
+
+  bool match = (name_total == id_total) && checkByID();
+  addResult("query by ID", timer.get_float_wall_time() / m_reps,
+	    timer2.get_float_wall_time() / m_reps, match);
+}
+
+//--------------------------------------------------------
+// Procedure: checkByID
+//   Purpose: Replay the operations and confirm, after each one, that
+//            every query by ID agrees with the same query by name,
+//            that IDs are found without being interned, and that
+//            changedSince() is true for exactly the variables set
+//            since the deltas were last cleared.
+
+bool InfoBufferBench::checkByID() const
+{
+  InfoBuffer buffer;
+  vector<unsigned int> set_iter(m_var_names.size(), 0);
+  vector<bool>         ever_set(m_var_names.size(), false);
+
+  for(unsigned int i=0; i<m_buffer_ops.size(); i++) {
+    const BufferOp& op = m_buffer_ops[i];
+    const string& var = m_var_names[op.var_ix];
+    applyOp(buffer, op, var);
+    if((op.kind == 'd') || (op.kind == 's')) {
+      set_iter[op.var_ix] = buffer.getIteration();
+      ever_set[op.var_ix] = true;
+    }
+
+    unsigned int id;
+    const InfoBuffer& cbuffer = buffer;
+    bool found = cbuffer.findVarID(var, id);
+    if(found != ever_set[op.var_ix])
+      return(false);
+    if(!found)
+      continue;
+
+    bool ok1, ok2;
+    if((buffer.sQuery(id, ok1) != buffer.sQuery(var, ok2)) || (ok1 != ok2))
+      return(false);
+    if((buffer.dQuery(id, ok1) != buffer.dQuery(var, ok2)) || (ok1 != ok2))
+      return(false);
+    if(buffer.tQuery(id, false) != buffer.tQuery(var, false))
+      return(false);
+    if(buffer.mtQuery(id, false) != buffer.mtQuery(var, false))
+      return(false);
+    if(buffer.sQueryDeltas(id) != buffer.sQueryDeltas(var, ok1))
+      return(false);
+    if(buffer.dQueryDeltas(id) != buffer.dQueryDeltas(var, ok1))
+      return(false);
+
+    // Changed in this round of deltas, or not
+    unsigned int iter = buffer.getIteration();
+    bool changed = ever_set[op.var_ix] && (set_iter[op.var_ix] == iter);
+    if(buffer.changedSince(id, iter) != changed)
+      return(false);
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: printSettings
+
+void InfoBufferBench::printSettings()
+{
+  printf("Operations: %u  Variables: %u  Reps: %u\n", m_ops, m_vars, 
+	 m_reps);
+}
@@ -0,0 +1,66 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: InfoBufferBench.h                                    */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef INFO_BUFFER_BENCH_HEADER
+#define INFO_BUFFER_BENCH_HEADER
+
+#include <vector>
+#include <string>
+#include "BenchModule.h"
+
+// One operation on the buffer, followed by queries on its variable
+struct BufferOp
+{
+  char         kind;    // 'd'ouble, 's'tring, 'c'lear deltas, 't'ime
+  unsigned int var_ix;
+  double       dval;
+  std::string  sval;
+  double       msg_time;
+};
+
+class InfoBufferBench : public BenchModule
+{
+ public:
+  InfoBufferBench();
+  ~InfoBufferBench() {}
+
+  bool setParam(const std::string& param, const std::string& value);
+  bool handle();
+
+ protected:
+  void printSettings();
+  void makeOps();
+
+  void benchOps();
+  void benchQueryByID();
+  bool checkByID() const;
+
+ protected:
+  unsigned int m_ops;
+  unsigned int m_vars;
+  unsigned int m_reps;
+
+  std::vector<std::string> m_var_names;
+  std::vector<BufferOp>    m_buffer_ops;
+};
+
+#endif
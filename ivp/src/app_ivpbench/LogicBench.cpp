@@ -0,0 +1,351 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: LogicBench.cpp                                       */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include "LogicBench.h"
+#include "LogicCondition.h"
+#include "ParseNode.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+
+using namespace std;
+
+//========================================================
+// The conditions are evaluated the way they were before they
+// were compiled: by the ParseNode tree. Each LogicCondition must
+// agree with the tree it was compiled from.
+//========================================================
+
+//--------------------------------------------------------
+// Constructor
+
+LogicBench::LogicBench()
+{
+  m_old_label = "Tree";
+  m_new_label = "Compiled";
+
+  m_conds  = 20000;
+  m_rounds = 6;
+  m_reps   = 5;
+
+  m_vars.push_back("A");
+  m_vars.push_back("B");
+  m_vars.push_back("C");
+}
+
+//--------------------------------------------------------
+// Procedure: setParam
+
+bool LogicBench::setParam(const string& param, const string& value)
+{
+  if(param == "conds")
+    return(setUIntParam(m_conds, value));
+  else if(param == "rounds")
+    return(setUIntParam(m_rounds, value));
+  else if(param == "reps")
+    return(setUIntParam(m_reps, value));
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: handle
+
+bool LogicBench::handle()
+{
+  clearResults();
+  makeConditions();
+  if(m_cond_strs.size() == 0) {
+    printf("Unable to generate any valid conditions\n");
+    return(false);
+  }
+
+  benchEval();
+  benchEvalByIndex();
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: randomRelation
+
+static string randomRelation(const vector<string>& vars)
+{
+  const char *rels[] = {"=", "==", "!=", "<", "<=", ">", ">="};
+  const char *lits[] = {"5", "3.2", "abc", "\"abc\"", "\"5\"", "$(B)", 
+			"$(C)", "x=1", "-2", "\"x=1,y=2\""};
+  return(vars[rand() % vars.size()] + " " + rels[rand() % 7] + " " +
+	 lits[rand() % 10]);
+}
+
+//--------------------------------------------------------
+// Procedure: randomCondition
+
+static string randomCondition(const vector<string>& vars, int depth)
+{
+  int choice = rand() % 4;
+  if((depth == 0) || (choice == 0))
+    return(randomRelation(vars));
+  if(choice == 1)
+    return("!(" + randomCondition(vars, depth-1) + ")");
+
+  string join = (choice == 2) ? "and" : "or";
+  return("(" + randomCondition(vars, depth-1) + ") " + join + " (" +
+	 randomCondition(vars, depth-1) + ")");
+}
+
+//--------------------------------------------------------
+// Procedure: makeConditions
+//      Note: Random conditions over three variables, nested up to
+//            three deep with and, or and not. The literals mix
+//            numbers, strings, quoted numbers and other variables,
+//            and the values set mix strings and doubles so both
+//            sides of every comparison are exercised. Conditions
+//            that do not parse are dropped.
+
+void LogicBench::makeConditions()
+{
+  m_cond_strs.clear();
+  m_cond_rounds.clear();
+
+  const char *svals[] = {"5", "abc", "\"abc\"", "3.2", "x=1,y=2", "y=2",
+			 "\"5\"", "-2", " 5"};
+
+  srand(7);
+  for(unsigned int i=0; i<m_conds; i++) {
+    string cond = randomCondition(m_vars, 3);
+    ParseNode node(cond);
+    if(!node.recursiveParse() || !node.recursiveSyntaxCheck())
+      continue;
+
+    vector<LogicRound> rounds;
+    for(unsigned int j=0; j<m_rounds; j++) {
+      LogicRound round;
+      round.clear = ((rand() % 3) == 0);
+      unsigned int sets = rand() % 4;
+      for(unsigned int k=0; k<sets; k++) {
+	round.var_ix.push_back(rand() % m_vars.size());
+	bool is_string = ((rand() % 2) == 0);
+	round.is_string.push_back(is_string);
+	round.svals.push_back(svals[rand() % 9]);
+	double dval = (rand() % 9) - 3;
+	if((rand() % 2) == 0)
+	  dval = 3.2;
+	round.dvals.push_back(dval);
+      }
+      rounds.push_back(round);
+    }
+    m_cond_strs.push_back(cond);
+    m_cond_rounds.push_back(rounds);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: evalLegacy
+//   Purpose: Apply each round to the ParseNode tree of each condition
+//            and note the result of each evaluation.
+
+void LogicBench::evalLegacy(vector<ParseNode*>& nodes, 
+			    vector<bool>& results) const
+{
+  for(unsigned int i=0; i<nodes.size(); i++) {
+    ParseNode *node = nodes[i];
+    const vector<LogicRound>& rounds = m_cond_rounds[i];
+    for(unsigned int j=0; j<rounds.size(); j++) {
+      const LogicRound& round = rounds[j];
+      if(round.clear)
+	node->recursiveClearVarVal();
+      for(unsigned int k=0; k<round.var_ix.size(); k++) {
+	const string& var = m_vars[round.var_ix[k]];
+	if(round.is_string[k])
+	  node->recursiveSetVarVal(var, round.svals[k]);
+	else
+	  node->recursiveSetVarVal(var, round.dvals[k]);
+      }
+      results.push_back(node->recursiveEvaluate());
+    }
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: timeLegacy
+//   Purpose: Time all rounds over all conditions, m_reps times, with
+//            the ParseNode trees. The trees are built before timing,
+//            as a behavior builds its conditions once.
+
+double LogicBench::timeLegacy(vector<bool>& results) const
+{
+  vector<ParseNode*> nodes;
+  for(unsigned int i=0; i<m_cond_strs.size(); i++) {
+    ParseNode *node = new ParseNode(m_cond_strs[i]);
+    node->recursiveParse();
+    node->recursiveSyntaxCheck();
+    nodes.push_back(node);
+  }
+
+  MBTimer timer;
+  timer.start();
+  for(unsigned int r=0; r<m_reps; r++) {
+    results.clear();
+    evalLegacy(nodes, results);
+  }
+  timer.stop();
+
+  for(unsigned int i=0; i<nodes.size(); i++)
+    delete(nodes[i]);
+  return(timer.get_float_wall_time());
+}
+
+//--------------------------------------------------------
+// Procedure: benchEval
+
+void LogicBench::benchEval()
+{
+  vector<bool> legacy_results;
+  double legacy_time = timeLegacy(legacy_results);
+
+  vector<LogicCondition> conds(m_cond_strs.size());
+  for(unsigned int i=0; i<m_cond_strs.size(); i++)
+    conds[i].setCondition(m_cond_strs[i]);
+
+  vector<bool> new_results;
+  MBTimer timer;
+  timer.start();
+  for(unsigned int r=0; r<m_reps; r++) {
+    new_results.clear();
+    for(unsigned int i=0; i<conds.size(); i++) {
+      LogicCondition& cond = conds[i];
+      const vector<LogicRound>& rounds = m_cond_rounds[i];
+      for(unsigned int j=0; j<rounds.size(); j++) {
+	const LogicRound& round = rounds[j];
+	if(round.clear)
+	  cond.clearVarVals();
+	for(unsigned int k=0; k<round.var_ix.size(); k++) {
+	  const string& var = m_vars[round.var_ix[k]];
+	  if(round.is_string[k])
+	    cond.setVarVal(var, round.svals[k]);
+	  else
+	    cond.setVarVal(var, round.dvals[k]);
+	}
+	new_results.push_back(cond.eval());
+      }
+    }
+  }
+  timer.stop();
+
+  bool match = (legacy_results == new_results) && checkCopies();
+  addResult("setVarVal+eval", legacy_time / m_reps, 
+	    timer.get_float_wall_time() / m_reps, match);
+}
+
+//--------------------------------------------------------
+// Procedure: benchEvalByIndex
+//      Note: As a behavior does it, the variable names are resolved
+//            to indices once and values are then set by index.
+
+void LogicBench::benchEvalByIndex()
+{
+  vector<bool> legacy_results;
+  double legacy_time = timeLegacy(legacy_results);
+
+  vector<LogicCondition> conds(m_cond_strs.size());
+  vector<vector<int> > var_ix(m_cond_strs.size());
+  for(unsigned int i=0; i<m_cond_strs.size(); i++) {
+    conds[i].setCondition(m_cond_strs[i]);
+    for(unsigned int v=0; v<m_vars.size(); v++)
+      var_ix[i].push_back(conds[i].getVarIndex(m_vars[v]));
+  }
+
+  vector<bool> new_results;
+  MBTimer timer;
+  timer.start();
+  for(unsigned int r=0; r<m_reps; r++) {
+    new_results.clear();
+    for(unsigned int i=0; i<conds.size(); i++) {
+      LogicCondition& cond = conds[i];
+      const vector<LogicRound>& rounds = m_cond_rounds[i];
+      for(unsigned int j=0; j<rounds.size(); j++) {
+	const LogicRound& round = rounds[j];
+	if(round.clear)
+	  cond.clearVarVals();
+	for(unsigned int k=0; k<round.var_ix.size(); k++) {
+	  int ix = var_ix[i][round.var_ix[k]];
+	  if(ix < 0)
+	    continue;
+	  if(round.is_string[k])
+	    cond.setVarValByIx((unsigned int)(ix), round.svals[k]);
+	  else
+	    cond.setVarValByIx((unsigned int)(ix), round.dvals[k]);
+	}
+	new_results.push_back(cond.eval());
+      }
+    }
+  }
+  timer.stop();
+
+  bool match = (legacy_results == new_results);
+  addResult("setVarValByIx+eval", legacy_time / m_reps, 
+	    timer.get_float_wall_time() / m_reps, match);
+}
+
+//--------------------------------------------------------
+// Procedure: checkCopies
+//   Purpose: Confirm a copy and an assigned copy of a condition,
+//            made part way through the rounds, carry its variable
+//            values and give the same result.
+
+bool LogicBench::checkCopies() const
+{
+  for(unsigned int i=0; i<m_cond_strs.size(); i++) {
+    LogicCondition cond;
+    cond.setCondition(m_cond_strs[i]);
+
+    const vector<LogicRound>& rounds = m_cond_rounds[i];
+    for(unsigned int j=0; j<rounds.size(); j++) {
+      const LogicRound& round = rounds[j];
+      if(round.clear)
+	cond.clearVarVals();
+      for(unsigned int k=0; k<round.var_ix.size(); k++) {
+	const string& var = m_vars[round.var_ix[k]];
+	if(round.is_string[k])
+	  cond.setVarVal(var, round.svals[k]);
+	else
+	  cond.setVarVal(var, round.dvals[k]);
+      }
+      LogicCondition copied(cond);
+      LogicCondition assigned;
+      assigned = cond;
+      bool result = cond.eval();
+      if((copied.eval() != result) || (assigned.eval() != result))
+	return(false);
+    }
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: printSettings
+
+void LogicBench::printSettings()
+{
+  printf("Conditions: %u  Rounds: %u  Reps: %u\n", 
+	 (unsigned int)(m_cond_strs.size()), m_rounds, m_reps);
+}
@@ -0,0 +1,74 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: LogicBench.h                                         */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef LOGIC_BENCH_HEADER
+#define LOGIC_BENCH_HEADER
+
+#include <vector>
+#include <string>
+#include "BenchModule.h"
+
+class ParseNode;
+
+// One round of changes to the variables of a condition, made
+// before the condition is evaluated
+struct LogicRound
+{
+  bool                     clear;
+  std::vector<unsigned int> var_ix;
+  std::vector<bool>        is_string;
+  std::vector<std::string> svals;
+  std::vector<double>      dvals;
+};
+
+class LogicBench : public BenchModule
+{
+ public:
+  LogicBench();
+  ~LogicBench() {}
+
+  bool setParam(const std::string& param, const std::string& value);
+  bool handle();
+
+ protected:
+  void   printSettings();
+  void   makeConditions();
+
+  void   benchEval();
+  void   benchEvalByIndex();
+
+  void   evalLegacy(std::vector<ParseNode*>& nodes, 
+		    std::vector<bool>& results) const;
+  double timeLegacy(std::vector<bool>& results) const;
+  bool   checkCopies() const;
+
+ protected:
+  unsigned int m_conds;
+  unsigned int m_rounds;
+  unsigned int m_reps;
+
+  std::vector<std::string>             m_vars;
+  std::vector<std::string>             m_cond_strs;
+  std::vector<std::vector<LogicRound> > m_cond_rounds;
+};
+
+#endif
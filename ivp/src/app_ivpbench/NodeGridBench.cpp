@@ -0,0 +1,322 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: NodeGridBench.cpp                                    */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include "NodeGridBench.h"
+#include "NodeGrid.h"
+#include "CPAEngine.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+
+using namespace std;
+
+//--------------------------------------------------------
+// Constructor
+
+NodeGridBench::NodeGridBench()
+{
+  m_counts.push_back(10);
+  m_counts.push_back(100);
+  m_counts.push_back(500);
+  m_counts.push_back(2000);
+
+  m_reps        = 10;
+  m_spacing     = 200;
+  m_min_cpa     = 10;
+  m_comms_range = 500;
+  m_max_tol     = 2;
+}
+
+//--------------------------------------------------------
+// Procedure: setParam
+
+bool NodeGridBench::setParam(const string& param, const string& value)
+{
+  if(param == "vehicles") {
+    vector<unsigned int> counts;
+    vector<string> svector = parseString(value, ',');
+    for(unsigned int i=0; i<svector.size(); i++) {
+      int ival = atoi(svector[i].c_str());
+      if(!isNumber(svector[i]) || (ival < 2))
+	return(false);
+      counts.push_back((unsigned int)(ival));
+    }
+    if(counts.size() == 0)
+      return(false);
+    m_counts = counts;
+  }
+  else if(param == "reps")
+    return(setUIntParam(m_reps, value));
+  else if(param == "spacing")
+    return(setPosDoubleParam(m_spacing, value));
+  else if(param == "min_cpa")
+    return(setPosDoubleParam(m_min_cpa, value));
+  else if(param == "comms_range")
+    return(setPosDoubleParam(m_comms_range, value));
+  else
+    return(false);
+
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: handle
+//   Purpose: For each vehicle count, find the pairs that would be
+//            flagged by uFldCollisionDetect (CPA within min_cpa) and
+//            by uFldNodeComms (within comms range), once checking
+//            all pairs and once checking only pairs from the grid.
+
+bool NodeGridBench::handle()
+{
+  m_cpa_brute_time.clear();
+  m_cpa_grid_time.clear();
+  m_rng_brute_time.clear();
+  m_rng_grid_time.clear();
+  m_cpa_pairs.clear();
+  m_rng_pairs.clear();
+  clearResults();
+
+  for(unsigned int i=0; i<m_counts.size(); i++) {
+    makeNodes(m_counts[i]);
+
+    double cpa_brute = 0, cpa_grid = 0;
+    double rng_brute = 0, rng_grid = 0;
+    unsigned int cpa_pairs = 0, rng_pairs = 0;
+    bool match = true;
+    for(unsigned int j=0; j<m_reps; j++) {
+      unsigned int brute_pairs = 0;
+      unsigned int grid_pairs  = 0;
+      cpa_brute += cpaPairsBrute(brute_pairs);
+      cpa_grid  += cpaPairsGrid(grid_pairs);
+      match = match && (brute_pairs == grid_pairs);
+      cpa_pairs = brute_pairs;
+
+      rng_brute += rangePairsBrute(brute_pairs);
+      rng_grid  += rangePairsGrid(grid_pairs);
+      match = match && (brute_pairs == grid_pairs);
+      rng_pairs = brute_pairs;
+    }
+    m_cpa_brute_time.push_back(cpa_brute);
+    m_cpa_grid_time.push_back(cpa_grid);
+    m_rng_brute_time.push_back(rng_brute);
+    m_rng_grid_time.push_back(rng_grid);
+    m_cpa_pairs.push_back(cpa_pairs);
+    m_rng_pairs.push_back(rng_pairs);
+    m_test.push_back(uintToString(m_counts[i]) + " vehicles");
+    m_match.push_back(match);
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: makeNodes
+//   Purpose: Scatter the given number of vehicles over a square
+//            sized so the density is the same for every count.
+
+void NodeGridBench::makeNodes(unsigned int amt)
+{
+  m_nodes.clear();
+  m_tols.clear();
+
+  srand(amt);
+  double side = sqrt((double)(amt)) * m_spacing;
+  for(unsigned int i=0; i<amt; i++) {
+    char name[32];
+    sprintf(name, "v%06u", i);
+
+    NodeRecord record(name);
+    record.setX(side * ((double)(rand()) / RAND_MAX));
+    record.setY(side * ((double)(rand()) / RAND_MAX));
+    record.setHeading(360 * ((double)(rand()) / RAND_MAX));
+    record.setSpeed(5 * ((double)(rand()) / RAND_MAX));
+    m_nodes.push_back(record);
+    m_tols.push_back(m_max_tol * ((double)(rand()) / RAND_MAX));
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: cpaPairsBrute
+
+double NodeGridBench::cpaPairsBrute(unsigned int& pairs)
+{
+  MBTimer timer;
+  timer.start();
+
+  pairs = 0;
+  unsigned int i, j, vsize = m_nodes.size();
+  for(i=0; i<vsize; i++) {
+    const NodeRecord& os = m_nodes[i];
+    for(j=i+1; j<vsize; j++) {
+      const NodeRecord& cn = m_nodes[j];
+      CPAEngine cpaengine(cn.getY(), cn.getX(), cn.getHeading(),
+			  cn.getSpeed(), os.getY(), os.getX());
+      double dist = cpaengine.evalCPA(os.getHeading(), os.getSpeed(),
+				      m_tols[i]);
+      if(dist < m_min_cpa)
+	pairs++;
+    }
+  }
+
+  timer.stop();
+  return(timer.get_float_wall_time());
+}
+
+//--------------------------------------------------------
+// Procedure: cpaPairsGrid
+//      Note: Mirrors CollisionDetector::Iterate(). Building the
+//            grid is part of the timed work.
+
+double NodeGridBench::cpaPairsGrid(unsigned int& pairs)
+{
+  MBTimer timer;
+  timer.start();
+
+  NodeGrid grid(m_min_cpa);
+  double max_speed = 0;
+  unsigned int i, j, vsize = m_nodes.size();
+  for(i=0; i<vsize; i++) {
+    grid.addNode(m_nodes[i].getName(), m_nodes[i].getX(), 
+		 m_nodes[i].getY());
+    if(fabs(m_nodes[i].getSpeed()) > max_speed)
+      max_speed = fabs(m_nodes[i].getSpeed());
+  }
+
+  pairs = 0;
+  vector<string> nearby;
+  for(i=0; i<vsize; i++) {
+    const NodeRecord& os = m_nodes[i];
+    double reach = m_min_cpa;
+    reach += (fabs(os.getSpeed()) + max_speed) * m_tols[i];
+    reach += 1 + (0.01 * reach);
+
+    nearby.clear();
+    grid.getNodesWithin(os.getX(), os.getY(), reach, nearby);
+    for(j=0; j<nearby.size(); j++) {
+      if(nearby[j] <= os.getName())
+	continue;
+      // Names are v%06u so the index is recoverable from the name
+      const NodeRecord& cn = m_nodes[atoi(nearby[j].c_str()+1)];
+      CPAEngine cpaengine(cn.getY(), cn.getX(), cn.getHeading(),
+			  cn.getSpeed(), os.getY(), os.getX());
+      double dist = cpaengine.evalCPA(os.getHeading(), os.getSpeed(),
+				      m_tols[i]);
+      if(dist < m_min_cpa)
+	pairs++;
+    }
+  }
+
+  timer.stop();
+  return(timer.get_float_wall_time());
+}
+
+//--------------------------------------------------------
+// Procedure: rangePairsBrute
+
+double NodeGridBench::rangePairsBrute(unsigned int& pairs)
+{
+  MBTimer timer;
+  timer.start();
+
+  pairs = 0;
+  unsigned int i, j, vsize = m_nodes.size();
+  for(i=0; i<vsize; i++) {
+    for(j=0; j<vsize; j++) {
+      if(i == j)
+	continue;
+      double range = hypot(m_nodes[i].getX() - m_nodes[j].getX(),
+			   m_nodes[i].getY() - m_nodes[j].getY());
+      if(range <= m_comms_range)
+	pairs++;
+    }
+  }
+
+  timer.stop();
+  return(timer.get_float_wall_time());
+}
+
+//--------------------------------------------------------
+// Procedure: rangePairsGrid
+//      Note: Mirrors FldNodeComms::distributeNodeReportInfo(), with
+//            every vehicle sending a report.
+
+double NodeGridBench::rangePairsGrid(unsigned int& pairs)
+{
+  MBTimer timer;
+  timer.start();
+
+  NodeGrid grid(m_comms_range);
+  unsigned int i, j, vsize = m_nodes.size();
+  for(i=0; i<vsize; i++)
+    grid.addNode(m_nodes[i].getName(), m_nodes[i].getX(), 
+		 m_nodes[i].getY());
+
+  pairs = 0;
+  vector<string> nearby;
+  double reach = m_comms_range + 1 + (0.01 * m_comms_range);
+  for(i=0; i<vsize; i++) {
+    const NodeRecord& u = m_nodes[i];
+    nearby.clear();
+    grid.getNodesWithin(u.getX(), u.getY(), reach, nearby);
+    for(j=0; j<nearby.size(); j++) {
+      if(nearby[j] == u.getName())
+	continue;
+      const NodeRecord& v = m_nodes[atoi(nearby[j].c_str()+1)];
+      double range = hypot(u.getX() - v.getX(), u.getY() - v.getY());
+      if(range <= m_comms_range)
+	pairs++;
+    }
+  }
+
+  timer.stop();
+  return(timer.get_float_wall_time());
+}
+
+//--------------------------------------------------------
+// Procedure: printReport
+
+void NodeGridBench::printReport()
+{
+  printf("%-9s %10s %10s %8s %8s %10s %10s %8s %8s %6s\n", "Vehicles",
+	 "CPA-All", "CPA-Grid", "Speedup", "Pairs", "Rng-All", 
+	 "Rng-Grid", "Speedup", "Pairs", "Match");
+  printf("%-9s %10s %10s %8s %8s %10s %10s %8s %8s %6s\n", "--------",
+	 "-------", "--------", "-------", "-----", "-------", 
+	 "--------", "-------", "-----", "-----");
+
+  for(unsigned int i=0; i<m_counts.size(); i++) {
+    double cpa_speedup = 0;
+    if(m_cpa_grid_time[i] > 0)
+      cpa_speedup = m_cpa_brute_time[i] / m_cpa_grid_time[i];
+    double rng_speedup = 0;
+    if(m_rng_grid_time[i] > 0)
+      rng_speedup = m_rng_brute_time[i] / m_rng_grid_time[i];
+    printf("%-9u %10.3f %10.3f %8.2f %8u %10.3f %10.3f %8.2f %8u %6s\n",
+	   m_counts[i], m_cpa_brute_time[i], m_cpa_grid_time[i],
+	   cpa_speedup, m_cpa_pairs[i], m_rng_brute_time[i], 
+	   m_rng_grid_time[i], rng_speedup, m_rng_pairs[i], 
+	   boolToString(m_match[i]).c_str());
+  }
+  printf("Reps: %u  Spacing: %g  MinCPA: %g  CommsRange: %g\n", m_reps,
+	 m_spacing, m_min_cpa, m_comms_range);
+}
@@ -0,0 +1,72 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: NodeGridBench.h                                      */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef NODE_GRID_BENCH_HEADER
+#define NODE_GRID_BENCH_HEADER
+
+#include <vector>
+#include <string>
+#include "NodeRecord.h"
+#include "BenchModule.h"
+
+class NodeGridBench : public BenchModule
+{
+ public:
+  NodeGridBench();
+  ~NodeGridBench() {}
+
+  bool setParam(const std::string& param, const std::string& value);
+  bool handle();
+  void printReport();
+
+ protected:
+  void   makeNodes(unsigned int amt);
+
+  double cpaPairsBrute(unsigned int& pairs);
+  double cpaPairsGrid(unsigned int& pairs);
+  double rangePairsBrute(unsigned int& pairs);
+  double rangePairsGrid(unsigned int& pairs);
+
+ protected:
+  std::vector<unsigned int> m_counts;
+
+  unsigned int m_reps;
+  double       m_spacing;
+  double       m_min_cpa;
+  double       m_comms_range;
+  double       m_max_tol;
+
+  // Synthetic node records, sorted by name, and the time each is
+  // evaluated relative to its report time
+  std::vector<NodeRecord> m_nodes;
+  std::vector<double>     m_tols;
+
+  // Results per vehicle count. Times are totals over all reps.
+  std::vector<double>       m_cpa_brute_time;
+  std::vector<double>       m_cpa_grid_time;
+  std::vector<double>       m_rng_brute_time;
+  std::vector<double>       m_rng_grid_time;
+  std::vector<unsigned int> m_cpa_pairs;
+  std::vector<unsigned int> m_rng_pairs;
+};
+
+#endif
@@ -0,0 +1,294 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: NodeReportBench.cpp                                  */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include "NodeReportBench.h"
+#include "NodeRecordUtils.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+
+using namespace std;
+
+//--------------------------------------------------------
+// Less regular reports, as may be posted by hand or by other
+// tools, and the spec of the record each should parse to: lower
+// case keys, blanks, values that are not numbers, duplicate and
+// unknown keys.
+
+static const char *report_checks[][2] = {
+  {"name=abe,x=12.5,y=-3,spd=1.2,hdg=90,utc_time=100.25",
+   "NAME=abe,X=12.5,Y=-3,SPD=1.2,HDG=90,TIME=100.25"},
+  {" NAME = abe , X = 12.5 ,\tY=-3\t, SPEED= 2 ,HEADING =181.5",
+   "NAME=abe,X=12.5,Y=-3,SPD=2,HDG=181.5"},
+  {"NAME=abe,X=+5,Y=1e3,SPD=fast,HDG=-,DEP=.5,ALT=-.25,LEN=5.",
+   "NAME=abe,X=5,DEP=0.5,ALTITUDE=-0.25,LENGTH=5"},
+  {"NAME=abe,X=1,X=2,X=abc,TIME=99,UTC_TIME=98,Len=4,LENGTH=",
+   "NAME=abe,X=2,TIME=98,LENGTH=4"},
+  {"NAME=abe,BOGUS=7,X,=5,Y==3,,SPD_OG=1.5,HDG_OG=359.99,YAW=1.5",
+   "NAME=abe,SPD_OG=1.5,HDG_OG=359.99,YAW=1.5707963"},
+  {"NAME=abe,INDEX=12,THRUST_MODE_REVERSE=TRUE,ALLSTOP=clear",
+   "NAME=abe,ALLSTOP=clear,INDEX=12,THRUST_MODE_REVERSE=true"},
+  {"NAME=abe,INDEX=seven,THRUST_MODE_REVERSE=yes,LOAD_WARNING=x",
+   "NAME=abe,LOAD_WARNING=x"},
+  {"NAME=abe,X=-0,Y=-0.000,DEPTH=00012.50,LAT=42.3584,LON=-71.0878",
+   "NAME=abe,X=0,Y=0,DEP=12.5,LAT=42.3584,LON=-71.0878"},
+  {"NAME=abe,Y=0.1234567890123456789012345",
+   "NAME=abe,Y=0.12"},
+  {"NAME=abe,TYPE=kayak,GROUP=red,MODE=MODE@ACTIVE:LOITERING,x=1",
+   "NAME=abe,X=1,TYPE=kayak,GROUP=red,MODE=MODE@ACTIVE:LOITERING"},
+  {"",      "NAME="},
+  {",,,",   "NAME="},
+  {"NAME",  "NAME="},
+  {"NAME=", "NAME="},
+  {"=",     "NAME="},
+  {"X=1=2", "NAME="}};
+
+static const unsigned int report_check_count = 
+  sizeof(report_checks) / sizeof(report_checks[0]);
+
+//--------------------------------------------------------
+// Procedure: recordSignature
+//      Note: Every field of a record set by makeReports(), with 
+//            doubles at full precision, so a parsed record can be 
+//            compared exactly to the record its report came from.
+//            The yaw is left out since getSpec() posts the yaw as
+//            derived from the heading, and -0 is taken as 0.
+
+static string recordSignature(const NodeRecord& record)
+{
+  double dvals[] = {record.getX(), record.getY(), record.getLat(), 
+		    record.getLon(), record.getSpeed(), 
+		    record.getHeading(), record.getDepth(), 
+		    record.getLength(), record.getTimeStamp()};
+
+  string sig = record.getName() + ";" + record.getType() + ";" +
+    record.getGroup() + ";" + record.getMode() + ";" + 
+    record.getAllStop();
+  for(unsigned int i=0; i<(sizeof(dvals)/sizeof(double)); i++) {
+    char buff[64];
+    snprintf(buff, 64, ";%.17g", dvals[i] + 0.0);
+    sig += buff;
+  }
+  sig += ";" + intToString(record.getIndex());
+  return(sig);
+}
+
+//--------------------------------------------------------
+// Procedure: randVal
+
+static double randVal(double low, double high, int digits)
+{
+  double frac = (double)(rand()) / (double)(RAND_MAX);
+  double val  = low + (frac * (high - low));
+  return(atof(doubleToString(val, digits).c_str()));
+}
+
+//--------------------------------------------------------
+// Constructor
+
+NodeReportBench::NodeReportBench()
+{
+  m_reports = 100000;
+  m_reps    = 3;
+}
+
+//--------------------------------------------------------
+// Procedure: setParam
+
+bool NodeReportBench::setParam(const string& param, const string& value)
+{
+  if(param == "reports")
+    return(setUIntParam(m_reports, value));
+  else if(param == "reps")
+    return(setUIntParam(m_reps, value));
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: handle
+
+bool NodeReportBench::handle()
+{
+  clearResults();
+
+  makeReports();
+  benchParse();
+  benchFormat();
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: makeReports
+//      Note: Mostly reports as posted by the helm and simulator, made
+//            by getSpec() from a record with every field at the
+//            precision getSpec() posts. Mixed in are the reports of
+//            the check table, with the records they parse to.
+
+void NodeReportBench::makeReports()
+{
+  m_report_strs.clear();
+  m_records.clear();
+
+  const char *types[] = {"kayak", "uuv", "ship", "glider"};
+  const char *modes[] = {"MODE@ACTIVE:LOITERING", "MODE@ACTIVE:SURVEYING",
+			 "MODE@INACTIVE", "MODE@ACTIVE:RETURNING"};
+  srand(1);
+
+  for(unsigned int i=0; i<m_reports; i++) {
+    if((i % 50) < report_check_count) {
+      string report = report_checks[i % 50][0];
+      m_report_strs.push_back(report);
+      m_records.push_back(string2NodeRecord(report));
+      continue;
+    }
+
+    NodeRecord record("vehicle_" + uintToString(i % 20), types[i % 4]);
+    record.setX(randVal(-2000, 2000, 2));
+    record.setY(randVal(-2000, 2000, 2));
+    record.setSpeed(randVal(0, 5, 2));
+    record.setHeading(randVal(0, 360, 2));
+    record.setDepth(randVal(0, 100, 1));
+    record.setLat(randVal(42, 43, 8));
+    record.setLon(randVal(-71, -70, 8));
+    record.setGroup((i%3) ? "red" : "blue");
+    record.setMode(modes[i % 4]);
+    record.setAllStop("clear");
+    record.setIndex(i);
+    if(i % 2)
+      record.setYaw(randVal(-3, 3, 7));
+    record.setTimeStamp(randVal(1700000000, 1800000000, 2));
+    record.setLength(4);
+    m_report_strs.push_back(record.getSpec());
+    m_records.push_back(record);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: benchParse
+//      Note: A report made by getSpec() parses to the record it was
+//            made from, and each report of the check table parses
+//            to its given spec.
+
+void NodeReportBench::benchParse()
+{
+  unsigned int i, j, count = m_report_strs.size();
+  vector<NodeRecord> records(count);
+
+  MBTimer timer;
+  timer.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      records[i] = string2NodeRecord(m_report_strs[i]);
+  timer.stop();
+
+  bool match = true;
+  for(i=0; (i<count) && match; i++) {
+    if((i % 50) < report_check_count)
+      match = (records[i].getSpec() == report_checks[i % 50][1]);
+    else
+      match = (recordSignature(records[i]) == recordSignature(m_records[i]));
+    if(!match)
+      printf("Parse mismatch: [%s]\n", m_report_strs[i].c_str());
+  }
+  addResult("string2NodeRecord", -1, timer.get_float_wall_time() / m_reps,
+	    match);
+}
+
+//--------------------------------------------------------
+// Procedure: benchFormat
+//      Note: A record with every field set posts them in the order
+//            and precision given below, and the spec of any record
+//            parses to a record with the same spec.
+
+void NodeReportBench::benchFormat()
+{
+  unsigned int i, j, count = m_records.size();
+  vector<string> specs(count);
+
+  MBTimer timer;
+  timer.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      specs[i] = m_records[i].getSpec();
+  timer.stop();
+
+  NodeRecord full("abe", "kayak");
+  full.setX(1.126);
+  full.setY(-2.5);
+  full.setSpeed(1.2);
+  full.setHeading(90);
+  full.setDepth(3);
+  full.setLat(42.358456789);
+  full.setLon(-71.087812345);
+  full.setGroup("red");
+  full.setMode("MODE@ACTIVE");
+  full.setModeAux("LOITERING");
+  full.setAllStop("clear");
+  full.setLoadWarning("none");
+  full.setAltitude(10);
+  full.setSpeedOG(1.25);
+  full.setHeadingOG(91);
+  full.setIndex(7);
+  full.setThrustModeReverse(true);
+  full.setYaw(0.5);
+  full.setTimeStamp(100.126);
+  full.setLength(4);
+  full.setProperty("COLOR", "yellow");
+
+  string full_spec = "NAME=abe,X=1.13,Y=-2.5,SPD=1.2,HDG=90,DEP=3,"
+    "LAT=42.35845679,LON=-71.08781235,TYPE=kayak,GROUP=red,"
+    "MODE=MODE@ACTIVE,MODE_AUX=LOITERING,ALLSTOP=clear,"
+    "LOAD_WARNING=none,ALTITUDE=10,SPD_OG=1.25,HDG_OG=91,INDEX=7,"
+    "THRUST_MODE_REVERSE=true,YAW=0,TIME=100.13,LENGTH=4,COLOR=yellow";
+
+  bool match = (full.getSpec() == full_spec);
+  if(!match)
+    printf("Format mismatch:\n  [%s]\n  [%s]\n", full.getSpec().c_str(),
+	   full_spec.c_str());
+  for(i=0; (i<count) && match; i++) {
+    match = (string2NodeRecord(specs[i]).getSpec() == specs[i]);
+    if(!match)
+      printf("Format mismatch: [%s]\n", specs[i].c_str());
+  }
+  addResult("NodeRecord::getSpec", -1, timer.get_float_wall_time() / m_reps,
+	    match);
+}
+
+//--------------------------------------------------------
+// Procedure: printReport
+
+void NodeReportBench::printReport()
+{
+  printf("%-22s %11s %11s %6s\n", "Test", "Time(ms)", "K/sec", "Match");
+  printf("%-22s %11s %11s %6s\n", "----", "--------", "-----", "-----");
+
+  unsigned int count = m_report_strs.size();
+  for(unsigned int i=0; i<m_test.size(); i++) {
+    double rate = 0;
+    if(m_new_time[i] > 0)
+      rate = (count / m_new_time[i]) / 1000;
+    printf("%-22s %11.1f %11.1f %6s\n", m_test[i].c_str(),
+	   m_new_time[i] * 1000, rate, boolToString(m_match[i]).c_str());
+  }
+  printf("Reports: %u  Reps: %u\n", count, m_reps);
+}
@@ -0,0 +1,55 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: NodeReportBench.h                                    */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef NODE_REPORT_BENCH_HEADER
+#define NODE_REPORT_BENCH_HEADER
+
+#include <vector>
+#include <string>
+#include "BenchModule.h"
+#include "NodeRecord.h"
+
+class NodeReportBench : public BenchModule
+{
+ public:
+  NodeReportBench();
+  ~NodeReportBench() {}
+
+  bool setParam(const std::string& param, const std::string& value);
+  bool handle();
+  void printReport();
+
+ protected:
+  void makeReports();
+
+  void benchParse();
+  void benchFormat();
+
+ protected:
+  unsigned int m_reports;
+  unsigned int m_reps;
+
+  std::vector<std::string> m_report_strs;
+  std::vector<NodeRecord>  m_records;
+};
+
+#endif
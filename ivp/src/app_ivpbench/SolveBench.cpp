@@ -0,0 +1,355 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: SolveBench.cpp                                       */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include "SolveBench.h"
+#include "PopulatorIPP.h"
+#include "IvPProblem.h"
+#include "PDMap.h"
+#include "AOF_Gaussian.h"
+#include "OF_Reflector.h"
+#include "FunctionEncoder.h"
+#include "BuildUtils.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+#include "AllocCounter.h"
+
+using namespace std;
+
+//--------------------------------------------------------
+// Constructor
+
+SolveBench::SolveBench()
+{
+  m_threads   = 4;
+  m_reps      = 10;
+  m_verbose   = false;
+  m_generated = false;
+
+  m_gen_funcs  = 6;
+  m_gen_pieces = 2000;
+  m_gen_size   = 400;
+}
+
+//--------------------------------------------------------
+// Procedure: addFile
+
+bool SolveBench::addFile(const string& filename)
+{
+  FILE *f = fopen(filename.c_str(), "r");
+  if(!f)
+    return(false);
+  fclose(f);
+  m_files.push_back(filename);
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: setParam
+
+bool SolveBench::setParam(const string& param, const string& value)
+{
+  if((param == "file") && strEnds(value, ".ipp"))
+    return(addFile(value));
+  else if(param == "threads")
+    return(setUIntParam(m_threads, value));
+  else if(param == "reps")
+    return(setUIntParam(m_reps, value));
+  else if(param == "funcs")
+    return(setUIntParam(m_gen_funcs, value));
+  else if(param == "pieces")
+    return(setUIntParam(m_gen_pieces, value));
+  else if(param == "size")
+    return(setUIntParam(m_gen_size, value));
+  else if(param == "verbose")
+    return(setBooleanOnString(m_verbose, value));
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: makeProblemFile
+//   Purpose: Write a problem over a two dimensional domain made of
+//            Gaussian objective functions placed at random, with
+//            random priority weights. Used when no files are given.
+
+bool SolveBench::makeProblemFile(const string& filename)
+{
+  FILE *f = fopen(filename.c_str(), "w");
+  if(!f)
+    return(false);
+
+  srand(1);
+  unsigned int size = m_gen_size;
+  IvPDomain domain;
+  domain.addDomain("x", 0, size, size+1);
+  domain.addDomain("y", 0, size, size+1);
+  fprintf(f, "domain = %s\n", domainToString(domain).c_str());
+
+  for(unsigned int i=0; i<m_gen_funcs; i++) {
+    AOF_Gaussian aof(domain);
+    aof.setParam("xcent", rand() % size);
+    aof.setParam("ycent", rand() % size);
+    aof.setParam("sigma", 10 + (rand() % (size/2 + 1)));
+    aof.setParam("range", 100);
+
+    OF_Reflector reflector(&aof, 1);
+    reflector.create(m_gen_pieces);
+    IvPFunction *ipf = reflector.extractOF();
+    if(ipf) {
+      ipf->setPWT(1 + (rand() % 100));
+      fprintf(f, "ipf = %s\n", IvPFunctionToString(ipf).c_str());
+      delete(ipf);
+    }
+  }
+  fclose(f);
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: handle
+//   Purpose: Solve each problem m_reps times with the serial solver
+//            and with the parallel solver, noting the total wall
+//            time of each and whether the decisions agree. Also
+//            count the heap allocations made by the serial solver.
+
+bool SolveBench::handle()
+{
+  m_serial_time.clear();
+  m_parallel_time.clear();
+  m_allocs_first.clear();
+  m_allocs_repeat.clear();
+  clearResults();
+
+  if(m_files.size() == 0) {
+    string file = "solvebench_tmp.ipp";
+    if(!makeProblemFile(file)) {
+      cout << "Unable to write " << file << endl;
+      return(false);
+    }
+    m_files.push_back(file);
+    m_generated = true;
+  }
+
+  for(unsigned int i=0; i<m_files.size(); i++) {
+    string file = m_files[i];
+    double serial_time = 0;
+    double parallel_time = 0;
+    vector<double> serial_decisions;
+    vector<double> parallel_decisions;
+    bool ok1 = solveAndTime(file, 1, serial_time, serial_decisions);
+    bool ok2 = solveAndTime(file, m_threads, parallel_time, 
+			    parallel_decisions);
+    if(!ok1 || !ok2) {
+      cout << "Unable to load problem from: " << file << endl;
+      removeGenerated();
+      return(false);
+    }
+    m_serial_time.push_back(serial_time);
+    m_parallel_time.push_back(parallel_time);
+    m_test.push_back(file);
+    m_match.push_back(serial_decisions == parallel_decisions);
+
+    unsigned long allocs_first  = 0;
+    unsigned long allocs_repeat = 0;
+    if(!countAllocs(file, allocs_first, allocs_repeat)) {
+      removeGenerated();
+      return(false);
+    }
+    m_allocs_first.push_back(allocs_first);
+    m_allocs_repeat.push_back(allocs_repeat);
+  }
+  removeGenerated();
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: removeGenerated
+
+void SolveBench::removeGenerated()
+{
+  if(m_generated && (m_files.size() > 0))
+    remove(m_files.back().c_str());
+}
+
+//--------------------------------------------------------
+// Procedure: loadProblem
+
+IvPProblem* SolveBench::loadProblem(const string& file, 
+				    unsigned int threads)
+{
+  PopulatorIPP populator;
+  populator.setVerbose(false);
+  populator.setThreads(threads);
+  if(!populator.populate(file))
+    return(0);
+
+  IvPProblem *problem = populator.getIvPProblem();
+  if(problem && (problem->getDomain().size() > 0))
+    problem->alignOFs();
+  return(problem);
+}
+
+//--------------------------------------------------------
+// Procedure: solveAndTime
+//   Purpose: Solve the problem m_reps times, as the helm solves the
+//            same problem object each iteration, and note the total
+//            time and the decision of every solve.
+//      Note: Only the solve itself is timed. Loading the problem
+//            from file and building the grids is excluded.
+
+bool SolveBench::solveAndTime(const string& file, unsigned int threads,
+			      double& elapsed, vector<double>& decisions)
+{
+  IvPProblem *problem = loadProblem(file, threads);
+  if(!problem)
+    return(false);
+
+  // Build the grids ahead of time so only the search is timed.
+  for(int k=0; k<problem->getOFNUM(); k++) {
+    PDMap *pdmap = problem->getOF(k)->getPDMap();
+    if(pdmap && (pdmap->getGrid() == 0))
+      pdmap->updateGrid();
+  }
+
+  elapsed = 0;
+  IvPDomain domain = problem->getDomain();
+  for(unsigned int j=0; j<m_reps; j++) {
+    problem->clearSolution();
+    MBTimer timer;
+    timer.start();
+    problem->solve();
+    timer.stop();
+    elapsed += timer.get_float_wall_time();
+
+    for(unsigned int d=0; d<domain.size(); d++)
+      decisions.push_back(problem->getResult(domain.getVarName(d)));
+    decisions.push_back(problem->getMaxWT());
+
+    if(m_verbose) {
+      cout << file << " threads:" << threads << " time:";
+      cout << timer.get_float_wall_time();
+      cout << " maxwt:" << problem->getMaxWT() << endl;
+    }
+  }
+
+  delete(problem);
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: countAllocs
+//   Purpose: Count the heap allocations made during solve() by the
+//            serial solver. The first solve of a problem allocates
+//            its per-level working storage. Solving it again should
+//            re-use that storage and allocate nothing.
+
+bool SolveBench::countAllocs(const string& file, unsigned long& first,
+			     unsigned long& repeat)
+{
+  IvPProblem *problem = loadProblem(file, 1);
+  if(!problem)
+    return(false);
+
+  for(int k=0; k<problem->getOFNUM(); k++) {
+    PDMap *pdmap = problem->getOF(k)->getPDMap();
+    if(pdmap && (pdmap->getGrid() == 0))
+      pdmap->updateGrid();
+  }
+
+  unsigned long count = getAllocCount();
+  problem->solve();
+  first = getAllocCount() - count;
+
+  count = getAllocCount();
+  problem->solve();
+  repeat = getAllocCount() - count;
+
+  delete(problem);
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: allPassed
+//   Purpose: True if the serial and parallel decisions agreed for
+//            every problem, and no repeated solve allocated memory.
+
+bool SolveBench::allPassed() const
+{
+  if(!BenchModule::allPassed())
+    return(false);
+  for(unsigned int i=0; i<m_allocs_repeat.size(); i++) {
+    if(m_allocs_repeat[i] != 0)
+      return(false);
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: printChecks
+
+void SolveBench::printChecks()
+{
+  printf("%-30s %6s %6s\n", "Problem", "Match", "Allocs");
+  printf("%-30s %6s %6s\n", "-------", "-----", "------");
+  for(unsigned int i=0; i<m_test.size(); i++) {
+    bool no_allocs = (m_allocs_repeat[i] == 0);
+    printf("%-30s %6s %6s\n", m_test[i].c_str(),
+	   boolToString(m_match[i]).c_str(), 
+	   boolToString(no_allocs).c_str());
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: printReport
+
+void SolveBench::printReport()
+{
+  printf("%-30s %12s %12s %8s %6s %8s %8s\n", "Problem", "Serial(s)", 
+	 "Parallel(s)", "Speedup", "Match", "Allocs", "Repeat");
+  printf("%-30s %12s %12s %8s %6s %8s %8s\n", "-------", "---------", 
+	 "-----------", "-------", "-----", "------", "------");
+
+  double serial_total = 0;
+  double parallel_total = 0;
+  bool   all_match = true;
+  for(unsigned int i=0; i<m_serial_time.size(); i++) {
+    double speedup = 0;
+    if(m_parallel_time[i] > 0)
+      speedup = m_serial_time[i] / m_parallel_time[i];
+    printf("%-30s %12.3f %12.3f %8.2f %6s %8lu %8lu\n", 
+	   m_files[i].c_str(), m_serial_time[i], m_parallel_time[i], 
+	   speedup, boolToString(m_match[i]).c_str(), m_allocs_first[i],
+	   m_allocs_repeat[i]);
+    serial_total   += m_serial_time[i];
+    parallel_total += m_parallel_time[i];
+    all_match = all_match && m_match[i];
+  }
+
+  double speedup = 0;
+  if(parallel_total > 0)
+    speedup = serial_total / parallel_total;
+  printf("%-30s %12.3f %12.3f %8.2f %6s\n", "TOTAL", serial_total, 
+	 parallel_total, speedup, boolToString(all_match).c_str());
+  printf("Threads: %u  Reps: %u\n", m_threads, m_reps);
+}
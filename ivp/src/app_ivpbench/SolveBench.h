@@ -0,0 +1,77 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: SolveBench.h                                         */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef SOLVE_BENCH_HEADER
+#define SOLVE_BENCH_HEADER
+
+#include <vector>
+#include <string>
+#include "BenchModule.h"
+
+class IvPProblem;
+
+class SolveBench : public BenchModule
+{
+ public:
+  SolveBench();
+  ~SolveBench() {}
+
+  bool setParam(const std::string& param, const std::string& value);
+  bool handle();
+  void printReport();
+  void printChecks();
+  bool allPassed() const;
+
+ protected:
+  bool        addFile(const std::string&);
+  bool        makeProblemFile(const std::string&);
+  void        removeGenerated();
+  IvPProblem* loadProblem(const std::string&, unsigned int threads);
+  bool        solveAndTime(const std::string&, unsigned int threads,
+			   double& elapsed, std::vector<double>& decisions);
+  bool        countAllocs(const std::string&, unsigned long& first,
+			  unsigned long& repeat);
+
+ protected:
+  std::vector<std::string> m_files;
+
+  unsigned int m_threads;
+  unsigned int m_reps;
+  bool         m_verbose;
+  bool         m_generated;
+
+  // Size of the problem generated if no files are given
+  unsigned int m_gen_funcs;
+  unsigned int m_gen_pieces;
+  unsigned int m_gen_size;
+
+  // Results per file
+  std::vector<double> m_serial_time;
+  std::vector<double> m_parallel_time;
+
+  // Heap allocations made by the serial solver in solving a newly
+  // loaded problem, and in solving that same problem again.
+  std::vector<unsigned long> m_allocs_first;
+  std::vector<unsigned long> m_allocs_repeat;
+};
+
+#endif
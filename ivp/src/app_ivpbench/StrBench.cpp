@@ -0,0 +1,632 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: StrBench.cpp                                         */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include "StrBench.h"
+#include "StrView.h"
+#include "MBUtils.h"
+#include "MBTimer.h"
+#include "XYFormatUtilsPoint.h"
+#include "XYFormatUtilsPoly.h"
+#include "LogicUtils.h"
+
+using namespace std;
+
+//========================================================
+// A small reference for the functions being checked. It
+// follows the documented rules directly on std::string, one
+// character at a time, with no attempt at speed.
+//========================================================
+
+//--------------------------------------------------------
+// Procedure: refSplit
+//      Note: The fields of str between separators. An empty string
+//            has no fields and a trailing separator ends the last
+//            field without starting a new one. With protect set, a
+//            separator within double quotes or braces is not one.
+
+static vector<string> refSplit(const string& str, const string& sep,
+			       bool protect=false)
+{
+  vector<string> rvector;
+  bool in_quotes = false;
+  unsigned int braces = 0;
+
+  string field;
+  string::size_type i = 0;
+  while(i < str.length()) {
+    bool open = !protect || (!in_quotes && (braces == 0));
+    if(open && (str.compare(i, sep.length(), sep) == 0)) {
+      rvector.push_back(field);
+      field.clear();
+      i += sep.length();
+      continue;
+    }
+    char c = str[i++];
+    if(protect && (c == '"'))
+      in_quotes = !in_quotes;
+    else if(protect && (c == '{'))
+      braces++;
+    else if(protect && (c == '}') && (braces > 0))
+      braces--;
+    field += c;
+  }
+  if((field != "") || ((str != "") && !strEnds(str, sep)))
+    rvector.push_back(field);
+  return(rvector);
+}
+
+//--------------------------------------------------------
+// Procedure: refTokParse
+//      Note: The value of the first field whose param is left. Any
+//            field that is not exactly one param=value pair ends the
+//            search with no value.
+
+static bool refTokParse(const string& str, const string& left,
+			bool protect, string& value)
+{
+  vector<string> fields = refSplit(str, ",", protect);
+  for(unsigned int i=0; i<fields.size(); i++) {
+    vector<string> pair = refSplit(fields[i], "=");
+    if(pair.size() != 2)
+      return(false);
+    if(stripBlankEnds(pair[0]) == left) {
+      value = stripBlankEnds(pair[1]);
+      return(true);
+    }
+  }
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: refFieldMatch
+//      Note: One string matches the other if either contains the
+//            other, and the fields of the one with fewer fields are
+//            a run of fields of the other.
+
+static bool refFieldMatch(const string& str1, const string& str2)
+{
+  if(!strContains(str1, str2) && !strContains(str2, str1))
+    return(false);
+
+  vector<string> fields1 = refSplit(str1, ":");
+  vector<string> fields2 = refSplit(str2, ":");
+  if((fields1.size() == 0) || (fields2.size() == 0))
+    return(false);
+
+  bool one_short = (fields1.size() < fields2.size());
+  vector<string>& short_fields = one_short ? fields1 : fields2;
+  vector<string>& long_fields  = one_short ? fields2 : fields1;
+
+  unsigned int i, j;
+  for(i=0; i<short_fields.size(); i++)
+    short_fields[i] = stripBlankEnds(short_fields[i]);
+  for(j=0; j<long_fields.size(); j++)
+    long_fields[j] = stripBlankEnds(long_fields[j]);
+
+  for(j=0; j+short_fields.size() <= long_fields.size(); j++) {
+    bool run = true;
+    for(i=0; (i<short_fields.size()) && run; i++)
+      run = (short_fields[i] == long_fields[j+i]);
+    if(run)
+      return(true);
+  }
+  return(false);
+}
+
+//========================================================
+// StrBench
+//========================================================
+
+//--------------------------------------------------------
+// Constructor
+
+StrBench::StrBench()
+{
+  m_strings = 20000;
+  m_reps    = 5;
+}
+
+//--------------------------------------------------------
+// Procedure: setParam
+
+bool StrBench::setParam(const string& param, const string& value)
+{
+  if(param == "strings")
+    return(setUIntParam(m_strings, value));
+  else if(param == "reps")
+    return(setUIntParam(m_reps, value));
+  return(false);
+}
+
+//--------------------------------------------------------
+// Procedure: handle
+
+bool StrBench::handle()
+{
+  clearResults();
+
+  makeStrings();
+
+  benchParseString();
+  benchParseStringQ();
+  benchParseStringSep();
+  benchTokParse();
+  benchSplitter();
+  benchParamIter();
+  benchPoint();
+  benchPoly();
+  benchFieldMatch();
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: makeStrings
+//      Note: Strings typical of the mail parsed by apps and 
+//            behaviors, plus a share of irregular ones: empty
+//            fields, blanks, separators at either end.
+
+void StrBench::makeStrings()
+{
+  m_param_strs.clear();
+  m_quoted_strs.clear();
+  m_sep_strs.clear();
+  m_point_strs.clear();
+  m_poly_strs.clear();
+  m_field_strs.clear();
+
+  const char *odd_strs[] = {"", ",", ",,x=1,,", " x = 1 , y=2 ,", "x",
+			    "=", "x==2", "\tlabel = a b\t,x=-0.5,y=+3",
+			    "x=1e3,y=.5,z=abc", "label=\"a,b\",x=1,y=2"};
+  unsigned int odd_count = sizeof(odd_strs) / sizeof(char*);
+
+  srand(1);
+  for(unsigned int i=0; i<m_strings; i++) {
+    double x = (rand() % 400000) / 100.0 - 2000;
+    double y = (rand() % 400000) / 100.0 - 2000;
+    string xstr = doubleToStringX(x, 2);
+    string ystr = doubleToStringX(y, 2);
+    string id = uintToString(i);
+
+    if((i % 25) < odd_count) {
+      string odd = odd_strs[i % 25];
+      m_param_strs.push_back(odd);
+      m_quoted_strs.push_back(odd);
+      m_sep_strs.push_back(odd);
+      m_point_strs.push_back(odd);
+      m_poly_strs.push_back(odd);
+      m_field_strs.push_back(odd);
+      continue;
+    }
+
+    m_param_strs.push_back("NAME=abe_" + id + ",X=" + xstr + ",Y=" + 
+			   ystr + ",SPD=1.2,HDG=" + intToString(i%360) + 
+			   ",TYPE=kayak,MODE=MODE@ACTIVE:LOITERING,"
+			   "ALLSTOP=clear,INDEX=" + id + ",LENGTH=4");
+    m_quoted_strs.push_back("var=DEPLOY, val=\"true,false\", "
+			    "cond={a=1,b=2}, x=" + xstr + ", y=" + ystr +
+			    ", id=" + id);
+    m_sep_strs.push_back("apples $@$ pears " + id + " $@$ bananas $@$ " +
+			 xstr + "$@$$@$" + ystr);
+    m_point_strs.push_back("x=" + xstr + ",y=" + ystr + ",label=pt_" + id + 
+			   ",vertex_size=4,vertex_color=red");
+
+    string pts;
+    for(unsigned int k=0; k<12; k++) {
+      double rad = (k * 30.0) * 3.14159265358979 / 180;
+      if(k > 0)
+	pts += ":";
+      pts += doubleToStringX(x + 50 * cos(rad), 2) + "," + 
+	doubleToStringX(y + 50 * sin(rad), 2);
+    }
+    m_poly_strs.push_back("pts={" + pts + "},label=poly_" + id + 
+			  ",edge_color=gray,vertex_size=2");
+
+    string field = "alpha:bravo:charlie_" + uintToString(i%7) + ":delta";
+    m_field_strs.push_back(field);
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: benchParseString
+
+void StrBench::benchParseString()
+{
+  unsigned int i, j, count = m_param_strs.size();
+  unsigned int ref_total = 0;
+  unsigned int new_total = 0;
+
+  MBTimer timer;
+  timer.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      ref_total += refSplit(m_param_strs[i], ",").size();
+  timer.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      new_total += parseString(m_param_strs[i], ',').size();
+  timer2.stop();
+
+  bool match = (ref_total == new_total);
+  for(i=0; (i<count) && match; i++)
+    match = (refSplit(m_param_strs[i], ",") ==
+	     parseString(m_param_strs[i], ','));
+
+  addResult("parseString(char)", timer.get_float_wall_time() / m_reps,
+	    timer2.get_float_wall_time() / m_reps, match);
+}
+
+//--------------------------------------------------------
+// Procedure: benchParseStringQ
+
+void StrBench::benchParseStringQ()
+{
+  unsigned int i, j, count = m_quoted_strs.size();
+  unsigned int ref_total = 0;
+  unsigned int new_total = 0;
+
+  MBTimer timer;
+  timer.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      ref_total += refSplit(m_quoted_strs[i], ",", true).size();
+  timer.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      new_total += parseStringQ(m_quoted_strs[i], ',').size();
+  timer2.stop();
+
+  bool match = (ref_total == new_total);
+  for(i=0; (i<count) && match; i++)
+    match = (refSplit(m_quoted_strs[i], ",", true) ==
+	     parseStringQ(m_quoted_strs[i], ','));
+
+  addResult("parseStringQ(char)", timer.get_float_wall_time() / m_reps,
+	    timer2.get_float_wall_time() / m_reps, match);
+}
+
+//--------------------------------------------------------
+// Procedure: benchParseStringSep
+
+void StrBench::benchParseStringSep()
+{
+  unsigned int i, j, count = m_sep_strs.size();
+  unsigned int ref_total = 0;
+  unsigned int new_total = 0;
+  string sep = "$@$";
+
+  MBTimer timer;
+  timer.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      ref_total += refSplit(m_sep_strs[i], sep).size();
+  timer.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      new_total += parseString(m_sep_strs[i], sep).size();
+  timer2.stop();
+
+  bool match = (ref_total == new_total);
+  for(i=0; (i<count) && match; i++)
+    match = (refSplit(m_sep_strs[i], sep) == parseString(m_sep_strs[i], sep));
+
+  addResult("parseString(string)", timer.get_float_wall_time() / m_reps,
+	    timer2.get_float_wall_time() / m_reps, match);
+}
+
+//--------------------------------------------------------
+// Procedure: benchTokParse
+//      Note: A param with no value in the reference is "" from
+//            tokStringParse() and 0 from tokDoubleParse().
+
+void StrBench::benchTokParse()
+{
+  const char *params[] = {"id", "val", "cond", "x", "y", "z"};
+  unsigned int pcount = sizeof(params) / sizeof(char*);
+
+  unsigned int i, j, k, count = m_quoted_strs.size();
+  double ref_total = 0;
+  double new_total = 0;
+  string value;
+
+  MBTimer timer;
+  timer.start();
+  for(j=0; j<m_reps; j++) {
+    for(i=0; i<count; i++) {
+      if(refTokParse(m_quoted_strs[i], "id", true, value))
+	ref_total += value.length();
+      if(refTokParse(m_point_strs[i], "y", false, value))
+	ref_total += atof(value.c_str());
+    }
+  }
+  timer.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(j=0; j<m_reps; j++) {
+    for(i=0; i<count; i++) {
+      new_total += tokStringParse(m_quoted_strs[i], "id", ',', 
+				  '=').length();
+      new_total += tokDoubleParse(m_point_strs[i], "y", ',', '=');
+    }
+  }
+  timer2.stop();
+
+  bool match = (ref_total == new_total);
+  for(i=0; (i<count) && match; i++) {
+    for(k=0; (k<pcount) && match; k++) {
+      string sval;
+      refTokParse(m_quoted_strs[i], params[k], true, sval);
+      match = (sval == tokStringParse(m_quoted_strs[i], params[k], ',', '='));
+
+      double dval = 0;
+      if(refTokParse(m_point_strs[i], params[k], false, value))
+	dval = atof(value.c_str());
+      match = match && (dval == tokDoubleParse(m_point_strs[i], params[k],
+						 ',', '='));
+    }
+  }
+
+  addResult("tokString/DoubleParse", timer.get_float_wall_time() / m_reps,
+	    timer2.get_float_wall_time() / m_reps, match);
+}
+
+//--------------------------------------------------------
+// Procedure: benchSplitter
+//      Note: Each token of StrSplitter, viewed in place, against the
+//            fields of the reference.
+
+void StrBench::benchSplitter()
+{
+  unsigned int i, j, count = m_quoted_strs.size();
+  unsigned int ref_total = 0;
+  unsigned int new_total = 0;
+
+  MBTimer timer;
+  timer.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      ref_total += refSplit(m_quoted_strs[i], ",", true).size();
+  timer.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(j=0; j<m_reps; j++) {
+    for(i=0; i<count; i++) {
+      StrSplitter splitter(m_quoted_strs[i], ',', true);
+      StrView tok;
+      while(splitter.next(tok))
+	new_total++;
+    }
+  }
+  timer2.stop();
+
+  bool match = (ref_total == new_total);
+  for(i=0; (i<count) && match; i++) {
+    for(unsigned int p=0; (p<2) && match; p++) {
+      bool protect = (p == 1);
+      vector<string> fields = refSplit(m_quoted_strs[i], ",", protect);
+      StrSplitter splitter(m_quoted_strs[i], ',', protect);
+      StrView tok;
+      unsigned int k = 0;
+      while(match && splitter.next(tok))
+	match = ((k < fields.size()) && (tok == fields[k++]));
+      match = match && (k == fields.size());
+    }
+  }
+
+  addResult("StrSplitter", timer.get_float_wall_time() / m_reps,
+	    timer2.get_float_wall_time() / m_reps, match);
+}
+
+//--------------------------------------------------------
+// Procedure: benchParamIter
+//      Note: Each pair of StrParamIter against the fields of the
+//            reference, each cut at its first '=' with blank ends
+//            stripped, as biteStringX() would.
+
+void StrBench::benchParamIter()
+{
+  unsigned int i, j, count = m_param_strs.size();
+  unsigned int ref_total = 0;
+  unsigned int new_total = 0;
+
+  MBTimer timer;
+  timer.start();
+  for(j=0; j<m_reps; j++) {
+    for(i=0; i<count; i++) {
+      vector<string> fields = refSplit(m_param_strs[i], ",");
+      for(unsigned int k=0; k<fields.size(); k++)
+	ref_total += biteStringX(fields[k], '=').length();
+    }
+  }
+  timer.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(j=0; j<m_reps; j++) {
+    for(i=0; i<count; i++) {
+      StrParamIter iter(m_param_strs[i]);
+      StrView param, value;
+      while(iter.next(param, value))
+	new_total += param.length();
+    }
+  }
+  timer2.stop();
+
+  bool match = (ref_total == new_total);
+  for(i=0; (i<count) && match; i++) {
+    vector<string> fields = refSplit(m_param_strs[i], ",");
+    StrParamIter iter(m_param_strs[i]);
+    StrView param, value;
+    unsigned int k = 0;
+    while(match && iter.next(param, value)) {
+      if(k >= fields.size())
+	match = false;
+      else {
+	string ref_param = biteStringX(fields[k], '=');
+	match = ((param == ref_param) && (value == fields[k]));
+	k++;
+      }
+    }
+    match = match && (k == fields.size());
+  }
+
+  addResult("StrParamIter", timer.get_float_wall_time() / m_reps,
+	    timer2.get_float_wall_time() / m_reps, match);
+}
+
+//--------------------------------------------------------
+// Procedure: benchPoint
+//      Note: Checked by invariant: a point made from x=,y= pairs has
+//            that vertex, and a point made from the spec of another
+//            has the same spec. Nothing is timed against it.
+
+void StrBench::benchPoint()
+{
+  unsigned int i, j, count = m_point_strs.size();
+  unsigned int total = 0;
+
+  MBTimer timer;
+  timer.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      total += stringStandard2Point(m_point_strs[i]).valid();
+  timer.stop();
+
+  bool match = true;
+  unsigned int valids = 0;
+  for(i=0; (i<count) && match; i++) {
+    XYPoint point = stringStandard2Point(m_point_strs[i]);
+    valids += point.valid();
+    string xstr, ystr;
+    bool has_x = refTokParse(m_point_strs[i], "x", false, xstr);
+    bool has_y = refTokParse(m_point_strs[i], "y", false, ystr);
+    if(has_x && has_y && isNumber(xstr) && isNumber(ystr))
+      match = (point.valid() && (point.x() == atof(xstr.c_str())) &&
+	       (point.y() == atof(ystr.c_str())));
+    if(match && point.valid()) {
+      string spec = point.get_spec();
+      match = (stringStandard2Point(spec).get_spec() == spec);
+    }
+  }
+
+  match = match && (total == m_reps * valids);
+
+  addResult("stringStandard2Point", -1,
+	    timer.get_float_wall_time() / m_reps, match);
+}
+
+//--------------------------------------------------------
+// Procedure: benchPoly
+//      Note: Checked by invariant: each generated polygon has all
+//            twelve of its vertices, and a polygon made from the
+//            spec of another has the same spec.
+
+void StrBench::benchPoly()
+{
+  unsigned int i, j, count = m_poly_strs.size();
+  unsigned int total = 0;
+
+  MBTimer timer;
+  timer.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      total += stringStandard2Poly(m_poly_strs[i]).size();
+  timer.stop();
+
+  bool match = true;
+  unsigned int sizes = 0;
+  for(i=0; (i<count) && match; i++) {
+    XYPolygon poly = stringStandard2Poly(m_poly_strs[i]);
+    if(strBegins(m_poly_strs[i], "pts={"))
+      match = (poly.size() == 12);
+    sizes += poly.size();
+    if(match && (poly.size() > 0)) {
+      string spec = poly.get_spec(3);
+      match = (stringStandard2Poly(spec).get_spec(3) == spec);
+    }
+  }
+
+  match = match && (total == m_reps * sizes);
+
+  addResult("stringStandard2Poly", -1,
+	    timer.get_float_wall_time() / m_reps, match);
+}
+
+//--------------------------------------------------------
+// Procedure: benchFieldMatch
+
+void StrBench::benchFieldMatch()
+{
+  const char *patterns[] = {"bravo", "charlie_3", "bravo:charlie_1", 
+			    "alpha:charlie_2", "delta", "echo", ""};
+  unsigned int pcount = sizeof(patterns) / sizeof(char*);
+
+  unsigned int i, j, k, count = m_field_strs.size();
+  unsigned int ref_total = 0;
+  unsigned int new_total = 0;
+
+  MBTimer timer;
+  timer.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      for(k=0; k<pcount; k++)
+	ref_total += refFieldMatch(m_field_strs[i], patterns[k]);
+  timer.stop();
+
+  MBTimer timer2;
+  timer2.start();
+  for(j=0; j<m_reps; j++)
+    for(i=0; i<count; i++)
+      for(k=0; k<pcount; k++)
+	new_total += strFieldMatch(m_field_strs[i], patterns[k], ':');
+  timer2.stop();
+
+  bool match = (ref_total == new_total);
+  for(i=0; (i<count) && match; i++)
+    for(k=0; (k<pcount) && match; k++)
+      match = (refFieldMatch(m_field_strs[i], patterns[k]) ==
+	       strFieldMatch(m_field_strs[i], patterns[k], ':'));
+
+  addResult("strFieldMatch", timer.get_float_wall_time() / m_reps,
+	    timer2.get_float_wall_time() / m_reps, match);
+}
+
+//--------------------------------------------------------
+// Procedure: printSettings
+
+void StrBench::printSettings()
+{
+  printf("Strings: %u per test  Reps: %u\n", m_strings, m_reps);
+}
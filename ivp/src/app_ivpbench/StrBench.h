@@ -0,0 +1,66 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: StrBench.h                                           */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef STR_BENCH_HEADER
+#define STR_BENCH_HEADER
+
+#include <vector>
+#include <string>
+#include "BenchModule.h"
+
+class StrBench : public BenchModule
+{
+ public:
+  StrBench();
+  ~StrBench() {}
+
+  bool setParam(const std::string& param, const std::string& value);
+  bool handle();
+
+ protected:
+  void printSettings();
+  void makeStrings();
+
+  void benchParseString();
+  void benchParseStringQ();
+  void benchParseStringSep();
+  void benchTokParse();
+  void benchSplitter();
+  void benchParamIter();
+  void benchPoint();
+  void benchPoly();
+  void benchFieldMatch();
+
+ protected:
+  unsigned int m_strings;
+  unsigned int m_reps;
+
+  // Generated inputs, by the kind of string each test parses
+  std::vector<std::string> m_param_strs;
+  std::vector<std::string> m_quoted_strs;
+  std::vector<std::string> m_sep_strs;
+  std::vector<std::string> m_point_strs;
+  std::vector<std::string> m_poly_strs;
+  std::vector<std::string> m_field_strs;
+};
+
+#endif
@@ -0,0 +1,238 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: main.cpp                                             */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "MBUtils.h"
+#include "ReleaseInfo.h"
+#include "SolveBench.h"
+#include "NodeGridBench.h"
+#include "GeomBench.h"
+#include "ALogBench.h"
+#include "NodeReportBench.h"
+#include "StrBench.h"
+#include "HelmReportBench.h"
+#include "LogicBench.h"
+#include "InfoBufferBench.h"
+#include "CPABench.h"
+#include "BatchBench.h"
+#include "HelmParBench.h"
+
+using namespace std;
+
+void help_message();
+BenchModule *newBench(const string& name);
+
+const string all_benches = "solve,nodegrid,geom,alog,nodereport,str,"
+  "helmreport,logic,infobuffer,cpa,batch,helmpar";
+
+//--------------------------------------------------------
+// Procedure: main
+
+int main(int argc, char *argv[])
+{
+  // Look for a request for help information
+  if(scanArgs(argc, argv, "-h", "--help", "-help")) {
+    help_message();
+    return(0);
+  }
+
+  // Look for a request for version information
+  if(scanArgs(argc, argv, "-v", "--version", "-version")) {
+    showReleaseInfo("ivpbench", "gpl");
+    return(0);
+  }
+
+  // Pass 1: Gather the benches to run. If none named, run all.
+  vector<string> names;
+  vector<BenchModule*> benches;
+  for(int i=1; i<argc; i++) {
+    string argi = argv[i];
+    BenchModule *bench = newBench(argi);
+    if(bench) {
+      names.push_back(argi);
+      benches.push_back(bench);
+    }
+  }
+  if(benches.size() == 0) {
+    vector<string> svector = parseString(all_benches, ',');
+    for(unsigned int i=0; i<svector.size(); i++) {
+      names.push_back(svector[i]);
+      benches.push_back(newBench(svector[i]));
+    }
+  }
+
+  // Pass 2: Hand each option to every bench that will take it
+  bool args_ok = true;
+  bool check_only = false;
+  for(int i=1; i<argc; i++) {
+    string argi = argv[i];
+    if((argi == "--check") || (argi == "-check")) {
+      check_only = true;
+      continue;
+    }
+    string param = "file";
+    string value = argi;
+    if((argi == "--verbose") || (argi == "-verbose")) {
+      param = "verbose";
+      value = "true";
+    }
+    else if(strBegins(argi, "--")) {
+      value = argi.substr(2);
+      param = biteString(value, '=');
+    }
+    else if(vectorContains(parseString(all_benches, ','), argi))
+      continue;
+
+    bool handled = false;
+    for(unsigned int j=0; j<benches.size(); j++)
+      handled = benches[j]->setParam(param, value) || handled;
+    if(!handled) {
+      cout << "Bad argument or missing file: " << argi << endl;
+      args_ok = false;
+    }
+  }
+
+  // Run each bench in turn, noting any that fail
+  bool all_passed = args_ok;
+  for(unsigned int i=0; args_ok && (i<benches.size()); i++) {
+    cout << "==== " << names[i] << endl;
+    if(benches[i]->handle()) {
+      if(check_only)
+	benches[i]->printChecks();
+      else
+	benches[i]->printReport();
+      if(!benches[i]->allPassed())
+	all_passed = false;
+    }
+    else
+      all_passed = false;
+    cout << endl;
+  }
+
+  for(unsigned int i=0; i<benches.size(); i++)
+    delete(benches[i]);
+
+  if(!all_passed)
+    return(1);
+  return(0);
+}
+
+//--------------------------------------------------------
+// Procedure: newBench
+
+BenchModule *newBench(const string& name)
+{
+  if(name == "solve")
+    return(new SolveBench);
+  else if(name == "nodegrid")
+    return(new NodeGridBench);
+  else if(name == "geom")
+    return(new GeomBench);
+  else if(name == "alog")
+    return(new ALogBench);
+  else if(name == "nodereport")
+    return(new NodeReportBench);
+  else if(name == "str")
+    return(new StrBench);
+  else if(name == "helmreport")
+    return(new HelmReportBench);
+  else if(name == "logic")
+    return(new LogicBench);
+  else if(name == "infobuffer")
+    return(new InfoBufferBench);
+  else if(name == "cpa")
+    return(new CPABench);
+  else if(name == "batch")
+    return(new BatchBench);
+  else if(name == "helmpar")
+    return(new HelmParBench);
+  return(0);
+}
+
+//-------------------------------------------------------------
+// Procedure: help_message
+
+void help_message()
+{
+  cout << "Usage: " << endl;
+  cout << "  ivpbench [BENCH ...] [file.ipp] [file.alog] [OPTIONS]         " << endl;
+  cout << "                                                                " << endl;
+  cout << "Synopsis:                                                       " << endl;
+  cout << "  Check parts of the helm, solver and utilities against a simple" << endl;
+  cout << "  reference: brute force, a second API or a model of the        " << endl;
+  cout << "  expected behavior. Report the time of each and whether every  " << endl;
+  cout << "  check passed.                                                 " << endl;
+  cout << "  With no BENCH named, all are run.                             " << endl;
+  cout << "                                                                " << endl;
+  cout << "Benches:                                                        " << endl;
+  cout << "  solve        Serial vs parallel IvP solver, heap allocations  " << endl;
+  cout << "  nodegrid     CPA and range pair checks, all pairs vs NodeGrid " << endl;
+  cout << "  geom         Convex grid and polygon point queries            " << endl;
+  cout << "  alog         LogUtils FILE* readers vs ALogReader             " << endl;
+  cout << "  nodereport   NODE_REPORT parsing and building                 " << endl;
+  cout << "  str          MBUtils string parsing, StrSplitter, StrParamIter" << endl;
+  cout << "  helmreport   HelmReport and the IVPHELM_SUMMARY delta         " << endl;
+  cout << "  logic        LogicCondition, ParseNode tree vs compiled       " << endl;
+  cout << "  infobuffer   InfoBuffer, queries by name vs by ID             " << endl;
+  cout << "  cpa          CPAEngine, direct trig vs course trig table      " << endl;
+  cout << "  batch        AOF evalPtBatch, one point at a time vs batched  " << endl;
+  cout << "  helmpar      Helm behaviors produced serially vs on threads  " << endl;
+  cout << "                                                                " << endl;
+  cout << "Options:                                                        " << endl;
+  cout << "  -h,--help         Displays this help message                  " << endl;
+  cout << "  -v,--version      Displays the current release version        " << endl;
+  cout << "  --verbose         Report the time and weight of each solve    " << endl;
+  cout << "  --check           Report only whether each check passed       " << endl;
+  cout << "  --reps=N          Passes over the inputs, for every bench     " << endl;
+  cout << "                                                                " << endl;
+  cout << "  solve:       --threads=N (4) --funcs=N (6) --pieces=N (2000)  " << endl;
+  cout << "               --size=N (400)                                   " << endl;
+  cout << "  nodegrid:    --vehicles=N,.. (10,100,500,2000) --spacing=M    " << endl;
+  cout << "               (200) --min_cpa=M (10) --comms_range=M (500)     " << endl;
+  cout << "  geom:        --points=N (20000) --vertices=N (64)             " << endl;
+  cout << "               --buckets=N (16) --cell_size=M (10)              " << endl;
+  cout << "  alog:        --lines=N (500000)                               " << endl;
+  cout << "  nodereport:  --reports=N (100000)                             " << endl;
+  cout << "  str:         --strings=N (20000)                              " << endl;
+  cout << "  helmreport:  --bhvs=N (20) --iters=N (20000)                  " << endl;
+  cout << "  logic:       --conds=N (20000) --rounds=N (6)                 " << endl;
+  cout << "  infobuffer:  --ops=N (200000) --vars=N (6)                    " << endl;
+  cout << "  cpa:         --scenarios=N (50) --tol=S (60)                  " << endl;
+  cout << "  batch:       --points=N (1000000)                             " << endl;
+  cout << "  helmpar:     --contacts=N (8) --iters=N (20)                  " << endl;
+  cout << "               --bhv_threads=N (4)                              " << endl;
+  cout << "                                                                " << endl;
+  cout << "Further Notes:                                                  " << endl;
+  cout << "  (1) Each option is given to every bench that takes it. An     " << endl;
+  cout << "      option no bench takes is an error.                        " << endl;
+  cout << "  (2) With no .ipp file, solve generates a problem of random    " << endl;
+  cout << "      Gaussian functions over a two variable domain. With no    " << endl;
+  cout << "      .alog file, alog generates one. Both are removed after.   " << endl;
+  cout << "  (3) Solve reports the heap allocations of the serial solver   " << endl;
+  cout << "      on a new problem, and on solving it again (expected 0).   " << endl;
+  cout << "  (4) Exits non-zero if any check fails. Times never fail a run." << endl;
+  cout << "  (5) ctest runs each bench with --check on small inputs.       " << endl;
+  cout << endl;
+}
@@ -72,6 +72,11 @@ BHV_AvoidCollision::BHV_AvoidCollision(IvPDomain gdomain) :
 
   m_no_alert_request  = false;
 
+  // Each instance builds from its own contact state and AOF, so
+  // spawned instances may produce their functions concurrently if
+  // configured with parallel=true and the helm BEHAVIOR_THREADS>1.
+  setParallelSafe(true);
+
   // Initialize state variables
   m_curr_closing_spd = 0;
   m_avoiding = false;
@@ -128,6 +128,17 @@ IvPFunction *BHV_ConstantHeading::onRunState()
   }
 
 
+  // The function depends only on the behavior parameters
+  string key;
+  addCacheKey(key, m_desired_heading);
+  addCacheKey(key, m_basewidth);
+  addCacheKey(key, m_peakwidth);
+  addCacheKey(key, m_summitdelta);
+  addCacheKey(key, m_priority_wt);
+  IvPFunction *cached_ipf = getCachedOF(key);
+  if(cached_ipf)
+    return(cached_ipf);
+
   ZAIC_PEAK zaic(m_domain, "course");
   zaic.setSummit(m_desired_heading);
   zaic.setBaseWidth(m_basewidth);
@@ -145,7 +156,7 @@ IvPFunction *BHV_ConstantHeading::onRunState()
   if(zaic_warnings != "")
     postWMessage(zaic_warnings);
 
-  return(ipf);
+  return(setCachedOF(ipf));
 }
 
 //-----------------------------------------------------------
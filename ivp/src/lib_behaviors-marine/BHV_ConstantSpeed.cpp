@@ -103,6 +103,17 @@ IvPFunction *BHV_ConstantSpeed::onRunState()
     return(0);
   }
 
+  // The function depends only on the behavior parameters
+  string key;
+  addCacheKey(key, m_desired_speed);
+  addCacheKey(key, m_basewidth);
+  addCacheKey(key, m_peakwidth);
+  addCacheKey(key, m_summitdelta);
+  addCacheKey(key, m_priority_wt);
+  IvPFunction *cached_ipf = getCachedOF(key);
+  if(cached_ipf)
+    return(cached_ipf);
+
   ZAIC_PEAK zaic(m_domain, "speed");
   zaic.setSummit(m_desired_speed);
   zaic.setBaseWidth(m_basewidth);
@@ -119,7 +130,7 @@ IvPFunction *BHV_ConstantSpeed::onRunState()
   if(zaic_warnings != "")
     postWMessage(zaic_warnings);
 
-  return(ipf);
+  return(setCachedOF(ipf));
 }
 
 //-----------------------------------------------------------
@@ -273,11 +273,22 @@ IvPFunction *BHV_Loiter::onRunState()
   m_ptx = m_waypoint_engine.getPointX();
   m_pty = m_waypoint_engine.getPointY();
 
-  IvPFunction *ipf = buildIPF("zaic");
-
-  if(ipf) {
-    ipf->getPDMap()->normalize(0,100);
-    ipf->setPWT(m_priority_wt);
+  // The function depends on ownship position only through the
+  // bearing to the next loiter point.
+  double rel_ang_to_wpt = relAng(m_osx, m_osy, m_ptx, m_pty);
+  string key;
+  addCacheKey(key, "course", rel_ang_to_wpt);
+  addCacheKey(key, m_desired_speed);
+  addCacheKey(key, m_priority_wt);
+  IvPFunction *ipf = getCachedOF(key);
+
+  if(!ipf) {
+    ipf = buildIPF("zaic");
+    if(ipf) {
+      ipf->getPDMap()->normalize(0,100);
+      ipf->setPWT(m_priority_wt);
+    }
+    setCachedOF(ipf);
   }
 
   postViewablePolygon();
@@ -472,12 +472,27 @@ IvPFunction *BHV_Waypoint::onRunState()
   if(m_var_dist_to_next != "")
     postMessage(m_var_dist_to_next, m_waypoint_engine.distToNextWpt(m_osx, m_osy));
 
-  IvPFunction *ipf = buildOF(m_ipf_type);
+  // The function depends on ownship position only through the
+  // bearing to the track point, and on heading only in zaic mode.
+  double rel_ang_to_trk = relAng(m_osx, m_osy, m_trackpt.x(), m_trackpt.y());
+  string key = m_ipf_type;
+  addCacheKey(key, "course", rel_ang_to_trk);
+  addCacheKey(key, m_cruise_speed);
+  addCacheKey(key, m_priority_wt);
+  if((m_ipf_type != "roc") && (m_ipf_type != "rate_of_closure")) {
+    addCacheKey(key, "course", m_osh);
+    addCacheKey(key, m_course_pct);
+    addCacheKey(key, m_speed_pct);
+  }
+  IvPFunction *ipf = getCachedOF(key);
   if(ipf)
-    ipf->setPWT(m_priority_wt);
+    return(ipf);
 
+  ipf = buildOF(m_ipf_type);
+  if(ipf)
+    ipf->setPWT(m_priority_wt);
 
-  return(ipf);
+  return(setCachedOF(ipf));
 }
 
 //-----------------------------------------------------------
@@ -31,6 +31,7 @@
 #include <iostream>
 #include <vector>
 #include <cstdlib>
+#include <cmath>
 #include "IvPBehavior.h"
 #include "MBUtils.h"
 #include "BuildUtils.h"
@@ -53,6 +54,8 @@ IvPBehavior::IvPBehavior(IvPDomain g_domain)
   m_bad_updates  = 0;
   m_perpetual    = false;
   m_filter_level = 0;
+  m_parallel_ok  = false;
+  m_parallel_safe = false;
   
   m_duration     = -1;
   m_duration_started         =  false;
@@ -65,6 +68,21 @@ IvPBehavior::IvPBehavior(IvPDomain g_domain)
   m_duration_prev_state      = "";
   m_duration_idle_decay      = true;
   m_duration_reset_on_transition = false;
+
+  m_cond_vars_iter     = 0;
+  m_cond_vars_resolved = false;
+
+  m_ofcache_ipf    = 0;
+  m_ofcache_hits   = 0;
+  m_ofcache_misses = 0;
+}
+
+//-----------------------------------------------------------
+// Procedure: Destructor
+
+IvPBehavior::~IvPBehavior()
+{
+  clearCachedOF();
 }
 
 //-----------------------------------------------------------
@@ -153,8 +171,10 @@ bool IvPBehavior::setParam(string g_param, string g_val)
     bool ok = true;
     LogicCondition new_condition;
     ok = new_condition.setCondition(g_val);
-    if(ok)
+    if(ok) {
       m_logic_conditions.push_back(new_condition);
+      m_cond_vars_resolved = false;
+    }
     return(ok);
   }
   else if(g_param == "duration_status") {
@@ -249,6 +269,9 @@ bool IvPBehavior::setParam(string g_param, string g_val)
     m_perpetual = (modval == "true");
     return(true);
   }
+
+  else if(g_param == "parallel")
+    return(setBooleanOnString(m_parallel_ok, g_val));
   
   // Accept duration parameter (in seconds)
   else if(g_param == "duration") {
@@ -346,6 +369,7 @@ string IvPBehavior::isRunnable()
 void IvPBehavior::setInfoBuffer(const InfoBuffer *ib)
 {
   m_info_buffer = ib;
+  resolveConditionVars();
 }
 
 //-----------------------------------------------------------
@@ -376,6 +400,33 @@ void IvPBehavior::postMessage(string var, string sdata, string key)
   m_messages.push_back(pair);
 }
 
+//-----------------------------------------------------------
+// Procedure: postBinaryMessage
+//     Notes: Same as postMessage for strings except the data is kept
+//            byte for byte (no stripping of blank ends) and the pair
+//            is marked binary so the helm posts it as binary data.
+
+void IvPBehavior::postBinaryMessage(string var, const string& bdata, 
+				    string key)
+{
+  map<string,string>::iterator p;
+  p = m_remap_vars.find(var);
+  if(p != m_remap_vars.end()) {
+    var = p->second;
+    if(tolower(var) == "silent")
+      return;
+  }
+  VarDataPair pair(var, "");
+  pair.set_bdata(bdata);
+
+  if(tolower(key) != "repeatable") {
+    key = (m_descriptor + var + key);
+    pair.set_key(key);
+  }
+
+  m_messages.push_back(pair);
+}
+
 //-----------------------------------------------------------
 // Procedure: postMessage
 //     Notes: If the key is set to be "repeatable" then in effect 
@@ -528,30 +579,45 @@ bool IvPBehavior::checkConditions()
     return(false);
 
   unsigned int i, j, vsize, csize;
-
-  // Phase 1: get all the variable names from all present conditions.
-  vector<string> all_vars;
   csize = m_logic_conditions.size();
-  for(i=0; i<csize; i++) {
-    vector<string> svector = m_logic_conditions[i].getVarNames();
-    all_vars = mergeVectors(all_vars, svector);
-  }
-  all_vars = removeDuplicates(all_vars);
+
+  // Phase 1: resolve the variable names of the conditions, if not
+  // done since a condition was added or the info_buffer was set.
+  if(!m_cond_vars_resolved)
+    resolveConditionVars();
 
   // Phase 2: get values of all variables from the info_buffer and 
-  // propogate these values down to all the logic conditions.
-  vsize = all_vars.size();
+  // propogate these values down to all the logic conditions. Those
+  // unchanged since the last check already hold the buffer values.
+  // A variable not yet in the buffer has no value to propogate. 
+  vsize = m_cond_vars.size();
   for(i=0; i<vsize; i++) {
-    string varname = all_vars[i];
-    bool   ok_s, ok_d;
-    string s_result = m_info_buffer->sQuery(varname, ok_s);
-    double d_result = m_info_buffer->dQuery(varname, ok_d);
+    if(m_cond_var_ids[i] < 0) {
+      unsigned int id;
+      if(!m_info_buffer->findVarID(m_cond_vars[i], id))
+	continue;
+      m_cond_var_ids[i] = (int)(id);
+    }
 
-    for(j=0; (j<csize)&&(ok_s); j++)
-      m_logic_conditions[j].setVarVal(varname, s_result);
-    for(j=0; (j<csize)&&(ok_d); j++)
-      m_logic_conditions[j].setVarVal(varname, d_result);
+    unsigned int id = (unsigned int)(m_cond_var_ids[i]);
+    if(!m_info_buffer->changedSince(id, m_cond_vars_iter))
+      continue;
+
+    bool   ok_s, ok_d;
+    string s_result = m_info_buffer->sQuery(id, ok_s);
+    double d_result = m_info_buffer->dQuery(id, ok_d);
+
+    const vector<int>& ixs = m_cond_var_ix[i];
+    for(j=0; j<csize; j++) {
+      if(ixs[j] < 0)
+	continue;
+      if(ok_s)
+	m_logic_conditions[j].setVarValByIx(ixs[j], s_result);
+      if(ok_d)
+	m_logic_conditions[j].setVarValByIx(ixs[j], d_result);
+    }
   }
+  m_cond_vars_iter = m_info_buffer->getIteration();
 
   // Phase 3: evaluate all logic conditions. Return true only if all
   // conditions evaluate to be true.
@@ -567,6 +633,46 @@ bool IvPBehavior::checkConditions()
 
 }
 
+//-----------------------------------------------------------
+// Procedure: resolveConditionVars()
+//   Purpose: Get all the variable names from all present conditions,
+//            the index of each in each condition, and the ID of each
+//            in the info_buffer. Done when the info_buffer is set and
+//            when a condition is added, not on each iteration.
+//      Note: The info_buffer is only looked up, never written. A
+//            variable not yet in the buffer is given the ID of -1,
+//            and looked up again by checkConditions() until found.
+//            Behaviors may be run concurrently (see the parallel
+//            parameter), all reading the one info_buffer.
+
+void IvPBehavior::resolveConditionVars()
+{
+  unsigned int i, j, csize = m_logic_conditions.size();
+
+  vector<string> all_vars;
+  for(i=0; i<csize; i++) {
+    vector<string> svector = m_logic_conditions[i].getVarNames();
+    all_vars = mergeVectors(all_vars, svector);
+  }
+  m_cond_vars = removeDuplicates(all_vars);
+  m_cond_var_ids.clear();
+  m_cond_var_ix.clear();
+  for(i=0; i<m_cond_vars.size(); i++) {
+    vector<int> ixs;
+    for(j=0; j<csize; j++)
+      ixs.push_back(m_logic_conditions[j].getVarIndex(m_cond_vars[i]));
+    m_cond_var_ix.push_back(ixs);
+
+    unsigned int id;
+    if(m_info_buffer && m_info_buffer->findVarID(m_cond_vars[i], id))
+      m_cond_var_ids.push_back((int)(id));
+    else
+      m_cond_var_ids.push_back(-1);
+  }
+  m_cond_vars_iter = 0;
+  m_cond_vars_resolved = true;
+}
+
 //-----------------------------------------------------------
 // Procedure: checkForDurationReset()
 
@@ -1125,5 +1231,95 @@ vector<string> IvPBehavior::getStateSpaceVars()
   return(rvector);
 }
 
+//-----------------------------------------------------------
+// Procedure: getCachedOF
+//   Purpose: Allow a behavior to skip re-building its IvP function
+//            when the inputs it depends on are unchanged. The key is
+//            built by the behavior from its (quantized) inputs and
+//            parameter state. If it matches the key of the cached
+//            function, a copy of the cached function is returned.
+//            Otherwise NULL is returned and the key is held until
+//            the newly built function is handed to setCachedOF().
+
+IvPFunction* IvPBehavior::getCachedOF(const string& key)
+{
+  if(m_ofcache_ipf && (key == m_ofcache_key)) {
+    m_ofcache_hits++;
+    m_ofcache_pending_key = "";
+    return(m_ofcache_ipf->copy());
+  }
+
+  m_ofcache_misses++;
+  m_ofcache_pending_key = key;
+  return(0);
+}
+
+//-----------------------------------------------------------
+// Procedure: setCachedOF
+//   Purpose: Store a copy of the given IvP function under the key
+//            of the last missed getCachedOF() call. The given
+//            function is returned unaltered for convenience.
 
+IvPFunction* IvPBehavior::setCachedOF(IvPFunction *ipf)
+{
+  clearCachedOF();
+  if(ipf && (m_ofcache_pending_key != "")) {
+    m_ofcache_ipf = ipf->copy();
+    m_ofcache_key = m_ofcache_pending_key;
+  }
+  m_ofcache_pending_key = "";
+  return(ipf);
+}
 
+//-----------------------------------------------------------
+// Procedure: clearCachedOF
+
+void IvPBehavior::clearCachedOF()
+{
+  delete(m_ofcache_ipf);
+  m_ofcache_ipf = 0;
+  m_ofcache_key = "";
+}
+
+//-----------------------------------------------------------
+// Procedure: addCacheKey
+//   Purpose: Append one input of the IvP function to a key for
+//            getCachedOF(). Numbers are rendered to six decimal
+//            places, enough to tell apart any two parameter values.
+
+void IvPBehavior::addCacheKey(string& key, double val)
+{
+  addCacheKey(key, doubleToString(val, 6));
+}
+
+//-----------------------------------------------------------
+// Procedure: addCacheKey
+
+void IvPBehavior::addCacheKey(string& key, const string& str)
+{
+  if(key != "")
+    key += ",";
+  key += str;
+}
+
+//-----------------------------------------------------------
+// Procedure: addCacheKey
+//   Purpose: Append the given value, snapped to the resolution of
+//            the named domain variable. Values landing in the same
+//            domain cell produce the same key. If the variable is 
+//            not in the domain, the value is appended at full 
+//            precision.
+
+void IvPBehavior::addCacheKey(string& key, const string& var, double val)
+{
+  int ix = m_domain.getIndex(var);
+  if(ix >= 0) {
+    double delta = m_domain.getVarDelta(ix);
+    if(delta > 0) {
+      int cell = (int)(floor((val / delta) + 0.5));
+      addCacheKey(key, var + "=" + intToString(cell));
+      return;
+    }
+  }
+  addCacheKey(key, var + "=" + doubleToString(val, 6));
+}
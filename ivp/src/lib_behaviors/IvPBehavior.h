@@ -45,7 +45,7 @@ class IvPBehavior {
 friend class BehaviorSet;
 public:
   IvPBehavior(IvPDomain);
-  virtual ~IvPBehavior() {}
+  virtual ~IvPBehavior();
 
   virtual IvPFunction* onRunState() {return(0);}
   virtual BehaviorReport onRunState(std::string);
@@ -74,16 +74,25 @@ public:
   std::string getUpdateSummary()         {return(m_update_summary);}
   std::vector<VarDataPair> getMessages() {return(m_messages);}
   int    getFilterLevel() const          {return(m_filter_level);}
+  bool   parallelOK() const              {return(m_parallel_ok);}
+  bool   parallelSafe() const            {return(m_parallel_safe);}
   bool   stateOK() const                 {return(m_bhv_state_ok);}
   void   clearMessages()                 {m_messages.clear();}
   void   resetStateOK()                  {m_bhv_state_ok=true;}
 
+  unsigned int getOFCacheHits() const    {return(m_ofcache_hits);}
+  unsigned int getOFCacheMisses() const  {return(m_ofcache_misses);}
+  void   clearCachedOF();
+
   void    postMessage(std::string, std::string, std::string key="");
+  void    postBinaryMessage(std::string, const std::string&, 
+			    std::string key="");
 protected:
   bool    setBehaviorName(std::string str);
   bool    augBehaviorName(std::string str);
   void    setBehaviorType(std::string str) {m_behavior_type = str;}
   void    setPriorityWt(double);
+  void    setParallelSafe(bool v)          {m_parallel_safe=v;}
 
   void    addInfoVars(std::string, std::string="");
   void    setComplete();
@@ -102,8 +111,16 @@ protected:
   void    durationReset();
   void    updateStateDurations(std::string);
   bool    checkConditions();
+  void    resolveConditionVars();
   bool    checkForDurationReset();
   bool    checkNoStarve();
+
+  IvPFunction* getCachedOF(const std::string& key);
+  IvPFunction* setCachedOF(IvPFunction*);
+  void         addCacheKey(std::string& key, double val);
+  void         addCacheKey(std::string& key, const std::string& str);
+  void         addCacheKey(std::string& key, const std::string& var,
+			   double val);
   
 
   double                   getPriorityWt() {return(m_priority_wt);}
@@ -134,6 +151,16 @@ protected:
 
   std::vector<VarDataPair>       m_messages;
   std::vector<LogicCondition>    m_logic_conditions;
+
+  // Each variable named in the conditions, its index in each
+  // condition (-1 if absent), and its info_buffer ID (-1 if not yet
+  // in the buffer), set by resolveConditionVars(). Also the 
+  // info_buffer iteration last checked.
+  std::vector<std::string>       m_cond_vars;
+  std::vector<std::vector<int> > m_cond_var_ix;
+  std::vector<int>               m_cond_var_ids;
+  unsigned int                   m_cond_vars_iter;
+  bool                           m_cond_vars_resolved;
   std::vector<VarDataPair>       m_run_flags;
   std::vector<VarDataPair>       m_active_flags;
   std::vector<VarDataPair>       m_inactive_flags;
@@ -171,6 +198,23 @@ protected:
   bool        m_perpetual; 
   int         m_filter_level;
 
+  // Set by a behavior type whose onRunState() touches only its own
+  // state, and so may be run concurrently with other such behaviors.
+  // Such a behavior must only read the info_buffer, through its 
+  // const interface, e.g., getBufferDoubleVal().
+  bool        m_parallel_safe;
+
+  // True if configured with parallel=true. Honored by the helm only
+  // if the type is parallel-safe.
+  bool        m_parallel_ok;
+
+  // Variables for caching the IvP function across iterations
+  IvPFunction *m_ofcache_ipf;
+  std::string  m_ofcache_key;
+  std::string  m_ofcache_pending_key;
+  unsigned int m_ofcache_hits;
+  unsigned int m_ofcache_misses;
+
   // The state_ok flag shouldn't be set to true once it has been 
   // set to false. So prevent subclasses from setting this directly.
   // This variable should only be accessible via (1) postEMessage()
@@ -145,6 +145,9 @@ bool AOF_AttractorCPA::initialize()
 
   cpa_engine = new CPAEngine(cn_lat, cn_lon, cn_crs, cn_spd,
 			     os_lat, os_lon);
+  cpa_engine->setTrigTable(m_domain.getVarLow(crs_ix), 
+			   m_domain.getVarDelta(crs_ix),
+			   m_domain.getVarPoints(crs_ix));
 
   max_heading = cpa_engine->minMaxROC(5, 360, min_roc, max_roc);
   
@@ -89,6 +89,22 @@ double AOF_AvoidCollision::evalBox(const IvPBox *b) const
   return(eval_dist);
 }
 
+//----------------------------------------------------------------
+// Procedure: evalPtBatch
+
+void AOF_AvoidCollision::evalPtBatch(const int *pts, unsigned int count,
+				     double *vals) const
+{
+  vector<double> crs_vals, spd_vals;
+  getBatchVals(pts, count, m_crs_ix, crs_vals);
+  getBatchVals(pts, count, m_spd_ix, spd_vals);
+
+  for(unsigned int k=0; k<count; k++) {
+    double cpa_dist = m_cpa_engine.evalCPA(crs_vals[k], spd_vals[k], m_tol);
+    vals[k] = metric(cpa_dist);
+  }
+}
+
 //----------------------------------------------------------------
 // Procedure: metric
 
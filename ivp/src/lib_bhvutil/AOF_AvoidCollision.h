@@ -35,6 +35,7 @@ public:
 
 public: // virtuals defined
   double evalBox(const IvPBox*) const;   
+  void   evalPtBatch(const int*, unsigned int, double*) const;
   bool   setParam(const std::string&, double);
   bool   initialize();
 
@@ -158,6 +158,9 @@ bool AOF_AvoidCollisionDepth::initialize()
 
   cpa_engine = new CPAEngine(m_cny, m_cnx, m_cnh, 
 			     m_cnv, m_osy, m_osx);
+  cpa_engine->setTrigTable(m_domain.getVarLow(m_crs_ix), 
+			   m_domain.getVarDelta(m_crs_ix),
+			   m_domain.getVarPoints(m_crs_ix));
 
   m_max_decision_depth = m_domain.getVarHigh(m_dep_ix);
   m_rate_of_closure = cpa_engine->evalROC(m_osh, m_osv);
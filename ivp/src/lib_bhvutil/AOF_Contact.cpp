@@ -182,6 +182,14 @@ bool AOF_Contact::initialize()
   
   m_cpa_engine = CPAEngine(m_cny, m_cnx, m_cnh, m_cnv, m_osy, m_osx);
 
+  // The course grid is fixed by the domain, so trig values can
+  // be computed once up front.
+  int crs_ix = m_domain.getIndex("course");
+  if(crs_ix != -1)
+    m_cpa_engine.setTrigTable(m_domain.getVarLow(crs_ix), 
+			      m_domain.getVarDelta(crs_ix),
+			      m_domain.getVarPoints(crs_ix));
+
   return(true);
 }
 
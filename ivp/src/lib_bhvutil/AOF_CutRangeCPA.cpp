@@ -143,6 +143,9 @@ bool AOF_CutRangeCPA::initialize()
     return(false);
 
   m_cpa_engine = new CPAEngine(m_cny, m_cnx, m_cnh, m_cnv, m_osy, m_osx);
+  m_cpa_engine->setTrigTable(m_domain.getVarLow(m_crs_ix), 
+			     m_domain.getVarDelta(m_crs_ix),
+			     m_domain.getVarPoints(m_crs_ix));
 
   double max_ownship_spd = m_domain.getVarHigh(m_spd_ix);
 
@@ -196,6 +199,28 @@ double AOF_CutRangeCPA::evalBox(const IvPBox *b) const
   m_domain.getVal(m_crs_ix, b->pt(m_crs_ix,0), eval_crs);
   m_domain.getVal(m_spd_ix, b->pt(m_spd_ix,0), eval_spd);
 
+  return(evalCrsSpd(eval_crs, eval_spd));
+}
+
+//----------------------------------------------------------------
+// Procedure: evalPtBatch
+
+void AOF_CutRangeCPA::evalPtBatch(const int *pts, unsigned int count,
+				  double *vals) const
+{
+  vector<double> crs_vals, spd_vals;
+  getBatchVals(pts, count, m_crs_ix, crs_vals);
+  getBatchVals(pts, count, m_spd_ix, spd_vals);
+
+  for(unsigned int k=0; k<count; k++)
+    vals[k] = evalCrsSpd(crs_vals[k], spd_vals[k]);
+}
+
+//----------------------------------------------------------------
+// Procedure: evalCrsSpd
+
+double AOF_CutRangeCPA::evalCrsSpd(double eval_crs, double eval_spd) const
+{
   if((m_discourage_low_speeds == true) && 
      (eval_spd <= m_discourage_low_speeds_thresh)) {
     return(m_discourage_low_speeds_value);
@@ -34,6 +34,7 @@ public:
 
 public:    
   double evalBox(const IvPBox*) const;   // virtual defined
+  void   evalPtBatch(const int*, unsigned int, double*) const;
   bool   setParam(const std::string&, double);
   bool   initialize();
   
@@ -42,6 +43,7 @@ public:
 
 protected:
   double metric(double) const;
+  double evalCrsSpd(double crs, double spd) const;
 
 protected:
   int    m_crs_ix;  // Index of "course" variable in IvPDomain
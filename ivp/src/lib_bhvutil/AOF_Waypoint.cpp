@@ -129,7 +129,29 @@ double AOF_Waypoint::evalBox(const IvPBox *b) const
 
   m_domain.getVal(m_crs_ix, b->pt(m_crs_ix,0), eval_crs);
   m_domain.getVal(m_spd_ix, b->pt(m_spd_ix,0), eval_spd);
-  
+
+  return(evalCrsSpd(eval_crs, eval_spd));
+}
+
+//----------------------------------------------------------------
+// Procedure: evalPtBatch
+
+void AOF_Waypoint::evalPtBatch(const int *pts, unsigned int count,
+			       double *vals) const
+{
+  vector<double> crs_vals, spd_vals;
+  getBatchVals(pts, count, m_crs_ix, crs_vals);
+  getBatchVals(pts, count, m_spd_ix, spd_vals);
+
+  for(unsigned int k=0; k<count; k++)
+    vals[k] = evalCrsSpd(crs_vals[k], spd_vals[k]);
+}
+
+//----------------------------------------------------------------
+// Procedure: evalCrsSpd
+
+double AOF_Waypoint::evalCrsSpd(double eval_crs, double eval_spd) const
+{
   // CALCULATE THE FIRST SCORE - SCORE_ROC
 
   double angle_diff      = angle360(eval_crs - m_angle_to_wpt);
@@ -0,0 +1,162 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: NodeGrid.cpp                                         */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cmath>
+#include <climits>
+#include <algorithm>
+#include "NodeGrid.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor
+
+NodeGrid::NodeGrid(double cell_size)
+{
+  m_cell_size = 100;
+  setCellSize(cell_size);
+}
+
+//---------------------------------------------------------
+// Procedure: clear()
+
+void NodeGrid::clear()
+{
+  m_names.clear();
+  m_xpos.clear();
+  m_ypos.clear();
+  m_cells.clear();
+}
+
+//---------------------------------------------------------
+// Procedure: setCellSize()
+//      Note: Only allowed while the grid is empty since the
+//            nodes already added would be in the wrong cells.
+
+bool NodeGrid::setCellSize(double cell_size)
+{
+  if((cell_size <= 0) || (m_names.size() != 0))
+    return(false);
+  m_cell_size = cell_size;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: addNode()
+
+void NodeGrid::addNode(const string& name, double x, double y)
+{
+  unsigned int index = m_names.size();
+  m_names.push_back(name);
+  m_xpos.push_back(x);
+  m_ypos.push_back(y);
+
+  pair<int,int> key(cellIndex(x), cellIndex(y));
+  m_cells[key].push_back(index);
+}
+
+//---------------------------------------------------------
+// Procedure: getNodesWithin()
+
+vector<string> NodeGrid::getNodesWithin(double x, double y,
+					double range) const
+{
+  vector<string> names;
+  getNodesWithin(x, y, range, names);
+  return(names);
+}
+
+//---------------------------------------------------------
+// Procedure: getNodesWithin()
+//   Purpose: Append to names every node within range of x,y.
+//      Note: If the query box spans more cells than there are
+//            nodes, a straight scan of the nodes is cheaper.
+
+void NodeGrid::getNodesWithin(double x, double y, double range,
+			      vector<string>& names) const
+{
+  if((range < 0) || (x != x) || (y != y))
+    return;
+
+  double range_squared = range * range;
+
+  int col_lo = cellIndex(x - range);
+  int col_hi = cellIndex(x + range);
+  int row_lo = cellIndex(y - range);
+  int row_hi = cellIndex(y + range);
+
+  double span = ((double)(col_hi - col_lo) + 1) * 
+    ((double)(row_hi - row_lo) + 1);
+
+  if(span > (double)(m_names.size())) {
+    unsigned int i, vsize = m_names.size();
+    for(i=0; i<vsize; i++) {
+      double dx = m_xpos[i] - x;
+      double dy = m_ypos[i] - y;
+      if(((dx*dx) + (dy*dy)) <= range_squared)
+	names.push_back(m_names[i]);
+    }
+    return;
+  }
+
+  // Gather the candidate indices first so that results come back
+  // in insertion order regardless of how cells were visited.
+  vector<unsigned int> hits;
+  for(int col=col_lo; col<=col_hi; col++) {
+    map<pair<int,int>, vector<unsigned int> >::const_iterator p;
+    p = m_cells.lower_bound(pair<int,int>(col, row_lo));
+    for(; (p!=m_cells.end()) && (p->first.first == col) && 
+	  (p->first.second <= row_hi); p++) {
+      const vector<unsigned int>& members = p->second;
+      unsigned int i, vsize = members.size();
+      for(i=0; i<vsize; i++) {
+	unsigned int ix = members[i];
+	double dx = m_xpos[ix] - x;
+	double dy = m_ypos[ix] - y;
+	if(((dx*dx) + (dy*dy)) <= range_squared)
+	  hits.push_back(ix);
+      }
+    }
+  }
+  
+  sort(hits.begin(), hits.end());
+  unsigned int i, vsize = hits.size();
+  for(i=0; i<vsize; i++)
+    names.push_back(m_names[hits[i]]);
+}
+
+//---------------------------------------------------------
+// Procedure: cellIndex()
+//      Note: Clamped so far-flung coordinates share an edge cell
+//            rather than overflowing the int.
+
+int NodeGrid::cellIndex(double val) const
+{
+  double cell = floor(val / m_cell_size);
+  if(cell != cell)
+    return(0);
+  if(cell < (double)(INT_MIN + 1))
+    return(INT_MIN + 1);
+  if(cell > (double)(INT_MAX - 1))
+    return(INT_MAX - 1);
+  return((int)(cell));
+}
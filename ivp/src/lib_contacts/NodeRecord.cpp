@@ -21,6 +21,7 @@
 /* <http://www.gnu.org/licenses/>.                               */
 /*****************************************************************/
 
+#include <cstdio>
 #include "NodeRecord.h"
 #include "MBUtils.h"
 #include "AngleUtils.h"
@@ -44,6 +45,8 @@ NodeRecord::NodeRecord(string vname, string vtype)
   m_speed_og   = 0;
   m_heading    = 0;
   m_heading_og = 0;
+  m_yaw        = 0;
+  m_pitch      = 0;
   m_depth      = 0;
   m_altitude   = 0;
   m_timestamp  = 0;
@@ -61,6 +64,8 @@ NodeRecord::NodeRecord(string vname, string vtype)
   m_speed_og_set   = false;
   m_heading_set    = false;
   m_heading_og_set = false;
+  m_yaw_set        = false;
+  m_pitch_set      = false;
   m_depth_set      = false;
   m_altitude_set   = false;
   m_length_set     = false;
@@ -150,67 +155,112 @@ bool NodeRecord::hasProperty(string key) const
 }
 
 
+//------------------------------------------------------------
+// Procedure: appendDoubleX()
+//   Purpose: Append ",<key>=<val>" to the given string, with val
+//            formatted as by doubleToStringX(), but in place rather
+//            than through temporary strings.
+
+static void appendDoubleX(string& str, const char *key, double val,
+			  int digits)
+{
+  str += ',';
+  str += key;
+  str += '=';
+
+  // Very large values are printed in %e format by doubleToString()
+  if((digits < 0) || (digits > 9) || !(val <= 3.4028236692e+38)) {
+    str += doubleToStringX(val, digits);
+    return;
+  }
+
+  char buff[64];
+  int len = snprintf(buff, 64, "%.*f", digits, val);
+  if((len <= 0) || (len >= 64)) {
+    str += doubleToStringX(val, digits);
+    return;
+  }
+
+  // As in dstringCompact(): drop trailing zeros and the decimal
+  if(digits > 0) {
+    while(buff[len-1] == '0')
+      len--;
+    if(buff[len-1] == '.')
+      len--;
+  }
+  if((len == 2) && (buff[0] == '-') && (buff[1] == '0'))
+    str += '0';
+  else
+    str.append(buff, len);
+}
+
 //------------------------------------------------------------
 // Procedure: getSpec()
 
 string NodeRecord::getSpec() const
 {
-  string str = "NAME=" + m_name;
+  string str;
+  str.reserve(256);
+
+  str += "NAME=";
+  str += m_name;
   if(m_x_set)
-    str += ",X="    + doubleToStringX(m_x,2);
+    appendDoubleX(str, "X", m_x, 2);
   if(m_y_set)
-    str += ",Y="    + doubleToStringX(m_y,2);
+    appendDoubleX(str, "Y", m_y, 2);
   if(m_speed_set)
-    str += ",SPD="  + doubleToStringX(m_speed,2);
+    appendDoubleX(str, "SPD", m_speed, 2);
   if(m_heading_set)
-    str += ",HDG="  + doubleToStringX(m_heading,2);
+    appendDoubleX(str, "HDG", m_heading, 2);
   if(m_depth_set)
-    str += ",DEP="  + doubleToStringX(m_depth,2);
+    appendDoubleX(str, "DEP", m_depth, 2);
 
   if(m_lat_set)
-    str += ",LAT=" + doubleToStringX(m_lat, 8);
+    appendDoubleX(str, "LAT", m_lat, 8);
   if(m_lon_set)
-    str += ",LON=" + doubleToStringX(m_lon, 8);
+    appendDoubleX(str, "LON", m_lon, 8);
   if(m_type != "")
-    str += ",TYPE=" + m_type;
+    str.append(",TYPE=").append(m_type);
   if(m_group != "")
-    str += ",GROUP=" + m_group;
+    str.append(",GROUP=").append(m_group);
   if(m_mode != "")
-    str += ",MODE=" + m_mode;
+    str.append(",MODE=").append(m_mode);
   if(m_mode_aux != "")
-    str += ",MODE_AUX=" + m_mode_aux;
+    str.append(",MODE_AUX=").append(m_mode_aux);
   if(m_allstop != "")
-    str += ",ALLSTOP=" + m_allstop;
+    str.append(",ALLSTOP=").append(m_allstop);
   if(m_load_warning != "")
-    str += ",LOAD_WARNING=" + m_load_warning;
+    str.append(",LOAD_WARNING=").append(m_load_warning);
 
   if(m_altitude_set)
-    str += ",ALTITUDE=" + doubleToStringX(m_altitude,2);
+    appendDoubleX(str, "ALTITUDE", m_altitude, 2);
 
   if(m_speed_og_set)
-    str += ",SPD_OG=" + doubleToStringX(m_speed_og,2);
+    appendDoubleX(str, "SPD_OG", m_speed_og, 2);
 
   if(m_heading_og_set)
-    str += ",HDG_OG="  + doubleToStringX(m_heading_og,2);
+    appendDoubleX(str, "HDG_OG", m_heading_og, 2);
 
   if(m_index != 0)
-    str += ",INDEX="  + intToString(m_index);
+    str.append(",INDEX=").append(intToString(m_index));
   
   if(m_thrust_mode_reverse)
     str += ",THRUST_MODE_REVERSE=true";
 
   if(m_yaw_set) 
-    str += ",YAW=" + doubleToStringX(headingToRadians(m_heading),7);
+    appendDoubleX(str, "YAW", headingToRadians(m_heading), 7);
     //str += ",YAW="  + doubleToStringX(m_heading,2);
   if(m_timestamp_set)
-    str += ",TIME=" + doubleToStringX(m_timestamp,2);
+    appendDoubleX(str, "TIME", m_timestamp, 2);
   if(m_length_set)
-    str += ",LENGTH=" + doubleToStringX(m_length,2);
+    appendDoubleX(str, "LENGTH", m_length, 2);
   
   map<string, string>::const_iterator p;
   for(p=m_properties.begin(); p!=m_properties.end(); p++) {
-    str += "," + p->first;
-    str += "=" + p->second;
+    str += ',';
+    str += p->first;
+    str += '=';
+    str += p->second;
   }
   
   return(str);
@@ -22,77 +22,193 @@
 /*****************************************************************/
 
 #include <cstdlib>
+#include <cstring>
 #include "NodeRecordUtils.h"
 #include "MBUtils.h"
 
 using namespace std;
 
+// Fields of a NODE_REPORT understood by string2NodeRecord()
+enum NodeReportField {NRF_NAME, NRF_TYPE, NRF_GROUP, NRF_MODE, NRF_ALLSTOP,
+		      NRF_LOAD_WARNING, NRF_INDEX, NRF_THRUST_MODE_REVERSE,
+		      NRF_TIME, NRF_X, NRF_Y, NRF_LAT, NRF_LON, NRF_SPEED,
+		      NRF_SPEED_OG, NRF_HEADING, NRF_HEADING_OG, NRF_YAW,
+		      NRF_DEPTH, NRF_ALTITUDE, NRF_LENGTH, NRF_NONE};
+
+struct NodeReportKey
+{
+  const char*     key;
+  unsigned int    len;
+  NodeReportField field;
+};
+
+static const NodeReportKey node_report_keys[] = {
+  {"NAME", 4, NRF_NAME},          {"TYPE", 4, NRF_TYPE}, 
+  {"GROUP", 5, NRF_GROUP},        {"MODE", 4, NRF_MODE}, 
+  {"ALLSTOP", 7, NRF_ALLSTOP},    {"LOAD_WARNING", 12, NRF_LOAD_WARNING},
+  {"INDEX", 5, NRF_INDEX},  
+  {"THRUST_MODE_REVERSE", 19, NRF_THRUST_MODE_REVERSE},
+  {"UTC_TIME", 8, NRF_TIME},      {"TIME", 4, NRF_TIME}, 
+  {"X", 1, NRF_X},                {"Y", 1, NRF_Y}, 
+  {"LAT", 3, NRF_LAT},            {"LON", 3, NRF_LON},
+  {"SPD", 3, NRF_SPEED},          {"SPEED", 5, NRF_SPEED}, 
+  {"SPD_OG", 6, NRF_SPEED_OG},    {"HDG", 3, NRF_HEADING}, 
+  {"HEADING", 7, NRF_HEADING},    {"HDG_OG", 6, NRF_HEADING_OG}, 
+  {"YAW", 3, NRF_YAW},            {"DEP", 3, NRF_DEPTH}, 
+  {"DEPTH", 5, NRF_DEPTH},        {"ALT", 3, NRF_ALTITUDE}, 
+  {"ALTITUDE", 8, NRF_ALTITUDE},  {"LENGTH", 6, NRF_LENGTH},
+  {"LEN", 3, NRF_LENGTH}};
+
+// A perfect hash of the keys above, from nodeReportHash() to the
+// index of the key, or -1. Must be redone if a key is added.
+static const int node_report_hash[64] = {
+  -1, -1, 21,  6, -1, -1, -1, -1, 16, -1,  8, -1, -1, -1, 26,  4,
+  20,  1, -1, -1, -1, 25, -1,  3, -1, 10, -1, -1, -1, -1, -1, -1,
+  -1,  9, 24, -1, -1, -1, -1, 14, -1, 15, 11, -1, 13,  7, -1,  5,
+  -1,  0, -1, 23, 22, 17, -1,  2, 19, -1, -1, -1, 18, -1, 12, -1};
+
+//---------------------------------------------------------
+// Procedure: upperChar
+
+static inline unsigned int upperChar(char c)
+{
+  if((c >= 'a') && (c <= 'z'))
+    return((unsigned int)(c - 'a' + 'A'));
+  return((unsigned int)((unsigned char)(c)));
+}
+
+//---------------------------------------------------------
+// Procedure: nodeReportField
+//   Purpose: Find the field of the given key, in any case, with one
+//            table look up and one key compare.
+
+static NodeReportField nodeReportField(const char *key, unsigned int len)
+{
+  if(len == 0)
+    return(NRF_NONE);
+
+  unsigned int c0 = upperChar(key[0]);
+  unsigned int c1 = (len > 1) ? upperChar(key[1]) : c0;
+  unsigned int cn = upperChar(key[len-1]);
+  int ix = node_report_hash[(len + 4*c0 + 3*c1 + 10*cn) & 63];
+  if((ix < 0) || (node_report_keys[ix].len != len))
+    return(NRF_NONE);
+
+  const char *kstr = node_report_keys[ix].key;
+  for(unsigned int i=0; i<len; i++) {
+    if(upperChar(key[i]) != (unsigned int)(kstr[i]))
+      return(NRF_NONE);
+  }
+  return(node_report_keys[ix].field);
+}
+
 //---------------------------------------------------------
 // Procedure: string2NodeRecord
 //   Example: NAME=alpha,TYPE=KAYAK,UTC_TIME=1267294386.51,
 //            X=29.66,Y=-23.49,LAT=43.825089, LON=-70.330030, 
 //            SPD=2.00, HDG=119.06,YAW=119.05677,DEPTH=0.00,     
 //            LENGTH=4.0,MODE=DRIVE,GROUP=A
+//      Note: A single pass over the report. The fields are found in
+//            place, with blank ends skipped, and keys are matched in
+//            any case. A numeric field is only set if its value is a
+//            number per isNumber(). No strings are built other than
+//            the values of the string fields.
 
 NodeRecord string2NodeRecord(const string& node_rep_string, bool returnPartialResult)
 {
-  NodeRecord empty_record;
   NodeRecord new_record;
 
-  vector<string> svector = parseString(node_rep_string, ',');
-  unsigned int i, vsize = svector.size();
-  for(i=0; i<vsize; i++) {
-    string param = toupper(biteStringX(svector[i], '='));
-    string value = svector[i];
-
-    if(param == "NAME")
-      new_record.setName(value);
-    else if(param == "TYPE")
-      new_record.setType(value);
-    else if(param == "GROUP")
-      new_record.setGroup(value);
-    else if(param == "MODE")
-      new_record.setMode(value);
-    else if(param == "ALLSTOP")
-      new_record.setAllStop(value);
-    else if(param == "LOAD_WARNING")
-      new_record.setLoadWarning(value);
-    else if(param == "INDEX")
-      new_record.setIndex(atof(value.c_str()));
-    else if((param == "THRUST_MODE_REVERSE") && (tolower(value) == "true")) 
-      new_record.setThrustModeReverse(true);
-    else if(isNumber(value)) {
-      if((param == "UTC_TIME") || (param == "TIME"))
-	new_record.setTimeStamp(atof(value.c_str()));
-      else if(param == "X")
-	new_record.setX(atof(value.c_str()));
-      else if(param == "Y")
-	new_record.setY(atof(value.c_str()));
-      else if(param == "LAT")
-	new_record.setLat(atof(value.c_str()));
-      else if(param == "LON")
-	new_record.setLon(atof(value.c_str()));
-
-      else if((param == "SPD") || (param == "SPEED"))
-	new_record.setSpeed(atof(value.c_str()));
-      else if(param == "SPD_OG")
-	new_record.setSpeedOG(atof(value.c_str()));
-
-      else if((param == "HDG") || (param == "HEADING"))
-	new_record.setHeading(atof(value.c_str()));
-      else if(param == "HDG_OG")
-	new_record.setHeadingOG(atof(value.c_str()));
-
-      
-
-      else if(param == "YAW")
-	new_record.setYaw(atof(value.c_str()));
-      else if((param == "DEP") || (param == "DEPTH"))
-	new_record.setDepth(atof(value.c_str()));
-      else if((param == "ALT") || (param == "ALTITUDE"))
-	new_record.setAltitude(atof(value.c_str()));
-      else if((param == "LENGTH") || (param == "LEN"))
-	new_record.setLength(atof(value.c_str()));
+  const char  *str = node_rep_string.c_str();
+  unsigned int len = strlen(str);
+
+  unsigned int i = 0;
+  while(i < len) {
+    // Part 1: Find the field and the end of the param
+    unsigned int fend = i;
+    unsigned int pend = len;
+    while((fend < len) && (str[fend] != ',')) {
+      if((pend == len) && (str[fend] == '='))
+	pend = fend;
+      fend++;
+    }
+    if(pend > fend)
+      pend = fend;
+
+    // Part 2: Strip the blank ends of the param and the value
+    unsigned int pbeg = i;
+    unsigned int vbeg = (pend < fend) ? pend+1 : fend;
+    unsigned int vend = fend;
+    while((pbeg < pend) && ((str[pbeg]==' ') || (str[pbeg]=='\t')))
+      pbeg++;
+    while((pend > pbeg) && ((str[pend-1]==' ') || (str[pend-1]=='\t')))
+      pend--;
+    while((vbeg < vend) && ((str[vbeg]==' ') || (str[vbeg]=='\t')))
+      vbeg++;
+    while((vend > vbeg) && ((str[vend-1]==' ') || (str[vend-1]=='\t')))
+      vend--;
+    i = fend + 1;
+
+    const char  *value = str + vbeg;
+    unsigned int vlen  = vend - vbeg;
+
+    // Part 3: Apply the value to the field
+    NodeReportField field = nodeReportField(str + pbeg, pend - pbeg);
+    if(field == NRF_NONE)
+      continue;
+
+    if(field == NRF_NAME)
+      new_record.setName(string(value, vlen));
+    else if(field == NRF_TYPE)
+      new_record.setType(string(value, vlen));
+    else if(field == NRF_GROUP)
+      new_record.setGroup(string(value, vlen));
+    else if(field == NRF_MODE)
+      new_record.setMode(string(value, vlen));
+    else if(field == NRF_ALLSTOP)
+      new_record.setAllStop(string(value, vlen));
+    else if(field == NRF_LOAD_WARNING)
+      new_record.setLoadWarning(string(value, vlen));
+    else if(field == NRF_INDEX) {
+      double dval = 0;
+      if(!parseDouble(value, vlen, dval))
+	dval = atof(string(value, vlen).c_str());
+      new_record.setIndex(dval);
+    }
+    else if(field == NRF_THRUST_MODE_REVERSE) {
+      if((vlen == 4) && (tolower(string(value, vlen)) == "true"))
+	new_record.setThrustModeReverse(true);
+    }
+    else {
+      double dval = 0;
+      if(!parseDouble(value, vlen, dval))
+	continue;
+
+      if(field == NRF_TIME)
+	new_record.setTimeStamp(dval);
+      else if(field == NRF_X)
+	new_record.setX(dval);
+      else if(field == NRF_Y)
+	new_record.setY(dval);
+      else if(field == NRF_LAT)
+	new_record.setLat(dval);
+      else if(field == NRF_LON)
+	new_record.setLon(dval);
+      else if(field == NRF_SPEED)
+	new_record.setSpeed(dval);
+      else if(field == NRF_SPEED_OG)
+	new_record.setSpeedOG(dval);
+      else if(field == NRF_HEADING)
+	new_record.setHeading(dval);
+      else if(field == NRF_HEADING_OG)
+	new_record.setHeadingOG(dval);
+      else if(field == NRF_YAW)
+	new_record.setYaw(dval);
+      else if(field == NRF_DEPTH)
+	new_record.setDepth(dval);
+      else if(field == NRF_ALTITUDE)
+	new_record.setAltitude(dval);
+      else if(field == NRF_LENGTH)
+	new_record.setLength(dval);
     }
   }
   
@@ -101,7 +217,3 @@ NodeRecord string2NodeRecord(const string& node_rep_string, bool returnPartialRe
 
   return(new_record);
 }
-
-
-
-
@@ -41,6 +41,9 @@ CPAEngine::CPAEngine()
   cnCRS = 0;
   osLAT = 0;
   osLON = 0;
+
+  m_trig_crs_low   = 0;
+  m_trig_crs_delta = 0;
 }
 
 //----------------------------------------------------------
@@ -63,6 +66,10 @@ CPAEngine::CPAEngine(double gcnlat, double gcnlon, double gcncrs,
   osLON   = goslon;
   if(cnSPD < 0)
     cnSPD = 0;
+
+  m_trig_crs_low   = 0;
+  m_trig_crs_delta = 0;
+
   this->setStatic();
 }
 
@@ -102,6 +109,72 @@ void CPAEngine::setContactCache(double secs)
   }
 }
 
+//----------------------------------------------------------------
+// Procedure: setTrigTable()
+//   Purpose: Precompute the sine and cosine of each ownship course
+//            on the grid crs_low + (crs_delta * i). Calls to evalCPA
+//            or evalROC with a course exactly on this grid then skip
+//            the trig calculations.
+
+void CPAEngine::setTrigTable(double crs_low, double crs_delta, 
+			     unsigned int crs_pts)
+{
+  clearTables();
+  if(crs_delta <= 0)
+    return;
+
+  m_trig_crs_low   = crs_low;
+  m_trig_crs_delta = crs_delta;
+  m_trig_cos.resize(crs_pts);
+  m_trig_sin.resize(crs_pts);
+  for(unsigned int i=0; i<crs_pts; i++) {
+    double gamOS = degToRadians(angle360(crs_low + (crs_delta * i)));
+    m_trig_cos[i] = cos(gamOS);
+    m_trig_sin[i] = sin(gamOS);
+  }
+}
+
+//----------------------------------------------------------------
+// Procedure: clearTables()
+
+void CPAEngine::clearTables()
+{
+  m_trig_cos.clear();
+  m_trig_sin.clear();
+}
+
+//----------------------------------------------------------------
+// Procedure: tableIndex()
+//   Purpose: Find ix such that val == low + (delta * ix) exactly.
+
+bool CPAEngine::tableIndex(double val, double low, double delta,
+			   unsigned int pts, unsigned int& ix) const
+{
+  double dix = (val - low) / delta;
+  if((dix < 0) || (dix > (double)(pts)))
+    return(false);
+
+  ix = (unsigned int)(dix + 0.5);
+  if((ix >= pts) || ((low + (delta * ix)) != val))
+    return(false);
+  return(true);
+}
+
+//----------------------------------------------------------------
+// Procedure: trigLookup()
+
+bool CPAEngine::trigLookup(double osCRS, double& cgam, double& sgam) const
+{
+  unsigned int ix;
+  if(m_trig_cos.empty() || !tableIndex(osCRS, m_trig_crs_low, 
+				       m_trig_crs_delta,
+				       m_trig_cos.size(), ix))
+    return(false);
+
+  cgam = m_trig_cos[ix];
+  sgam = m_trig_sin[ix];
+  return(true);
+}
 
 //----------------------------------------------------------------
 // Procedure: evalCPA
@@ -111,11 +184,15 @@ void CPAEngine::setContactCache(double secs)
 double CPAEngine::evalCPA(double osCRS, double osSPD, 
 			  double osTOL, double *calcROC) const
 {
-  osCRS = angle360(osCRS);
+  double cgamOS, sgamOS;
+  bool cached = trigLookup(osCRS, cgamOS, sgamOS);
 
-  double gamOS  = degToRadians(osCRS);    // Angle in radians.
-  double cgamOS = cos(gamOS);             // Cosine of Angle (osCRS).
-  double sgamOS = sin(gamOS);             // Sine   of Angle (osCRS).
+  osCRS = angle360(osCRS);
+  if(!cached) {
+    double gamOS = degToRadians(osCRS);   // Angle in radians.
+    cgamOS = cos(gamOS);                  // Cosine of Angle (osCRS).
+    sgamOS = sin(gamOS);                  // Sine   of Angle (osCRS).
+  }
 
   double k2 = statK2;
   double k1 = statK1;
@@ -166,11 +243,15 @@ double CPAEngine::evalCPA(double osCRS, double osSPD,
 
 double CPAEngine::evalROC(double osCRS, double osSPD) const
 {
+  double cgamOS, sgamOS;
+  bool cached = trigLookup(osCRS, cgamOS, sgamOS);
+
   osCRS = angle360(osCRS);
-  
-  double gamOS  = degToRadians(osCRS);    // Angle in radians.
-  double cgamOS = cos(gamOS);             // Cosine of Angle (osCRS).
-  double sgamOS = sin(gamOS);             // Sine   of Angle (osCRS).
+  if(!cached) {
+    double gamOS = degToRadians(osCRS);   // Angle in radians.
+    cgamOS = cos(gamOS);                  // Cosine of Angle (osCRS).
+    sgamOS = sin(gamOS);                  // Sine   of Angle (osCRS).
+  }
 
   double k1 = statK1;
   
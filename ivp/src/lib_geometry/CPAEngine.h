@@ -36,6 +36,9 @@ public:
   void setContactCache(double secs);
   ~CPAEngine() {}
 
+  void setTrigTable(double crs_low, double crs_delta, unsigned int crs_pts);
+  void clearTables();
+
 public:    
   double evalCPA(double osh, double osv, double ostol, double* calc_roc=0) const;
   double evalROC(double osh, double osv) const;
@@ -73,6 +76,9 @@ public:
  protected:
   void   setStatic();
   double smallAngle(double, double) const;
+  bool   trigLookup(double osh, double& cgam, double& sgam) const;
+  bool   tableIndex(double val, double low, double delta, 
+		    unsigned int pts, unsigned int& ix) const;
 
  protected: // Config parameters
   double cnLAT;   // Contact Lat position at time Tm.
@@ -108,6 +114,14 @@ public:
   std::vector<double> m_cn_cache_x;
   std::vector<double> m_cn_cache_y;
   double m_cn_cache_tdelta;
+
+  // Optional trig table over a fixed ownship course grid, e.g., 
+  // the helm decision domain. Lookups are exact matches only and
+  // fall back to direct calculation otherwise.
+  double m_trig_crs_low;
+  double m_trig_crs_delta;
+  std::vector<double> m_trig_cos;
+  std::vector<double> m_trig_sin;
 };
 
 #endif
@@ -30,6 +30,19 @@
 
 using namespace std;
 
+//-------------------------------------------------------------
+// Constructor
+
+XYConvexGrid::XYConvexGrid()
+{
+  m_config_cell_size = 0;
+
+  m_cell_cols = 0;
+  m_cell_rows = 0;
+  m_cell_xlen = 0;
+  m_cell_ylen = 0;
+}
+
 //-------------------------------------------------------------
 // Procedure: initialize
 //      Note: A convenience function. Only one cell variable is 
@@ -98,6 +111,7 @@ bool XYConvexGrid::initialize(const XYPolygon& poly,
     return(false);
 
   unsigned int esize = m_elements.size();
+  m_cell_lookup.assign(esize, -1);
 
   for(i=0; i<esize; i++) {
     xlow  = m_elements[i].getVal(0,0);
@@ -109,8 +123,10 @@ bool XYConvexGrid::initialize(const XYPolygon& poly,
     spoly.add_vertex(xhigh, ylow);
     spoly.add_vertex(xhigh, yhigh);
     spoly.add_vertex(xlow,  yhigh);
-    if(spoly.intersects(poly))
+    if(spoly.intersects(poly)) {
+      m_cell_lookup[i] = (int)(int_elements.size());
       int_elements.push_back(m_elements[i]);
+    }
   }
 
   m_elements  = int_elements;
@@ -393,11 +409,49 @@ void XYConvexGrid::setMaxLimit(double max_limit, unsigned int cix)
 
 bool XYConvexGrid::ptIntersect(double x, double y) const
 {
-  unsigned int i, vsize = m_elements.size();
-  for(i=0; i<vsize; i++) 
-    if(m_elements[i].containsPoint(x, y))
-      return(true);
-  return(false);
+  return(ptIntersectCells(x, y).size() > 0);
+}
+
+//-------------------------------------------------------------
+// Procedure: ptIntersectCells
+//   Purpose: Return the indices, in increasing order, of all grid
+//            elements containing the given point. A point on a
+//            shared edge or corner is in more than one element.
+//      Note: The column and row are found directly from the point.
+//            Neighbours are checked too, with the same containsPoint
+//            test as before, so round-off can not change the result.
+//            Visiting by column then row keeps the indices in order.
+
+vector<unsigned int> XYConvexGrid::ptIntersectCells(double x, double y) const
+{
+  vector<unsigned int> cells;
+  if((m_cell_cols == 0) || (m_cell_rows == 0))
+    return(cells);
+
+  // The last column and row may extend past the bounding square
+  double dcol = floor((x - m_bounding_square.getVal(0,0)) / m_cell_xlen);
+  double drow = floor((y - m_bounding_square.getVal(1,0)) / m_cell_ylen);
+  if((dcol != dcol) || (dcol < -1) || (dcol > (double)(m_cell_cols)))
+    return(cells);
+  if((drow != drow) || (drow < -1) || (drow > (double)(m_cell_rows)))
+    return(cells);
+
+  int col = (int)(dcol);
+  int row = (int)(drow);
+
+  // Elements were laid out by column, then by row
+  for(int i=col-1; i<=col+1; i++) {
+    if((i < 0) || (i >= (int)(m_cell_cols)))
+      continue;
+    for(int j=row-1; j<=row+1; j++) {
+      if((j < 0) || (j >= (int)(m_cell_rows)))
+	continue;
+      int ix = m_cell_lookup[(i * m_cell_rows) + j];
+      if((ix >= 0) && m_elements[ix].containsPoint(x, y))
+	cells.push_back((unsigned int)(ix));
+    }
+  }
+  return(cells);
 }
 
 //-------------------------------------------------------------
@@ -462,6 +516,11 @@ bool XYConvexGrid::initialize(const XYSquare& outer_square,
   }
 
   m_bounding_square = outer_square;
+
+  m_cell_cols = (unsigned int)(x_count);
+  m_cell_rows = (unsigned int)(y_count);
+  m_cell_xlen = unit_x_len;
+  m_cell_ylen = unit_y_len;
   return(true);
 }
 
@@ -32,7 +32,7 @@
 
 class XYConvexGrid : public XYObject {
 public:
-  XYConvexGrid() {}
+  XYConvexGrid();
   ~XYConvexGrid() {}
 
   bool      initialize(const XYPolygon&, double cell_size, double init_val);
@@ -51,6 +51,7 @@ public:
   XYSquare     getElement(unsigned int index) const;
   XYSquare     getSBound() const  {return(m_bounding_square);}
   bool         ptIntersect(double, double) const;
+  std::vector<unsigned int> ptIntersectCells(double, double) const;
   bool         ptIntersectBound(double, double) const;
   bool         segIntersectBound(double, double, double, double) const;
 
@@ -107,6 +108,14 @@ protected:
   std::vector<double>                m_cell_max_sofar;
   std::vector<double>                m_cell_min_sofar;
   std::vector<bool>                  m_cell_minmax_noted;
+
+  // Direct lookup from a column/row of the bounding square to an
+  // index into m_elements, or -1 if that square was not kept.
+  std::vector<int>  m_cell_lookup;
+  unsigned int      m_cell_cols;
+  unsigned int      m_cell_rows;
+  double            m_cell_xlen;
+  double            m_cell_ylen;
 };
 
 #endif
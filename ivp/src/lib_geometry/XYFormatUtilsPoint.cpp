@@ -25,6 +25,7 @@
 #include <cstdlib>
 #include "XYFormatUtilsPoint.h"
 #include "MBUtils.h"
+#include "StrView.h"
 
 using namespace std;
 
@@ -60,14 +61,11 @@ XYPoint stringStandard2Point(const string& str)
   XYPoint null_point;
   XYPoint new_point;
 
-  vector<string> mvector = parseString(str, ',');
-  unsigned int i, vsize = mvector.size();
+  StrParamIter iter(str);
+  StrView param, value;
   
-  string x,y,z;
-  for(i=0; i<vsize; i++) {
-    string param = biteStringX(mvector[i], '=');
-    string value = mvector[i];
-
+  StrView x,y,z;
+  while(iter.next(param, value)) {
     if(param == "x")
       x = value;
     else if(param == "y")
@@ -75,13 +73,13 @@ XYPoint stringStandard2Point(const string& str)
     else if(param == "z")
       z = value;
     else
-      new_point.set_param(param, value);
+      new_point.set_param(param.str(), value.str());
   }
   
-  if((x=="") || (y==""))
+  if(x.empty() || y.empty())
     return(null_point);
   
-  new_point.set_vertex(atof(x.c_str()), atof(y.c_str()), atof(z.c_str()));
+  new_point.set_vertex(x.atof(), y.atof(), z.atof());
   
   return(new_point);
 }
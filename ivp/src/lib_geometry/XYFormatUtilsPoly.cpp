@@ -30,6 +30,7 @@
 #include <iostream>
 #include "XYFormatUtilsPoly.h"
 #include "MBUtils.h"
+#include "StrView.h"
 #include "AngleUtils.h"
 #include "GeomUtils.h"
 
@@ -127,67 +128,63 @@ XYPolygon stringStandard2Poly(string str)
   XYPolygon null_poly;
   XYPolygon new_poly;
 
-  string rest = stripBlankEnds(str);
+  StrView rest = StrView(str).stripBlankEnds();
 
-  while(rest != "") {
-    string left = stripBlankEnds(biteString(rest, '='));
-    rest = stripBlankEnds(rest);
+  while(!rest.empty()) {
+    StrView left = rest.biteStringX('=');
     
     if(left == "pts") {
-      string pstr = biteStringX(rest, '}');
+      StrView pstr = rest.biteStringX('}');
       
       // Empty set of points is an error
-      if(pstr == "")
+      if(pstr.empty())
 	return(null_poly);
 
       // Points should begin with an open brace (but discard now)
       if(pstr[0] != '{') 
 	return(null_poly);
       else
-	pstr = pstr.substr(1);
+	pstr = pstr.substr(1, pstr.length()-1);
 
       // If more components after pts={}, then it should begin w/ comma
-      if(rest != "") {
+      if(!rest.empty()) {
 	if(rest[0] != ',')
 	  return(null_poly);
 	else
-	  rest = rest.substr(1);
+	  rest = rest.substr(1, rest.length()-1);
       }
 
-      vector<string> svector = parseString(pstr, ':');
-      unsigned int i, vsize = svector.size();
-      for(i=0; i<vsize; i++) {
-	string vertex = stripBlankEnds(svector[i]);
-	string xstr = biteStringX(vertex, ',');
-	string ystr = biteStringX(vertex, ',');
-	string zstr = biteStringX(vertex, ',');
-	string pstr = biteStringX(vertex, ',');
+      StrSplitter splitter(pstr, ':');
+      StrView vertex;
+      while(splitter.next(vertex)) {
+	vertex = vertex.stripBlankEnds();
+	StrView xstr = vertex.biteStringX(',');
+	StrView ystr = vertex.biteStringX(',');
+	StrView zstr = vertex.biteStringX(',');
+	StrView pstr = vertex.biteStringX(',');
 	  
 	string property;
 	  
-	if(!isNumber(xstr) || !isNumber(ystr))
+	double xval = 0;
+	double yval = 0;
+	if(!xstr.toDouble(xval) || !ystr.toDouble(yval))
 	  return(null_poly);
-	double xval = atof(xstr.c_str());
-	double yval = atof(ystr.c_str());
 	double zval = 0;
-	if(isNumber(zstr))
-	  zval = atof(zstr.c_str());
-	else if(zstr != "")
-	  property = zstr;
+	if(!zstr.toDouble(zval) && !zstr.empty())
+	  property = zstr.str();
 	  
-	if(pstr != "") {
+	if(!pstr.empty()) {
 	  if(property != "")
 	    property += ",";
-	  property += pstr;
+	  property += pstr.str();
 	}
 	new_poly.add_vertex(xval, yval, zval, property, false);
       }
       new_poly.determine_convexity();
     }
     else {
-      string right = stripBlankEnds(biteString(rest, ','));
-      rest = stripBlankEnds(rest);
-      new_poly.set_param(left, right);
+      StrView right = rest.biteStringX(',');
+      new_poly.set_param(left.str(), right.str());
     }
   }	  				  
 	
@@ -29,6 +29,7 @@
 #include "XYFormatUtilsSegl.h"
 #include "XYPatternBlock.h"
 #include "MBUtils.h"
+#include "StrView.h"
 #include "AngleUtils.h"
 #include "GeomUtils.h"
 
@@ -88,64 +89,62 @@ XYSegList stringStandard2SegList(string str)
   XYSegList null_segl;
   XYSegList new_seglist;
 
-  string rest = str;
+  StrView rest = str;
 
-  while(rest != "") {
-    string left = biteStringX(rest, '=');
+  while(!rest.empty()) {
+    StrView left = rest.biteStringX('=');
     
     if(left == "pts") {
-      string pstr = biteStringX(rest, '}');
+      StrView pstr = rest.biteStringX('}');
       
       // Empty set of points is an error
-      if(pstr == "")
+      if(pstr.empty())
 	return(null_segl);
 
       // Points should begin with an open brace (but discard now)
       if(pstr[0] != '{') 
 	return(null_segl);
       else
-	pstr = pstr.substr(1);
+	pstr = pstr.substr(1, pstr.length()-1);
 
       // If more components after pts={}, then it should begin w/ comma
-      if(rest != "") {
+      if(!rest.empty()) {
 	if(rest[0] != ',')
 	  return(null_segl);
 	else
-	  rest = rest.substr(1);
+	  rest = rest.substr(1, rest.length()-1);
       }
 
-      vector<string> svector = parseString(pstr, ':');
-      unsigned int i, vsize = svector.size();
-      for(i=0; i<vsize; i++) {
-	string vertex = stripBlankEnds(svector[i]);
-	string xstr = biteStringX(vertex, ',');
-	string ystr = biteStringX(vertex, ',');
-	string zstr = biteStringX(vertex, ',');
-	string pstr = biteStringX(vertex, ',');
+      StrSplitter splitter(pstr, ':');
+      StrView vertex;
+      while(splitter.next(vertex)) {
+	vertex = vertex.stripBlankEnds();
+	StrView xstr = vertex.biteStringX(',');
+	StrView ystr = vertex.biteStringX(',');
+	StrView zstr = vertex.biteStringX(',');
+	StrView pstr = vertex.biteStringX(',');
 	  
 	string property;
 	  
-	if(!isNumber(xstr) || !isNumber(ystr))
+	double xval = 0;
+	double yval = 0;
+	if(!xstr.toDouble(xval) || !ystr.toDouble(yval))
 	  return(null_segl);
-	double xval = atof(xstr.c_str());
-	double yval = atof(ystr.c_str());
 	double zval = 0;
-	if(isNumber(zstr))
-	  zval = atof(zstr.c_str());
-	else if(zstr != "")
-	  property = zstr;
+	if(!zstr.toDouble(zval) && !zstr.empty())
+	  property = zstr.str();
 	  
-	if(pstr != "") {
+	if(!pstr.empty()) {
 	  if(property != "")
 	    property += ",";
-	  property += pstr;
+	  property += pstr.str();
 	}
 	new_seglist.add_vertex(xval, yval, zval, property);
       }
     }
     else {
-      string right = biteStringX(rest, ',');
-      new_seglist.set_param(left, right);
+      StrView right = rest.biteStringX(',');
+      new_seglist.set_param(left.str(), right.str());
     }
   }	  				  
 
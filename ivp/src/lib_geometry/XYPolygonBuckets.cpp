@@ -0,0 +1,348 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: XYPolygonBuckets.cpp                                 */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cmath>
+#include "XYPolygonBuckets.h"
+#include "GeomUtils.h"
+
+using namespace std;
+
+//-------------------------------------------------------------
+// Procedure: distPointToBox
+//   Purpose: Distance from a point to an axis-aligned box, zero if
+//            the point is in the box.
+
+static double distPointToBox(double px, double py, double xlow, 
+			     double xhigh, double ylow, double yhigh)
+{
+  double dx = 0;
+  if(px < xlow)
+    dx = xlow - px;
+  else if(px > xhigh)
+    dx = px - xhigh;
+
+  double dy = 0;
+  if(py < ylow)
+    dy = ylow - py;
+  else if(py > yhigh)
+    dy = py - yhigh;
+
+  return(hypot(dx, dy));
+}
+
+//-------------------------------------------------------------
+// Procedure: segCrossesBox
+//   Purpose: Determine if a line segment touches an axis-aligned
+//            box, by clipping the segment to the box.
+
+static bool segCrossesBox(double x1, double y1, double x2, double y2,
+			  double xlow, double xhigh, 
+			  double ylow, double yhigh)
+{
+  double t0 = 0;
+  double t1 = 1;
+  double p[4] = {-(x2-x1), (x2-x1), -(y2-y1), (y2-y1)};
+  double q[4] = {x1-xlow, xhigh-x1, y1-ylow, yhigh-y1};
+  for(int i=0; i<4; i++) {
+    if(p[i] == 0) {
+      if(q[i] < 0)
+	return(false);
+    }
+    else {
+      double t = q[i] / p[i];
+      if(p[i] < 0) {
+	if(t > t1)
+	  return(false);
+	if(t > t0)
+	  t0 = t;
+      }
+      else {
+	if(t < t0)
+	  return(false);
+	if(t < t1)
+	  t1 = t;
+      }
+    }
+  }
+  return(true);
+}
+
+//-------------------------------------------------------------
+// Constructor
+
+XYPolygonBuckets::XYPolygonBuckets()
+{
+  clear();
+}
+
+//-------------------------------------------------------------
+// Procedure: clear
+
+void XYPolygonBuckets::clear()
+{
+  m_poly.clear();
+  m_xlow  = 0;
+  m_ylow  = 0;
+  m_xlen  = 0;
+  m_ylen  = 0;
+  m_cols  = 0;
+  m_rows  = 0;
+  m_slack = 0;
+  m_bucket_state.clear();
+  m_bucket_edges.clear();
+}
+
+//-------------------------------------------------------------
+// Procedure: initialize
+//   Purpose: Build the buckets over the polygon's bounding box,
+//            padded by half its size on each side.
+//      Note: Polygons with fewer than three vertices are kept but
+//            not bucketed. Queries then go straight to the polygon.
+
+bool XYPolygonBuckets::initialize(const XYPolygon& poly, 
+				  unsigned int buckets)
+{
+  clear();
+  m_poly = poly;
+
+  unsigned int i, j, vsize = poly.size();
+  if((vsize < 3) || (buckets == 0))
+    return(false);
+
+  double xlow  = poly.get_vx(0);
+  double xhigh = poly.get_vx(0);
+  double ylow  = poly.get_vy(0);
+  double yhigh = poly.get_vy(0);
+  for(i=1; i<vsize; i++) {
+    double x = poly.get_vx(i);
+    double y = poly.get_vy(i);
+    if(x < xlow)    xlow  = x;
+    if(x > xhigh)   xhigh = x;
+    if(y < ylow)    ylow  = y;
+    if(y > yhigh)   yhigh = y;
+  }
+  
+  double pad = (xhigh - xlow);
+  if((yhigh - ylow) > pad)
+    pad = (yhigh - ylow);
+  pad *= 0.5;
+  if(!(pad > 0))
+    return(false);
+
+  m_xlow = xlow - pad;
+  m_ylow = ylow - pad;
+  m_cols = buckets;
+  m_rows = buckets;
+  m_xlen = ((xhigh + pad) - m_xlow) / m_cols;
+  m_ylen = ((yhigh + pad) - m_ylow) / m_rows;
+
+  double coord_max = 0;
+  coord_max = fabs(m_xlow) > coord_max ? fabs(m_xlow) : coord_max;
+  coord_max = fabs(m_ylow) > coord_max ? fabs(m_ylow) : coord_max;
+  coord_max = fabs(xhigh+pad) > coord_max ? fabs(xhigh+pad) : coord_max;
+  coord_max = fabs(yhigh+pad) > coord_max ? fabs(yhigh+pad) : coord_max;
+  m_slack = 1e-8 * (1 + coord_max);
+
+  // A bucket is known to be inside or outside only if every point in
+  // it is far enough from every edge that XYPolygon::side() can not be
+  // swayed by round-off. Sharp vertices and steep (but not vertical)
+  // edges widen that margin, or rule out known buckets entirely.
+  double margin = -1;
+  if(poly.is_convex()) {
+    bool steep = false;
+    for(i=0; i<vsize; i++) {
+      unsigned int k = (i+1) % vsize;
+      double run  = poly.get_vx(k) - poly.get_vx(i);
+      double rise = poly.get_vy(k) - poly.get_vy(i);
+      if((run != 0) && (fabs(rise) > (1e6 * fabs(run))))
+	steep = true;
+    }
+    double vsine = minVertexSine();
+    if(!steep && (vsine > 1e-6))
+      margin = m_slack / vsine;
+  }
+  
+  unsigned int bsize = m_cols * m_rows;
+  m_bucket_state.assign(bsize, -1);
+  m_bucket_edges.assign(bsize, vector<unsigned int>());
+
+  vector<double> lower(vsize, 0);
+  vector<double> upper(vsize, 0);
+  for(i=0; i<m_cols; i++) {
+    for(j=0; j<m_rows; j++) {
+      unsigned int bix = (i * m_rows) + j;
+      double bxlow  = m_xlow + (i * m_xlen) - m_slack;
+      double bxhigh = m_xlow + ((i+1) * m_xlen) + m_slack;
+      double bylow  = m_ylow + (j * m_ylen) - m_slack;
+      double byhigh = m_ylow + ((j+1) * m_ylen) + m_slack;
+
+      double cx[4] = {bxlow, bxhigh, bxhigh, bxlow};
+      double cy[4] = {bylow, bylow,  byhigh, byhigh};
+
+      // Bounds on the distance from any point in the bucket to each
+      // edge. The farthest point from an edge is at a box corner. 
+      double min_upper = 0;
+      double min_lower = 0;
+      unsigned int e, c;
+      for(e=0; e<vsize; e++) {
+	unsigned int k = (e+1) % vsize;
+	double x1 = poly.get_vx(e);
+	double y1 = poly.get_vy(e);
+	double x2 = poly.get_vx(k);
+	double y2 = poly.get_vy(k);
+
+	upper[e] = 0;
+	for(c=0; c<4; c++) {
+	  double d = distPointToSeg(x1, y1, x2, y2, cx[c], cy[c]);
+	  if(d > upper[e])
+	    upper[e] = d;
+	}
+
+	if(segCrossesBox(x1, y1, x2, y2, bxlow, bxhigh, bylow, byhigh))
+	  lower[e] = 0;
+	else {
+	  lower[e] = distPointToBox(x1, y1, bxlow, bxhigh, bylow, byhigh);
+	  double d = distPointToBox(x2, y2, bxlow, bxhigh, bylow, byhigh);
+	  if(d < lower[e])
+	    lower[e] = d;
+	  for(c=0; c<4; c++) {
+	    d = distPointToSeg(x1, y1, x2, y2, cx[c], cy[c]);
+	    if(d < lower[e])
+	      lower[e] = d;
+	  }
+	}
+
+	if((e == 0) || (upper[e] < min_upper))
+	  min_upper = upper[e];
+	if((e == 0) || (lower[e] < min_lower))
+	  min_lower = lower[e];
+      }
+
+      double limit = (min_upper * (1 + 1e-9)) + m_slack;
+      for(e=0; e<vsize; e++) {
+	if(lower[e] <= limit)
+	  m_bucket_edges[bix].push_back(e);
+      }
+
+      if((margin >= 0) && (min_lower > margin)) {
+	double midx = m_xlow + ((i + 0.5) * m_xlen);
+	double midy = m_ylow + ((j + 0.5) * m_ylen);
+	m_bucket_state[bix] = poly.contains(midx, midy) ? 1 : 0;
+      }
+    }
+  }
+  
+  return(true);
+}
+
+//-------------------------------------------------------------
+// Procedure: contains
+//      Note: Same result as XYPolygon::contains(). Points outside
+//            the buckets or in a bucket crossed by the boundary 
+//            are checked against the polygon.
+
+bool XYPolygonBuckets::contains(double x, double y) const
+{
+  unsigned int bix;
+  if(bucketIndex(x, y, bix) && (m_bucket_state[bix] >= 0))
+    return(m_bucket_state[bix] == 1);
+  return(m_poly.contains(x, y));
+}
+
+//-------------------------------------------------------------
+// Procedure: dist_to_poly
+//      Note: Same result as XYPolygon::dist_to_poly(), taking the
+//            minimum over only the edges that may be nearest.
+
+double XYPolygonBuckets::dist_to_poly(double x, double y) const
+{
+  unsigned int bix;
+  if(!bucketIndex(x, y, bix))
+    return(m_poly.dist_to_poly(x, y));
+
+  const vector<unsigned int>& edges = m_bucket_edges[bix];
+
+  unsigned int vsize = m_poly.size();
+  double dist = 0;
+  for(unsigned int i=0; i<edges.size(); i++) {
+    unsigned int ix  = edges[i];
+    unsigned int ixx = (ix+1) % vsize;
+    double idist = distPointToSeg(m_poly.get_vx(ix), m_poly.get_vy(ix),
+				  m_poly.get_vx(ixx), m_poly.get_vy(ixx),
+				  x, y);
+    if((i==0) || (idist < dist))
+      dist = idist;
+  }
+  return(dist);
+}
+
+//-------------------------------------------------------------
+// Procedure: bucketIndex
+
+bool XYPolygonBuckets::bucketIndex(double x, double y, 
+				   unsigned int& ix) const
+{
+  if((m_cols == 0) || (m_rows == 0))
+    return(false);
+
+  double dcol = floor((x - m_xlow) / m_xlen);
+  double drow = floor((y - m_ylow) / m_ylen);
+  if(!(dcol >= 0) || (dcol >= (double)(m_cols)))
+    return(false);
+  if(!(drow >= 0) || (drow >= (double)(m_rows)))
+    return(false);
+
+  ix = ((unsigned int)(dcol) * m_rows) + (unsigned int)(drow);
+  return(true);
+}
+
+//-------------------------------------------------------------
+// Procedure: minVertexSine
+//   Purpose: Smallest sin(a/2) over the interior angles a of the
+//            polygon. A point at distance d from a convex polygon
+//            is at least d*sin(a/2) beyond some edge line. Returns
+//            zero if any two adjacent vertices coincide.
+
+double XYPolygonBuckets::minVertexSine() const
+{
+  unsigned int i, vsize = m_poly.size();
+  double min_sine = 1;
+  for(i=0; i<vsize; i++) {
+    unsigned int prev = (i + vsize - 1) % vsize;
+    unsigned int next = (i + 1) % vsize;
+    double ax = m_poly.get_vx(prev) - m_poly.get_vx(i);
+    double ay = m_poly.get_vy(prev) - m_poly.get_vy(i);
+    double bx = m_poly.get_vx(next) - m_poly.get_vx(i);
+    double by = m_poly.get_vy(next) - m_poly.get_vy(i);
+    double alen = hypot(ax, ay);
+    double blen = hypot(bx, by);
+    if((alen == 0) || (blen == 0))
+      return(0);
+    double cosa = ((ax*bx) + (ay*by)) / (alen * blen);
+    if(cosa > 1)
+      cosa = 1;
+    double sine = sqrt((1 - cosa) / 2);
+    if(sine < min_sine)
+      min_sine = sine;
+  }
+  return(min_sine);
+}
@@ -0,0 +1,73 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: XYPolygonBuckets.h                                   */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef XY_POLYGON_BUCKETS_HEADER
+#define XY_POLYGON_BUCKETS_HEADER
+
+#include <vector>
+#include "XYPolygon.h"
+
+// An acceleration structure for repeated contains() and dist_to_poly()
+// queries against one polygon. The area around the polygon is split
+// into buckets, each holding the edges that may be nearest to a point
+// in the bucket, and whether the bucket is wholly inside or outside
+// the polygon. Results are identical to those of the XYPolygon. The
+// polygon is copied, so later changes to the original are not seen.
+
+class XYPolygonBuckets {
+public:
+  XYPolygonBuckets();
+  ~XYPolygonBuckets() {}
+
+  bool   initialize(const XYPolygon&, unsigned int buckets=16);
+  void   clear();
+
+  bool   contains(double x, double y) const;
+  double dist_to_poly(double x, double y) const;
+
+  const XYPolygon& getPolygon() const {return(m_poly);}
+  unsigned int     size() const       {return(m_bucket_edges.size());}
+
+protected:
+  bool   bucketIndex(double x, double y, unsigned int& ix) const;
+  double minVertexSine() const;
+
+protected:
+  XYPolygon m_poly;
+
+  double       m_xlow;
+  double       m_ylow;
+  double       m_xlen;
+  double       m_ylen;
+  unsigned int m_cols;
+  unsigned int m_rows;
+
+  // Round-off allowance in the units of the polygon
+  double       m_slack;
+  
+  // Per bucket: 1 if inside, 0 if outside, -1 if unknown, and the
+  // indices of edges that may be nearest to a point in the bucket.
+  std::vector<int>                        m_bucket_state;
+  std::vector<std::vector<unsigned int> > m_bucket_edges;
+};
+
+#endif
@@ -37,12 +37,16 @@ using namespace std;
 BehaviorSet::BehaviorSet()
 {
   m_report_ipf = true;
+  m_report_ipf_binary = false;
   m_curr_time  = -1;
   m_bfactory_dynamic.loadEnvVarDirectories("IVP_BEHAVIOR_DIRS");
 
   m_total_behaviors_ever = 0;
   m_bhv_entry.reserve(1000);
   m_completed_pending = false;
+
+  m_ofcache_hits   = 0;
+  m_ofcache_misses = 0;
 }
 
 //------------------------------------------------------------
@@ -329,6 +333,17 @@ SpecBuild BehaviorSet::buildBehaviorFromSpec(BehaviorSpec spec,
 
     specs_valid = specs_valid && valid;
   }
+
+  // A behavior may ask to be produced concurrently only if its type
+  // is declared parallel-safe. Otherwise the request is dropped with
+  // a warning, and the behavior is produced in the ordered pass.
+  if(bhv->parallelOK() && !bhv->parallelSafe()) {
+    bhv->IvPBehavior::setParam("parallel", "false");
+    string msg = spec.getFileName() + ": " + bhv->getDescriptor();
+    msg += ": parallel=true ignored, " + bhv_kind + " is not parallel-safe";
+    addWarning(msg);
+  }
+
   if(specs_valid) {
     sbuild.setIvPBehavior(bhv);
     // Added Oct 1313 mikerb - allow template behaviors to make an initial
@@ -415,9 +430,12 @@ IvPFunction* BehaviorSet::produceOF(unsigned int ix,
   string old_activity_state = m_bhv_entry[ix].getState();
 
   // Look for possible dynamic updates to the behavior parameters
+  // A cached IvP function is no longer trusted after updates.
   bool update_made = bhv->checkUpdates();
-  if(update_made)
+  if(update_made) {
     bhv->onSetParamComplete();
+    bhv->clearCachedOF();
+  }
   
   // Check if the behavior duration is to be reset
   bhv->checkForDurationReset();
@@ -454,8 +472,16 @@ IvPFunction* BehaviorSet::produceOF(unsigned int ix,
     if(old_activity_state == "idle")
       bhv->onIdleToRunState();
 
-    // Step 1: Ask the behavior to build a IvP function
+    // Step 1: Ask the behavior to build a IvP function, noting
+    // whether it was taken from the behavior's cache
+    unsigned int cache_hits   = bhv->getOFCacheHits();
+    unsigned int cache_misses = bhv->getOFCacheMisses();
     ipf = bhv->onRunState();
+    // Counters are shared when behaviors are produced concurrently
+    __sync_fetch_and_add(&m_ofcache_hits, 
+			 bhv->getOFCacheHits() - cache_hits);
+    __sync_fetch_and_add(&m_ofcache_misses, 
+			 bhv->getOFCacheMisses() - cache_misses);
     // Step 2: If IvP function contains NaN components, report and abort
     if(ipf && !ipf->freeOfNan()) {
       bhv->postEMessage("NaN detected in IvP Function");
@@ -478,8 +504,10 @@ IvPFunction* BehaviorSet::produceOF(unsigned int ix,
       string iter_str = uintToString(iteration);
       string ctxt_str = iter_str + ":" + desc_str;
       ipf->setContextStr(ctxt_str);
-      string ipf_str = IvPFunctionToString(ipf);
-      bhv->postMessage("BHV_IPF", ipf_str);
+      if(m_report_ipf_binary)
+	bhv->postBinaryMessage("BHV_IPF", IvPFunctionToBinary(ipf));
+      else
+	bhv->postMessage("BHV_IPF", IvPFunctionToString(ipf));
     }
     // Step 5: Handle normal case of healthy IvP function returned
     if(ipf) {
@@ -730,6 +758,22 @@ int BehaviorSet::getFilterLevel(unsigned int ix)
     return(0);
 }
 
+//------------------------------------------------------------
+// Procedure: parallelOK
+//      Note: Behaviors reporting true may have produceOF() invoked
+//            concurrently with other such behaviors. Both the type
+//            and the configuration must allow it.
+
+bool BehaviorSet::parallelOK(unsigned int ix)
+{
+  if(ix < m_bhv_entry.size()) {
+    IvPBehavior *bhv = m_bhv_entry[ix].getBehavior();
+    return(bhv->parallelOK() && bhv->parallelSafe());
+  }
+  else
+    return(false);
+}
+
 //------------------------------------------------------------
 // Procedure: filterBehaviorsPresent
 
@@ -64,10 +64,13 @@ public:
   void   setModeSet(ModeSet v)          {m_mode_set = v;}
 
   unsigned int getTCount()              {return(m_total_behaviors_ever);}
+  unsigned int getOFCacheHits() const   {return(m_ofcache_hits);}
+  unsigned int getOFCacheMisses() const {return(m_ofcache_misses);}
 
   unsigned int size()                   {return(m_bhv_entry.size());}
 
   void         setReportIPF(bool v)     {m_report_ipf=v;}
+  void         setReportIPFBinary(bool v) {m_report_ipf_binary=v;}
   bool         stateOK(unsigned int);
   void         resetStateOK();
   IvPFunction* produceOF(unsigned int ix, unsigned int iter, 
@@ -83,6 +86,7 @@ public:
   double         getStateElapsed(unsigned int);
   double         getStateTimeEntered(unsigned int);
   int            getFilterLevel(unsigned int);
+  bool           parallelOK(unsigned int);
   bool           filterBehaviorsPresent();
 
   std::vector<VarDataPair> getMessages(unsigned int bhv_ix, bool clear=true);
@@ -140,12 +144,16 @@ protected:
   std::vector<LifeEvent>        m_life_events;
 
   bool    m_report_ipf;
+  bool    m_report_ipf_binary;
   double  m_curr_time;
   bool    m_completed_pending;
 
   ModeSet m_mode_set;
 
   unsigned int m_total_behaviors_ever;
+
+  unsigned int m_ofcache_hits;
+  unsigned int m_ofcache_misses;
 };
 
 #endif 
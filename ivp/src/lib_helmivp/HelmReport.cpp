@@ -51,6 +51,24 @@ void HelmReport::initialize()
   m_max_create_time = 0;
   m_max_solve_time  = 0;
   m_max_loop_time   = 0;
+  m_ofcache_hits    = 0;
+  m_ofcache_misses  = 0;
+
+  for(int i=0; i<TXT_COUNT; i++)
+    clearText(i);
+}
+
+//-----------------------------------------------------------
+// Procedure: clearText()
+//   Purpose: Note that a serialized part of the report must be
+//            made anew since the part has changed.
+
+void HelmReport::clearText(int ix)
+{
+  if((ix < 0) || (ix >= TXT_COUNT))
+    return;
+  m_text[ix] = "";
+  m_text_ok[ix] = false;
 }
 
 //-----------------------------------------------------------
@@ -79,6 +97,7 @@ void HelmReport::clear(bool clear_completed)
   m_bhvs_active_upds.clear();
   m_bhvs_active_pwt.clear();
   m_bhvs_active_cpu.clear();
+  m_bhvs_active_wall.clear();
   m_bhvs_active_pcs.clear();
   m_bhvs_active_ipfs.clear();
   
@@ -89,12 +108,94 @@ void HelmReport::clear(bool clear_completed)
   m_domain = IvPDomain();
 }
 
+//-----------------------------------------------------------
+// Procedure: addMsg()
+
+void HelmReport::addMsg(const string& str)
+{
+  HelmReportMsg msg;
+  msg.text     = str;
+  msg.bhv_msg  = false;
+  msg.produced = false;
+  msg.cpu_time = 0;
+  msg.pcs      = 0;
+  msg.pwt      = 0;
+  m_messages.push_back(msg);
+}
+
+//-----------------------------------------------------------
+// Procedure: addBhvMsg()
+//   Purpose: Note that a behavior produced a function, but leave
+//            the message text to be made only if asked for.
+
+void HelmReport::addBhvMsg(const string& descriptor, double cpu_time,
+			   double pcs, double pwt)
+{
+  HelmReportMsg msg;
+  msg.text     = descriptor;
+  msg.bhv_msg  = true;
+  msg.produced = true;
+  msg.cpu_time = cpu_time;
+  msg.pcs      = pcs;
+  msg.pwt      = pwt;
+  m_messages.push_back(msg);
+}
+
+//-----------------------------------------------------------
+// Procedure: addBhvMsg()
+//   Purpose: Note that a behavior produced no function.
+
+void HelmReport::addBhvMsg(const string& descriptor)
+{
+  HelmReportMsg msg;
+  msg.text     = descriptor;
+  msg.bhv_msg  = true;
+  msg.produced = false;
+  msg.cpu_time = 0;
+  msg.pcs      = 0;
+  msg.pwt      = 0;
+  m_messages.push_back(msg);
+}
+
+//-----------------------------------------------------------
+// Procedure: getMsgs()
+
+vector<string> HelmReport::getMsgs() const
+{
+  vector<string> rvector;
+  for(unsigned int i=0; i<m_messages.size(); i++) {
+    const HelmReportMsg& msg = m_messages[i];
+    string line = msg.text;
+    if(msg.bhv_msg && msg.produced) {
+      line += " produces obj-function - time:";
+      line += doubleToString(msg.cpu_time,2);
+      line += " pcs: " + doubleToString(msg.pcs);
+      line += " pwt: " + doubleToString(msg.pwt);
+    }
+    else if(msg.bhv_msg)
+      line += " did NOT produce an obj-function";
+    rvector.push_back(line);
+  }
+  return(rvector);
+}
+
+//-----------------------------------------------------------
+// Procedure: setIvPDomain()
+
+void HelmReport::setIvPDomain(const IvPDomain& dom)
+{
+  m_domain = dom;
+  clearText(TXT_DECISIONS);
+  clearText(TXT_DOMAIN);
+}
+
 //-----------------------------------------------------------
 // Procedure: addDecision()
 
 void HelmReport::addDecision(const string& var, double val) 
 {
   m_decisions[var] = val;
+  clearText(TXT_DECISIONS);
 }
 
 
@@ -104,6 +205,7 @@ void HelmReport::addDecision(const string& var, double val)
 void HelmReport::clearDecisions()
 {
   m_decisions.clear();
+  clearText(TXT_DECISIONS);
 }
 
 
@@ -138,24 +240,145 @@ bool HelmReport::changedBehaviors(const HelmReport& report) const
 {
   // Want to base changes on simple list of behaviors, not full reports
   // of behaviors which includes timestamps etc.
-  bool full=false;  
-  
-  if(getActiveBehaviors(full)  != report.getActiveBehaviors(full))
+  if(changedActiveBHVs(report))
     return(true);
-  if(getRunningBehaviors(full) != report.getRunningBehaviors(full))
+  if(changedRunningBHVs(report))
     return(true);
-  if(getIdleBehaviors(full)    != report.getIdleBehaviors(full))
+  if(changedIdleBHVs(report))
     return(true);
-  if(getCompletedBehaviors(full) != report.getCompletedBehaviors(full))
+  if(changedCompletedBHVs(report))
     return(true);
   return(false);
 }
 
+//-----------------------------------------------------------
+// Procedure: changedActiveBHVs
+//   Returns: true if getActiveBehaviors(false) differs between this
+//            and the given report. The lists are only made if the
+//            behavior names differ.
+
+bool HelmReport::changedActiveBHVs(const HelmReport& report) const
+{
+  if(sameActiveBHVs(report, false))
+    return(false);
+  return(getActiveBehaviors(false) != report.getActiveBehaviors(false));
+}
+
+//-----------------------------------------------------------
+// Procedure: changedRunningBHVs
+
+bool HelmReport::changedRunningBHVs(const HelmReport& report) const
+{
+  if(sameRunningBHVs(report, false))
+    return(false);
+  return(getRunningBehaviors(false) != report.getRunningBehaviors(false));
+}
+
+//-----------------------------------------------------------
+// Procedure: changedIdleBHVs
+
+bool HelmReport::changedIdleBHVs(const HelmReport& report) const
+{
+  if(sameIdleBHVs(report, false))
+    return(false);
+  return(getIdleBehaviors(false) != report.getIdleBehaviors(false));
+}
+
+//-----------------------------------------------------------
+// Procedure: changedCompletedBHVs
+
+bool HelmReport::changedCompletedBHVs(const HelmReport& report) const
+{
+  if(sameCompletedBHVs(report, false))
+    return(false);
+  string this_list = getCompletedBehaviors(false);
+  return(this_list != report.getCompletedBehaviors(false));
+}
+
+//-----------------------------------------------------------
+// Procedure: sameActiveBHVs
+//   Returns: true if the fields serialized by getActiveBehaviors()
+//            are identical, hence the strings must be too. If false
+//            the strings may still match, e.g., cpu times equal to
+//            the precision serialized.
+
+bool HelmReport::sameActiveBHVs(const HelmReport& report, bool full) const
+{
+  if(m_bhvs_active_desc != report.m_bhvs_active_desc)
+    return(false);
+  if(!full)
+    return(true);
+
+  return((m_bhvs_active_time == report.m_bhvs_active_time) &&
+	 (m_bhvs_active_pwt  == report.m_bhvs_active_pwt)  &&
+	 (m_bhvs_active_pcs  == report.m_bhvs_active_pcs)  &&
+	 (m_bhvs_active_cpu  == report.m_bhvs_active_cpu)  &&
+	 (m_bhvs_active_upds == report.m_bhvs_active_upds) &&
+	 (m_bhvs_active_ipfs == report.m_bhvs_active_ipfs) &&
+	 (m_bhvs_active_wall == report.m_bhvs_active_wall));
+}
+
+//-----------------------------------------------------------
+// Procedure: sameRunningBHVs
+
+bool HelmReport::sameRunningBHVs(const HelmReport& report, bool full) const
+{
+  if(m_bhvs_running_desc != report.m_bhvs_running_desc)
+    return(false);
+  if(!full)
+    return(true);
+
+  return((m_bhvs_running_time == report.m_bhvs_running_time) &&
+	 (m_bhvs_running_upds == report.m_bhvs_running_upds));
+}
+
+//-----------------------------------------------------------
+// Procedure: sameIdleBHVs
+
+bool HelmReport::sameIdleBHVs(const HelmReport& report, bool full) const
+{
+  if(m_bhvs_idle_desc != report.m_bhvs_idle_desc)
+    return(false);
+  if(!full)
+    return(true);
+
+  return((m_bhvs_idle_time == report.m_bhvs_idle_time) &&
+	 (m_bhvs_idle_upds == report.m_bhvs_idle_upds));
+}
+
+//-----------------------------------------------------------
+// Procedure: sameCompletedBHVs
+
+bool HelmReport::sameCompletedBHVs(const HelmReport& report, bool full) const
+{
+  if(m_bhvs_completed_desc != report.m_bhvs_completed_desc)
+    return(false);
+  if(!full)
+    return(true);
+
+  return((m_bhvs_completed_time == report.m_bhvs_completed_time) &&
+	 (m_bhvs_completed_upds == report.m_bhvs_completed_upds));
+}
+
+//-----------------------------------------------------------
+// Procedure: sameDecisions
+//   Returns: true if getDecisionSummary() must be the same for both
+//            reports, without making either summary.
+
+bool HelmReport::sameDecisions(const HelmReport& report) const
+{
+  return((m_domain == report.m_domain) && 
+	 (m_decisions == report.m_decisions));
+}
+
 //-----------------------------------------------------------
 // Procedure: getDecisionSummary()
 
 string HelmReport::getDecisionSummary() const
 {
+  if(m_text_ok[TXT_DECISIONS])
+    return(m_text[TXT_DECISIONS]);
+
   string summary;
 
   unsigned int i, domain_size = m_domain.size();
@@ -170,6 +393,9 @@ string HelmReport::getDecisionSummary() const
     else
       summary += doubleToStringX(p->second);
   }
+
+  m_text[TXT_DECISIONS]    = summary;
+  m_text_ok[TXT_DECISIONS] = true;
   return(summary);
 }
 
@@ -180,7 +406,7 @@ string HelmReport::getDecisionSummary() const
 void HelmReport::addActiveBHV(const string& descriptor, double time, 
 			      double pwt, int pcs, double cpu_time, 
 			      const string& update_summary, 
-			      unsigned int ipfs)
+			      unsigned int ipfs, double wall_time)
 {
   m_bhvs_active_desc.push_back(descriptor);
   m_bhvs_active_time.push_back(time);
@@ -189,6 +415,10 @@ void HelmReport::addActiveBHV(const string& descriptor, double time,
   m_bhvs_active_pcs.push_back(pcs);
   m_bhvs_active_cpu.push_back(cpu_time);
   m_bhvs_active_ipfs.push_back(ipfs);
+  m_bhvs_active_wall.push_back(wall_time);
+
+  clearText(TXT_ACTIVE);
+  clearText(TXT_ACTIVE_LIST);
 }
   
 //-----------------------------------------------------------
@@ -196,6 +426,10 @@ void HelmReport::addActiveBHV(const string& descriptor, double time,
 
 string HelmReport::getActiveBehaviors(bool full_report) const
 {
+  int ix = full_report ? TXT_ACTIVE : TXT_ACTIVE_LIST;
+  if(m_text_ok[ix])
+    return(m_text[ix]);
+
   string return_str;
   unsigned int i, vsize = m_bhvs_active_desc.size();
   for(i=0; i<vsize; i++) {
@@ -209,6 +443,7 @@ string HelmReport::getActiveBehaviors(bool full_report) const
       return_str += "$" + doubleToString(m_bhvs_active_cpu[i]);
       return_str += "$" + m_bhvs_active_upds[i];
       return_str += "$" + uintToString(m_bhvs_active_ipfs[i]);
+      return_str += "$" + doubleToString(m_bhvs_active_wall[i]);
     }
     else {
       if(i>0)
@@ -219,6 +454,9 @@ string HelmReport::getActiveBehaviors(bool full_report) const
 
   if(return_str == "none")
     return_str = "";
+
+  m_text[ix]    = return_str;
+  m_text_ok[ix] = true;
   return(return_str);
 }
 
@@ -232,8 +470,12 @@ void HelmReport::clearActiveBHVs()
   m_bhvs_active_upds.clear();
   m_bhvs_active_pwt.clear();
   m_bhvs_active_cpu.clear();
+  m_bhvs_active_wall.clear();
   m_bhvs_active_pcs.clear();
   m_bhvs_active_ipfs.clear();
+
+  clearText(TXT_ACTIVE);
+  clearText(TXT_ACTIVE_LIST);
 }
 
 //-----------------------------------------------------------
@@ -245,6 +487,9 @@ void HelmReport::addRunningBHV(const string& descriptor, double time,
   m_bhvs_running_desc.push_back(descriptor);
   m_bhvs_running_time.push_back(time);
   m_bhvs_running_upds.push_back(update_summary);
+
+  clearText(TXT_RUNNING);
+  clearText(TXT_RUNNING_LIST);
 }
 
 //-----------------------------------------------------------
@@ -253,6 +498,10 @@ void HelmReport::addRunningBHV(const string& descriptor, double time,
 
 string HelmReport::getRunningBehaviors(bool full_report) const
 {
+  int ix = full_report ? TXT_RUNNING : TXT_RUNNING_LIST;
+  if(m_text_ok[ix])
+    return(m_text[ix]);
+
   string return_str;
   unsigned int i, vsize = m_bhvs_running_desc.size();
   for(i=0; i<vsize; i++) {
@@ -271,6 +520,9 @@ string HelmReport::getRunningBehaviors(bool full_report) const
   }
   if(return_str == "none")
     return_str = "";
+
+  m_text[ix]    = return_str;
+  m_text_ok[ix] = true;
   return(return_str);
 }
 
@@ -282,6 +534,9 @@ void HelmReport::clearRunningBHVs()
   m_bhvs_running_desc.clear();
   m_bhvs_running_time.clear();
   m_bhvs_running_upds.clear();
+
+  clearText(TXT_RUNNING);
+  clearText(TXT_RUNNING_LIST);
 }
 
 
@@ -295,6 +550,9 @@ void HelmReport::addIdleBHV(const string& descriptor, double time,
   m_bhvs_idle_desc.push_back(descriptor);
   m_bhvs_idle_time.push_back(time);
   m_bhvs_idle_upds.push_back(update_summary);
+
+  clearText(TXT_IDLE);
+  clearText(TXT_IDLE_LIST);
 }
 
 //-----------------------------------------------------------
@@ -303,6 +561,10 @@ void HelmReport::addIdleBHV(const string& descriptor, double time,
 
 string HelmReport::getIdleBehaviors(bool full_report) const
 {
+  int ix = full_report ? TXT_IDLE : TXT_IDLE_LIST;
+  if(m_text_ok[ix])
+    return(m_text[ix]);
+
   string return_str;
   unsigned int i, vsize = m_bhvs_idle_desc.size();
   for(i=0; i<vsize; i++) {
@@ -321,6 +583,9 @@ string HelmReport::getIdleBehaviors(bool full_report) const
   }
   if(return_str == "none")
     return_str = "";
+
+  m_text[ix]    = return_str;
+  m_text_ok[ix] = true;
   return(return_str);
 }
 
@@ -332,6 +597,9 @@ void HelmReport::clearIdleBHVs()
   m_bhvs_idle_desc.clear();
   m_bhvs_idle_time.clear();
   m_bhvs_idle_upds.clear();
+
+  clearText(TXT_IDLE);
+  clearText(TXT_IDLE_LIST);
 }
 
 //-----------------------------------------------------------
@@ -353,6 +621,9 @@ void HelmReport::addCompletedBHV(const string& descriptor, double time,
     m_bhvs_completed_time.pop_front();
     m_bhvs_completed_upds.pop_front();
   }
+
+  clearText(TXT_COMPLETED);
+  clearText(TXT_COMPLETED_LIST);
 }
 
 //-----------------------------------------------------------
@@ -361,6 +632,10 @@ void HelmReport::addCompletedBHV(const string& descriptor, double time,
 
 string HelmReport::getCompletedBehaviors(bool full_report) const
 {
+  int ix = full_report ? TXT_COMPLETED : TXT_COMPLETED_LIST;
+  if(m_text_ok[ix])
+    return(m_text[ix]);
+
   string return_str;
 
   unsigned int i, vsize = m_bhvs_completed_desc.size();
@@ -380,6 +655,9 @@ string HelmReport::getCompletedBehaviors(bool full_report) const
   }
   if(return_str == "none")
     return_str = "";
+
+  m_text[ix]    = return_str;
+  m_text_ok[ix] = true;
   return(return_str);
 }
 
@@ -392,6 +670,9 @@ void HelmReport::clearCompletedBHVs()
   m_bhvs_completed_desc.clear();
   m_bhvs_completed_time.clear();
   m_bhvs_completed_upds.clear();
+
+  clearText(TXT_COMPLETED);
+  clearText(TXT_COMPLETED_LIST);
 }
 
 
@@ -401,7 +682,11 @@ void HelmReport::clearCompletedBHVs()
 
 string HelmReport::getDomainString() const
 {
-  return(domainToString(m_domain));
+  if(!m_text_ok[TXT_DOMAIN]) {
+    m_text[TXT_DOMAIN]    = domainToString(m_domain);
+    m_text_ok[TXT_DOMAIN] = true;
+  }
+  return(m_text[TXT_DOMAIN]);
 
 #if 0
   string return_string;
@@ -432,6 +717,10 @@ string HelmReport::getReportAsString() const
 
 //-----------------------------------------------------------
 // Procedure: getReportAsString(const HelmReport&)
+//      Note: A part is serialized only if it may differ from that of
+//            the prior report. Both serializations are then compared
+//            as before, most often with the prior one already made
+//            on the previous iteration.
 
 string HelmReport::getReportAsString(const HelmReport& prep, bool full) const
 {
@@ -454,13 +743,20 @@ string HelmReport::getReportAsString(const HelmReport& prep, bool full) const
   if(full || (m_max_loop_time != prep.getMaxLoopTime()))
     report += (",max_loop_time=" + doubleToString(m_max_loop_time, 2));
 
+  if(full || (m_ofcache_hits != prep.getOFCacheHits()))
+    report += (",ofcache_hits=" + uintToString(m_ofcache_hits));
+  if(full || (m_ofcache_misses != prep.getOFCacheMisses()))
+    report += (",ofcache_misses=" + uintToString(m_ofcache_misses));
+
   double loop_time = m_create_time + m_solve_time;
   if(full || (loop_time != prep.getLoopTime()))
     report += (",loop_time=" + doubleToString(loop_time, 2));
   
-  string decision_summary = getDecisionSummary();
-  if(full || (decision_summary != prep.getDecisionSummary()))
-    report += "," + decision_summary;
+  if(full || !sameDecisions(prep)) {
+    string decision_summary = getDecisionSummary();
+    if(full || (decision_summary != prep.getDecisionSummary()))
+      report += "," + decision_summary;
+  }
 
   if(full || (m_halted != prep.getHalted()))
     report += (",halted=" + boolToString(m_halted));
@@ -473,47 +769,57 @@ string HelmReport::getReportAsString(const HelmReport& prep, bool full) const
       report += m_modes;
   }
 
-  string running_bhvs = getRunningBehaviors();
-  if(full || (running_bhvs != prep.getRunningBehaviors())) {
-    report += ",running_bhvs=";
-    if(running_bhvs == "")
-      report += "none";
-    else
-      report += running_bhvs;
+  if(full || !sameRunningBHVs(prep, true)) {
+    string running_bhvs = getRunningBehaviors();
+    if(full || (running_bhvs != prep.getRunningBehaviors())) {
+      report += ",running_bhvs=";
+      if(running_bhvs == "")
+	report += "none";
+      else
+	report += running_bhvs;
+    }
   }
 
-  string active_bhvs = getActiveBehaviors();
-  if(full || (active_bhvs != prep.getActiveBehaviors())) {
-    report += ",active_bhvs=";
-    if(active_bhvs == "")
-      report += "none";
-    else
-      report += active_bhvs;
+  if(full || !sameActiveBHVs(prep, true)) {
+    string active_bhvs = getActiveBehaviors();
+    if(full || (active_bhvs != prep.getActiveBehaviors())) {
+      report += ",active_bhvs=";
+      if(active_bhvs == "")
+	report += "none";
+      else
+	report += active_bhvs;
+    }
   }
 
-  string idle_bhvs = getIdleBehaviors();
-  if(full || (idle_bhvs != prep.getIdleBehaviors())) {
-    report += ",idle_bhvs=";
-    if(idle_bhvs == "")
-      report += "none";
-    else
-      report += idle_bhvs;
+  if(full || !sameIdleBHVs(prep, true)) {
+    string idle_bhvs = getIdleBehaviors();
+    if(full || (idle_bhvs != prep.getIdleBehaviors())) {
+      report += ",idle_bhvs=";
+      if(idle_bhvs == "")
+	report += "none";
+      else
+	report += idle_bhvs;
+    }
   }
 
-  string completed_bhvs = getCompletedBehaviors();
-  if(full || (completed_bhvs != prep.getCompletedBehaviors())) {
-    report += ",completed_bhvs=";
-    if(completed_bhvs == "") {
-      if(prep.getCompletedBehaviors() == "")
-	report += "none";
+  if(full || !sameCompletedBHVs(prep, true)) {
+    string completed_bhvs = getCompletedBehaviors();
+    if(full || (completed_bhvs != prep.getCompletedBehaviors())) {
+      report += ",completed_bhvs=";
+      if(completed_bhvs == "") {
+	if(prep.getCompletedBehaviors() == "")
+	  report += "none";
+      }
+      else
+	report += completed_bhvs;
     }
-    else
-      report += completed_bhvs;
   }
 
-  string domain_str = domainToString(m_domain);
-  if(full || (domain_str != prep.getDomainString()))
-    report += ",ivpdomain=\"" + domain_str + "\"";
+  if(full || !(m_domain == prep.m_domain)) {
+    string domain_str = getDomainString();
+    if(full || (domain_str != prep.getDomainString()))
+      report += ",ivpdomain=\"" + domain_str + "\"";
+  }
 
   if(full || (m_halt_message != prep.getHaltMsg())) {
     report += ",halt_msg=";
@@ -541,6 +847,8 @@ void HelmReport::print() const
   cout << "warning_count:" << m_warning_count << endl;
   cout << "iteration:" << m_iteration << endl;
   cout << "ofnum:" << m_ofnum << endl;
+  cout << "ofcache_hits:" << m_ofcache_hits << endl;
+  cout << "ofcache_misses:" << m_ofcache_misses << endl;
   cout << "halted:" << boolToString(m_halted) << endl;
 }
 
@@ -555,12 +863,14 @@ void HelmReport::print() const
 //    SolveTime:      0.00    (max=0.00)
 //    CreateTime:     0.00    (max=0.00)
 //    LoopTime:       0.00    (max=0.00)
+//    IPF Cache:      12 hits  (3 misses)
 //    Halted:         false   (0 warnings: 0 total)
 //  Helm Decision: [speed,0,5,26] [course,0,359,360] 
 //    course = 195
 //    speed  = 1.2
 //  Behaviors Active: ---------- (1)
-//    loiter [0.25] (pwt=100.00000) (pcs=9) (cpu=0.00000) (upd=0/0)
+//    loiter [0.25] (pwt=100.00000) (pcs=9) (cpu=0.00000) (wall=0.00012)
+//      (upd=0/0)
 //  Behaviors Running: --------- (0)
 //  Behaviors Idle: ------------ (2)
 //    waypt_return, station-keep
@@ -588,6 +898,10 @@ list<string> HelmReport::formattedSummary(double curr_time, bool verbose) const
   str += "   (max=" + doubleToString(m_max_loop_time,2) + ")";
   rlist.push_back(str);
 
+  str =  "  IPF Cache:      " + uintToString(m_ofcache_hits) + " hits";
+  str += "   (" + uintToString(m_ofcache_misses) + " misses)";
+  rlist.push_back(str);
+
   str = "  Halted:         " + boolToString(m_halted);
   str += "   (" + uintToString(m_warning_count) + " warnings)";
   rlist.push_back(str);
@@ -621,6 +935,7 @@ list<string> HelmReport::formattedSummary(double curr_time, bool verbose) const
     str += " (pwt=" + doubleToStringX(m_bhvs_active_pwt[i]) + ")";
     str += " (pcs=" + intToString(m_bhvs_active_pcs[i]) + ")";
     str += " (cpu=" + doubleToStringX(m_bhvs_active_cpu[i]) + ")";
+    str += " (wall=" + doubleToStringX(m_bhvs_active_wall[i]) + ")";
     str += " (upd=" + m_bhvs_active_upds[i] + ")";
     rlist.push_back(str);
   }
@@ -31,6 +31,19 @@
 #include <string>
 #include "IvPDomain.h"
 
+// A message of the report. For a report of the function made by a
+// behavior, only the numbers are kept. The text is made only if the
+// messages are asked for.
+struct HelmReportMsg
+{
+  std::string text;
+  bool        bhv_msg;
+  bool        produced;
+  double      cpu_time;
+  double      pcs;
+  double      pwt;
+};
+
 class HelmReport {
 public:
   HelmReport();
@@ -38,14 +51,17 @@ public:
 
   void  initialize();
   void  clear(bool clear_completed=false);
-  void  addMsg(const std::string& str)     {m_messages.push_back(str);}
+  void  addMsg(const std::string& str);
+  void  addBhvMsg(const std::string& descriptor, double cpu_time,
+		  double pcs, double pwt);
+  void  addBhvMsg(const std::string& descriptor);
   void  setHaltMsg(const std::string& str) {m_halt_message = str;}
   
   void  clearActiveBHVs();
   void  addActiveBHV(const std::string& descriptor, double time,
 		     double pwt, int pcs, double cpu,
 		     const std::string& update_summary, 
-		     unsigned int ipfs);
+		     unsigned int ipfs, double wall=0);
 
   void  clearRunningBHVs();
   void  addRunningBHV(const std::string& descriptor, double time,
@@ -60,7 +76,7 @@ public:
 			const std::string& update_summary);
 
   void  setModeSummary(const std::string& s) {m_modes=s;}
-  void  setIvPDomain(const IvPDomain &dom)   {m_domain = dom;}
+  void  setIvPDomain(const IvPDomain &dom);
   void  setTimeUTC(double v)                 {m_time_utc = v;}
   void  setWarningCount(unsigned int v)      {m_warning_count = v;}
   void  setHalted(bool v)                    {m_halted=v;}
@@ -71,6 +87,8 @@ public:
   void  setMaxLoopTime(double t)             {m_max_loop_time=t;}
   void  setMaxCreateTime(double t)           {m_max_create_time=t;}
   void  setMaxSolveTime(double t)            {m_max_solve_time=t;}
+  void  setOFCacheHits(unsigned int v)       {m_ofcache_hits=v;}
+  void  setOFCacheMisses(unsigned int v)     {m_ofcache_misses=v;}
 
   void  clearDecisions();
   void  addDecision(const std::string &var, double val);
@@ -87,15 +105,21 @@ public:
   double       getMaxLoopTime() const {return(m_max_loop_time);}
   double       getMaxSolveTime()  const {return(m_max_solve_time);}
   double       getMaxCreateTime() const {return(m_max_create_time);}
+  unsigned int getOFCacheHits()   const {return(m_ofcache_hits);}
+  unsigned int getOFCacheMisses() const {return(m_ofcache_misses);}
 
   double       getDecision(const std::string&) const;
   bool         hasDecision(const std::string&) const;
 
   bool         changedBehaviors(const HelmReport&) const;
+  bool         changedActiveBHVs(const HelmReport&) const;
+  bool         changedRunningBHVs(const HelmReport&) const;
+  bool         changedIdleBHVs(const HelmReport&) const;
+  bool         changedCompletedBHVs(const HelmReport&) const;
 
   std::string  getModeSummary()      const {return(m_modes);}
   std::string  getHaltMsg()          const {return(m_halt_message);}
-  std::vector<std::string> getMsgs() const {return(m_messages);}
+  std::vector<std::string> getMsgs() const;
 
   // Serialization Helper Methods
   std::string  getDecisionSummary()    const;
@@ -116,6 +140,14 @@ public:
   // Debugging
   void print() const;
 
+protected:
+  bool  sameActiveBHVs(const HelmReport&, bool full) const;
+  bool  sameRunningBHVs(const HelmReport&, bool full) const;
+  bool  sameIdleBHVs(const HelmReport&, bool full) const;
+  bool  sameCompletedBHVs(const HelmReport&, bool full) const;
+  bool  sameDecisions(const HelmReport&) const;
+  void  clearText(int ix);
+
 protected:
 
   std::vector<std::string>  m_bhvs_running_desc;   // Running Behaviors
@@ -135,11 +167,12 @@ protected:
   std::vector<std::string>  m_bhvs_active_upds;
   std::vector<double>       m_bhvs_active_pwt;
   std::vector<double>       m_bhvs_active_cpu;
+  std::vector<double>       m_bhvs_active_wall;
   std::vector<int>          m_bhvs_active_pcs;
   std::vector<unsigned int> m_bhvs_active_ipfs;
 
 
-  std::vector<std::string>      m_messages;
+  std::vector<HelmReportMsg>    m_messages;
   std::map<std::string, double> m_decisions;  // +
 
   std::string   m_halt_message;    // +
@@ -157,7 +190,20 @@ protected:
   double        m_max_solve_time;
   double        m_max_loop_time;
 
+  unsigned int  m_ofcache_hits;    // Cumulative behavior IPF cache hits
+  unsigned int  m_ofcache_misses;
+
   IvPDomain     m_domain;          // referenced for varbalk info
+
+  // The serialized parts of the report, made only when first asked
+  // for, and kept until the part is changed. Kept also in a copy, so
+  // a report compared against on the next iteration is not redone.
+  enum {TXT_ACTIVE, TXT_ACTIVE_LIST, TXT_RUNNING, TXT_RUNNING_LIST,
+	TXT_IDLE, TXT_IDLE_LIST, TXT_COMPLETED, TXT_COMPLETED_LIST, 
+	TXT_DECISIONS, TXT_DOMAIN, TXT_COUNT};
+
+  mutable std::string m_text[TXT_COUNT];
+  mutable bool        m_text_ok[TXT_COUNT];
 };
 
 #endif
@@ -53,11 +53,11 @@ HelmReport string2HelmReport(const string& str)
 //            modes=MODE@ACTIVE:LOITERING
 //            halt_msg=
 // 
-//            active_bhvs=waypt_survey$1343667403.10$100.00000$6$0.00000$n/a$1,
+//            active_bhvs=waypt_survey$1343667403.10$100.00000$6$0.00000$n/a$1$0.00012,
 //            idle_bhvs=waypt_return$0.00$n/a
 // 
 //  Example = iter=1,utc_time=1343667403.10,ofnum=1,var=speed:2,var=course:124,
-//            active_bhvs=waypt_survey$1343667403.10$100.00000$6$0.00000$n/a$1,
+//            active_bhvs=waypt_survey$1343667403.10$100.00000$6$0.00000$n/a$1$0.00012,
 //            idle_bhvs=waypt_return$0.00$n/a
 
 HelmReport string2HelmReport(const string& str, 
@@ -89,6 +89,10 @@ HelmReport string2HelmReport(const string& str,
       report.setMaxSolveTime(atof(right.c_str()));
     else if(left == "max_loop_time")
       report.setMaxLoopTime(atof(right.c_str()));
+    else if(left == "ofcache_hits")
+      report.setOFCacheHits(atoi(right.c_str()));
+    else if(left == "ofcache_misses")
+      report.setOFCacheMisses(atoi(right.c_str()));
 
     else if(left == "utc_time")
       report.setTimeUTC(atof(right.c_str()));
@@ -121,14 +125,17 @@ HelmReport string2HelmReport(const string& str,
 	string pcs  = biteStringX(bhv, '$');
 	string cpu  = biteStringX(bhv, '$');
 	string upds = biteStringX(bhv, '$');
-	string ipfs = bhv;
+	string ipfs = biteStringX(bhv, '$');
+	string wall = bhv;
 	
 	double d_time = atof(time.c_str());
 	double d_pwt  = atof(pwt.c_str());
 	int    i_pcs  = atoi(pcs.c_str());
 	double d_cpu  = atof(cpu.c_str());
 	unsigned int u_ipfs = (unsigned int)(atoi(ipfs.c_str()));      
-	report.addActiveBHV(descriptor, d_time, d_pwt, i_pcs, d_cpu, upds, u_ipfs);
+	double d_wall = atof(wall.c_str());
+	report.addActiveBHV(descriptor, d_time, d_pwt, i_pcs, d_cpu, upds, 
+			    u_ipfs, d_wall);
       }
     }
     
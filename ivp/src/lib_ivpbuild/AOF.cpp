@@ -49,4 +49,44 @@ double AOF::extract(const string& varname, const vector<double>& point) const
   return(point[index]);
 }
 
+//----------------------------------------------------------------
+// Procedure: evalPtBatch()
+
+void AOF::evalPtBatch(const int *pts, unsigned int count, 
+		      double *vals) const
+{
+  unsigned int d, dim = m_domain.size();
+
+  IvPBox ptbox(dim);
+  vector<double> point(dim, 0);
+  for(unsigned int k=0; k<count; k++) {
+    for(d=0; d<dim; d++) {
+      int ix = pts[(d*count)+k];
+      ptbox.setPTS(d, ix, ix);
+      point[d] = m_domain.getVal(d, ix);
+    }
+    vals[k] = evalPoint(point);
+    if(vals[k] == 0)
+      vals[k] = evalBox(&ptbox);
+  }
+}
 
+//----------------------------------------------------------------
+// Procedure: getBatchVals()
+//   Purpose: Convert the domain indices of one dimension of a batch
+//            of points (see evalPtBatch) to their native values. An
+//            unknown dimension yields all zeros, as does extract().
+
+void AOF::getBatchVals(const int *pts, unsigned int count, int dim_ix,
+		       vector<double>& vals) const
+{
+  vals.assign(count, 0);
+  if((dim_ix < 0) || ((unsigned int)(dim_ix) >= m_domain.size()))
+    return;
+  
+  double low   = m_domain.getVarLow(dim_ix);
+  double delta = m_domain.getVarDelta(dim_ix);
+  const int *dpts = pts + (dim_ix * count);
+  for(unsigned int k=0; k<count; k++)
+    vals[k] = low + (delta * dpts[k]);
+}
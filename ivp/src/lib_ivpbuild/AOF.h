@@ -46,6 +46,14 @@ public:
   {return(0);}
 
   virtual double evalPoint(const std::vector<double>&) const {return(0);}
+
+  // Evaluate a batch of point boxes in one call. The points are
+  // given as domain indices in dimension-major order: the index of
+  // point k in dimension d is pts[(d*count)+k]. The default tries
+  // evalPoint() and then evalBox() on each point, as the Regressor
+  // always has. Subclasses may override with a tighter loop.
+  virtual void evalPtBatch(const int *pts, unsigned int count, 
+			   double *vals) const;
   virtual bool  initialize() {return(true);}
   virtual bool  setParam(const std::string&, double) {return(false);}
   virtual bool  setParam(const std::string&, const std::string&) 
@@ -70,6 +78,10 @@ public:
 
   int  getDim() const   {return(m_domain.size());}
 
+protected:
+  void getBatchVals(const int *pts, unsigned int count, int dim_ix,
+		    std::vector<double>& vals) const;
+
 protected:
   IvPDomain m_domain;
 };
@@ -86,6 +86,21 @@ double AOF_Gaussian::evalPoint(const vector<double>& point) const
 }
 #endif
 
+//----------------------------------------------------------------
+// Procedure: evalPtBatch
 
-
+void AOF_Gaussian::evalPtBatch(const int *pts, unsigned int count,
+			       double *vals) const
+{
+  vector<double> xvals, yvals;
+  getBatchVals(pts, count, m_domain.getIndex("x"), xvals);
+  getBatchVals(pts, count, m_domain.getIndex("y"), yvals);
+
+  double denom = 2 * (m_sigma * m_sigma);
+  for(unsigned int k=0; k<count; k++) {
+    double dist = hypot((xvals[k] - m_xcent), (yvals[k] - m_ycent));
+    double pct  = pow(M_E, -((dist*dist)/denom));
+    vals[k] = pct * m_range;
+  }
+}
 
@@ -38,6 +38,7 @@ class AOF_Gaussian: public AOF {
   
  public:
   double evalPoint(const std::vector<double>& point) const;
+  void   evalPtBatch(const int*, unsigned int, double*) const;
   bool   setParam(const std::string&, double);
 
 private:
@@ -54,7 +54,17 @@ double AOF_Linear::evalBox(const IvPBox *ptbox) const
   return((m_coeff * x_val) + (n_coeff * y_val) + b_scalar);
 }
 
+//----------------------------------------------------------------
+// Procedure: evalPtBatch
 
+void AOF_Linear::evalPtBatch(const int *pts, unsigned int count,
+			     double *vals) const
+{
+  vector<double> x_vals, y_vals;
+  getBatchVals(pts, count, m_domain.getIndex("x"), x_vals);
+  getBatchVals(pts, count, m_domain.getIndex("y"), y_vals);
 
-
+  for(unsigned int k=0; k<count; k++)
+    vals[k] = (m_coeff * x_vals[k]) + (n_coeff * y_vals[k]) + b_scalar;
+}
 
@@ -36,6 +36,7 @@ class AOF_Linear: public AOF {
 
 public:    
   double evalBox(const IvPBox*) const;
+  void   evalPtBatch(const int*, unsigned int, double*) const;
   bool   setParam(const std::string& param, double val); 
   
 private:
@@ -145,6 +145,25 @@ bool Demuxer::addMuxPacket(const string& str, double time_stamp,
 }
 
 
+//-------------------------------------------------------------
+// Procedure: addDemuxedString()
+//   Purpose: Accept a string that arrived whole, e.g., a binary IvP
+//            function posted without muxing. It goes straight onto
+//            the list of results, in arrival order with any strings
+//            completed by demuxUnits().
+
+bool Demuxer::addDemuxedString(const string& str, double time_stamp,
+			       const string& src)
+{
+  if(str == "")
+    return(false);
+
+  demuxUnits();
+  DemuxedResult result(str, src, time_stamp);
+  m_demuxed_results.push_back(result);
+  return(true);
+}
+
 //-------------------------------------------------------------
 // Procedure: demuxUnits()
 //   Purpose: Iterate through the DemuxUnits and check if the Unit
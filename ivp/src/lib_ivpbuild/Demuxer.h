@@ -41,6 +41,10 @@ public:
 		    double timestamp, 
 		    const std::string& source="");
 
+  bool addDemuxedString(const std::string& str,
+			double timestamp,
+			const std::string& source="");
+
   std::string   getDemuxString();
   DemuxedResult getDemuxedResult();
 
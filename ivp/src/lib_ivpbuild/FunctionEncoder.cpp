@@ -25,6 +25,7 @@
 
 #include <iostream>
 #include <cstdio>
+#include <cstring>
 #include "MBUtils.h"
 #include "BuildUtils.h"
 #include "FunctionEncoder.h"
@@ -32,6 +33,93 @@
 
 using namespace std;
 
+//--------------------------------------------------------------
+// Binary IPF format (version 1), all multi-byte fields little-endian
+//
+//   "IPFB",version,cstr_len,cstr,dim,pcs,deg,wtc,pwt(8 bytes),
+//   dom_len,domain,gel[0..dim-1],
+//   per box: bound flags (one byte per 4 dims), then for each dim
+//            the low bound as a zigzag delta from the prior box's
+//            low bound and the width (hgh-low), then wtc float32
+//            weights.
+//
+//   Unsigned integers are varints (7 bits per byte, high bit set
+//   when more bytes follow). Adjacent pieces in a PDMap are usually
+//   neighbours, so the low-bound deltas are typically one byte.
+
+static const unsigned int BIN_IPF_VERSION = 1;
+
+static void writeVarint(string& str, unsigned int val)
+{
+  while(val >= 0x80) {
+    str += (char)((val & 0x7F) | 0x80);
+    val >>= 7;
+  }
+  str += (char)val;
+}
+
+static bool readVarint(const string& str, unsigned int& ix, 
+		       unsigned int& val)
+{
+  val = 0;
+  unsigned int shift = 0;
+  while((ix < str.length()) && (shift < 35)) {
+    unsigned char c = (unsigned char)(str[ix]);
+    ix++;
+    val |= ((unsigned int)(c & 0x7F)) << shift;
+    if((c & 0x80) == 0)
+      return(true);
+    shift += 7;
+  }
+  return(false);
+}
+
+static unsigned int zigzag(int val)
+{
+  return((((unsigned int)val) << 1) ^ (unsigned int)(val >> 31));
+}
+
+static int unzigzag(unsigned int val)
+{
+  return((int)(val >> 1) ^ -((int)(val & 1)));
+}
+
+static void writeFloat(string& str, float fval)
+{
+  unsigned int bits;
+  memcpy(&bits, &fval, 4);
+  for(unsigned int i=0; i<4; i++)
+    str += (char)((bits >> (8*i)) & 0xFF);
+}
+
+static float readFloat(const string& str, unsigned int ix)
+{
+  unsigned int bits = 0;
+  for(unsigned int i=0; i<4; i++)
+    bits |= ((unsigned int)(unsigned char)(str[ix+i])) << (8*i);
+  float fval;
+  memcpy(&fval, &bits, 4);
+  return(fval);
+}
+
+static void writeDouble(string& str, double dval)
+{
+  unsigned long long bits;
+  memcpy(&bits, &dval, 8);
+  for(unsigned int i=0; i<8; i++)
+    str += (char)((bits >> (8*i)) & 0xFF);
+}
+
+static double readDouble(const string& str, unsigned int ix)
+{
+  unsigned long long bits = 0;
+  for(unsigned int i=0; i<8; i++)
+    bits |= ((unsigned long long)(unsigned char)(str[ix+i])) << (8*i);
+  double dval;
+  memcpy(&dval, &bits, 8);
+  return(dval);
+}
+
 //--------------------------------------------------------------
 // Procedure: IvPFunctionToString
 //      Note: cstr is short for context_string
@@ -295,6 +383,8 @@ IvPFunction *StringToIvPFunction(const string& str)
 {
   if(str == "")
     return(0);
+  if(isBinaryIPF(str))
+    return(BinaryToIvPFunction(str));
 
   int d, i;
 
@@ -502,6 +592,14 @@ IvPFunction *StringToIvPFunction(const string& str)
 
 string StringToIvPContext(const string& str)
 {
+  if(isBinaryIPF(str)) {
+    unsigned int ix = 5;
+    unsigned int cstr_len = 0;
+    if(!readVarint(str, ix, cstr_len) || ((ix + cstr_len) > str.length()))
+      return("");
+    return(str.substr(ix, cstr_len));
+  }
+
   int cix = 2; // To account for the H, in the header
 
   // Determine the length of the context string
@@ -535,6 +633,22 @@ string StringToIvPContext(const string& str)
 
 IvPDomain IPFStringToIvPDomain(const string& str)
 {
+  if(isBinaryIPF(str)) {
+    IvPDomain null_domain;
+    unsigned int ix = 5;
+    unsigned int cstr_len, dim, pcs, deg, wtc, dom_len;
+    if(!readVarint(str, ix, cstr_len))
+      return(null_domain);
+    ix += cstr_len;
+    if(!readVarint(str, ix, dim) || !readVarint(str, ix, pcs) ||
+       !readVarint(str, ix, deg) || !readVarint(str, ix, wtc))
+      return(null_domain);
+    ix += 8;
+    if(!readVarint(str, ix, dom_len) || ((ix + dom_len) > str.length()))
+      return(null_domain);
+    return(stringToDomain(str.substr(ix, dom_len)));
+  }
+
   int cix = 2; // To account for the H, in the header
 
   // Determine the length of the context string
@@ -563,6 +677,182 @@ IvPDomain IPFStringToIvPDomain(const string& str)
 }
 
 
+//--------------------------------------------------------------
+// Procedure: IvPFunctionToBinary
+//   Purpose: Same content as IvPFunctionToString but in the binary
+//            format described at the top of this file. Box bounds
+//            are exact. Weights are float32, which keeps more
+//            significant digits than the four decimal places of the
+//            text format for all but very large weights.
+
+string IvPFunctionToBinary(IvPFunction *ivp_function)
+{
+  PDMap *pdmap = ivp_function->getPDMap();
+  if(!pdmap || (pdmap->size() == 0))
+    return("");
+
+  unsigned int dim = (unsigned int)(ivp_function->getDim());
+  unsigned int pcs = (unsigned int)(pdmap->size());
+  unsigned int deg = (unsigned int)(pdmap->getDegree());
+  unsigned int wtc = (unsigned int)(pdmap->bx(0)->getWtc());
+  string cstr = ivp_function->getContextStr();
+  string domain_str = domainToString(pdmap->getDomain());
+
+  string str;
+  str.reserve(64 + cstr.length() + domain_str.length() + 
+	      (pcs * (((dim+3)/4) + (dim*3) + (wtc*4))));
+
+  str += "IPFB";
+  str += (char)BIN_IPF_VERSION;
+  writeVarint(str, cstr.length());
+  str += cstr;
+  writeVarint(str, dim);
+  writeVarint(str, pcs);
+  writeVarint(str, deg);
+  writeVarint(str, wtc);
+  writeDouble(str, ivp_function->getPWT());
+  writeVarint(str, domain_str.length());
+  str += domain_str;
+
+  IvPBox gelbox = pdmap->getGelBox();
+  for(unsigned int d=0; d<dim; d++)
+    writeVarint(str, (unsigned int)(gelbox.pt(d, 1)));
+
+  vector<int> prev_low(dim, 0);
+  for(unsigned int i=0; i<pcs; i++) {
+    IvPBox *ibox = pdmap->bx(i);
+
+    unsigned char flags = 0;
+    for(unsigned int d=0; d<dim; d++) {
+      unsigned int bit = (d % 4) * 2;
+      if(ibox->bd(d,0))
+	flags |= (unsigned char)(1 << bit);
+      if(ibox->bd(d,1))
+	flags |= (unsigned char)(1 << (bit+1));
+      if(((d % 4) == 3) || (d == (dim-1))) {
+	str += (char)flags;
+	flags = 0;
+      }
+    }
+
+    for(unsigned int d=0; d<dim; d++) {
+      int low = ibox->pt(d,0);
+      int hgh = ibox->pt(d,1);
+      writeVarint(str, zigzag(low - prev_low[d]));
+      writeVarint(str, (unsigned int)(hgh - low));
+      prev_low[d] = low;
+    }
+
+    for(unsigned int j=0; j<wtc; j++)
+      writeFloat(str, (float)(ibox->wt(j)));
+  }
+
+  return(str);
+}
+
+//--------------------------------------------------------------
+// Procedure: isBinaryIPF
+
+bool isBinaryIPF(const string& str)
+{
+  if(str.length() < 5)
+    return(false);
+  return((str[0]=='I') && (str[1]=='P') && (str[2]=='F') && 
+	 (str[3]=='B') && ((unsigned char)(str[4]) == BIN_IPF_VERSION));
+}
+
+//--------------------------------------------------------------
+// Procedure: BinaryToIvPFunction
+//   Purpose: Inverse of IvPFunctionToBinary. Returns null if the
+//            string is not a complete binary IPF.
+
+IvPFunction *BinaryToIvPFunction(const string& str)
+{
+  if(!isBinaryIPF(str))
+    return(0);
+
+  unsigned int ix = 5;
+  unsigned int len = str.length();
+
+  unsigned int cstr_len = 0;
+  if(!readVarint(str, ix, cstr_len) || ((ix + cstr_len) > len))
+    return(0);
+  string cstr = str.substr(ix, cstr_len);
+  ix += cstr_len;
+
+  unsigned int dim, pcs, deg, wtc;
+  if(!readVarint(str, ix, dim) || !readVarint(str, ix, pcs) ||
+     !readVarint(str, ix, deg) || !readVarint(str, ix, wtc))
+    return(0);
+  if((dim == 0) || (pcs == 0) || (pcs > len) || (wtc != ((deg*dim)+1)))
+    return(0);
+  if((ix + 8) > len)
+    return(0);
+  double pwt = readDouble(str, ix);
+  ix += 8;
+
+  unsigned int dom_len = 0;
+  if(!readVarint(str, ix, dom_len) || ((ix + dom_len) > len))
+    return(0);
+  IvPDomain domain = stringToDomain(str.substr(ix, dom_len));
+  ix += dom_len;
+  if(domain.size() != dim)
+    return(0);
+
+  IvPBox gelbox(dim,0);
+  for(unsigned int d=0; d<dim; d++) {
+    unsigned int val = 0;
+    if(!readVarint(str, ix, val))
+      return(0);
+    gelbox.setPTS(d, 0, (int)val);
+  }
+
+  unsigned int flag_bytes = (dim + 3) / 4;
+  vector<int> prev_low(dim, 0);
+
+  PDMap *pdmap = new PDMap(pcs, domain, deg);
+  for(unsigned int i=0; i<pcs; i++) {
+    bool ok = ((ix + flag_bytes) <= len);
+    IvPBox *newbox = new IvPBox(dim,deg);
+    for(unsigned int d=0; ok && (d<dim); d++) {
+      unsigned char flags = (unsigned char)(str[ix + (d/4)]);
+      unsigned int bit = (d % 4) * 2;
+      newbox->bd(d,0) = ((flags >> bit) & 1);
+      newbox->bd(d,1) = ((flags >> (bit+1)) & 1);
+    }
+    ix += flag_bytes;
+
+    for(unsigned int d=0; ok && (d<dim); d++) {
+      unsigned int zlow  = 0;
+      unsigned int width = 0;
+      ok = readVarint(str, ix, zlow) && readVarint(str, ix, width);
+      if(!ok)
+	break;
+      int low = prev_low[d] + unzigzag(zlow);
+      newbox->setPTS(d, low, low + (int)width);
+      prev_low[d] = low;
+    }
+
+    if(ok && ((ix + (wtc*4)) <= len)) {
+      for(unsigned int j=0; j<wtc; j++)
+	newbox->wt(j) = (double)(readFloat(str, ix + (j*4)));
+      ix += wtc*4;
+    }
+    else
+      ok = false;
 
+    pdmap->bx(i) = newbox;
+    if(!ok) {
+      delete(pdmap);
+      return(0);
+    }
+  }
 
+  pdmap->setGelBox(gelbox);
+  pdmap->updateGrid(1,1);
+  IvPFunction *new_of = new IvPFunction(pdmap);
+  new_of->setPWT(pwt);
+  new_of->setContextStr(cstr);
 
+  return(new_of);
+}
@@ -32,6 +32,12 @@
 // Convert an IvPFunction to string represntation
 std::string IvPFunctionToString(IvPFunction*);
 
+// Convert an IvPFunction to a compact binary representation
+std::string IvPFunctionToBinary(IvPFunction*);
+
+// True if the string holds the binary rather than text representation
+bool isBinaryIPF(const std::string&);
+
 // Convert an IvPFunction to a vector of strings
 std::vector<std::string> IvPFunctionToVector(const std::string&, 
 					     const std::string&, int);
@@ -39,6 +45,9 @@ std::vector<std::string> IvPFunctionToVector(const std::string&,
 // Create an IvPFunction based on a string representation
 IvPFunction *StringToIvPFunction(const std::string&);
 
+// Create an IvPFunction based on a binary representation
+IvPFunction *BinaryToIvPFunction(const std::string&);
+
 // Create an IvPFunction Context String without building the function
 std::string StringToIvPContext(const std::string&);
 
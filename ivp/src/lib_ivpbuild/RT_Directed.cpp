@@ -160,16 +160,19 @@ PDMap* RT_Directed::create(PDMap *pdmap, const IvPBox& region,
   for(i=0; i<old_count; i++)
     new_pdmap->bx(i) = non_boxes[i];
 
-  for(i=0; i<new_count; i++) {
+  if(new_count > 0) {
     if(!pqueue.null()) {
-      double delta = m_regressor->setWeight(new_boxes[i], true);
-      pqueue.insert(i+old_count, delta);
+      vector<double> deltas(new_count, 0);
+      m_regressor->setWeights(&(new_boxes[0]), new_count, &(deltas[0]));
+      for(i=0; i<new_count; i++)
+	pqueue.insert(i+old_count, deltas[i]);
     }
     else
-      m_regressor->setWeight(new_boxes[i], false);
-    
-    new_pdmap->bx(i+old_count) = new_boxes[i];
+      m_regressor->setWeights(&(new_boxes[0]), new_count);
   }
+
+  for(i=0; i<new_count; i++)
+    new_pdmap->bx(i+old_count) = new_boxes[i];
   
   delete(pdmap);
   return(new_pdmap);
@@ -25,6 +25,7 @@
 /*****************************************************************/
 
 #include <iostream>
+#include <vector>
 #include "RT_Uniform.h"
 #include "BuildUtils.h"
 #include "Regressor.h"
@@ -73,11 +74,13 @@ PDMap* RT_Uniform::create(const IvPBox* unifbox, const IvPBox* gelbox,
     return(0);
   
   PDMap *pdmap = new PDMap(vsize, domain, degree);
+  vector<IvPBox*> boxes(vsize, 0);
   BoxSetNode *bsn = boxset->retBSN(FIRST);
   int index = 0;
   while(bsn) {
     pdmap->bx(index) = bsn->getBox();
     pdmap->bx(index)->ofindex() = index;
+    boxes[index] = bsn->getBox();
     index++;
     bsn = bsn->getNext();
   }
@@ -88,15 +91,17 @@ PDMap* RT_Uniform::create(const IvPBox* unifbox, const IvPBox* gelbox,
   else
     pdmap->setGelBox(*unifbox);
   
+  // Set the weights of all pieces at once, letting the regressor
+  // sample the AOF over many pieces per call.
   int unifCount = pdmap->size();
-  for(int i=0; i<unifCount; i++) {
-    if(use_pqueue) {
-      double delta = m_regressor->setWeight(pdmap->bx(i), true);
-      pqueue.insert(i, delta);
-    }
-    else
-      m_regressor->setWeight(pdmap->bx(i), false);
+  if(use_pqueue) {
+    vector<double> deltas(unifCount, 0);
+    m_regressor->setWeights(&(boxes[0]), unifCount, &(deltas[0]));
+    for(int i=0; i<unifCount; i++)
+      pqueue.insert(i, deltas[i]);
   }
+  else
+    m_regressor->setWeights(&(boxes[0]), unifCount);
 
   pdmap->updateGrid(1,1);
   
@@ -74,6 +74,8 @@ Regressor::Regressor(const AOF *g_aof, int g_degree)
   // The center_point is a placeholder for point sampled at the 
   // center of a given box being fitted - if it has a center.
   m_center_point = new IvPBox(m_dim);
+  m_center_val   = 0;
+  m_center_flag  = false;
 
   // The m_mask array is useful on each setWeight call
   // mask[0]=1, mask[1]=2, mask[2]=4, and so on.
@@ -113,6 +115,59 @@ Regressor::~Regressor()
 //            degree = 2  QUADRATIC
 
 double Regressor::setWeight(IvPBox *gbox, bool feedback)
+{
+  if((m_degree < 0) || (m_degree > 2))
+    return(0);
+
+  if(!sampleBoxes(&gbox, 1))
+    return(0);
+  loadSamples(gbox, 0);
+  return(fitWeight(gbox, feedback));
+}
+
+//-------------------------------------------------------------
+// Procedure: setWeights
+//   Purpose: Set the weights of a group of boxes, same as calling 
+//            setWeight() on each, but with the AOF sampled at all
+//            the points of many boxes in one evalPtBatch() call.
+//      Note: If errs is non-null, the feedback (error estimate) of
+//            each box is written to errs[i]. With no AOF to sample,
+//            the weights are left unset and each error is zero.
+
+#define REGRESSOR_BATCH 256
+
+void Regressor::setWeights(IvPBox **boxes, unsigned int amt, 
+			   double *errs)
+{
+  if((m_degree < 0) || (m_degree > 2))
+    return;
+
+  bool feedback = (errs != 0);
+  for(unsigned int i=0; i<amt; i+=REGRESSOR_BATCH) {
+    unsigned int j, grp = amt - i;
+    if(grp > REGRESSOR_BATCH)
+      grp = REGRESSOR_BATCH;
+
+    if(!sampleBoxes(boxes+i, grp)) {
+      for(j=i; feedback && (j<amt); j++)
+	errs[j] = 0;
+      return;
+    }
+    for(j=0; j<grp; j++) {
+      loadSamples(boxes[i+j], j);
+      double err = fitWeight(boxes[i+j], feedback);
+      if(feedback)
+	errs[i+j] = err;
+    }
+  }
+}
+
+//-------------------------------------------------------------
+// Procedure: fitWeight
+//   Purpose: Set the interior function of the box, given that the
+//            corner and center samples have been loaded.
+
+double Regressor::fitWeight(IvPBox *gbox, bool feedback)
 {
   if(m_degree==0)  // Piecewise Scalar
     return(setWeight0(gbox, feedback));
@@ -134,11 +189,7 @@ double Regressor::setWeight(IvPBox *gbox, bool feedback)
 double Regressor::setWeight0(IvPBox *gbox, bool feedback)
 {
   int i;
-  setCorners(gbox);
-  
-  bool center_flag = centerBox(gbox, m_center_point);
-  if(center_flag)
-    m_center_val = this->evalPtBox(m_center_point);
+  bool center_flag = m_center_flag;
   
   double val = 0.0;
   for(i=0; (i < m_corners); i++)
@@ -174,11 +225,7 @@ double Regressor::setWeight0(IvPBox *gbox, bool feedback)
 double Regressor::setWeight1(IvPBox *gbox, bool feedback)
 {
   int i, d;
-  setCorners(gbox);
-  
-  bool center_flag = centerBox(gbox, m_center_point);
-  if(center_flag)
-    m_center_val = this->evalPtBox(m_center_point);
+  bool center_flag = m_center_flag;
 
   for(d=0; (d <= m_dim); d++)
     m_vals[d] = 0.0;
@@ -335,11 +382,7 @@ double Regressor::setWeight1(IvPBox *gbox, bool feedback)
 double Regressor::setWeight2(IvPBox *gbox, bool feedback)
 {
   int i, d;
-  setCorners(gbox);
-  
-  bool center_flag = centerBox(gbox, m_center_point);
-  if(center_flag)
-    m_center_val = this->evalPtBox(m_center_point);
+  bool center_flag = m_center_flag;
 
   for(d=0; d<=(m_dim*2); d++)
     m_vals[d] = 0.0;
@@ -517,7 +560,8 @@ void Regressor::setQuadCoeffs(double  x1, double  y1, double  x2,
 //-------------------------------------------------------------
 // Procedure: setCorners
 //   Purpose: To set the corners of the given box, and then to 
-//            eval the AOF at each corner. The trick is to NOT
+//            set the AOF value at each corner from the samples 
+//            taken by sampleBoxes(). The trick is to NOT
 //            eval the AOF more than once if a box has an edge 
 //            length equal to 1 in one or more dimensions. It is
 //            thought that evaluating the AOF is typically the 
@@ -564,7 +608,7 @@ void Regressor::setQuadCoeffs(double  x1, double  y1, double  x2,
 //                       dim=0
 //           
 
-void Regressor::setCorners(IvPBox *gbox)
+void Regressor::setCorners(IvPBox *gbox, unsigned int& sample_ix)
 {
   int i, d;
   
@@ -576,49 +620,112 @@ void Regressor::setCorners(IvPBox *gbox)
     }
   }
   
-  int emask = 0;
-  for(d=0; (d < m_dim); d++)
-    if(gbox->pt(d,1) == gbox->pt(d,0))
-      emask += m_mask[d];
+  int emask = edgeMask(gbox);
 
-  // Evaluate the AOF at each of the corners. If one or more of the 
-  // edge lengths of the gbox is 1 (high==low) then avoid evaluating
-  // the AOF at that point by "borrowing" its value from another pt.
-  m_corner_val[0] = this->evalPtBox(m_corner_point[0]);
-  for(i=1; (i < m_corners); i++) {
+  // Take the AOF value at each of the corners from the samples. If
+  // one or more of the edge lengths of the gbox is 1 (high==low) 
+  // the AOF was not sampled at that point, so "borrow" its value
+  // from another pt.
+  for(i=0; (i < m_corners); i++) {
     bool borrow = (emask & i);
     if(borrow) {
       int lender = ((emask & i) ^ i);
       m_corner_val[i] = m_corner_val[lender];
     }
     else
-      m_corner_val[i] = this->evalPtBox(m_corner_point[i]);
+      m_corner_val[i] = m_sample_vals[sample_ix++];
+  }
+}
+
+//-------------------------------------------------------------
+// Procedure: edgeMask
+//   Purpose: Note the dimensions in which the box has edge length 1,
+//            i.e., where the AOF need not be sampled at both ends.
+
+int Regressor::edgeMask(const IvPBox *gbox) const
+{
+  int emask = 0;
+  for(int d=0; (d < m_dim); d++)
+    if(gbox->pt(d,1) == gbox->pt(d,0))
+      emask += m_mask[d];
+  return(emask);
+}
+
+//-------------------------------------------------------------
+// Procedure: sampleBoxes
+//   Purpose: Evaluate the AOF at the sample points of each of the 
+//            given boxes - the corners that cannot be borrowed 
+//            (see setCorners) and the center point if there is one.
+//            All points are evaluated in a single evalPtBatch() 
+//            call, and the results left in m_sample_vals.
+//   Returns: false, with a message noted, if there is no AOF.
+
+bool Regressor::sampleBoxes(IvPBox **boxes, unsigned int amt)
+{
+  if(!m_aof) {
+    m_messages.push_back("Regressor: no AOF to sample");
+    return(false);
+  }
+
+  int i, d;
+  m_sample_pts.clear();
+  m_sample_off.clear();
+  for(unsigned int b=0; b<amt; b++) {
+    IvPBox *gbox = boxes[b];
+    m_sample_off.push_back(m_sample_pts.size() / m_dim);
+    int emask = edgeMask(gbox);
+    for(i=0; i<m_corners; i++) {
+      if(!(emask & i)) {
+	for(d=0; d<m_dim; d++)
+	  m_sample_pts.push_back(gbox->pt(d, (i & m_mask[d]) ? 1 : 0));
+      }
+    }
+    if(centerBox(gbox, m_center_point)) {
+      for(d=0; d<m_dim; d++)
+	m_sample_pts.push_back(m_center_point->pt(d,0));
+    }
+  }
 
+  // Transpose the points to the dimension-major batch layout.
+  unsigned int k, count = m_sample_pts.size() / m_dim;
+  m_batch_pts.resize(m_sample_pts.size());
+  for(k=0; k<count; k++)
+    for(d=0; d<m_dim; d++)
+      m_batch_pts[(d*count)+k] = m_sample_pts[(k*m_dim)+d];
+
+  m_sample_vals.resize(count);
+  if(count == 0)
+    return(true);
+  m_aof->evalPtBatch(&(m_batch_pts[0]), count, &(m_sample_vals[0]));
+
+  // Points evaluating to zero are given one more chance via the
+  // AOF's debug evaluation, if it has one.
+  for(k=0; k<count; k++) {
+    if(m_sample_vals[k] == 0) {
+      for(d=0; d<m_dim; d++) {
+	int val = m_sample_pts[(k*m_dim)+d];
+	m_center_point->setPTS(d, val, val);
+      }
+      m_sample_vals[k] = m_aof->evalBoxDebug(m_center_point, m_messages);
+    }
   }
+  return(true);
 }
 
 //-------------------------------------------------------------
-// Procedure: evalPtBox()
-//   Purpose: Evaluate a point box based on the set of linear coefficients.
+// Procedure: loadSamples
+//   Purpose: Set the corner and center points and values of the 
+//            given box from the samples of box number ix of the 
+//            last call to sampleBoxes().
 
-double Regressor::evalPtBox(const IvPBox *gbox)
+void Regressor::loadSamples(IvPBox *gbox, unsigned int ix)
 {
-  if(!m_aof) 
-    return(0);
-  
-  unsigned int dim = gbox->getDim();
-  if(dim != m_domain.size())
-    return(0);
-  
-  vector<double> pvals;
-  for(unsigned int d=0; d<dim; d++)
-    pvals.push_back(m_domain.getVal(d, gbox->pt(d)));
-  double val = m_aof->evalPoint(pvals);
-  if(val == 0)
-    val = m_aof->evalBox(gbox);
-  if(val == 0)
-    val = m_aof->evalBoxDebug(gbox, m_messages);
-  return(val);
+  unsigned int sample_ix = m_sample_off[ix];
+  setCorners(gbox, sample_ix);
+
+  m_center_flag = centerBox(gbox, m_center_point);
+  if(m_center_flag)
+    m_center_val = m_sample_vals[sample_ix++];
 }
 
 
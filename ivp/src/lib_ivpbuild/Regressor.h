@@ -39,6 +39,7 @@ public:
   int     getDegree() const   {return(m_degree);}
 
   double  setWeight(IvPBox*, bool feedback=false);
+  void    setWeights(IvPBox**, unsigned int, double *errs=0);
   void    setStrictRange(bool val) {m_strict_range = val;}
 
   unsigned int getMessageCnt() const {return(m_messages.size());}
@@ -47,13 +48,16 @@ public:
   const AOF* getAOF() {return(m_aof);}
 
 protected:
-  void    setCorners(IvPBox*);
+  void    setCorners(IvPBox*, unsigned int&);
+  int     edgeMask(const IvPBox*) const;
+  double  fitWeight(IvPBox*, bool);
+  bool    sampleBoxes(IvPBox**, unsigned int);
+  void    loadSamples(IvPBox*, unsigned int);
   double  setWeight0(IvPBox*, bool);
   double  setWeight1(IvPBox*, bool);
   double  setWeight2(IvPBox*, bool);
   void    setQuadCoeffs(double, double,  double,  double, double, 
 			double, double&, double&, double&);
-  double  evalPtBox(const IvPBox*);
   bool    centerBox(const IvPBox*, IvPBox*);
   
 protected:
@@ -71,12 +75,21 @@ protected:
   // once for efficiency sake.
   IvPBox*   m_center_point;
   double    m_center_val;
+  bool      m_center_flag;
   IvPBox**  m_corner_point; 
   double*   m_corner_val;   
   int       m_corners;      
   int*      m_mask;
   double*   m_vals;
 
+  // The sample points of a group of boxes are gathered and handed
+  // to the AOF in one evalPtBatch() call. m_sample_off holds the 
+  // offset of each box's first sample into m_sample_vals.
+  std::vector<int>          m_sample_pts;
+  std::vector<int>          m_batch_pts;
+  std::vector<double>       m_sample_vals;
+  std::vector<unsigned int> m_sample_off;
+
   int       m_degree;
 };
 
@@ -32,8 +32,9 @@ using namespace std;
 //---------------------------------------------------------------
 // Constructor
 
-BoxSet::BoxSet()
+BoxSet::BoxSet(BoxSetNodePool *pool)
 {
+  m_pool = pool;
   m_head = 0; 
   m_tail = 0; 
   m_size = 0; 
@@ -47,7 +48,7 @@ BoxSet::~BoxSet()
   BoxSetNode *thisBSN = m_head;
   while(thisBSN != 0) {
     BoxSetNode *next = thisBSN->m_next;
-    delete(thisBSN);
+    delBSN(thisBSN);
     thisBSN = next;
   }
 }
@@ -63,7 +64,7 @@ void BoxSet::makeEmpty()
   BoxSetNode *nextBSN = 0;
   while(aBSN != 0) {
     nextBSN = aBSN->m_next;
-    delete(aBSN);
+    delBSN(aBSN);
     aBSN = nextBSN;
   }      
   m_head = 0; 
@@ -83,7 +84,7 @@ void BoxSet::makeEmptyAndDeleteBoxes()
   while(aBSN != 0) {
     nextBSN = aBSN->m_next;
     delete(aBSN->getBox());
-    delete(aBSN);
+    delBSN(aBSN);
     aBSN = nextBSN;
   }
   m_head=0; 
@@ -98,7 +99,7 @@ void BoxSet::makeEmptyAndDeleteBoxes()
 
 void BoxSet::addBox(IvPBox* b, int end)
 {
-  BoxSetNode *bsn = new BoxSetNode(b);
+  BoxSetNode *bsn = newBSN(b);
   if(end==FIRST)
     addBSN(*bsn, FIRST);
   else
@@ -245,12 +246,12 @@ void BoxSet::mergeCopy(BoxSet& bs)
   while(cBSN != 0) {
     m_size++;
     if(!m_head) {                  // case where THIS BoxSet is empty
-      newBSN = new BoxSetNode(cBSN->getBox());
+      newBSN = this->newBSN(cBSN->getBox());
       m_head = newBSN;
       m_tail = newBSN;
     }
     else {
-      newBSN = new BoxSetNode(cBSN->getBox());
+      newBSN = this->newBSN(cBSN->getBox());
       m_tail->m_next = newBSN;
       newBSN->m_prev = m_tail;
 	m_tail = newBSN;
@@ -326,24 +327,34 @@ void BoxSet::removeDups()
     IvPBox *abox = bsn->getBox();       // and removing on
     if(abox->mark()) {                  // second encounter.
       this->remBSN(bsn);
-      delete(bsn);
+      delBSN(bsn);
     }
     abox->mark() = true;
     bsn = nextbsn;  
   }
 }
 
+//---------------------------------------------------------------
+// Procedure: newBSN
+//   Purpose: Create a BSN holding the given box, from the pool
+//            if this BoxSet has one.
 
+BoxSetNode *BoxSet::newBSN(IvPBox *b)
+{
+  if(m_pool)
+    return(m_pool->getBSN(b));
+  return(new BoxSetNode(b));
+}
 
+//---------------------------------------------------------------
+// Procedure: delBSN
+//   Purpose: Dispose of the given BSN, returning it to the pool
+//            if this BoxSet has one.
 
-
-
-
-
-
-
-
-
-
-
-
+void BoxSet::delBSN(BoxSetNode *bsn)
+{
+  if(m_pool)
+    m_pool->putBSN(bsn);
+  else
+    delete(bsn);
+}
@@ -29,15 +29,18 @@
 #define BOXSET_HEADER
 
 #include "BoxSetNode.h"
+#include "BoxSetNodePool.h"
 
 #define FIRST 0
 #define LAST  1
 
 class BoxSet {
 public:
-  BoxSet();
+  BoxSet(BoxSetNodePool *pool=0);
   ~BoxSet();
 
+  void setPool(BoxSetNodePool *pool) {m_pool=pool;}
+
   void makeEmpty();
   void makeEmptyAndDeleteBoxes();
   int  getSize()     { return(m_size); }
@@ -55,6 +58,12 @@ public:
   void  removeDups();
 
 private:
+  BoxSetNode *newBSN(IvPBox*);
+  void        delBSN(BoxSetNode*);
+
+private:
+  BoxSetNodePool *m_pool;
+
   BoxSetNode *m_head;
   BoxSetNode *m_tail;
   int         m_size;
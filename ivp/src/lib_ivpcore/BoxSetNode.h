@@ -31,6 +31,7 @@
 class IvPBox;
 class BoxSetNode {
 friend class BoxSet;
+friend class BoxSetNodePool;
 public:
   BoxSetNode()            {m_prev=0; m_next=0; m_box=0;}
   BoxSetNode(IvPBox *b)   {m_prev=0; m_next=0; m_box=b;}
@@ -0,0 +1,103 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: BoxSetNodePool.cpp                                   */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include "BoxSetNodePool.h"
+
+//---------------------------------------------------------------
+// Constructor
+
+BoxSetNodePool::BoxSetNodePool()
+{
+  m_free        = 0;
+  m_free_count  = 0;
+  m_alloc_count = 0;
+}
+
+//---------------------------------------------------------------
+// Destructor
+//      Note: Only nodes currently in the pool are deleted. Nodes 
+//            handed out are owned by the BoxSet holding them.
+
+BoxSetNodePool::~BoxSetNodePool()
+{
+  BoxSetNode *bsn = m_free;
+  while(bsn != 0) {
+    BoxSetNode *next = bsn->m_next;
+    delete(bsn);
+    bsn = next;
+  }
+}
+
+//---------------------------------------------------------------
+// Procedure: getBSN
+//   Purpose: Return a node holding the given box, taken from the
+//            pool if one is available, otherwise from the heap.
+
+BoxSetNode* BoxSetNodePool::getBSN(IvPBox *box)
+{
+  BoxSetNode *bsn = m_free;
+  if(bsn) {
+    m_free = bsn->m_next;
+    m_free_count--;
+  }
+  else {
+    bsn = new BoxSetNode;
+    m_alloc_count++;
+  }
+
+  bsn->m_prev = 0;
+  bsn->m_next = 0;
+  bsn->m_box  = box;
+  return(bsn);
+}
+
+//---------------------------------------------------------------
+// Procedure: putBSN
+//   Purpose: Return the given node to the pool. The box it holds
+//            is not affected.
+
+void BoxSetNodePool::putBSN(BoxSetNode *bsn)
+{
+  if(!bsn)
+    return;
+
+  bsn->m_prev = 0;
+  bsn->m_box  = 0;
+  bsn->m_next = m_free;
+  m_free = bsn;
+  m_free_count++;
+}
+
+//---------------------------------------------------------------
+// Procedure: reserve
+//   Purpose: Grow the pool so that at least the given number of 
+//            nodes are available without further allocation.
+
+void BoxSetNodePool::reserve(unsigned int amt)
+{
+  while(m_free_count < amt) {
+    m_alloc_count++;
+    putBSN(new BoxSetNode);
+  }
+}
@@ -42,8 +42,6 @@ using namespace std;
 
 IvPBox::IvPBox(int g_dim, int g_degree)
 {
-  m_dim     = (short int) g_dim;
-  m_degree  = (short int) g_degree;
   m_pts     = 0;
   m_bds     = 0;
   m_wts     = 0;
@@ -51,12 +49,9 @@ IvPBox::IvPBox(int g_dim, int g_degree)
   m_markval = false;
   m_of      = 0;
 
+  allocate(g_dim, g_degree);
+
   if(m_dim > 0) {
-    int wtc = (m_degree * m_dim)+1;
-    m_pts = new int[m_dim * 2];
-    m_bds = new bool[m_dim * 2];
-    m_wts = new double[wtc];
-    
     int i;
     for(i=0; (i < m_dim); i++) {
       m_pts[i*2]   = 0;
@@ -65,6 +60,7 @@ IvPBox::IvPBox(int g_dim, int g_degree)
       m_bds[i*2+1] = 1;    // Default - inclusive inequality
     }
     
+    int wtc = getWtc();
     for(i=0; i<wtc; i++)
       m_wts[i] = 0.0;
   }
@@ -75,8 +71,6 @@ IvPBox::IvPBox(int g_dim, int g_degree)
 
 IvPBox::IvPBox(const IvPBox &b)
 {
-  m_dim     = b.m_dim;
-  m_degree  = b.m_degree;
   m_pts     = 0;
   m_bds     = 0;
   m_wts     = 0;
@@ -84,19 +78,16 @@ IvPBox::IvPBox(const IvPBox &b)
   m_markval = b.m_markval;
   m_of      = b.m_of;
 
+  allocate(b.m_dim, b.m_degree);
 
   if(m_dim > 0) {
-    int wtc = (m_degree * m_dim)+1;
-    m_pts = new int[m_dim*2];
-    m_bds = new bool[m_dim*2];
-    m_wts = new double[wtc];
-
     int i;
     for(i=0; i<(m_dim*2); i++) {
       m_pts[i] = b.m_pts[i];
       m_bds[i] = b.m_bds[i];
     }
     
+    int wtc = getWtc();
     for(i=0; i<wtc; i++)
       m_wts[i] = b.m_wts[i];
   }
@@ -107,9 +98,7 @@ IvPBox::IvPBox(const IvPBox &b)
 
 IvPBox::~IvPBox()
 {
-  if(m_pts) delete [] m_pts;
-  if(m_bds) delete [] m_bds;
-  if(m_wts) delete [] m_wts;
+  release();
 }
 
 //------------------------------------------------------
@@ -128,32 +117,18 @@ const IvPBox &IvPBox::operator=(const IvPBox &right)
     m_markval = right.m_markval;
     m_of      = right.m_of;
 
-    int wtc = (right.m_degree * right.m_dim) + 1;
-
-    if(m_dim != right.m_dim) {
-      if(m_pts) delete [] m_pts;
-      if(m_bds) delete [] m_bds;
-      m_pts = new int[right.m_dim*2];
-      m_bds = new bool[right.m_dim*2];
-    }
-    
     if((m_dim != right.m_dim) || (m_degree != right.m_degree)) {
-      if(m_wts) 
-	delete [] m_wts;
-      m_wts = 0;
-      if(right.m_dim > 0)
-	m_wts = new double[wtc];
+      release();
+      allocate(right.m_dim, right.m_degree);
     }
 
-    m_dim     = right.m_dim;
-    m_degree  = right.m_degree;
-
     for(i=0; i<(m_dim*2); i++) {
       m_pts[i] = right.m_pts[i];
       m_bds[i] = right.m_bds[i];
     }
 
     if(m_wts) {
+      int wtc = getWtc();
       for(i=0; i<wtc; i++)
 	m_wts[i] = right.m_wts[i];
     }  
@@ -162,6 +137,54 @@ const IvPBox &IvPBox::operator=(const IvPBox &right)
   return(*this);
 }
 
+//-------------------------------------------------------------
+// Procedure: allocate
+//   Purpose: Set the dimension and degree and point the pts, bds 
+//            and wts arrays at storage of the proper size. Small
+//            boxes use the storage inside the box itself, so no
+//            memory from the heap is allocated for them.
+//      Note: Any prior storage is assumed to have been released.
+
+void IvPBox::allocate(int g_dim, int g_degree)
+{
+  m_dim    = (uint16) g_dim;
+  m_degree = (uint16) g_degree;
+  m_pts    = 0;
+  m_bds    = 0;
+  m_wts    = 0;
+
+  if(m_dim == 0)
+    return;
+
+  if((m_dim <= IVPBOX_INLINE_DIM) && (getWtc() <= IVPBOX_INLINE_WTS)) {
+    m_pts = m_inl_pts;
+    m_bds = m_inl_bds;
+    m_wts = m_inl_wts;
+  }
+  else {
+    m_pts = new int[m_dim * 2];
+    m_bds = new bool[m_dim * 2];
+    m_wts = new double[(m_degree * m_dim)+1];
+  }
+}
+
+//-------------------------------------------------------------
+// Procedure: release
+//   Purpose: Free the pts, bds and wts arrays if they were taken
+//            from the heap. Inline storage needs no freeing.
+
+void IvPBox::release()
+{
+  if(!isInline()) {
+    if(m_pts) delete [] m_pts;
+    if(m_bds) delete [] m_bds;
+    if(m_wts) delete [] m_wts;
+  }
+  m_pts = 0;
+  m_bds = 0;
+  m_wts = 0;
+}
+
 //-------------------------------------------------------------
 // Procedure: copy()
 //      Note: Make a copy of this box, equal in all ways, including
@@ -632,36 +655,37 @@ void IvPBox::transDomain(int newEdges, const int *edgeMap)
     newBds[edgeMap[i]*2+1] = m_bds[i*2+1];
   }
 
-  delete [] m_pts;  m_pts=newPts;
-  delete [] m_bds;  m_bds=newBds;
-
   // Now handle the setting of the new interior function
-  if(m_degree != 0) {
-    int     newWtc = m_dim + newEdges + 1;
-    double *newWts = new double[newWtc];
+  int     newWtc = 1;
+  double *newWts = 0;
+  if(m_degree == 0) {
+    newWts = new double[1];
+    newWts[0] = m_wts ? m_wts[0] : 0.0;
+  }
+  else {
+    newWtc = m_dim + newEdges + 1;
+    newWts = new double[newWtc];
     for(i=0; i<newWtc; i++)
       newWts[i] = 0.0;
     for(i=0; i<m_dim; i++)
       newWts[edgeMap[i]] = m_wts[i];
     newWts[newWtc-1] = m_wts[m_dim];
-    delete [] m_wts;
-    m_wts = newWts;
   }
 
-  m_dim = newDim;
-}
-
-
-
-
-
-
-
-
-
-
-
-
-
+  // Finally re-allocate storage for the new dimension and copy
+  release();
+  allocate(newDim, m_degree);
 
+  for(i=0; i<(newDim*2); i++) {
+    m_pts[i] = newPts[i];
+    m_bds[i] = newBds[i];
+  }
+  if(m_wts) {
+    for(i=0; i<newWtc; i++)
+      m_wts[i] = newWts[i];
+  }
 
+  delete [] newPts;
+  delete [] newBds;
+  delete [] newWts;
+}
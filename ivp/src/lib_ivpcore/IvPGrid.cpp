@@ -294,6 +294,18 @@ void IvPGrid::remBox(const IvPBox *rbox)
 BoxSet *IvPGrid::getBS(const IvPBox *b, bool int_check)
 {
   BoxSet *retBS = new BoxSet();
+  getBS(b, *retBS, int_check);
+  return(retBS);
+}
+
+//---------------------------------------------------------------
+// Procedure: getBS
+//   Purpose: Same as getBS(b) except the boxes are added to the
+//            given (presumably empty) BoxSet. If the BoxSet draws
+//            its nodes from a pool, no heap allocation is needed.
+
+void IvPGrid::getBS(const IvPBox *b, BoxSet& retBS, bool int_check)
+{
   setIXBOX(b);                      // Set IX_BOX array.
 
   bool moreGrids = true;
@@ -307,18 +319,35 @@ BoxSet *IvPGrid::getBS(const IvPBox *b, bool int_check)
       while(bsn != 0) {
 	IvPBox *iBox = bsn->getBox();
 	if(b->intersect(iBox))
-	  retBS->addBox(iBox, LAST);
+	  retBS.addBox(iBox, LAST);
 	bsn = bsn->getNext();
       }
     }
     else
-      retBS->mergeCopy(*(grid[ix]));
+      retBS.mergeCopy(*(grid[ix]));
 
     moreGrids = moveToNextGrid();
   }
-  if(dup_flag) retBS->removeDups();
+  if(dup_flag) retBS.removeDups();
+}
 
-  return(retBS);
+//---------------------------------------------------------------
+// Procedure: getPtBS
+//   Purpose: Return the BoxSet of the one grid element containing
+//            the given point box. The BoxSet is owned by the grid.
+//      Note: All boxes containing the point are in this grid 
+//            element, but not all boxes in it contain the point.
+
+BoxSet *IvPGrid::getPtBS(const IvPBox *b) const
+{
+  long ix = 0;
+  for(int d=dim-1; d>=0; d--) {
+    long relPT = min(DOMAIN_HIGH[d]-DOMAIN_LOW[d],
+		     b->pt(d, HIGH)-DOMAIN_LOW[d]);
+    relPT = max(0, relPT);
+    ix += (relPT / PTS_PER_GEL[d]) * DIM_WT[d];
+  }
+  return(grid[ix]);
 }
 
 //---------------------------------------------------------------
@@ -395,6 +424,78 @@ double IvPGrid::getCheapBound(const IvPBox *qbox)
   return(result);
 }
 
+//---------------------------------------------------------------
+// Procedure: getBoxes
+//   Purpose: Same result as getBS(b, true), in the same order, but
+//            without touching any grid member state or the box marks
+//            used by BoxSet::removeDups(). Safe for concurrent use
+//            by several threads as long as the grid is not modified.
+//      Note: Duplicates are suppressed by only accepting a box in
+//            the first grid element visited that holds both the
+//            query box and the candidate. Since grid elements are
+//            visited from the high corner down, that element is
+//            min(query_high, cand_high) in each dimension.
+
+void IvPGrid::getBoxes(const IvPBox *b, vector<IvPBox*>& boxes, 
+		       long *ixbuf) const
+{
+  boxes.clear();
+  setIXBOX(b, ixbuf);
+
+  const long *ix_box  = ixbuf;
+  const long *ix_high = ixbuf + (2*dim);
+
+  bool moreGrids = true;
+  while(moreGrids) {
+    long ix = 0;
+    for(int d=dim-1; d>=0; d--)
+      ix += ix_box[d] * DIM_WT[d];
+    
+    BoxSetNode *bsn = grid[ix]->retBSN(FIRST);
+    while(bsn != 0) {
+      IvPBox *iBox = bsn->getBox();
+      if(b->intersect(iBox)) {
+	bool first_visit = true;
+	for(int d=0; (d<dim) && dup_flag && first_visit; d++) {
+	  long relPT = min(DOMAIN_HIGH[d]-DOMAIN_LOW[d],
+			   iBox->pt(d, HIGH)-DOMAIN_LOW[d]);
+	  long ihigh = relPT / PTS_PER_GEL[d];
+	  if(ix_box[d] != min(ix_high[d], ihigh))
+	    first_visit = false;
+	}
+	if(first_visit)
+	  boxes.push_back(iBox);
+      }
+      bsn = bsn->getNext();
+    }
+    moreGrids = moveToNextGrid(ixbuf);
+  }
+}
+
+//---------------------------------------------------------------
+// Procedure: getCheapBound
+//   Purpose: Reentrant version of getCheapBound(qbox). See getBoxes().
+
+double IvPGrid::getCheapBound(const IvPBox *qbox, long *ixbuf) const
+{
+  double result = -99999.0;
+  bool   firstGrid = true;
+
+  setIXBOX(qbox, ixbuf);
+  bool moreGrids = true;
+  while(moreGrids) {
+    long ix = 0;
+    for(int d=dim-1; d>=0; d--)
+      ix += ixbuf[d] * DIM_WT[d];
+    if(!gridUBFresh[ix])
+      if(firstGrid || (gridUB[ix]>result))
+	result = gridUB[ix];
+    firstGrid = false;
+    moreGrids = moveToNextGrid(ixbuf);
+  }
+  return(result);
+}
+
 //---------------------------------------------------------------
 // Procedure: getLinearBound
 
@@ -535,6 +636,56 @@ inline bool IvPGrid::moveToNextGrid()
   return(moreGrids);
 }
 
+//---------------------------------------------------------------
+// Procedure: setIXBOX
+//   Purpose: Same as setIXBOX(b) but the results are written into
+//            the given buffer rather than IX_BOX and IX_BOX_BOUND.
+//            Layout: [0,dim) current gel, [dim,2dim) low bound,
+//            [2dim,3dim) high bound.
+
+void IvPGrid::setIXBOX(const IvPBox* b, long *ixbuf) const
+{
+  long *ix_box  = ixbuf;
+  long *ix_low  = ixbuf + dim;
+  long *ix_high = ixbuf + (2*dim);
+
+  long relPT = 0;
+  for(int d=0; d<dim; d++) {
+    if(b->bd(d,0) == 1)
+      relPT = max(0, b->pt(d, LOW)-DOMAIN_LOW[d]);
+    else
+      relPT = max(0, 1 + b->pt(d, LOW)-DOMAIN_LOW[d]);
+    ix_low[d] = relPT  / PTS_PER_GEL[d];
+    relPT = min(DOMAIN_HIGH[d]-DOMAIN_LOW[d],
+		b->pt(d, HIGH)-DOMAIN_LOW[d]);
+    ix_high[d] = relPT / PTS_PER_GEL[d];
+    ix_box[d]  = ix_high[d];
+  }
+}
+
+//---------------------------------------------------------------
+// Procedure: moveToNextGrid
+//   Purpose: Same as moveToNextGrid() but on the given buffer as
+//            set by setIXBOX(b, ixbuf).
+
+bool IvPGrid::moveToNextGrid(long *ixbuf) const
+{
+  long *ix_box  = ixbuf;
+  long *ix_low  = ixbuf + dim;
+  long *ix_high = ixbuf + (2*dim);
+
+  bool moreGrids = false;
+  for(int d=dim-1; (d>=0)&&(!moreGrids); d--) {
+    if(ix_box[d] > ix_low[d]) {
+      ix_box[d]--;
+      moreGrids = true;
+    }
+    else
+      if(d != 0) ix_box[d] = ix_high[d];
+  }
+  return(moreGrids);
+}
+
 //---------------------------------------------------------------
 // Procedure: calcBoxesPerGEL
 //   Purpose: Prints general info on grid construction
@@ -26,6 +26,7 @@
 #ifndef GRID_HEADER
 #define GRID_HEADER
 
+#include <vector>
 #include "BoxSet.h"
 
 class IvPDomain;
@@ -37,6 +38,8 @@ public:
   void     addBox(IvPBox*, bool BX=1, bool UB=1);
   void     remBox(const IvPBox *);
   BoxSet*  getBS(const IvPBox*, bool=true);
+  void     getBS(const IvPBox*, BoxSet&, bool=true);
+  BoxSet*  getPtBS(const IvPBox*) const;
   BoxSet*  getBS_Thresh(const IvPBox*, double);
   double   getCheapBound(const IvPBox *b=0);
   double   getTightBound(const IvPBox *b=0);
@@ -44,6 +47,12 @@ public:
   void     scaleBounds(double);
   void     moveBounds(double);
 
+  // Reentrant versions of getBS() and getCheapBound() for use by
+  // concurrent solvers. The caller supplies a scratch buffer of at
+  // least 3*dim longs used in place of IX_BOX and IX_BOX_BOUND.
+  void     getBoxes(const IvPBox*, std::vector<IvPBox*>&, long*) const;
+  double   getCheapBound(const IvPBox*, long*) const;
+
   int      getTotalGrids()     {return(total_grids);}
   int      getDim()            {return(dim);}
   IvPBox   getMaxPt()          {return(maxpt);}
@@ -53,6 +62,8 @@ public:
 protected:
   void     setIXBOX(const IvPBox*);
   bool     moveToNextGrid();
+  void     setIXBOX(const IvPBox*, long*) const;
+  bool     moveToNextGrid(long*) const;
 
 public:   // Testing functions
   double   calcBoxesPerGEL();
@@ -188,6 +188,23 @@ BoxSet* PDMap::getBS(const IvPBox *qbox)
   return(retBS);
 }
 
+//-------------------------------------------------------------
+// Procedure: getBS
+//   Purpose: Same as getBS(qbox) except the intersecting boxes
+//            are added to the given BoxSet.
+
+void PDMap::getBS(const IvPBox *qbox, BoxSet& retBS)
+{
+  if(m_grid) {
+    m_grid->getBS(qbox, retBS);
+    return;
+  }
+  
+  for(int i=0; (i < m_boxCount); i++) 
+    if(qbox->intersect(m_boxes[i]))
+      retBS.addBox(m_boxes[i]);
+}
+
 //-------------------------------------------------------------
 // Procedure: getUniverse
 //   Purpose: 
@@ -369,32 +386,22 @@ double PDMap::evalPoint(const IvPBox *gbox, bool* covered) const
     return(retVal);
   }
 
-  if(m_grid) {
-    BoxSet *bs = m_grid->getBS(gbox);
-    if(bs->getSize() == 0)
-      return(retVal);
-    else {
-      if(covered) *covered = true;
-      if(bs->getSize() > 1) {
-	BoxSetNode *bsn = bs->retBSN();
-	int numHits = 0;
-	while(bsn != NULL) {
-	  IvPBox *bx = bsn->getBox();
-	  if(gbox->intersect(bx)) {
-	    numHits++;
-	    retVal = bs->retBSN()->getBox()->ptVal(gbox);
-	  }
-	  bsn = bsn->getNext();
-	}
-	if(numHits != 1) {
-	  if(covered) *covered = false;
-	  return(0.0);
-	}
-      }
-      else
-	retVal = bs->retBSN()->getBox()->ptVal(gbox);
+  // A point box lies in exactly one grid element, so just check 
+  // the boxes in that one element. No BoxSet is created.
+  BoxSetNode *bsn = m_grid->getPtBS(gbox)->retBSN();
+  IvPBox *hitBox  = 0;
+  int     numHits = 0;
+  while(bsn != NULL) {
+    IvPBox *bx = bsn->getBox();
+    if(gbox->intersect(bx)) {
+      numHits++;
+      hitBox = bx;
     }
-    if(bs) delete(bs);
+    bsn = bsn->getNext();
+  }
+  if(numHits == 1) {
+    if(covered) *covered = true;
+    retVal = hitBox->ptVal(gbox);
   }
   return(retVal);
 }
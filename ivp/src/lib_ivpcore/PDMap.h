@@ -47,6 +47,7 @@ public:
   IvPBox    getGelBox() const     {return(m_gelbox);}
   IvPDomain getDomain() const     {return(m_domain);}
   BoxSet*   getBS(const IvPBox*); 
+  void      getBS(const IvPBox*, BoxSet&);
   IvPBox    getUniverse() const;
 
   int       size() const          {return(m_boxCount);}
@@ -51,7 +51,9 @@ using namespace std;
 
 IvPProblem::IvPProblem(Compactor *g_compactor)
 {
-  nodeBox = 0;
+  nodeBox    = 0;
+  m_levels   = 0;
+  m_level_bs = 0;
   if(g_compactor) {
     compactor = g_compactor;
     ownCompactor = false;
@@ -67,6 +69,7 @@ IvPProblem::IvPProblem(Compactor *g_compactor)
 
 IvPProblem::~IvPProblem() 
 {
+  clearNodeBoxes();
   if(ownCompactor)
     delete(compactor);
 }
@@ -110,13 +113,25 @@ void IvPProblem::solvePrior(const IvPBox *isolBox)
   // Start timer after (perhaps) outputting start message.
   if(!m_silent) cout << "---> entering IvP Solve routine: " << endl;
 
-  // A nodeBox is associated with each level of the tree. 
-  // Initialized here rather than in constructor since we need to 
-  // know the number of objective functions first.
-  nodeBox = new IvPBox*[m_ofnum+1];
-
-  for(int i=0; (i < m_ofnum+1); i++)
-    nodeBox[i] = m_ofs[0]->getPDMap()->getUniverse().copy();
+  // A nodeBox and BoxSet is associated with each level of the 
+  // tree. Initialized here rather than in constructor since we 
+  // need to know the number of objective functions first. They
+  // are re-used if solve is invoked again with the same number.
+  IvPBox universe = m_ofs[0]->getPDMap()->getUniverse();
+  if(m_levels != (m_ofnum+1)) {
+    clearNodeBoxes();
+    m_levels   = m_ofnum+1;
+    nodeBox    = new IvPBox*[m_levels];
+    m_level_bs = new BoxSet[m_levels];
+    for(int i=0; (i < m_levels); i++) {
+      nodeBox[i] = universe.copy();
+      m_level_bs[i].setPool(&m_bsn_pool);
+    }
+  }
+  else {
+    for(int i=0; (i < m_levels); i++)
+      *(nodeBox[i]) = universe;
+  }
   nodeBox[0]->setWT(0.0);
   
   if(isolBox)
@@ -189,12 +204,8 @@ void IvPProblem::solveRecurse(int level)
     return;
   }
   
-  IvPGrid *grid = m_ofs[level]->getPDMap()->getGrid();
-  BoxSet *levelBoxes;
-  if(grid)
-    levelBoxes = grid->getBS(nodeBox[level]);
-  else
-    levelBoxes = m_ofs[level]->getPDMap()->getBS(nodeBox[level]);
+  BoxSet *levelBoxes = &(m_level_bs[level]);
+  m_ofs[level]->getPDMap()->getBS(nodeBox[level], *levelBoxes);
   BoxSetNode *levBSN = levelBoxes->retBSN(FIRST);
 
   while(levBSN != NULL) {
@@ -211,7 +222,7 @@ void IvPProblem::solveRecurse(int level)
 
     levBSN = nextLevBSN;
   }
-  delete(levelBoxes);
+  levelBoxes->makeEmpty();    // Nodes go back to the pool
 }
 
 
@@ -220,14 +231,24 @@ void IvPProblem::solveRecurse(int level)
 
 void IvPProblem::solvePost()
 {
-  // Delete nodeBoxes here since solve may be invoked 
-  // again later, and the number of objective functions may be 
-  // different then.
-  for(int i=0; (i < m_ofnum+1); i++)
+  // The nodeBoxes are no longer deleted here. They are kept for
+  // re-use should solve be invoked again, and are replaced in
+  // solvePrior if the number of objective functions has changed.
+}
+
+//---------------------------------------------------------------
+// Procedure: clearNodeBoxes
+
+void IvPProblem::clearNodeBoxes()
+{
+  for(int i=0; (i < m_levels); i++)
     delete(nodeBox[i]);
 
   delete [] nodeBox;  
-  nodeBox = 0;  
+  delete [] m_level_bs;
+  nodeBox    = 0;  
+  m_level_bs = 0;
+  m_levels   = 0;
 }
 
 
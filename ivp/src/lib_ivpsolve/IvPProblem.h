@@ -38,6 +38,8 @@
 
 #include "Problem.h"
 #include "Compactor.h"
+#include "BoxSet.h"
+#include "BoxSetNodePool.h"
 
 class IvPProblem: public Problem {
 public:
@@ -51,6 +53,7 @@ protected:
   void   solvePrior(const IvPBox *b=0);
   void   solveRecurse(int);
   void   solvePost();
+  void   clearNodeBoxes();
   double upperTightBound(int, IvPBox*);
   double upperCheapBound(int, IvPBox*);
 
@@ -58,6 +61,12 @@ protected:
   IvPBox**   nodeBox;
   Compactor* compactor;
   bool       ownCompactor;
+
+  // Per-level working storage, kept across solves so that once
+  // warmed up, the branch and bound search allocates nothing.
+  int            m_levels;
+  BoxSet*        m_level_bs;
+  BoxSetNodePool m_bsn_pool;
 };  
 
 #endif
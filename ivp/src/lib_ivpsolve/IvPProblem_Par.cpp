@@ -0,0 +1,328 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: IvPProblem_Par.cpp                                   */
+/*    DATE: Oct 17th, 2026                                       */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <iostream> 
+#include <cfloat>
+#include "IvPProblem_Par.h"
+#include "IvPGrid.h"
+#include "PDMap.h"
+
+using namespace std;
+
+//---------------------------------------------------------------
+// Procedure: workerEntry
+//   Purpose: Pool work function. Runs the given worker of a problem.
+
+static void workerEntry(void *arg, unsigned int index)
+{
+  IvPProblem_Par *problem = (IvPProblem_Par*)(arg);
+  problem->runWorker(index);
+}
+
+//---------------------------------------------------------------
+// Procedure: Constructor
+
+IvPProblem_Par::IvPProblem_Par(unsigned int threads, Compactor *c) :
+  IvPProblem(c)
+{
+  m_threads       = threads;
+  m_shared_wt     = -DBL_MAX;
+  m_next_subtree  = 0;
+  m_subtree_count = 0;
+}
+
+//---------------------------------------------------------------
+// Procedure: Destructor
+
+IvPProblem_Par::~IvPProblem_Par()
+{
+  m_pool.stop();
+  clearWorkers();
+  clearSubtreeResults();
+}
+
+//---------------------------------------------------------------
+// Procedure: solve
+//   Purpose: Parallel version of IvPProblem::solve(). The boxes of
+//            the first objective function are the roots of disjoint
+//            subtrees. Workers claim subtrees one at a time and 
+//            search them with their own node boxes, sharing only the
+//            best weight found so far as a pruning bound.
+//      Note: The result is identical to the serial solver when
+//            m_epsilon is zero: each subtree reports the first best
+//            leaf in serial order, subtrees are only pruned when 
+//            strictly worse than a known solution, and results are
+//            merged in subtree order using the serial accept rule.
+//      Note: With a single thread, a single subtree, or on a 
+//            platform without pthreads, the serial solver is used.
+
+bool IvPProblem_Par::solve(const IvPBox *isolBox)
+{
+  if(m_ofnum == 0) {
+    cout << "IvPProblem_Par::solve() - zero OFS!!!!!" << endl;
+    return(false);
+  }
+
+  PDMap *pdmap = m_ofs[0]->getPDMap();
+  int boxCount = pdmap->size();
+
+#ifdef _WIN32
+  return(IvPProblem::solve(isolBox));
+#else
+  if((m_threads <= 1) || (boxCount <= 1) || (m_ofnum == 1))
+    return(IvPProblem::solve(isolBox));
+
+  solvePrior(isolBox);
+
+  clearSubtreeResults();
+  m_subtree_count = boxCount;
+  m_subtree_wt.resize(boxCount, 0);
+  m_subtree_box.resize(boxCount, 0);
+  m_next_subtree = 0;
+  m_shared_wt    = -DBL_MAX;
+  if(m_maxbox)
+    m_shared_wt = m_maxwt;
+
+  unsigned int threads = m_threads;
+  if(threads > (unsigned int)(boxCount))
+    threads = (unsigned int)(boxCount);
+  threads = m_pool.start(threads);
+
+  // Node boxes are copied fresh since the problem may have changed
+  // since the last solve.
+  clearWorkers();
+  int dim = pdmap->getDim();
+  m_workers.resize(threads);
+  m_ixbufs.resize(threads * 3 * dim);
+  for(unsigned int t=0; t<threads; t++) {
+    IvPParWorker& worker = m_workers[t];
+    worker.problem = this;
+    worker.index   = t;
+    worker.ixbuf   = &(m_ixbufs[t * 3 * dim]);
+    worker.level_boxes.resize(m_ofnum+1);
+    for(int i=0; i<m_ofnum+1; i++)
+      worker.node_box.push_back(nodeBox[i]->copy());
+  }
+
+  m_pool.run(threads, workerEntry, this);
+
+  mergeSubtreeResults();
+  solvePost();
+
+  return(true);
+#endif
+}
+
+//---------------------------------------------------------------
+// Procedure: runWorker
+//   Purpose: Search as the given worker until no subtrees remain.
+
+void IvPProblem_Par::runWorker(unsigned int index)
+{
+  if(index < m_workers.size())
+    workerLoop(m_workers[index]);
+}
+
+//---------------------------------------------------------------
+// Procedure: clearWorkers
+
+void IvPProblem_Par::clearWorkers()
+{
+  for(unsigned int t=0; t<m_workers.size(); t++) {
+    for(unsigned int i=0; i<m_workers[t].node_box.size(); i++)
+      delete(m_workers[t].node_box[i]);
+  }
+  m_workers.clear();
+}
+
+//---------------------------------------------------------------
+// Procedure: workerLoop
+//   Purpose: Claim and search subtrees until none remain.
+
+void IvPProblem_Par::workerLoop(IvPParWorker& worker)
+{
+  int ix = claimNextSubtree();
+  while(ix < m_subtree_count) {
+    solveSubtree(ix, worker);
+    ix = claimNextSubtree();
+  }
+}
+
+//---------------------------------------------------------------
+// Procedure: solveSubtree
+
+void IvPProblem_Par::solveSubtree(int ix, IvPParWorker& worker)
+{
+  worker.have_local = false;
+  worker.local_wt   = 0;
+  worker.local_box  = 0;
+
+  IvPBox *root = worker.node_box[1];
+  root->copy(m_ofs[0]->getPDMap()->bx(ix));
+
+  double upperBound = upperCheapBoundMT(1, root, worker);
+  if(upperBound < getSharedBound())
+    return;
+  if(m_maxbox && (upperBound <= (m_maxwt + m_epsilon)))
+    return;
+
+  solveRecurseMT(1, worker);
+
+  if(worker.have_local) {
+    m_subtree_wt[ix]  = worker.local_wt;
+    m_subtree_box[ix] = worker.local_box;
+  }
+}
+
+//---------------------------------------------------------------
+// Procedure: solveRecurseMT
+//   Purpose: Same search as IvPProblem::solveRecurse(), but on the
+//            worker's own node boxes and candidate lists. Pruning 
+//            uses the subtree's own incumbent (as the serial solver
+//            would) and, strictly, the bound shared by all workers.
+
+void IvPProblem_Par::solveRecurseMT(int level, IvPParWorker& worker)
+{
+  vector<IvPBox*>& node_box = worker.node_box;
+
+  if(level == m_ofnum) {
+    bool   ok = false;
+    double currWT = compactor->maxVal(node_box[level], &ok);
+    if(!ok || (currWT < getSharedBound()))
+      return;
+    if(m_maxbox && (currWT <= (m_maxwt + m_epsilon)))
+      return;
+    if(!worker.have_local || (currWT > (worker.local_wt + m_epsilon))) {
+      if(!worker.local_box)
+	worker.local_box = node_box[level]->copy();
+      else
+	worker.local_box->copy(node_box[level]);
+      worker.local_wt   = currWT;
+      worker.have_local = true;
+      raiseSharedBound(currWT);
+    }
+    return;
+  }
+  
+  IvPGrid *grid = m_ofs[level]->getPDMap()->getGrid();
+  vector<IvPBox*>& level_boxes = worker.level_boxes[level];
+  grid->getBoxes(node_box[level], level_boxes, worker.ixbuf);
+
+  unsigned int i, vsize = level_boxes.size();
+  for(i=0; i<vsize; i++) {
+    IvPBox *cbox = level_boxes[i];
+    bool result = node_box[level]->intersect(cbox, node_box[level+1]);
+    if(result) {
+      double upperBound = upperCheapBoundMT(level+1, node_box[level+1],
+					    worker);
+      bool prune = (upperBound < getSharedBound());
+      if(m_maxbox && (upperBound <= (m_maxwt + m_epsilon)))
+	prune = true;
+      if(worker.have_local && 
+	 (upperBound <= (worker.local_wt + m_epsilon)))
+	prune = true;
+      if(!prune)
+	solveRecurseMT(level+1, worker);
+    }
+  }
+}
+
+//---------------------------------------------------------------
+// Procedure: upperCheapBoundMT
+
+double IvPProblem_Par::upperCheapBoundMT(int level, IvPBox *box, 
+					 IvPParWorker& worker)
+{
+  double bound = box->maxVal();
+
+  for(int i=level; (i < m_ofnum); i++) {
+    IvPGrid *grid = m_ofs[i]->getPDMap()->getGrid();
+    bound += grid->getCheapBound(box, worker.ixbuf);
+  }
+
+  return(bound);
+}
+
+//---------------------------------------------------------------
+// Procedure: raiseSharedBound
+//   Purpose: Raise the shared bound to the given value unless some
+//            other worker has already raised it higher.
+
+void IvPProblem_Par::raiseSharedBound(double wt)
+{
+  double curr = getSharedBound();
+  while(wt > curr) {
+    if(__atomic_compare_exchange(&m_shared_wt, &curr, &wt, false,
+				 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+      return;
+  }
+}
+
+//---------------------------------------------------------------
+// Procedure: getSharedBound
+
+double IvPProblem_Par::getSharedBound() const
+{
+  double curr;
+  __atomic_load(&m_shared_wt, &curr, __ATOMIC_ACQUIRE);
+  return(curr);
+}
+
+//---------------------------------------------------------------
+// Procedure: claimNextSubtree
+
+int IvPProblem_Par::claimNextSubtree()
+{
+  return(__sync_fetch_and_add(&m_next_subtree, 1));
+}
+
+//---------------------------------------------------------------
+// Procedure: mergeSubtreeResults
+//   Purpose: Visit subtree results in the order the serial solver
+//            would have found them, applying the same accept rule.
+
+void IvPProblem_Par::mergeSubtreeResults()
+{
+  for(int i=0; i<m_subtree_count; i++) {
+    IvPBox *sbox = m_subtree_box[i];
+    if(sbox) {
+      double swt = m_subtree_wt[i];
+      if((m_maxbox==0) || (swt > (m_maxwt + m_epsilon)))
+	newSolution(swt, sbox);
+    }
+  }
+  clearSubtreeResults();
+}
+
+//---------------------------------------------------------------
+// Procedure: clearSubtreeResults
+
+void IvPProblem_Par::clearSubtreeResults()
+{
+  for(unsigned int i=0; i<m_subtree_box.size(); i++)
+    delete(m_subtree_box[i]);
+  m_subtree_box.clear();
+  m_subtree_wt.clear();
+  m_subtree_count = 0;
+}
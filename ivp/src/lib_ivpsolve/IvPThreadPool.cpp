@@ -0,0 +1,192 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: IvPThreadPool.cpp                                    */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include "IvPThreadPool.h"
+
+using namespace std;
+
+//---------------------------------------------------------------
+// Procedure: threadEntry
+//   Purpose: pthread entry point. Hands the thread to its pool.
+
+#ifndef _WIN32
+static void *threadEntry(void *arg)
+{
+  IvPPoolThread *thread = (IvPPoolThread*)(arg);
+  thread->pool->threadLoop(*thread);
+  return(0);
+}
+#endif
+
+//---------------------------------------------------------------
+// Procedure: Constructor
+
+IvPThreadPool::IvPThreadPool()
+{
+  m_generation = 0;
+  m_workers    = 0;
+  m_busy       = 0;
+  m_quit       = false;
+  m_work_fn    = 0;
+  m_work_arg   = 0;
+#ifndef _WIN32
+  pthread_mutex_init(&m_mutex, 0);
+  pthread_cond_init(&m_start, 0);
+  pthread_cond_init(&m_done, 0);
+#endif
+}
+
+//---------------------------------------------------------------
+// Procedure: Destructor
+
+IvPThreadPool::~IvPThreadPool()
+{
+  stop();
+#ifndef _WIN32
+  pthread_cond_destroy(&m_done);
+  pthread_cond_destroy(&m_start);
+  pthread_mutex_destroy(&m_mutex);
+#endif
+}
+
+//---------------------------------------------------------------
+// Procedure: start
+//   Purpose: Make sure the pool has threads enough for the given
+//            number of workers, counting the calling thread.
+//   Returns: The number of workers that can run, which is fewer
+//            than asked for if a thread could not be started.
+
+unsigned int IvPThreadPool::start(unsigned int workers)
+{
+#ifndef _WIN32
+  while((m_threads.size() + 1) < workers) {
+    IvPPoolThread *thread = new IvPPoolThread;
+    thread->pool  = this;
+    thread->index = m_threads.size() + 1;
+    thread->seen  = m_generation;
+    if(pthread_create(&(thread->tid), 0, threadEntry, thread) != 0) {
+      delete(thread);
+      break;
+    }
+    m_threads.push_back(thread);
+  }
+#endif
+  if(workers > (m_threads.size() + 1))
+    workers = m_threads.size() + 1;
+  return(workers);
+}
+
+//---------------------------------------------------------------
+// Procedure: run
+//   Purpose: Release the pool threads on a new run, run worker zero
+//            on the calling thread, and wait for every pool thread
+//            to be done before returning.
+//      Note: Workers beyond those started by start() are not run.
+
+void IvPThreadPool::run(unsigned int workers, IvPPoolWorkFn fn, void *arg)
+{
+  if((workers == 0) || (fn == 0))
+    return;
+
+#ifndef _WIN32
+  pthread_mutex_lock(&m_mutex);
+  m_work_fn  = fn;
+  m_work_arg = arg;
+  m_workers  = workers;
+  m_busy     = m_threads.size();
+  m_generation++;
+  pthread_cond_broadcast(&m_start);
+  pthread_mutex_unlock(&m_mutex);
+
+  fn(arg, 0);
+
+  pthread_mutex_lock(&m_mutex);
+  while(m_busy > 0)
+    pthread_cond_wait(&m_done, &m_mutex);
+  pthread_mutex_unlock(&m_mutex);
+#else
+  fn(arg, 0);
+#endif
+}
+
+//---------------------------------------------------------------
+// Procedure: threadLoop
+//   Purpose: Wait for a run to begin, run as this thread's worker
+//            if it is in use, report done, and wait again. Returns
+//            when the pool is stopped.
+
+void IvPThreadPool::threadLoop(IvPPoolThread& thread)
+{
+#ifndef _WIN32
+  while(1) {
+    pthread_mutex_lock(&m_mutex);
+    while(!m_quit && (thread.seen == m_generation))
+      pthread_cond_wait(&m_start, &m_mutex);
+    if(m_quit) {
+      pthread_mutex_unlock(&m_mutex);
+      return;
+    }
+    thread.seen = m_generation;
+    bool in_use = (thread.index < m_workers);
+    IvPPoolWorkFn fn  = m_work_fn;
+    void         *arg = m_work_arg;
+    pthread_mutex_unlock(&m_mutex);
+
+    if(in_use)
+      fn(arg, thread.index);
+
+    pthread_mutex_lock(&m_mutex);
+    m_busy--;
+    if(m_busy == 0)
+      pthread_cond_signal(&m_done);
+    pthread_mutex_unlock(&m_mutex);
+  }
+#endif
+}
+
+//---------------------------------------------------------------
+// Procedure: stop
+//   Purpose: Stop and join the pool threads. A later start() makes
+//            new ones.
+//      Note: Only called with no run under way.
+
+void IvPThreadPool::stop()
+{
+#ifndef _WIN32
+  pthread_mutex_lock(&m_mutex);
+  m_quit = true;
+  pthread_cond_broadcast(&m_start);
+  pthread_mutex_unlock(&m_mutex);
+
+  for(unsigned int t=0; t<m_threads.size(); t++) {
+    pthread_join(m_threads[t]->tid, 0);
+    delete(m_threads[t]);
+  }
+
+  pthread_mutex_lock(&m_mutex);
+  m_quit = false;
+  pthread_mutex_unlock(&m_mutex);
+#endif
+  m_threads.clear();
+}
@@ -0,0 +1,87 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: IvPThreadPool.h                                      */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of IvP Helm Core Libs                       */
+/*                                                               */
+/* IvP Helm Core Libs is free software: you can redistribute it  */
+/* and/or modify it under the terms of the Lesser GNU General    */
+/* Public License as published by the Free Software Foundation,  */
+/* either version 3 of the License, or (at your option) any      */
+/* later version.                                                */
+/*                                                               */
+/* IvP Helm Core Libs is distributed in the hope that it will    */
+/* be useful but WITHOUT ANY WARRANTY; without even the implied  */
+/* warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR       */
+/* PURPOSE. See the Lesser GNU General Public License for more   */
+/* details.                                                      */
+/*                                                               */
+/* You should have received a copy of the Lesser GNU General     */
+/* Public License along with MOOS-IvP.  If not, see              */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef IVP_THREAD_POOL_HEADER
+#define IVP_THREAD_POOL_HEADER
+
+#include <vector>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+class IvPThreadPool;
+
+// The function run by each worker, given the caller's argument and
+// the worker index, zero being the calling thread.
+typedef void (*IvPPoolWorkFn)(void*, unsigned int);
+
+// One thread of the pool. It lives as long as the pool and runs
+// as the worker of the same index on each run.
+class IvPPoolThread {
+public:
+  IvPPoolThread() {pool=0; index=0; seen=0;}
+
+  IvPThreadPool*  pool;
+  unsigned int    index;
+  unsigned long   seen;     // Last run generation handled
+#ifndef _WIN32
+  pthread_t       tid;
+#endif
+};
+
+// Threads are started as first needed and kept until the pool is
+// stopped or deleted. On each run the calling thread is worker zero
+// and pool thread i runs worker i, if i is in use. On a platform
+// without pthreads the calling thread is the only worker.
+class IvPThreadPool {
+public:
+  IvPThreadPool();
+  ~IvPThreadPool();
+
+  unsigned int start(unsigned int workers);
+  void         run(unsigned int workers, IvPPoolWorkFn, void*);
+  void         stop();
+
+  unsigned int size() const {return(m_threads.size());}
+
+  // Public only so the thread entry point can reach it.
+  void   threadLoop(IvPPoolThread&);
+
+protected:
+  std::vector<IvPPoolThread*> m_threads;
+#ifndef _WIN32
+  pthread_mutex_t m_mutex;
+  pthread_cond_t  m_start;      // Signalled when a run begins
+  pthread_cond_t  m_done;       // Signalled as threads finish
+#endif
+  unsigned long   m_generation;
+  unsigned int    m_workers;    // Workers in use this run
+  unsigned int    m_busy;       // Pool threads not yet finished
+  bool            m_quit;
+
+  IvPPoolWorkFn   m_work_fn;
+  void*           m_work_arg;
+};
+
+#endif
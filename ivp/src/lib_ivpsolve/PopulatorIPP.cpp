@@ -9,6 +9,7 @@
 #include <cstdlib>
 #include <cstdio>
 #include "PopulatorIPP.h"
+#include "IvPProblem_Par.h"
 #include "MBUtils.h"
 #include "BuildUtils.h"
 #include "FunctionEncoder.h"
@@ -34,7 +35,10 @@ bool PopulatorIPP::populate(string filename)
 
   if(m_ivp_problem)
     delete(m_ivp_problem);
-  m_ivp_problem = new IvPProblem;
+  if(m_threads > 1)
+    m_ivp_problem = new IvPProblem_Par(m_threads);
+  else
+    m_ivp_problem = new IvPProblem;
 
   vector<string> svector = fileBuffer(filename);
     
@@ -14,11 +14,12 @@
 class PopulatorIPP
 {
 public:
-  PopulatorIPP() {m_ivp_problem=0;}
+  PopulatorIPP() {m_ivp_problem=0; m_threads=1;}
   ~PopulatorIPP() {}
   
   bool populate(std::string filename);
   void setVerbose(bool v) {m_verbose=v;}
+  void setThreads(unsigned int v) {m_threads=v;}
 
   IvPProblem* getIvPProblem() {return(m_ivp_problem);}
 
@@ -26,7 +27,8 @@ protected:
   bool handleLine(std::string);
   
 protected:
-  IvPProblem* m_ivp_problem;
-  bool        m_verbose;
+  IvPProblem*  m_ivp_problem;
+  bool         m_verbose;
+  unsigned int m_threads;
 };
 #endif
@@ -93,7 +93,36 @@ void Problem::clearIPFs()
       delete(m_ofs[i]);
     delete[] m_ofs;
   }
-  m_ofs = 0;
+  m_ofs   = 0;
+  m_ofnum = 0;
+}
+
+//---------------------------------------------------------------
+// Procedure: releaseIPFs
+//   Purpose: Remove all IvP functions from the problem without 
+//            deleting them, regardless of how m_owner_ofs is set.
+//            Used when the functions are owned and re-used by the
+//            caller across several problems.
+
+void Problem::releaseIPFs()
+{
+  if(m_ofs)
+    delete[] m_ofs;
+  m_ofs   = 0;
+  m_ofnum = 0;
+}
+
+//---------------------------------------------------------------
+// Procedure: clearSolution
+//   Purpose: Forget the current best solution so the problem may
+//            be solved again, e.g., with a new set of functions.
+
+void Problem::clearSolution()
+{
+  if(m_maxbox)
+    delete(m_maxbox);
+  m_maxbox = 0;
+  m_maxwt  = 0;
 }
 
 
@@ -104,8 +133,11 @@ void Problem::clearIPFs()
 //      NOTE: Applies the priority weight of the given objective 
 //            function to itself. Previously done in 
 //            Problem::prepPWT().
+//      NOTE: If prepared is true, the function has already been
+//            normalized and weighted, e.g., by an earlier problem,
+//            and is added as is.
 
-void Problem::addOF(IvPFunction *gof)
+void Problem::addOF(IvPFunction *gof, bool prepared)
 {
   if(gof==0) return;
 
@@ -113,12 +145,14 @@ void Problem::addOF(IvPFunction *gof)
   // positive priority weight.
   if(gof->getPWT() <= 0) return;
 
-  double range = gof->getPDMap()->getMaxWT() - gof->getPDMap()->getMinWT();
-  if(range > 100)
-    gof->getPDMap()->normalize(0,100);
+  if(!prepared) {
+    double range = gof->getPDMap()->getMaxWT() - gof->getPDMap()->getMinWT();
+    if(range > 100)
+      gof->getPDMap()->normalize(0,100);
 
-  // Apply the priority weight to the OF
-  gof->getPDMap()->applyWeight(gof->getPWT());
+    // Apply the priority weight to the OF
+    gof->getPDMap()->applyWeight(gof->getPWT());
+  }
 
 
   IvPFunction** newOFs = new IvPFunction*[m_ofnum+1];
@@ -49,9 +49,11 @@ public:    // Virtual Function
   virtual bool solve(const IvPBox *b=0) = 0;
 
   void   setDomain(IvPDomain);
-  void   addOF(IvPFunction*);
+  void   addOF(IvPFunction*, bool prepared=false);
   void   setOwnerIPFs(bool v)    {m_owner_ofs = v;}
   void   clearIPFs();
+  void   releaseIPFs();
+  void   clearSolution();
   bool   alignOFs();
   int    getDim();
   int    getOFNUM() const        {return(m_ofnum);}
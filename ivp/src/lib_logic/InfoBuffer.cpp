@@ -35,11 +35,10 @@ using namespace std;
 
 double InfoBuffer::dQuery(string var, bool& result) const
 {
-  map<string, double>::const_iterator p2;
-  p2 = dmap.find(var);
-  if(p2 != dmap.end()) {
+  const InfoBufferEntry *entry = findEntry(var);
+  if(entry && entry->dval_set) {
     result = true;
-    return(p2->second);
+    return(entry->dval);
   }
   
   // If all fails, return ZERO and indicate failure.  
@@ -54,13 +53,12 @@ double InfoBuffer::dQuery(string var, bool& result) const
 
 double InfoBuffer::tQuery(string var, bool elapsed) const
 {
-  map<string, double>::const_iterator p2;
-  p2 = tmap.find(var);
-  if(p2 != tmap.end()) {
+  const InfoBufferEntry *entry = findEntry(var);
+  if(entry && entry->time_set) {
     if(elapsed)
-      return(m_curr_time_utc - p2->second);
+      return(m_curr_time_utc - entry->time);
     else
-      return(p2->second);
+      return(entry->time);
   }
   else
     return(-1);
@@ -73,13 +71,12 @@ double InfoBuffer::tQuery(string var, bool elapsed) const
 
 double InfoBuffer::mtQuery(string var, bool elapsed) const
 {
-  map<string, double>::const_iterator p;
-  p = mtmap.find(var);
-  if(p != mtmap.end()) {
+  const InfoBufferEntry *entry = findEntry(var);
+  if(entry && entry->time_set) {
     if(elapsed)
-      return(m_curr_time_utc - p->second);
+      return(m_curr_time_utc - entry->msg_time);
     else
-      return(p->second);
+      return(entry->msg_time);
   }
   else
     return(-1);
@@ -90,11 +87,10 @@ double InfoBuffer::mtQuery(string var, bool elapsed) const
 
 string InfoBuffer::sQuery(string var, bool& result) const
 {
-  map<string, string>::const_iterator p2;
-  p2 = smap.find(var);
-  if(p2 != smap.end()) {
+  const InfoBufferEntry *entry = findEntry(var);
+  if(entry && entry->sval_set) {
     result = true;
-    return(p2->second);
+    return(entry->sval);
   }
   
   // If all fails, return empty string and indicate failure.
@@ -111,11 +107,10 @@ vector<string> InfoBuffer::sQueryDeltas(string var, bool& result) const
   vector<string> empty_vector;
   
   // Find the vector associated with the given variable name
-  map<string, vector<string> >::const_iterator p2;
-  p2 = vsmap.find(var);
-  if(p2 != vsmap.end()) {
+  const InfoBufferEntry *entry = findEntry(var);
+  if(entry && (entry->sdeltas.size() > 0)) {
     result = true;
-    return(p2->second);
+    return(entry->sdeltas);
   }
   
   // If all fails, return empty vector and indicate failure.
@@ -132,11 +127,10 @@ vector<double> InfoBuffer::dQueryDeltas(string var, bool& result) const
   vector<double> empty_vector;
   
   // Find the vector associated with the given variable name
-  map<string, vector<double> >::const_iterator p2;
-  p2 = vdmap.find(var);
-  if(p2 != vdmap.end()) {
+  const InfoBufferEntry *entry = findEntry(var);
+  if(entry && (entry->ddeltas.size() > 0)) {
     result = true;
-    return(p2->second);
+    return(entry->ddeltas);
   }
   
   // If all fails, return empty vector and indicate failure.
@@ -149,117 +143,296 @@ vector<double> InfoBuffer::dQueryDeltas(string var, bool& result) const
 //   Purpose: Check whether the given variable was ever posted
 //            to the info buffer. Regardless of whether it was
 //            posted as a string or a double, it is registered
-//            in the mapping from varname to timestamp.
+//            with a timestamp.
               
 bool InfoBuffer::isKnown(string varname)
 {
-  map<string, double>::iterator p=tmap.find(varname);
-  if(p != tmap.end())
+  const InfoBufferEntry *entry = findEntry(varname);
+  if(entry && entry->time_set)
     return(true);
 
   return(false);
 }
 
 //-----------------------------------------------------------
-// Procedure: setValue
-//      Note: msg_time is the timestamp embedded in the incoming 
-//            message, vs. the time stamp of when this buffer is 
-//            beig updated.
+// Procedure: getVarID
+//   Purpose: Intern the given variable name. The ID is good for the
+//            life of the buffer, whether or not the variable has
+//            been posted yet.
 
-bool InfoBuffer::setValue(string var, double val, double msg_time)
+unsigned int InfoBuffer::getVarID(const string& var)
 {
-  dmap[var] = val;
-  tmap[var] = m_curr_time_utc;
-
-  // msg_time is the timestamp perhaps embedded in the incoming message, 
-  // vs. the buffer update time (the time at which the info_buffer is 
-  // undergoing a round of updates. If msg_time is unspecified (0) then 
-  // set it to the buffer update time.
-  if(msg_time == 0)
-    msg_time = m_curr_time_utc;
-  mtmap[var] = msg_time;
+  map<string, unsigned int>::const_iterator p = m_var_ids.find(var);
+  if(p != m_var_ids.end())
+    return(p->second);
+
+  InfoBufferEntry entry;
+  entry.name     = var;
+  entry.dval     = 0;
+  entry.time     = 0;
+  entry.msg_time = 0;
+  entry.sval_set = false;
+  entry.dval_set = false;
+  entry.time_set = false;
+  entry.change_iter    = 0;
+  entry.on_change_list = false;
+
+  unsigned int id = m_entries.size();
+  m_entries.push_back(entry);
+  m_var_ids[var] = id;
+  return(id);
+}
 
-  vdmap[var].push_back(val);
+//-----------------------------------------------------------
+// Procedure: findVarID
+//   Returns: true, with the ID, if the given name was interned. Does
+//            not intern the name.
 
+bool InfoBuffer::findVarID(const string& var, unsigned int& id) const
+{
+  map<string, unsigned int>::const_iterator p = m_var_ids.find(var);
+  if(p == m_var_ids.end())
+    return(false);
+  id = p->second;
   return(true);
 }
 
 //-----------------------------------------------------------
-// Procedure: setValue
+// Procedure: getVarName
 
-bool InfoBuffer::setValue(string var, string val, double msg_time)
+string InfoBuffer::getVarName(unsigned int id) const
 {
-  smap[var] = val;
-  tmap[var] = m_curr_time_utc;
+  if(id >= m_entries.size())
+    return("");
+  return(m_entries[id].name);
+}
 
-  // msg_time is the timestamp perhaps embedded in the incoming message, 
-  // vs. the buffer update time (the time at which the info_buffer is 
-  // undergoing a round of updates. If msg_time is unspecified (0) then 
-  // set it to the buffer update time.
-  if(msg_time == 0)
-    msg_time = m_curr_time_utc;
-  mtmap[var] = msg_time;
+//-----------------------------------------------------------
+// Procedure: sQuery
 
-  vsmap[var].push_back(val);
+string InfoBuffer::sQuery(unsigned int id, bool& result) const
+{
+  result = ((id < m_entries.size()) && m_entries[id].sval_set);
+  if(!result)
+    return("");
+  return(m_entries[id].sval);
+}
 
-  return(true);
+//-----------------------------------------------------------
+// Procedure: dQuery
+
+double InfoBuffer::dQuery(unsigned int id, bool& result) const
+{
+  result = ((id < m_entries.size()) && m_entries[id].dval_set);
+  if(!result)
+    return(0.0);
+  return(m_entries[id].dval);
 }
 
 //-----------------------------------------------------------
-// Procedure: clearDeltaVectors
+// Procedure: tQuery
 
-void InfoBuffer::clearDeltaVectors()
+double InfoBuffer::tQuery(unsigned int id, bool elapsed) const
 {
-  vsmap.clear();
-  vdmap.clear();
+  if(!isKnown(id))
+    return(-1);
+  if(elapsed)
+    return(m_curr_time_utc - m_entries[id].time);
+  return(m_entries[id].time);
 }
 
 //-----------------------------------------------------------
-// Procedure: print
+// Procedure: mtQuery
 
-void InfoBuffer::print() const
+double InfoBuffer::mtQuery(unsigned int id, bool elapsed) const
 {
-  cout << "InfoBuffer: " << endl;
-  cout << " curr_time_utc:" << m_curr_time_utc << endl;
-  
-  cout << "-----------------------------------------------" << endl; 
-  cout << " String Data: " << endl;
-  map<string, string>::const_iterator ps;
-  for(ps=smap.begin(); ps!=smap.end(); ps++)
-    cout << "  " << ps->first << ": " << ps->second << endl;
-  
-  cout << "-----------------------------------------------" << endl; 
-  cout << " Numerical Data: " << endl;
-  map<string, double>::const_iterator pd;
-  for(pd=dmap.begin(); pd!=dmap.end(); pd++) 
-    cout << "  " << pd->first << ": " << pd->second << endl;
-  
-  cout << "-----------------------------------------------" << endl; 
-  cout << " Time Data: " << endl;
-  map<string, double>::const_iterator pt;
-  for(pt=tmap.begin(); pt!=tmap.end(); pt++) {
-    cout << "  " << pt->first << ": " << m_curr_time_utc - pt->second << endl;
-  }
+  if(!isKnown(id))
+    return(-1);
+  if(elapsed)
+    return(m_curr_time_utc - m_entries[id].msg_time);
+  return(m_entries[id].msg_time);
+}
+
+//-----------------------------------------------------------
+// Procedure: isKnown
+
+bool InfoBuffer::isKnown(unsigned int id) const
+{
+  return((id < m_entries.size()) && m_entries[id].time_set);
+}
+
+//-----------------------------------------------------------
+// Procedure: sQueryDeltas
+//      Note: The returned vector is empty if there are no deltas,
+//            and is only good until the buffer is next changed.
+
+const vector<string>& InfoBuffer::sQueryDeltas(unsigned int id) const
+{
+  static const vector<string> empty_vector;
+  if(id >= m_entries.size())
+    return(empty_vector);
+  return(m_entries[id].sdeltas);
+}
+
+//-----------------------------------------------------------
+// Procedure: dQueryDeltas
+
+const vector<double>& InfoBuffer::dQueryDeltas(unsigned int id) const
+{
+  static const vector<double> empty_vector;
+  if(id >= m_entries.size())
+    return(empty_vector);
+  return(m_entries[id].ddeltas);
+}
+
+//-----------------------------------------------------------
+// Procedure: changedSince
+//   Returns: true if the variable was set on or after the given
+//            iteration, as given by getIteration().
+
+bool InfoBuffer::changedSince(unsigned int id, unsigned int iter) const
+{
+  if(!isKnown(id))
+    return(false);
+  return(m_entries[id].change_iter >= iter);
+}
+
+//-----------------------------------------------------------
+// Procedure: setValue
+//      Note: msg_time is the timestamp embedded in the incoming 
+//            message, vs. the time stamp of when this buffer is 
+//            beig updated.
+
+bool InfoBuffer::setValue(string var, double val, double msg_time)
+{
+  return(setValue(getVarID(var), val, msg_time));
 }
 
+//-----------------------------------------------------------
+// Procedure: setValue
 
+bool InfoBuffer::setValue(string var, string val, double msg_time)
+{
+  return(setValue(getVarID(var), val, msg_time));
+}
 
+//-----------------------------------------------------------
+// Procedure: setValue
 
+bool InfoBuffer::setValue(unsigned int id, double val, double msg_time)
+{
+  if(id >= m_entries.size())
+    return(false);
 
+  InfoBufferEntry& entry = m_entries[id];
+  entry.dval     = val;
+  entry.dval_set = true;
+  entry.ddeltas.push_back(val);
 
+  noteChange(id, msg_time);
+  return(true);
+}
 
+//-----------------------------------------------------------
+// Procedure: setValue
 
+bool InfoBuffer::setValue(unsigned int id, const string& val, 
+			  double msg_time)
+{
+  if(id >= m_entries.size())
+    return(false);
 
+  InfoBufferEntry& entry = m_entries[id];
+  entry.sval     = val;
+  entry.sval_set = true;
+  entry.sdeltas.push_back(val);
 
+  noteChange(id, msg_time);
+  return(true);
+}
 
+//-----------------------------------------------------------
+// Procedure: clearDeltaVectors
+//      Note: Only the variables changed since the last clearing 
+//            can have deltas. Also begins the next iteration.
 
+void InfoBuffer::clearDeltaVectors()
+{
+  for(unsigned int i=0; i<m_changed_ids.size(); i++) {
+    InfoBufferEntry& entry = m_entries[m_changed_ids[i]];
+    entry.sdeltas.clear();
+    entry.ddeltas.clear();
+    entry.on_change_list = false;
+  }
+  m_changed_ids.clear();
+  m_iteration++;
+}
 
+//-----------------------------------------------------------
+// Procedure: findEntry
+//   Returns: The entry of the named variable, or null if the name 
+//            was never interned. Does not intern the name.
 
+const InfoBufferEntry* InfoBuffer::findEntry(const string& var) const
+{
+  map<string, unsigned int>::const_iterator p = m_var_ids.find(var);
+  if(p == m_var_ids.end())
+    return(0);
+  return(&(m_entries[p->second]));
+}
 
+//-----------------------------------------------------------
+// Procedure: noteChange
 
+void InfoBuffer::noteChange(unsigned int id, double msg_time)
+{
+  InfoBufferEntry& entry = m_entries[id];
+  entry.time     = m_curr_time_utc;
+  entry.time_set = true;
 
+  // msg_time is the timestamp perhaps embedded in the incoming message, 
+  // vs. the buffer update time (the time at which the info_buffer is 
+  // undergoing a round of updates. If msg_time is unspecified (0) then 
+  // set it to the buffer update time.
+  if(msg_time == 0)
+    msg_time = m_curr_time_utc;
+  entry.msg_time = msg_time;
 
+  entry.change_iter = m_iteration;
+  if(!entry.on_change_list) {
+    entry.on_change_list = true;
+    m_changed_ids.push_back(id);
+  }
+}
 
+//-----------------------------------------------------------
+// Procedure: print
 
+void InfoBuffer::print() const
+{
+  cout << "InfoBuffer: " << endl;
+  cout << " curr_time_utc:" << m_curr_time_utc << endl;
 
+  // Walk the names, not the entries, to list them in sorted order 
+  map<string, unsigned int>::const_iterator p;
 
+  cout << "-----------------------------------------------" << endl; 
+  cout << " String Data: " << endl;
+  for(p=m_var_ids.begin(); p!=m_var_ids.end(); p++)
+    if(m_entries[p->second].sval_set)
+      cout << "  " << p->first << ": " << m_entries[p->second].sval << endl;
+  
+  cout << "-----------------------------------------------" << endl; 
+  cout << " Numerical Data: " << endl;
+  for(p=m_var_ids.begin(); p!=m_var_ids.end(); p++)
+    if(m_entries[p->second].dval_set)
+      cout << "  " << p->first << ": " << m_entries[p->second].dval << endl;
+  
+  cout << "-----------------------------------------------" << endl; 
+  cout << " Time Data: " << endl;
+  for(p=m_var_ids.begin(); p!=m_var_ids.end(); p++) {
+    const InfoBufferEntry& entry = m_entries[p->second];
+    if(entry.time_set)
+      cout << "  " << p->first << ": " << m_curr_time_utc - entry.time << endl;
+  }
+}
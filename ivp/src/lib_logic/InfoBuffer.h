@@ -27,11 +27,29 @@
 #include <string>
 #include <vector>
 #include <map>
-#include "InfoBuffer.h"
+
+// All that is known of one variable. A variable may hold both a
+// string and a double value if posted with both types.
+struct InfoBufferEntry
+{
+  std::string  name;
+  std::string  sval;
+  double       dval;
+  double       time;       // Buffer time of the last update
+  double       msg_time;   // Message time of the last update
+  bool         sval_set;
+  bool         dval_set;
+  bool         time_set;   // Ever posted, as either type
+  unsigned int change_iter;
+  bool         on_change_list;
+
+  std::vector<std::string> sdeltas;
+  std::vector<double>      ddeltas;
+};
 
 class InfoBuffer {
 public:
-  InfoBuffer()  {m_curr_time_utc=0;}
+  InfoBuffer()  {m_curr_time_utc=0; m_iteration=0;}
   ~InfoBuffer() {}
 
 public:
@@ -48,28 +66,51 @@ public:
   bool   isKnown(std::string);
   void   print() const;
 
+public: // Queries by the ID of an interned variable name
+  unsigned int getVarID(const std::string&);
+  bool         findVarID(const std::string&, unsigned int& id) const;
+  std::string  getVarName(unsigned int id) const;
+  unsigned int getVarCount() const {return(m_entries.size());}
+
+  std::string sQuery(unsigned int id, bool&) const;
+  double      dQuery(unsigned int id, bool&) const;
+  double      tQuery(unsigned int id, bool elapsed=true) const;
+  double      mtQuery(unsigned int id, bool elapsed=true) const;
+  bool        isKnown(unsigned int id) const;
+
+  const std::vector<std::string>& sQueryDeltas(unsigned int id) const;
+  const std::vector<double>&      dQueryDeltas(unsigned int id) const;
+
+  // Change tracking. The iteration advances each time the deltas 
+  // are cleared. A variable changed since iteration N if it was set
+  // on or after iteration N.
+  unsigned int getIteration() const   {return(m_iteration);}
+  bool         changedSince(unsigned int id, unsigned int iter) const;
+  const std::vector<unsigned int>& getChangedIDs() const {return(m_changed_ids);}
+
 public:
   bool   setValue(std::string, double, double msg_time=0);
   bool   setValue(std::string, std::string, double msg_time=0);
+  bool   setValue(unsigned int id, double, double msg_time=0);
+  bool   setValue(unsigned int id, const std::string&, double msg_time=0);
   void   clearDeltaVectors();
   void   setCurrTime(double t)         {m_curr_time_utc = t;}
   double getCurrTime() const           {return(m_curr_time_utc);}
 
 protected:
-  std::map<std::string, std::string> smap;
-  std::map<std::string, double>      dmap;
-  std::map<std::string, double>      tmap;
-  std::map<std::string, double>      mtmap;
+  const InfoBufferEntry* findEntry(const std::string&) const;
+  void   noteChange(unsigned int id, double msg_time);
+
+protected:
+  // No const method writes to the buffer, so it may be queried from
+  // several threads at once provided nothing sets values meanwhile.
+  std::map<std::string, unsigned int> m_var_ids;
+  std::vector<InfoBufferEntry>        m_entries;
 
-  std::map<std::string, std::vector<std::string> >  vsmap;
-  std::map<std::string, std::vector<double> > vdmap;
+  // IDs of the variables set since the deltas were last cleared
+  std::vector<unsigned int> m_changed_ids;
 
-  double m_curr_time_utc;
+  double       m_curr_time_utc;
+  unsigned int m_iteration;
 };
 #endif
-
-
-
-
-
-
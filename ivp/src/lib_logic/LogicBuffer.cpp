@@ -33,6 +33,7 @@ using namespace std;
 LogicBuffer::LogicBuffer()
 {
   m_info_buffer = new InfoBuffer;
+  m_cond_vars_resolved = false;
 }
 
 //-----------------------------------------------------------
@@ -51,8 +52,10 @@ bool LogicBuffer::addNewCondition(const string& str_value)
 {
   LogicCondition new_condition;
   bool ok = new_condition.setCondition(str_value);
-  if(ok)
+  if(ok) {
     m_logic_conditions.push_back(new_condition);
+    m_cond_vars_resolved = false;
+  }
 
   cout << "ok result: " << ok << endl;
   return(ok);
@@ -91,29 +94,44 @@ bool LogicBuffer::checkConditions()
     return(false);
 
   unsigned int i, j, vsize, csize;
-
-  // Phase 1: get all the variable names from all present conditions.
-  vector<string> all_vars;
   csize = m_logic_conditions.size();
-  for(i=0; i<csize; i++) {
-    vector<string> svector = m_logic_conditions[i].getVarNames();
-    all_vars = mergeVectors(all_vars, svector);
+
+  // Phase 1: get all the variable names from all present conditions,
+  // and the index of each in each condition, once per new condition.
+  if(!m_cond_vars_resolved) {
+    vector<string> all_vars;
+    for(i=0; i<csize; i++) {
+      vector<string> svector = m_logic_conditions[i].getVarNames();
+      all_vars = mergeVectors(all_vars, svector);
+    }
+    m_cond_vars = removeDuplicates(all_vars);
+    m_cond_var_ix.clear();
+    for(i=0; i<m_cond_vars.size(); i++) {
+      vector<int> ixs;
+      for(j=0; j<csize; j++)
+	ixs.push_back(m_logic_conditions[j].getVarIndex(m_cond_vars[i]));
+      m_cond_var_ix.push_back(ixs);
+    }
+    m_cond_vars_resolved = true;
   }
-  all_vars = removeDuplicates(all_vars);
 
   // Phase 2: get values of all variables from the info_buffer and 
   // propogate these values down to all the logic conditions.
-  vsize = all_vars.size();
+  vsize = m_cond_vars.size();
   for(i=0; i<vsize; i++) {
-    string varname = all_vars[i];
     bool   ok_s, ok_d;
-    string s_result = m_info_buffer->sQuery(varname, ok_s);
-    double d_result = m_info_buffer->dQuery(varname, ok_d);
-
-    for(j=0; (j<csize)&&(ok_s); j++)
-      m_logic_conditions[j].setVarVal(varname, s_result);
-    for(j=0; (j<csize)&&(ok_d); j++)
-      m_logic_conditions[j].setVarVal(varname, d_result);
+    string s_result = m_info_buffer->sQuery(m_cond_vars[i], ok_s);
+    double d_result = m_info_buffer->dQuery(m_cond_vars[i], ok_d);
+
+    const vector<int>& ixs = m_cond_var_ix[i];
+    for(j=0; j<csize; j++) {
+      if(ixs[j] < 0)
+	continue;
+      if(ok_s)
+	m_logic_conditions[j].setVarValByIx(ixs[j], s_result);
+      if(ok_d)
+	m_logic_conditions[j].setVarValByIx(ixs[j], d_result);
+    }
   }
 
   // Phase 3: evaluate all logic conditions. Return true only if all
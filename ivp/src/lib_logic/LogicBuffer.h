@@ -51,6 +51,12 @@ public:
 
 protected:
   std::vector<LogicCondition> m_logic_conditions;
+
+  // Each variable named in the conditions, and its index in each
+  // condition (-1 if absent), resolved by checkConditions()
+  std::vector<std::string>       m_cond_vars;
+  std::vector<std::vector<int> > m_cond_var_ix;
+  bool                           m_cond_vars_resolved;
   
   InfoBuffer *m_info_buffer;
 };
@@ -22,7 +22,10 @@
 /*****************************************************************/
 
 #include <iostream>
+#include <cstdlib>
 #include "LogicCondition.h"
+#include "LogicUtils.h"
+#include "MBUtils.h"
 
 using namespace std;
 
@@ -34,6 +37,9 @@ LogicCondition::LogicCondition()
 {
   m_node = 0;
   m_allow_dblequals = true;
+
+  m_result_known = false;
+  m_result       = false;
 }
 
 //------------------------------------------------------ 
@@ -56,6 +62,12 @@ LogicCondition::LogicCondition(const LogicCondition &b)
   else
     m_node = 0;
   m_allow_dblequals = true;
+
+  m_vars         = b.m_vars;
+  m_program      = b.m_program;
+  m_stack        = b.m_stack;
+  m_result_known = b.m_result_known;
+  m_result       = b.m_result;
 }
 
 //----------------------------------------------------------------
@@ -63,11 +75,23 @@ LogicCondition::LogicCondition(const LogicCondition &b)
 
 const LogicCondition &LogicCondition::operator=(const LogicCondition &right)
 {
+  if(this == &right)
+    return(*this);
+
+  if(m_node)
+    delete(m_node);
+
   if(right.m_node)
     m_node = right.m_node->copy();
   else 
     m_node = 0;
 
+  m_vars         = right.m_vars;
+  m_program      = right.m_program;
+  m_stack        = right.m_stack;
+  m_result_known = right.m_result_known;
+  m_result       = right.m_result;
+
   return(*this);
 }
 
@@ -77,9 +101,8 @@ const LogicCondition &LogicCondition::operator=(const LogicCondition &right)
 vector<string> LogicCondition::getVarNames() const
 {
   vector<string> rvector;
-  
-  if(m_node)
-    rvector = m_node->recursiveGetVarNames();
+  for(unsigned int i=0; i<m_vars.size(); i++)
+    rvector.push_back(m_vars[i].name);
   
   return(rvector);
 }
@@ -94,6 +117,10 @@ bool LogicCondition::setCondition(const string& str)
     delete(m_node);
     m_node = 0;
   }
+  m_vars.clear();
+  m_program.clear();
+  m_stack.clear();
+  m_result_known = false;
 
   m_node = new ParseNode(str);
 
@@ -113,27 +140,384 @@ bool LogicCondition::setCondition(const string& str)
     return(false);
   }
 
+  return(compile());
+}
+
+//----------------------------------------------------------------
+// Procedure: compile()
+//   Purpose: Flatten the parse tree into a postfix program over a
+//            table of the variables, so an evaluation needs neither
+//            recursion nor string compares to find the relations or
+//            to set the variables. Each variable name gets one entry
+//            since every leaf of a name is always set alike.
+
+bool LogicCondition::compile()
+{
+  m_vars.clear();
+  m_program.clear();
+  if(!m_node)
+    return(false);
+
+  vector<string> names = m_node->recursiveGetVarNames();
+  for(unsigned int i=0; i<names.size(); i++) {
+    LogicVar var;
+    var.name       = names[i];
+    var.dval       = 0;
+    var.sval_isnum = false;
+    var.sval_set   = false;
+    var.dval_set   = false;
+    m_vars.push_back(var);
+  }
+
+  bool ok = compileNode(m_node);
+
+  // The stack never holds more entries than there are instructions
+  m_stack.resize(m_program.size());
+  m_result_known = false;
+  return(ok);
+}
+
+//----------------------------------------------------------------
+// Procedure: compileNode()
+//      Note: Follows ParseNode::recursiveEvaluate() case by case. A
+//            relation whose sides could never be set there always 
+//            evaluates false, and is compiled as such.
+
+bool LogicCondition::compileNode(const ParseNode *node)
+{
+  LogicInstr instr;
+  instr.opcode      = LOP_FALSE;
+  instr.relop       = LREL_NONE;
+  instr.left_var    = 0;
+  instr.right_type  = LOPD_STRING;
+  instr.right_var   = 0;
+  instr.right_dval  = 0;
+  instr.right_isnum = false;
+
+  if(!node)
+    return(false);
+
+  string relation = node->getRelation();
+  const ParseNode *left_node  = node->getLeftNode();
+  const ParseNode *right_node = node->getRightNode();
+
+  if(relation == "not") {
+    if(left_node) {
+      if(!compileNode(left_node))
+	return(false);
+      instr.opcode = LOP_NOT;
+    }
+    m_program.push_back(instr);
+    return(true);
+  }
+
+  if(!left_node || !right_node) {
+    m_program.push_back(instr);
+    return(true);
+  }
+
+  if((relation == "or") || (relation == "and")) {
+    if(!compileNode(left_node) || !compileNode(right_node))
+      return(false);
+    instr.opcode = (relation == "or") ? LOP_OR : LOP_AND;
+    m_program.push_back(instr);
+    return(true);
+  }
+
+  // Handle the LEFT side, which must be a variable to ever be set
+  int left_ix = -1;
+  if(left_node->getRelation() == "variable")
+    left_ix = getVarIndex(left_node->getRawCondition());
+  
+  // Handle the RIGHT side
+  bool   right_ok = true;
+  string right_relation = right_node->getRelation();
+  string right_raw = right_node->getRawCondition();
+  if(right_relation == "string") {
+    instr.right_type = LOPD_STRING;
+    instr.right_sval = right_raw;
+    if(isQuoted(instr.right_sval))
+      instr.right_sval = stripQuotes(instr.right_sval);
+    instr.right_isnum = isNumber(instr.right_sval);
+    if(instr.right_isnum)
+      instr.right_dval = atof(instr.right_sval.c_str());
+  }
+  else if(right_relation == "double") {
+    instr.right_type = LOPD_DOUBLE;
+    instr.right_dval = atof(right_raw.c_str());
+  }
+  else if(right_relation == "variable") {
+    int right_ix = getVarIndex(right_raw);
+    instr.right_type = LOPD_VAR;
+    instr.right_var  = (unsigned int)(right_ix);
+    right_ok = (right_ix >= 0);
+  }
+  else
+    right_ok = false;
+
+  if((left_ix >= 0) && right_ok) {
+    instr.opcode   = LOP_CMP;
+    instr.left_var = (unsigned int)(left_ix);
+    if(relation == "=")
+      instr.relop = LREL_EQ;
+    else if(relation == "==")
+      instr.relop = LREL_FIELD_EQ;
+    else if(relation == "!=")
+      instr.relop = LREL_NE;
+    else if(relation == "<")
+      instr.relop = LREL_LT;
+    else if(relation == "<=")
+      instr.relop = LREL_LE;
+    else if(relation == ">")
+      instr.relop = LREL_GT;
+    else if(relation == ">=")
+      instr.relop = LREL_GE;
+  }
+
+  m_program.push_back(instr);
   return(true);
 }
 
+//----------------------------------------------------------------
+// Procedure: getVarIndex()
+//   Returns: The index of the named variable, or -1.
+
+int LogicCondition::getVarIndex(const string& var) const
+{
+  for(unsigned int i=0; i<m_vars.size(); i++)
+    if(m_vars[i].name == var)
+      return((int)(i));
+  return(-1);
+}
+
+//----------------------------------------------------------------
+// Procedure: clearVarVals()
+
+void LogicCondition::clearVarVals()
+{
+  for(unsigned int i=0; i<m_vars.size(); i++) {
+    m_vars[i].sval       = "";
+    m_vars[i].sval_x     = "";
+    m_vars[i].dval       = 0;
+    m_vars[i].sval_isnum = false;
+    m_vars[i].sval_set   = false;
+    m_vars[i].dval_set   = false;
+  }
+  m_result_known = false;
+}
+
+//----------------------------------------------------------------
+// Procedure: setVarVal()
+
+void LogicCondition::setVarVal(const string& var, const string& val)
+{
+  int ix = getVarIndex(var);
+  if(ix >= 0)
+    setVarValByIx((unsigned int)(ix), val);
+}
+
+//----------------------------------------------------------------
+// Procedure: setVarVal()
+
+void LogicCondition::setVarVal(const string& var, double val)
+{
+  int ix = getVarIndex(var);
+  if(ix >= 0)
+    setVarValByIx((unsigned int)(ix), val);
+}
+
+//----------------------------------------------------------------
+// Procedure: setVarValByIx()
+//      Note: Ok to overwrite a previous string-value, but cannot
+//            overwrite if previously set with a double value. The
+//            last result stands if the value is unchanged.
+
+void LogicCondition::setVarValByIx(unsigned int ix, const string& val)
+{
+  if(ix >= m_vars.size())
+    return;
+
+  LogicVar& var = m_vars[ix];
+  if(var.dval_set || (var.sval_set && (var.sval == val)))
+    return;
+
+  var.sval     = val;
+  var.sval_x   = val;
+  var.sval_set = true;
+  if(isQuoted(var.sval_x))
+    var.sval_x = stripQuotes(var.sval_x);
+  var.sval_isnum = isNumber(var.sval_x);
+  var.dval = 0;
+  if(var.sval_isnum)
+    var.dval = atof(var.sval_x.c_str());
+
+  m_result_known = false;
+}
+
+//----------------------------------------------------------------
+// Procedure: setVarValByIx()
+//      Note: Ok to overwrite a previous double-value, but cannot
+//            overwrite if previously set with a string value. The
+//            last result stands if the value is unchanged.
+
+void LogicCondition::setVarValByIx(unsigned int ix, double val)
+{
+  if(ix >= m_vars.size())
+    return;
+
+  LogicVar& var = m_vars[ix];
+  if(var.sval_set || (var.dval_set && (var.dval == val)))
+    return;
+
+  var.dval     = val;
+  var.dval_set = true;
+
+  m_result_known = false;
+}
 
 //----------------------------------------------------------------
 // Procedure: eval
 
 bool LogicCondition::eval() const
 {
-  if(m_node)
-    return(m_node->recursiveEvaluate());
-  else
+  if(!m_node)
     return(false);
+  if(m_result_known)
+    return(m_result);
+
+  unsigned int top = 0;
+  for(unsigned int i=0; i<m_program.size(); i++) {
+    const LogicInstr& instr = m_program[i];
+    if(instr.opcode == LOP_CMP)
+      m_stack[top++] = evalCompare(instr);
+    else if(instr.opcode == LOP_FALSE)
+      m_stack[top++] = false;
+    else if((instr.opcode == LOP_NOT) && (top > 0))
+      m_stack[top-1] = !m_stack[top-1];
+    else if((instr.opcode == LOP_AND) && (top > 1)) {
+      top--;
+      m_stack[top-1] = (m_stack[top-1] && m_stack[top]);
+    }
+    else if((instr.opcode == LOP_OR) && (top > 1)) {
+      top--;
+      m_stack[top-1] = (m_stack[top-1] || m_stack[top]);
+    }
+  }
+
+  m_result = ((top == 1) && m_stack[0]);
+  m_result_known = true;
+  return(m_result);
 }
-	   
 
-	   
+//----------------------------------------------------------------
+// Procedure: compareDoubles
+
+static bool compareDoubles(LogicRelOp relop, double left, double right)
+{
+  switch(relop) {
+  case LREL_EQ:
+  case LREL_FIELD_EQ:
+    return(left == right);
+  case LREL_NE:
+    return(left != right);
+  case LREL_LT:
+    return(left < right);
+  case LREL_LE:
+    return(left <= right);
+  case LREL_GT:
+    return(left > right);
+  case LREL_GE:
+    return(left >= right);
+  default:
+    return(false);
+  }
+}
+
+//----------------------------------------------------------------
+// Procedure: compareStrings
+
+static bool compareStrings(LogicRelOp relop, const string& left, 
+			   const string& right)
+{
+  switch(relop) {
+  case LREL_EQ:
+    return(left == right);
+  case LREL_FIELD_EQ:
+    return(strFieldMatch(left, right));
+  case LREL_NE:
+    return(left != right);
+  case LREL_LT:
+    return(left < right);
+  case LREL_LE:
+    return(left <= right);
+  case LREL_GT:
+    return(left > right);
+  case LREL_GE:
+    return(left >= right);
+  default:
+    return(false);
+  }
+}
 
+//----------------------------------------------------------------
+// Procedure: evalCompare
+//      Note: Same outcome as ParseNode::evaluate() for each pairing
+//            of string and double sides. Strings are already stripped
+//            of quotes and checked for being numbers.
 
+bool LogicCondition::evalCompare(const LogicInstr& instr) const
+{
+  const LogicVar& left = m_vars[instr.left_var];
+  if(!left.sval_set && !left.dval_set)
+    return(false);
 
+  bool          right_is_string = false;
+  const string *right_sval  = &instr.right_sval;
+  double        right_dval  = instr.right_dval;
+  bool          right_isnum = instr.right_isnum;
+
+  if(instr.right_type == LOPD_STRING)
+    right_is_string = true;
+  else if(instr.right_type == LOPD_VAR) {
+    const LogicVar& right = m_vars[instr.right_var];
+    if(right.sval_set) {
+      right_is_string = true;
+      right_sval  = &right.sval_x;
+      right_isnum = right.sval_isnum;
+    }
+    else if(!right.dval_set)
+      return(false);
+    right_dval = right.dval;
+  }
 
+  if(left.sval_set) {
+    if(right_is_string)
+      return(compareStrings(instr.relop, left.sval_x, *right_sval));
+    if(!left.sval_isnum)
+      return(false);
+    return(compareDoubles(instr.relop, left.dval, right_dval));
+  }
 
+  if(right_is_string && !right_isnum)
+    return(false);
+  return(compareDoubles(instr.relop, left.dval, right_dval));
+}
 
+//----------------------------------------------------------------
+// Procedure: print
 
+void LogicCondition::print() const
+{
+  if(!m_node)
+    return;
+
+  m_node->print();
+  for(unsigned int i=0; i<m_vars.size(); i++) {
+    cout << "  Var: [" << m_vars[i].name << "]: ";
+    if(m_vars[i].sval_set)
+      cout << "[" << m_vars[i].sval << "] ";
+    if(m_vars[i].dval_set)
+      cout << "[" << m_vars[i].dval << "] ";
+    cout << endl;
+  }
+}
@@ -24,6 +24,7 @@
 #include <cstring>
 #include "LogicUtils.h"
 #include "MBUtils.h"
+#include "StrView.h"
 
 using namespace std;
 
@@ -406,28 +407,22 @@ bool strFieldMatch(const string& str1,
   // For Example: "alpha:bravo" == "alpha:bravo:charlie"
   // But Not:     "pha:bra" == "alpha:bravo:charlie"
   
-  vector<string> svector1 = parseString(str1, separator);
-  vector<string> svector2 = parseString(str2, separator);
+  vector<StrView> svector1, svector2;
+  StrSplitter splitter1(str1.c_str(), separator);
+  StrSplitter splitter2(str2.c_str(), separator);
+  StrView tok;
+  while(splitter1.next(tok))
+    svector1.push_back(tok.stripBlankEnds());
+  while(splitter2.next(tok))
+    svector2.push_back(tok.stripBlankEnds());
+
   unsigned vsize1 = svector1.size();
   unsigned vsize2 = svector2.size();
   if((vsize1 == 0) || (vsize2 == 0))
     return(false);
 
-  unsigned int k;
-  for(k=0; k<vsize1; k++)
-    svector1[k] = stripBlankEnds(svector1[k]);
-  for(k=0; k<vsize2; k++)
-    svector2[k] = stripBlankEnds(svector2[k]);
-
-  vector<string> short_vector, long_vector;
-  if(vsize1 < vsize2) {
-    short_vector = svector1;
-    long_vector  = svector2;
-  }
-  else {
-    short_vector = svector2;
-    long_vector  = svector1;
-  }
+  const vector<StrView>& short_vector = (vsize1<vsize2) ? svector1 : svector2;
+  const vector<StrView>& long_vector  = (vsize1<vsize2) ? svector2 : svector1;
   unsigned int short_size = short_vector.size();
   unsigned int long_size  = long_vector.size();
 
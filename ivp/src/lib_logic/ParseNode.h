@@ -25,6 +25,7 @@
 #define PARSE_NODE_HEADER
 
 #include <string>
+#include <vector>
 
 class ParseNode {
 
@@ -35,6 +36,10 @@ public:
   ParseNode* copy();
 
   std::string getRawCondition() const {return(m_raw_string);}
+  std::string getRelation() const     {return(m_relation);}
+
+  const ParseNode* getLeftNode() const  {return(m_left_node);}
+  const ParseNode* getRightNode() const {return(m_right_node);}
 
   std::vector<std::string> recursiveGetVarNames() const;
 
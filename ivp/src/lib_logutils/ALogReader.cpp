@@ -0,0 +1,482 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: ALogReader.cpp                                       */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include <cstdlib>
+#include <cstring>
+#include "MBUtils.h"
+#include "ALogReader.h"
+
+using namespace std;
+
+#define ALOG_READ_BLOCK 1048576
+
+//--------------------------------------------------------
+// Procedure: clear()
+
+void ALogLineView::clear()
+{
+  m_line = "";
+  m_len  = 0;
+  m_tlen = 0;
+  m_vix  = 0;
+  m_vlen = 0;
+  m_six  = 0;
+  m_slen = 0;
+  m_dix  = 0;
+  m_dlen = 0;
+}
+
+//--------------------------------------------------------
+// Procedure: set()
+//     Notes: Syntax:  "TIMESTAMP   VAR   SOURCE   DATA"
+//            The data field runs to the end of the line and may
+//            contain white space.
+
+void ALogLineView::set(const char *line, unsigned int len)
+{
+  m_line = line;
+  m_len  = len;
+
+  unsigned int i = 0;
+  while((i<len) && (line[i] != ' ') && (line[i] != '\t'))
+    i++;
+  m_tlen = i;
+
+  while((i<len) && ((line[i] == ' ') || (line[i] == '\t')))
+    i++;
+  m_vix = i;
+  while((i<len) && (line[i] != ' ') && (line[i] != '\t'))
+    i++;
+  m_vlen = i - m_vix;
+
+  while((i<len) && ((line[i] == ' ') || (line[i] == '\t')))
+    i++;
+  m_six = i;
+  while((i<len) && (line[i] != ' ') && (line[i] != '\t'))
+    i++;
+  m_slen = i - m_six;
+
+  while((i<len) && ((line[i] == ' ') || (line[i] == '\t')))
+    i++;
+  m_dix  = i;
+  m_dlen = len - i;
+}
+
+//--------------------------------------------------------
+// Procedure: beginsWithDigit()
+
+bool ALogLineView::beginsWithDigit() const
+{
+  return((m_len > 0) && (m_line[0] >= '0') && (m_line[0] <= '9'));
+}
+
+//--------------------------------------------------------
+// Procedure: varIs()
+
+bool ALogLineView::varIs(const string& varname) const
+{
+  if(varname.length() != m_vlen)
+    return(false);
+  return(memcmp(m_line+m_vix, varname.c_str(), m_vlen) == 0);
+}
+
+//--------------------------------------------------------
+// Procedure: getTimeVal()
+
+bool ALogLineView::getTimeVal(double& val) const
+{
+  return(parseDouble(m_line, m_tlen, val));
+}
+
+//--------------------------------------------------------
+// Procedure: getSourceName()
+
+string ALogLineView::getSourceName() const
+{
+  return(string(m_line+m_six, m_slen));
+}
+
+//--------------------------------------------------------
+// Procedure: getSourceNameNoAux()
+
+string ALogLineView::getSourceNameNoAux() const
+{
+  unsigned int len = 0;
+  while((len < m_slen) && (m_line[m_six+len] != ':'))
+    len++;
+  return(string(m_line+m_six, len));
+}
+
+
+//--------------------------------------------------------
+// Constructor
+
+ALogReader::ALogReader()
+{
+  m_open     = false;
+  m_use_mmap = true;
+
+  m_map      = 0;
+  m_map_size = 0;
+  m_map_pos  = 0;
+
+  m_file     = 0;
+  m_buff_beg = 0;
+  m_buff_end = 0;
+  m_file_eof = false;
+}
+
+//--------------------------------------------------------
+// Destructor
+
+ALogReader::~ALogReader()
+{
+  close();
+}
+
+//--------------------------------------------------------
+// Procedure: open()
+//     Notes: Try to memory map the file first. If that is not
+//            supported or fails (e.g., a pipe or an empty file)
+//            fall back to block reads.
+
+bool ALogReader::open(const string& filename)
+{
+  close();
+
+#ifndef _WIN32
+  if(m_use_mmap) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if(fd < 0)
+      return(false);
+    struct stat st;
+    if((fstat(fd, &st) == 0) && S_ISREG(st.st_mode) && (st.st_size > 0)) {
+      void *addr = mmap(0, (size_t)(st.st_size), PROT_READ, MAP_PRIVATE,
+			fd, 0);
+      if(addr != MAP_FAILED) {
+	m_map      = (char*)(addr);
+	m_map_size = (size_t)(st.st_size);
+	m_map_pos  = 0;
+#ifdef MADV_SEQUENTIAL
+	madvise(addr, m_map_size, MADV_SEQUENTIAL);
+#endif
+      }
+    }
+    ::close(fd);
+    if(m_map) {
+      m_open = true;
+      return(true);
+    }
+  }
+#endif
+
+  m_file = fopen(filename.c_str(), "rb");
+  if(!m_file)
+    return(false);
+
+  m_buff.resize(ALOG_READ_BLOCK);
+  m_buff_beg = 0;
+  m_buff_end = 0;
+  m_file_eof = false;
+  m_open = true;
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: close()
+
+void ALogReader::close()
+{
+#ifndef _WIN32
+  if(m_map)
+    munmap(m_map, m_map_size);
+#endif
+  m_map      = 0;
+  m_map_size = 0;
+  m_map_pos  = 0;
+
+  if(m_file)
+    fclose(m_file);
+  m_file     = 0;
+  m_buff_beg = 0;
+  m_buff_end = 0;
+  m_file_eof = false;
+  m_open     = false;
+}
+
+//--------------------------------------------------------
+// Procedure: refill()
+//   Purpose: In block read mode, move the unread tail of the buffer
+//            to the front and read the next block behind it. The
+//            buffer doubles if one line fills the whole of it.
+//   Returns: false if no further bytes could be read.
+
+bool ALogReader::refill()
+{
+  if(!m_file || m_file_eof)
+    return(false);
+
+  size_t tail = m_buff_end - m_buff_beg;
+  if((tail > 0) && (m_buff_beg > 0))
+    memmove(&m_buff[0], &m_buff[m_buff_beg], tail);
+  m_buff_beg = 0;
+  m_buff_end = tail;
+
+  if(m_buff_end == m_buff.size())
+    m_buff.resize(m_buff.size() * 2);
+
+  size_t amt = fread(&m_buff[m_buff_end], 1, m_buff.size()-m_buff_end,
+		     m_file);
+  if(amt == 0) {
+    m_file_eof = true;
+    return(false);
+  }
+  m_buff_end += amt;
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: nextLine()
+//   Purpose: Set line/len to the next line, without its newline.
+//            A final line without a newline is still returned.
+//   Returns: false at the end of the file.
+
+bool ALogReader::nextLine(const char*& line, unsigned int& len)
+{
+  if(m_map) {
+    if(m_map_pos >= m_map_size)
+      return(false);
+    const char *beg = m_map + m_map_pos;
+    const char *eol = (const char*)memchr(beg, '\n', m_map_size-m_map_pos);
+    size_t llen = eol ? (size_t)(eol - beg) : (m_map_size - m_map_pos);
+    line = beg;
+    len  = (unsigned int)(llen);
+    m_map_pos += llen + 1;
+    return(true);
+  }
+
+  if(!m_file)
+    return(false);
+
+  size_t search_from = m_buff_beg;
+  while(1) {
+    const char *beg = &m_buff[0] + m_buff_beg;
+    const char *eol = 0;
+    if(m_buff_end > search_from)
+      eol = (const char*)memchr(&m_buff[0] + search_from, '\n',
+				m_buff_end - search_from);
+    if(eol) {
+      line = beg;
+      len  = (unsigned int)(eol - beg);
+      m_buff_beg += len + 1;
+      return(true);
+    }
+
+    size_t scanned = m_buff_end - m_buff_beg;
+    if(!refill()) {
+      if(m_buff_end == m_buff_beg)
+	return(false);
+      line = &m_buff[0] + m_buff_beg;
+      len  = (unsigned int)(m_buff_end - m_buff_beg);
+      m_buff_beg = m_buff_end;
+      return(true);
+    }
+    search_from = m_buff_beg + scanned;
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: nextLine()
+
+bool ALogReader::nextLine(ALogLineView& view)
+{
+  const char  *line = 0;
+  unsigned int len  = 0;
+  if(!nextLine(line, len)) {
+    view.clear();
+    return(false);
+  }
+  view.set(line, len);
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: nextLines()
+//   Purpose: Set beg/len to the next run of whole lines, newlines
+//            included: the next amt bytes extended to the end of the
+//            line they stop in. When mapped, beg points into the map
+//            and is good until close(). Otherwise it points into the
+//            read buffer and is good only until the next read.
+//   Returns: false at the end of the file.
+
+bool ALogReader::nextLines(const char*& beg, size_t& len, size_t amt)
+{
+  if(m_map) {
+    if(m_map_pos >= m_map_size)
+      return(false);
+    size_t end = m_map_pos + amt;
+    if(end >= m_map_size)
+      end = m_map_size;
+    else {
+      const char *eol = (const char*)memchr(m_map + end, '\n',
+					    m_map_size - end);
+      end = eol ? (size_t)(eol - m_map) + 1 : m_map_size;
+    }
+    beg = m_map + m_map_pos;
+    len = end - m_map_pos;
+    m_map_pos = end;
+    return(true);
+  }
+
+  if(!m_file)
+    return(false);
+
+  while(((m_buff_end - m_buff_beg) <= amt) && refill());
+
+  size_t search_from = m_buff_beg + amt;
+  while(1) {
+    const char *eol = 0;
+    if(m_buff_end > search_from)
+      eol = (const char*)memchr(&m_buff[0] + search_from, '\n',
+				m_buff_end - search_from);
+    if(eol) {
+      beg = &m_buff[0] + m_buff_beg;
+      len = (size_t)(eol - beg) + 1;
+      m_buff_beg += len;
+      return(true);
+    }
+
+    size_t scanned = m_buff_end - m_buff_beg;
+    if(!refill()) {
+      if(m_buff_end == m_buff_beg)
+	return(false);
+      beg = &m_buff[0] + m_buff_beg;
+      len = m_buff_end - m_buff_beg;
+      m_buff_beg = m_buff_end;
+      return(true);
+    }
+    search_from = m_buff_beg + scanned;
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: release()
+//   Purpose: When mapped, let the system drop the pages of a part of
+//            the file that has been read and will not be needed
+//            again, keeping the resident size down on large files.
+//            The pages are read back in if touched again.
+
+void ALogReader::release(const char *beg, size_t len)
+{
+#if !defined(_WIN32) && defined(MADV_DONTNEED)
+  if(!m_map || (beg < m_map) || ((beg + len) > (m_map + m_map_size)))
+    return;
+
+  size_t page = (size_t)(sysconf(_SC_PAGESIZE));
+  size_t from = (size_t)(beg - m_map);
+  size_t upto = from + len;
+  from = ((from + page - 1) / page) * page;
+  upto = (upto / page) * page;
+  if(upto > from)
+    madvise(m_map + from, upto - from, MADV_DONTNEED);
+#endif
+}
+
+//--------------------------------------------------------
+// Procedure: getNextRawLine()
+//   Returns: The next line, or "eof" at the end of the file, as
+//            with getNextRawLine(FILE*).
+
+string ALogReader::getNextRawLine()
+{
+  const char  *line = 0;
+  unsigned int len  = 0;
+  if(!nextLine(line, len))
+    return("eof");
+  return(string(line, len));
+}
+
+//--------------------------------------------------------
+// Procedure: getNextRawALogEntry()
+//     Notes: Same result as getNextRawALogEntry(FILE*), including
+//            the removal of white space from within the value.
+
+ALogEntry ALogReader::getNextRawALogEntry(bool allstrings)
+{
+  ALogEntry entry;
+
+  ALogLineView view;
+  if(!nextLine(view)) {
+    entry.setStatus("eof");
+    return(entry);
+  }
+
+  const char  *line = view.line();
+  unsigned int tlen = 0;
+  while((tlen < view.length()) && (line[tlen]!=' ') && (line[tlen]!='\t'))
+    tlen++;
+
+  // Check for lines that may be carriage return continuation of
+  // previous line's data field as in DB_VARSUMMARY
+  if((tlen > 0) && (line[0] != '%') && !view.beginsWithDigit()) {
+    entry.setStatus("invalid");
+    return(entry);
+  }
+
+  string var    = view.getVarName();
+  string rawsrc = view.getSourceName();
+  string val;
+  string data = view.getDataEntry();
+  val.reserve(data.length());
+  for(string::size_type i=0; i<data.length(); i++) {
+    if((data[i] != ' ') && (data[i] != '\t'))
+      val.push_back(data[i]);
+  }
+
+  double tstamp = 0;
+  if((tlen==0) || (var=="") || (rawsrc=="") || (val=="") ||
+     !view.getTimeVal(tstamp)) {
+    entry.setStatus("invalid");
+    return(entry);
+  }
+
+  string src    = biteString(rawsrc,':');
+  string srcaux = rawsrc;
+  if(src == "") {
+    entry.setStatus("invalid");
+    return(entry);
+  }
+
+  double dval = 0;
+  if(allstrings || !parseDouble(val.c_str(), val.length(), dval))
+    entry.set(tstamp, var, src, srcaux, val);
+  else
+    entry.set(tstamp, var, src, srcaux, dval);
+
+  return(entry);
+}
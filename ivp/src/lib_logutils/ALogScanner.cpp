@@ -36,7 +36,7 @@ ScanReport ALogScanner::scan()
   ScanReport report;
   bool done = false;
   while(!done) {
-    ALogEntry entry = getNextRawALogEntry(m_file, true);
+    ALogEntry entry = m_reader.getNextRawALogEntry(true);
     string status = entry.getStatus();
     // Check for the end of the file
     if(status == "eof")
@@ -74,11 +74,7 @@ ScanReport ALogScanner::scan()
 
 bool ALogScanner::openALogFile(string alogfile)
 {
-  m_file = fopen(alogfile.c_str(), "r");
-  if(!m_file)
-    return(false);
-  else
-    return(true);
+  return(m_reader.open(alogfile));
 }
 
 
@@ -28,18 +28,19 @@
 #include <map>
 #include <string>
 #include "ScanReport.h"
+#include "ALogReader.h"
 
 class ALogScanner
 {
  public:
-  ALogScanner() {m_file=0;}
+  ALogScanner() {}
   ~ALogScanner() {}
 
   bool       openALogFile(std::string);
   ScanReport scan();
 
  private:
-  FILE *m_file;
+  ALogReader m_reader;
 };
 
 #endif 
@@ -0,0 +1,462 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: KLogCache.cpp                                        */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include <sys/stat.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include "MBUtils.h"
+#include "ALogReader.h"
+#include "KLogCache.h"
+
+using namespace std;
+
+// File layout, native byte order, all offsets from the file start:
+//   Header of KCOL_HEADER bytes:
+//      0: "KCOL"        4: version (u32)    8: lines (u64)
+//     16: alog size     24: alog mtime      32: names (u32)
+//     40: name text length (u64)            48: text length (u64)
+//   Columns, one entry per line unless noted:
+//     double times, double values, u64 text offsets (lines+1),
+//     u64 name offsets (names+1), u32 var name index, u32 source
+//     name index, u8 flags, then the name text and the line text.
+
+#define KCOL_HEADER  64
+#define KCOL_VERSION 1
+
+// Flags per line
+#define KCOL_VALID   1  // Line makes a valid ALogEntry
+
+//--------------------------------------------------------
+// Constructor
+
+KLogCache::KLogCache()
+{
+  m_built    = false;
+  m_map      = 0;
+  m_map_size = 0;
+  m_base     = 0;
+  close();
+}
+
+//--------------------------------------------------------
+// Destructor
+
+KLogCache::~KLogCache()
+{
+  close();
+}
+
+//--------------------------------------------------------
+// Procedure: open()
+//   Purpose: Open the cache of the given klog file, building it
+//            from the klog file if missing or out of date with the
+//            given alog file. If the cache cannot be saved, it is
+//            kept in memory for this use only.
+
+bool KLogCache::open(const string& klog_file, const string& alog_file)
+{
+  close();
+
+  unsigned long long alog_size  = 0;
+  long long          alog_mtime = 0;
+  struct stat st;
+  if(stat(alog_file.c_str(), &st) == 0) {
+    alog_size  = (unsigned long long)(st.st_size);
+    alog_mtime = (long long)(st.st_mtime);
+  }
+
+  string kcol_file = klog_file;
+  if(strEnds(kcol_file, ".klog"))
+    kcol_file = kcol_file.substr(0, kcol_file.length()-5);
+  kcol_file += ".kcol";
+
+  if(load(kcol_file, alog_size, alog_mtime))
+    return(true);
+  close();
+
+  if(!build(klog_file, alog_size, alog_mtime)) {
+    close();
+    return(false);
+  }
+
+  // Write to a temporary file first so that another process never
+  // maps a partly written cache.
+  string temp_file = kcol_file + ".tmp";
+#ifndef _WIN32
+  temp_file += uintToString((unsigned int)(getpid()));
+#endif
+  FILE *f = fopen(temp_file.c_str(), "wb");
+  if(f) {
+    bool ok = (fwrite(m_data.c_str(), 1, m_data.length(), f) == 
+	       m_data.length());
+    ok = (fclose(f) == 0) && ok;
+    if(!ok || (rename(temp_file.c_str(), kcol_file.c_str()) != 0))
+      remove(temp_file.c_str());
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: close()
+
+void KLogCache::close()
+{
+#ifndef _WIN32
+  if(m_map)
+    munmap(m_map, m_map_size);
+#endif
+  m_map      = 0;
+  m_map_size = 0;
+  m_data     = "";
+  m_base     = 0;
+  m_built    = false;
+
+  m_count     = 0;
+  m_names     = 0;
+  m_times     = 0;
+  m_dvals     = 0;
+  m_toffs     = 0;
+  m_noffs     = 0;
+  m_varix     = 0;
+  m_srcix     = 0;
+  m_flags     = 0;
+  m_name_text = 0;
+  m_text      = 0;
+}
+
+//--------------------------------------------------------
+// Procedure: load()
+//   Purpose: Map an existing cache file and check it was built from
+//            the alog file of the given size and time.
+
+bool KLogCache::load(const string& kcol_file, unsigned long long alog_size,
+		     long long alog_mtime)
+{
+  size_t total = 0;
+#ifndef _WIN32
+  int fd = ::open(kcol_file.c_str(), O_RDONLY);
+  if(fd < 0)
+    return(false);
+  struct stat st;
+  if((fstat(fd, &st) == 0) && S_ISREG(st.st_mode) && 
+     (st.st_size >= KCOL_HEADER)) {
+    void *addr = mmap(0, (size_t)(st.st_size), PROT_READ, MAP_SHARED,
+		      fd, 0);
+    if(addr != MAP_FAILED) {
+      m_map      = (char*)(addr);
+      m_map_size = (size_t)(st.st_size);
+      m_base     = m_map;
+      total      = m_map_size;
+    }
+  }
+  ::close(fd);
+#else
+  FILE *f = fopen(kcol_file.c_str(), "rb");
+  if(!f)
+    return(false);
+  char buff[65536];
+  size_t amt = 0;
+  while((amt = fread(buff, 1, sizeof(buff), f)) > 0)
+    m_data.append(buff, amt);
+  fclose(f);
+  m_base = m_data.c_str();
+  total  = m_data.length();
+#endif
+  if(!m_base || (total < KCOL_HEADER))
+    return(false);
+
+  unsigned long long cache_size  = 0;
+  long long          cache_mtime = 0;
+  memcpy(&cache_size, m_base+16, 8);
+  memcpy(&cache_mtime, m_base+24, 8);
+  if((cache_size != alog_size) || (cache_mtime != alog_mtime))
+    return(false);
+
+  return(setColumns(total));
+}
+
+//--------------------------------------------------------
+// Procedure: build()
+//   Purpose: Read the klog file and build the cache in m_data. The
+//            values and entries are read by the same rules as the
+//            text reading of klog files in alogview.
+
+bool KLogCache::build(const string& klog_file, unsigned long long alog_size,
+		      long long alog_mtime)
+{
+  ALogReader reader;
+  if(!reader.open(klog_file))
+    return(false);
+
+  vector<double>             times;
+  vector<double>             dvals;
+  vector<unsigned long long> toffs(1, 0);
+  vector<unsigned int>       varix;
+  vector<unsigned int>       srcix;
+  vector<unsigned char>      flags;
+  string text;
+
+  map<string, unsigned int>  name_ix;
+  vector<string>             names;
+
+  ALogLineView line;
+  while(reader.nextLine(line)) {
+    if(line.isEmpty() || line.isComment())
+      continue;
+
+    double tstamp = 0;
+    bool   tvalid = line.getTimeVal(tstamp);
+    if(!tvalid)
+      tstamp = atof(line.getTimeStamp().c_str());
+
+    string data = line.getDataEntry();
+    double dval = 0;
+    if(!parseDouble(data.c_str(), data.length(), dval))
+      dval = atof(data.c_str());
+
+    string var = line.getVarName();
+    string src = line.getSourceName();
+    unsigned int ixs[2] = {0, 0};
+    string strs[2] = {var, src};
+    for(unsigned int i=0; i<2; i++) {
+      map<string, unsigned int>::iterator p = name_ix.find(strs[i]);
+      if(p != name_ix.end())
+	ixs[i] = p->second;
+      else {
+	ixs[i] = names.size();
+	name_ix[strs[i]] = ixs[i];
+	names.push_back(strs[i]);
+      }
+    }
+
+    // Valid as an ALogEntry by the rules of getNextRawALogEntry()
+    bool valid = tvalid && (line.getTimeStamp() != "") && 
+      line.beginsWithDigit() && (var != "") && (src != "") &&
+      (src.at(0) != ':');
+    bool has_val = false;
+    for(string::size_type i=0; (i<data.length()) && !has_val; i++)
+      has_val = (data[i] != ' ') && (data[i] != '\t');
+    valid = valid && has_val;
+
+    times.push_back(tstamp);
+    dvals.push_back(dval);
+    text += data;
+    toffs.push_back(text.length());
+    varix.push_back(ixs[0]);
+    srcix.push_back(ixs[1]);
+    flags.push_back(valid ? KCOL_VALID : 0);
+  }
+
+  vector<unsigned long long> noffs(1, 0);
+  string name_text;
+  for(unsigned int i=0; i<names.size(); i++) {
+    name_text += names[i];
+    noffs.push_back(name_text.length());
+  }
+
+  unsigned long long count     = times.size();
+  unsigned int       name_cnt  = names.size();
+  unsigned int       version   = KCOL_VERSION;
+  unsigned long long name_len  = name_text.length();
+  unsigned long long text_len  = text.length();
+
+  char header[KCOL_HEADER];
+  memset(header, 0, KCOL_HEADER);
+  memcpy(header, "KCOL", 4);
+  memcpy(header+4,  &version, 4);
+  memcpy(header+8,  &count, 8);
+  memcpy(header+16, &alog_size, 8);
+  memcpy(header+24, &alog_mtime, 8);
+  memcpy(header+32, &name_cnt, 4);
+  memcpy(header+40, &name_len, 8);
+  memcpy(header+48, &text_len, 8);
+
+  m_data.assign(header, KCOL_HEADER);
+  if(count > 0) {
+    m_data.append((const char*)(&times[0]), count * sizeof(double));
+    m_data.append((const char*)(&dvals[0]), count * sizeof(double));
+  }
+  m_data.append((const char*)(&toffs[0]), (count+1) * 8);
+  m_data.append((const char*)(&noffs[0]), (name_cnt+1) * 8);
+  if(count > 0) {
+    m_data.append((const char*)(&varix[0]), count * 4);
+    m_data.append((const char*)(&srcix[0]), count * 4);
+    m_data.append((const char*)(&flags[0]), count);
+  }
+  m_data += name_text;
+  m_data += text;
+
+  m_base  = m_data.c_str();
+  m_built = true;
+  return(setColumns(m_data.length()));
+}
+
+//--------------------------------------------------------
+// Procedure: setColumns()
+//   Purpose: Set the column pointers from the header, checking that
+//            the header, the offsets and the total size agree.
+
+bool KLogCache::setColumns(unsigned long long total)
+{
+  if(!m_base || (total < KCOL_HEADER) || (memcmp(m_base, "KCOL", 4) != 0))
+    return(false);
+
+  unsigned int       version  = 0;
+  unsigned long long count    = 0;
+  unsigned int       name_cnt = 0;
+  unsigned long long name_len = 0;
+  unsigned long long text_len = 0;
+  memcpy(&version,  m_base+4, 4);
+  memcpy(&count,    m_base+8, 8);
+  memcpy(&name_cnt, m_base+32, 4);
+  memcpy(&name_len, m_base+40, 8);
+  memcpy(&text_len, m_base+48, 8);
+  if((version != KCOL_VERSION) || (count >= 0xFFFFFFFFULL) || 
+     (name_cnt >= 0xFFFFFFFFU))
+    return(false);
+
+  unsigned long long expected = KCOL_HEADER + (count * 33) + 8 +
+    ((unsigned long long)(name_cnt) + 1) * 8 + name_len + text_len;
+  if(expected != total)
+    return(false);
+
+  const char *pos = m_base + KCOL_HEADER;
+  m_times = (const double*)(pos);              pos += count * 8;
+  m_dvals = (const double*)(pos);              pos += count * 8;
+  m_toffs = (const unsigned long long*)(pos);  pos += (count+1) * 8;
+  m_noffs = (const unsigned long long*)(pos);  pos += (name_cnt+1) * 8;
+  m_varix = (const unsigned int*)(pos);        pos += count * 4;
+  m_srcix = (const unsigned int*)(pos);        pos += count * 4;
+  m_flags = (const unsigned char*)(pos);       pos += count;
+  m_name_text = pos;                           pos += name_len;
+  m_text      = pos;
+
+  if((m_toffs[count] != text_len) || (m_noffs[name_cnt] != name_len))
+    return(false);
+  for(unsigned long long i=0; i<count; i++) {
+    if((m_toffs[i] > m_toffs[i+1]) || (m_varix[i] >= name_cnt) ||
+       (m_srcix[i] >= name_cnt))
+      return(false);
+  }
+  for(unsigned int i=0; i<name_cnt; i++) {
+    if(m_noffs[i] > m_noffs[i+1])
+      return(false);
+  }
+
+  m_count = (unsigned int)(count);
+  m_names = name_cnt;
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: getString()
+//   Returns: The data entry of the line as found in the klog file
+
+string KLogCache::getString(unsigned int ix) const
+{
+  if(ix >= m_count)
+    return("");
+  return(string(m_text + m_toffs[ix], m_toffs[ix+1] - m_toffs[ix]));
+}
+
+//--------------------------------------------------------
+// Procedure: getName()
+
+string KLogCache::getName(unsigned int nix) const
+{
+  if(nix >= m_names)
+    return("");
+  return(string(m_name_text + m_noffs[nix], m_noffs[nix+1] - m_noffs[nix]));
+}
+
+//--------------------------------------------------------
+// Procedure: getVarName()
+
+string KLogCache::getVarName(unsigned int ix) const
+{
+  if(ix >= m_count)
+    return("");
+  return(getName(m_varix[ix]));
+}
+
+//--------------------------------------------------------
+// Procedure: getSourceName()
+//   Returns: The source of the line, with any source aux
+
+string KLogCache::getSourceName(unsigned int ix) const
+{
+  if(ix >= m_count)
+    return("");
+  return(getName(m_srcix[ix]));
+}
+
+//--------------------------------------------------------
+// Procedure: isValidEntry()
+
+bool KLogCache::isValidEntry(unsigned int ix) const
+{
+  if(ix >= m_count)
+    return(false);
+  return((m_flags[ix] & KCOL_VALID) != 0);
+}
+
+//--------------------------------------------------------
+// Procedure: getEntry()
+//   Returns: The line as an ALogEntry, the same as would be given by
+//            getNextRawALogEntry() on the line in the klog file.
+
+ALogEntry KLogCache::getEntry(unsigned int ix, bool allstrings) const
+{
+  ALogEntry entry;
+  if(!isValidEntry(ix)) {
+    entry.setStatus("invalid");
+    return(entry);
+  }
+
+  const char *data = m_text + m_toffs[ix];
+  size_t      len  = (size_t)(m_toffs[ix+1] - m_toffs[ix]);
+  string val;
+  val.reserve(len);
+  for(size_t i=0; i<len; i++) {
+    if((data[i] != ' ') && (data[i] != '\t'))
+      val.push_back(data[i]);
+  }
+
+  string rawsrc = getSourceName(ix);
+  string src    = biteString(rawsrc, ':');
+  string srcaux = rawsrc;
+
+  double dval = 0;
+  if(allstrings || !parseDouble(val.c_str(), val.length(), dval))
+    entry.set(m_times[ix], getVarName(ix), src, srcaux, val);
+  else
+    entry.set(m_times[ix], getVarName(ix), src, srcaux, dval);
+
+  return(entry);
+}
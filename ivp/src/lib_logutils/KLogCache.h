@@ -0,0 +1,99 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: KLogCache.h                                          */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#ifndef KLOG_CACHE_HEADER
+#define KLOG_CACHE_HEADER
+
+#include <string>
+#include <vector>
+#include "ALogEntry.h"
+
+//----------------------------------------------------------------
+// KLogCache: A columnar binary copy of one klog file of a split
+// directory, kept next to it as a .kcol file. Time stamps and the
+// numeric value of each line are stored as arrays of doubles, the
+// data entries as offsets into one block of text, and the variable
+// and source names as indices into a table of names. A valid cache
+// is memory mapped, so it loads at once and is shared by all the
+// processes that open it. The cache is tied to the size and time of
+// last change of the alog file it was split from, and is rebuilt
+// from the klog file when these no longer match.
+
+class KLogCache
+{
+ public:
+  KLogCache();
+  ~KLogCache();
+
+  bool open(const std::string& klog_file, const std::string& alog_file);
+  void close();
+  bool isOpen() const    {return(m_base != 0);}
+  bool isMapped() const  {return(m_map != 0);}
+  bool wasBuilt() const  {return(m_built);}
+
+  unsigned int size() const {return(m_count);}
+
+  double      getTime(unsigned int ix) const    {return(m_times[ix]);}
+  double      getDouble(unsigned int ix) const  {return(m_dvals[ix]);}
+  std::string getString(unsigned int ix) const;
+  std::string getVarName(unsigned int ix) const;
+  std::string getSourceName(unsigned int ix) const;
+  bool        isValidEntry(unsigned int ix) const;
+
+  ALogEntry   getEntry(unsigned int ix, bool allstrings=false) const;
+
+ protected:
+  bool load(const std::string& kcol_file, unsigned long long alog_size,
+	    long long alog_mtime);
+  bool build(const std::string& klog_file, unsigned long long alog_size,
+	     long long alog_mtime);
+  bool setColumns(unsigned long long total);
+  std::string getName(unsigned int nix) const;
+
+ private: // Not copyable, the cache owns its mapping or buffer
+  KLogCache(const KLogCache&);
+  KLogCache& operator=(const KLogCache&);
+
+ protected:
+  bool   m_built;
+
+  // The cache file contents, either mapped or read into m_data
+  char*       m_map;
+  size_t      m_map_size;
+  std::string m_data;
+  const char* m_base;
+
+  // Columns, pointing into the cache file contents
+  unsigned int               m_count;
+  unsigned int               m_names;
+  const double*              m_times;
+  const double*              m_dvals;
+  const unsigned long long*  m_toffs;
+  const unsigned long long*  m_noffs;
+  const unsigned int*        m_varix;
+  const unsigned int*        m_srcix;
+  const unsigned char*       m_flags;
+  const char*                m_name_text;
+  const char*                m_text;
+};
+
+#endif
@@ -9,13 +9,45 @@
 #include <cstdlib>
 #include <cstdio>
 #include <cmath>
+#include <cstring>
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif
 #include "MBUtils.h"
 #include "SplitHandler.h"
 #include "LogUtils.h"
+#include "ALogReader.h"
 #include "TermUtils.h"
 
 using namespace std;
 
+//--------------------------------------------------------
+// Procedure: clear()
+//      Note: The handle on the binary log is kept open across
+//            chunks and closed by the split handler.
+
+void SplitChunk::clear()
+{
+  beg  = 0;
+  end  = 0;
+  data = "";
+  skips.clear();
+
+  iter_known = false;
+  helm_iter  = "";
+  pending.clear();
+
+  vars.clear();
+  bhv_names.clear();
+
+  time_min = "";
+  time_max = "";
+  vname    = "";
+  vtypes.clear();
+  vlengths.clear();
+}
+
 //--------------------------------------------------------
 // Constructor
 
@@ -25,6 +57,21 @@ SplitHandler::SplitHandler(string alog_file)
   m_alog_file = alog_file;
   m_verbose = false;
 
+  // One thread per core, up to eight. More gains little since the
+  // merge and the writes are done on one thread.
+  m_threads = 1;
+#ifndef _WIN32
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  if(cpus > 8)
+    cpus = 8;
+  if(cpus > 1)
+    m_threads = (unsigned int)(cpus);
+#endif
+
+  m_max_open       = 64;
+  m_chunk_size     = 4194304;
+  m_klog_buff_size = 32768;
+
   // Init state variables
   m_alog_file_confirmed = false;
   m_split_dir_prior     = false;
@@ -86,151 +133,525 @@ bool SplitHandler::handlePreCheckALogFile()
 
 //--------------------------------------------------------
 // Procedure: handleMakeSplitFiles
+//   Purpose: Split the alog file in rounds. Each round reads up to
+//            one chunk of whole lines per thread, splits the chunks
+//            in parallel, then merges them in file order, so each
+//            klog file gets its lines in the order of the alog file.
 
 bool SplitHandler::handleMakeSplitFiles()
 {
-  FILE *file_in = fopen(m_alog_file.c_str(), "r");
-  if(!file_in) {
+  ALogReader reader;
+  if(!reader.open(m_alog_file)) {
     cout << "Unable to open [" << m_alog_file << "] exiting." << endl;
     return(false);
   }
 
-  bool done = false;
-  while(!done) {    
-    string line_raw = getNextRawLine(file_in);
+  vector<SplitChunk> chunks(m_threads);
 
-    // Check if the line has the timestamp
-    if((m_logstart.length() == 0) && strContains(line_raw, "LOGSTART")) {
-      line_raw = findReplace(line_raw, "LOGSTART", "X");
-      biteStringX(line_raw, 'X');
-      m_logstart = line_raw;
-      continue;
+  bool ok    = true;
+  bool done  = false;
+  bool first = true;
+  while(ok && !done) {
+    unsigned int count = 0;
+    while((count < chunks.size()) && !done) {
+      if(readChunk(reader, chunks[count]))
+	count++;
+      else
+	done = true;
     }
-    // Check if the line is a comment
-    if((line_raw.length() > 0) && (line_raw.at(0) == '%'))
-      continue;
-    // Check for end of file
-    if(line_raw == "eof") 
+    if(count == 0)
       break;
 
-    // Otherwise handle a normal line
-    string varname = getVarName(line_raw);
-
-    // Reject any line that doesn't begin with a number
-    string one_char = line_raw.substr(0,1);
-    if(!isNumber(one_char) || (varname=="DB_VARSUMMARY"))
-      continue;
-
-    string tstamp = getTimeStamp(line_raw);
-    if(m_time_min == "")
-      m_time_min = tstamp;
-    m_time_max = tstamp;
-
-    if((varname=="VIEW_POINT")   || (varname=="VIEW_POLYGON") ||
-       (varname=="VIEW_SEGLIST") || (varname=="VIEW_CIRCLE")  ||
-       (varname=="GRID_INIT")    || (varname=="VIEW_MARKER")  ||
-       (varname=="GRID_DELTA")   || (varname=="VIEW_RANGE_PULSE"))
-      varname = "VISUALS";
-
-    // A measure implemented here to accommodate older alogfile formats where
-    // the behavior name in BHV_IPF is foobar1234 where 1234 is the helm 
-    // iteration. In Release 15.4 , the format it foobar^1234. If the separator
-    // is not found, we look to see if the behavior name ends with the current
-    // helm iteration, and remove it. Luckily the current helm iteration is 
-    // apparently reliably logged before the BHV_IPF. So we note it here to
-    // apply this measure. Bit of a hack, but should be not needed once the
-    // newer format (with the '^' separator) is more widely adopted.
-    if(varname == "IVPHELM_ITER") {
-      string sval = getDataEntry(line_raw);
-      string iter = biteString(sval, '.');
-      m_curr_helm_iter = iter;
+    // Only the very first chunk knows the helm iteration it starts in
+    if(first)
+      chunks[0].iter_known = true;
+    first = false;
+
+    splitChunks(chunks, count);
+    for(unsigned int i=0; ok && (i<count); i++) {
+      ok = mergeChunk(chunks[i]);
+      reader.release(chunks[i].beg, chunks[i].end - chunks[i].beg);
     }
+  }
 
-    // Handle BHV_IPF: Break out into sep files for each behavior
-    // P,waypt_return^445,1,1,H,16,445:waypt_return,2,35,1,100,D,
-    if(varname == "BHV_IPF") {
-      string sval = getDataEntry(line_raw);       
-      biteString(sval, ',');                   
-      string bhv_name  = biteString(sval, ',');      
-      if(strContains(bhv_name, '^'))
-	bhv_name = biteString(bhv_name, '^');
-      else
-	bhv_name = findReplace(bhv_name, m_curr_helm_iter, "");
-      varname = "BHV_IPF_" + bhv_name; 
-      m_bhv_names.insert(bhv_name);
+  if(m_verbose)
+    cout << "Done writing to klog files. Total files: " << m_klog_buff.size() << endl;
+
+  // Close all the file pointers before finishing
+  closeKLogs();
+  reader.close();
+  for(unsigned int i=0; i<chunks.size(); i++) {
+    if(chunks[i].blog_file)
+      fclose(chunks[i].blog_file);
+    chunks[i].blog_file = 0;
+  }
+
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: readChunk
+//   Purpose: Read the next run of whole lines into the chunk. Until
+//            the LOGSTART time is known, look for it here, noting 
+//            the line so it is not split as a regular line.
+
+bool SplitHandler::readChunk(ALogReader& reader, SplitChunk& chunk)
+{
+  chunk.clear();
+
+  const char *beg = 0;
+  size_t      len = 0;
+  if(!reader.nextLines(beg, len, m_chunk_size))
+    return(false);
+
+  if(!reader.isMapped()) {
+    chunk.data.assign(beg, len);
+    beg = chunk.data.c_str();
+  }
+  chunk.beg = beg;
+  chunk.end = beg + len;
+
+  const char *pos = chunk.beg;
+  while(m_logstart.length() == 0) {
+    const char *hit = 0;
+    for(const char *p=pos; (p+8)<=chunk.end; p++) {
+      p = (const char*)memchr(p, 'L', chunk.end - p);
+      if(!p)
+	break;
+      if(((p+8) <= chunk.end) && (strncmp(p, "LOGSTART", 8) == 0)) {
+	hit = p;
+	break;
+      }
     }
+    if(!hit)
+      break;
+
+    const char *line_beg = hit;
+    while((line_beg > chunk.beg) && (line_beg[-1] != '\n'))
+      line_beg--;
+    const char *line_end = (const char*)memchr(hit, '\n', chunk.end-hit);
+    if(!line_end)
+      line_end = chunk.end;
+
+    string line_raw(line_beg, line_end - line_beg);
+    line_raw = findReplace(line_raw, "LOGSTART", "X");
+    biteStringX(line_raw, 'X');
+    m_logstart = line_raw;
+    chunk.skips.push_back(line_beg);
+    pos = line_end;
+  }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: splitEntry
+//   Purpose: pthread entry point. Splits one chunk.
+
+#ifndef _WIN32
+struct SplitJob
+{
+  const SplitHandler *handler;
+  SplitChunk         *chunk;
+};
+
+static void *splitEntry(void *arg)
+{
+  SplitJob *job = (SplitJob*)(arg);
+  job->handler->splitChunk(*(job->chunk));
+  return(0);
+}
+#endif
+
+//--------------------------------------------------------
+// Procedure: splitChunks
+//      Note: The calling thread splits the first chunk. If a thread
+//            fails to start, or on a platform without pthreads, its
+//            chunk is split here afterwards.
+
+void SplitHandler::splitChunks(vector<SplitChunk>& chunks, 
+			       unsigned int count)
+{
+#ifdef _WIN32
+  for(unsigned int i=0; i<count; i++)
+    splitChunk(chunks[i]);
+#else
+  vector<SplitJob>  jobs(count);
+  vector<pthread_t> tids(count);
+  vector<bool>      started(count, false);
+  for(unsigned int i=1; i<count; i++) {
+    jobs[i].handler = this;
+    jobs[i].chunk   = &(chunks[i]);
+    started[i] = (pthread_create(&(tids[i]), 0, splitEntry, &(jobs[i])) == 0);
+  }
+  splitChunk(chunks[0]);
+  for(unsigned int i=1; i<count; i++) {
+    if(started[i])
+      pthread_join(tids[i], 0);
+    else
+      splitChunk(chunks[i]);
+  }
+#endif
+}
+
+//--------------------------------------------------------
+// Procedure: splitChunk
+//      Note: Runs on a worker thread. Touches nothing but the chunk
+//            and the handler's configuration.
+
+void SplitHandler::splitChunk(SplitChunk& chunk) const
+{
+  ALogLineView line;
+  const char *pos = chunk.beg;
+  while(pos < chunk.end) {
+    const char *eol = (const char*)memchr(pos, '\n', chunk.end - pos);
+    size_t len = eol ? (size_t)(eol - pos) : (size_t)(chunk.end - pos);
+    line.set(pos, (unsigned int)(len));
+    splitLine(line, chunk);
+    pos += len + 1;
+  }
+}
+
+//--------------------------------------------------------
+// Procedure: splitLine
+
+void SplitHandler::splitLine(const ALogLineView& line, 
+			     SplitChunk& chunk) const
+{
+  // Check if the line is a comment or holds the LOGSTART time
+  if(line.isComment())
+    return;
+  for(unsigned int i=0; i<chunk.skips.size(); i++)
+    if(line.line() == chunk.skips[i])
+      return;
+
+  // Reject any line that doesn't begin with a number
+  if(!line.beginsWithDigit() || line.varIs("DB_VARSUMMARY"))
+    return;
+
+  // Otherwise handle a normal line
+  string varname  = line.getVarName();
+  string tstamp   = line.getTimeStamp();
+  if(chunk.time_min == "")
+    chunk.time_min = tstamp;
+  chunk.time_max = tstamp;
+
+  if((varname=="VIEW_POINT")   || (varname=="VIEW_POLYGON") ||
+     (varname=="VIEW_SEGLIST") || (varname=="VIEW_CIRCLE")  ||
+     (varname=="GRID_INIT")    || (varname=="VIEW_MARKER")  ||
+     (varname=="GRID_DELTA")   || (varname=="VIEW_RANGE_PULSE"))
+    varname = "VISUALS";
+
+  // A measure implemented here to accommodate older alogfile formats where
+  // the behavior name in BHV_IPF is foobar1234 where 1234 is the helm 
+  // iteration. In Release 15.4 , the format it foobar^1234. If the separator
+  // is not found, we look to see if the behavior name ends with the current
+  // helm iteration, and remove it. Luckily the current helm iteration is 
+  // apparently reliably logged before the BHV_IPF. So we note it here to
+  // apply this measure. Bit of a hack, but should be not needed once the
+  // newer format (with the '^' separator) is more widely adopted.
+  if(varname == "IVPHELM_ITER") {
+    string sval = line.getDataEntry();
+    string iter = biteString(sval, '.');
+    chunk.helm_iter  = iter;
+    chunk.iter_known = true;
+  }
 
-    // Part 1: Determine the vehicle name if not already known
-    // Typically the MOOSDB automatically names itself MOOSDB_COMMUNITY, 
-    // For example, MOOSDB_alpha. DB_TIME is published by the MOOSDB.
-    if((m_vname.length() == 0) && (varname == "DB_TIME")) {
-      string var_src = getSourceName(line_raw);
-      biteString(var_src, '_');
-      m_vname = var_src;
+  // Handle BHV_IPF: Break out into sep files for each behavior. If
+  // the helm iteration is needed but not yet known in this chunk,
+  // hold the line until the chunk is merged.
+  if(varname == "BHV_IPF") {
+    if(!chunk.iter_known) {
+      string sval = line.getDataEntry();
+      biteString(sval, ',');
+      string bhv_name = biteString(sval, ',');
+      if(strBegins(line.getDataEntry(), "<MOOS_BINARY>") ||
+	 !strContains(bhv_name, '^')) {
+	chunk.pending.push_back(line.getLine());
+	return;
+      }
     }
+    splitHelmLine(line, chunk);
+    return;
+  }
 
-    if((m_vtype.length() == 0) && (varname == "NODE_REPORT_LOCAL")) {
+  // Part 1: Determine the vehicle name if not already known
+  // Typically the MOOSDB automatically names itself MOOSDB_COMMUNITY, 
+  // For example, MOOSDB_alpha. DB_TIME is published by the MOOSDB.
+  if((chunk.vname.length() == 0) && (varname == "DB_TIME")) {
+    string var_src = line.getSourceName();
+    biteString(var_src, '_');
+    chunk.vname = var_src;
+  }
 
-      string sval    = tolower(getDataEntry(line_raw));
+  if(varname == "NODE_REPORT_LOCAL") {
+    if((chunk.vtypes.size() == 0) || (chunk.vtypes.back() == "")) {
+      string sval    = tolower(line.getDataEntry());
       string vtype   = tokStringParse(sval, "type", ',', '=');      
       string vlength = tokStringParse(sval, "length", ',', '=');      
-      if(vtype != "")
-	m_vtype   = vtype;
-      if(vlength != "")
-	m_vlength = vlength;
+      chunk.vtypes.push_back(vtype);
+      chunk.vlengths.push_back(vlength);
     }
+  }
 
-    // Part 2: Check if the file ptr for this variable already exists. 
-    // If not, create a new file pointer and add it to the map.
-    FILE *file_ptr = 0;
-    if(m_file_ptr.count(varname) == 1) 
-      file_ptr = m_file_ptr[varname];
-    else {
-      string new_file = m_basedir + "/" + varname + ".klog"; 
-      FILE *new_ptr = fopen(new_file.c_str(), "a");
-      if(new_ptr) {
-	m_file_ptr[varname] = new_ptr;
-	file_ptr = new_ptr;
-      }
-      else {
-	cout << "Unable to open new file for VarName: " << varname << endl;
-	break;
-      }
-    }
-     
-    // Part 3: Update the type information
-    if(m_var_type[varname] != "string") {
-      string vardata = getDataEntry(line_raw);
-      if(!isNumber(vardata))
-	m_var_type[varname] = "string";
-      else
-	m_var_type[varname] = "double";
+  addLine(chunk, varname, line, line.getLine());
+}
+
+//--------------------------------------------------------
+// Procedure: splitHelmLine
+//   Purpose: Handle a BHV_IPF line given the current helm iteration
+//            in the chunk. E.g.,
+//            P,waypt_return^445,1,1,H,16,445:waypt_return,2,35,1,100,D,
+
+void SplitHandler::splitHelmLine(const ALogLineView& line, 
+				 SplitChunk& chunk) const
+{
+  string line_raw = line.getLine();
+  string sval = line.getDataEntry();
+
+  // A binary IvP function is logged by pLogger as a reference
+  // into the .blog file. Pull the bytes and store them hex coded
+  // so the klog file stays line oriented, with the behavior
+  // (source aux) and iteration in the same place as a P packet:
+  // B,waypt_return^445,495046420110...
+  if(strBegins(sval, "<MOOS_BINARY>")) {
+    string bytes = readBinaryEntry(sval, chunk);
+    if(bytes == "")
+      return;
+    string bhv_src = line.getSourceName();
+    biteString(bhv_src, ':');
+    bhv_src = biteString(bhv_src, '@');
+    string bval = "B," + bhv_src + "^" + chunk.helm_iter + ",";
+    bval += binaryToHex(bytes);
+    line_raw = findReplace(line_raw, sval, bval);
+    sval = bval;
+  }
+  biteString(sval, ',');                   
+  string bhv_name  = biteString(sval, ',');      
+  if(strContains(bhv_name, '^'))
+    bhv_name = biteString(bhv_name, '^');
+  else if(chunk.helm_iter != "")
+    bhv_name = findReplace(bhv_name, chunk.helm_iter, "");
+  chunk.bhv_names.insert(bhv_name);
+
+  addLine(chunk, "BHV_IPF_" + bhv_name, line, line_raw);
+}
+
+//--------------------------------------------------------
+// Procedure: addLine
+//   Purpose: Add the line to the given variable, updating its type
+//            and source information from the line as logged.
+
+void SplitHandler::addLine(SplitChunk& chunk, const string& varname,
+			   const ALogLineView& line, 
+			   const string& line_raw) const
+{
+  SplitVarData& var = chunk.vars[varname];
+  var.lines += line_raw;
+  var.lines += '\n';
+
+  if(!var.is_string && !isNumber(line.getDataEntry()))
+    var.is_string = true;
+
+  var.srcs.insert(line.getSourceNameNoAux());
+}
+
+//--------------------------------------------------------
+// Procedure: mergeChunk
+//   Purpose: Merge a split chunk into the handler, and write its
+//            lines to the klog files. Chunks are merged in order.
+//      Note: Held BHV_IPF lines all come before the first helm
+//            iteration in the chunk, so they are split now with the
+//            iteration carried over from the prior chunk, and merged
+//            ahead of the rest of the chunk.
+
+bool SplitHandler::mergeChunk(SplitChunk& chunk)
+{
+  bool ok = true;
+  if(chunk.pending.size() != 0) {
+    SplitChunk prior;
+    prior.iter_known = true;
+    prior.helm_iter  = m_curr_helm_iter;
+    prior.blog_file  = chunk.blog_file;
+    prior.blog_name  = chunk.blog_name;
+
+    ALogLineView line;
+    for(unsigned int i=0; i<chunk.pending.size(); i++) {
+      const string& line_raw = chunk.pending[i];
+      line.set(line_raw.c_str(), (unsigned int)(line_raw.length()));
+      splitHelmLine(line, prior);
     }
+    chunk.blog_file = prior.blog_file;
+    chunk.blog_name = prior.blog_name;
+    prior.blog_file = 0;
+    ok = mergeResults(prior);
+  }
 
-    // Part 4: Update the source information
-    string varsrc = getSourceNameNoAux(line_raw);
-    m_var_srcs[varname].insert(varsrc);
+  ok = ok && mergeResults(chunk);
+  if(chunk.iter_known)
+    m_curr_helm_iter = chunk.helm_iter;
+  return(ok);
+}
+
+//--------------------------------------------------------
+// Procedure: mergeResults
 
-    // Part 5: Write the line to the appropriate file
-    fprintf(file_ptr, "%s\n", line_raw.c_str());
+bool SplitHandler::mergeResults(const SplitChunk& chunk)
+{
+  if(m_time_min == "")
+    m_time_min = chunk.time_min;
+  if(chunk.time_max != "")
+    m_time_max = chunk.time_max;
+
+  if(m_vname.length() == 0)
+    m_vname = chunk.vname;
+
+  for(unsigned int i=0; (i<chunk.vtypes.size()) && (m_vtype == ""); i++) {
+    if(chunk.vtypes[i] != "")
+      m_vtype = chunk.vtypes[i];
+    if(chunk.vlengths[i] != "")
+      m_vlength = chunk.vlengths[i];
   }
 
-  if(m_verbose)
-    cout << "Done writing to klog files. Total files: " << m_file_ptr.size() << endl;
+  m_bhv_names.insert(chunk.bhv_names.begin(), chunk.bhv_names.end());
 
-  // Close all the file pointers before finishing
-  map<string, FILE*>::iterator p;
-  for(p=m_file_ptr.begin(); p!=m_file_ptr.end(); p++) {
-    FILE *ptr = p->second;
-    fclose(ptr);
+  map<string, SplitVarData>::const_iterator p;
+  for(p=chunk.vars.begin(); p!=chunk.vars.end(); p++) {
+    const string& varname = p->first;
+    const SplitVarData& var = p->second;
+
+    if(var.is_string)
+      m_var_type[varname] = "string";
+    else if(m_var_type[varname] != "string")
+      m_var_type[varname] = "double";
+
+    m_var_srcs[varname].insert(var.srcs.begin(), var.srcs.end());
+
+    if(!writeKLog(varname, var.lines))
+      return(false);
   }
+  return(true);
+}
+
+//--------------------------------------------------------
+// Procedure: writeKLog
+//   Purpose: Buffer lines for the given variable's klog file,
+//            writing them out once the buffer is large enough.
+
+bool SplitHandler::writeKLog(const string& varname, const string& lines)
+{
+  string& buff = m_klog_buff[varname];
+  buff += lines;
+  if(buff.length() < m_klog_buff_size)
+    return(true);
+  return(flushKLog(varname));
+}
+
+//--------------------------------------------------------
+// Procedure: flushKLog
+//   Purpose: Write out the buffered lines of the given variable.
+//            Files are opened for appending, so when the cap on 
+//            open files is reached the longest open one is closed
+//            and simply opened again when next needed.
 
-  if(file_in)
-    fclose(file_in);
+bool SplitHandler::flushKLog(const string& varname)
+{
+  string& buff = m_klog_buff[varname];
+  if(buff.length() == 0)
+    return(true);
 
+  FILE *file_ptr = 0;
+  map<string, FILE*>::iterator p = m_file_ptr.find(varname);
+  if(p != m_file_ptr.end())
+    file_ptr = p->second;
+  else {
+    if((m_file_ptr.size() >= m_max_open) && (m_open_order.size() > 0)) {
+      string oldest = m_open_order.front();
+      m_open_order.pop_front();
+      fclose(m_file_ptr[oldest]);
+      m_file_ptr.erase(oldest);
+    }
+    string new_file = m_basedir + "/" + varname + ".klog"; 
+    file_ptr = fopen(new_file.c_str(), "a");
+    if(!file_ptr) {
+      cout << "Unable to open new file for VarName: " << varname << endl;
+      return(false);
+    }
+    m_file_ptr[varname] = file_ptr;
+    m_open_order.push_back(varname);
+  }
+    
+  fwrite(buff.c_str(), 1, buff.length(), file_ptr);
+  buff.clear();
   return(true);
 }
 
+//--------------------------------------------------------
+// Procedure: closeKLogs
+//   Purpose: Write out all buffered lines and close all klog files.
+
+bool SplitHandler::closeKLogs()
+{
+  bool ok = true;
+  map<string, string>::iterator p;
+  for(p=m_klog_buff.begin(); p!=m_klog_buff.end(); p++)
+    ok = flushKLog(p->first) && ok;
+
+  map<string, FILE*>::iterator q;
+  for(q=m_file_ptr.begin(); q!=m_file_ptr.end(); q++)
+    fclose(q->second);
+  m_file_ptr.clear();
+  m_open_order.clear();
+  return(ok);
+}
+
+//--------------------------------------------------------
+// Procedure: readBinaryEntry
+//   Purpose: Given the alog entry of a binary posting, e.g.,
+//            <MOOS_BINARY>File=X.blog,Offset=97,Bytes=220</MOOS_BINARY>
+//            return the bytes from the .blog file. The file is named
+//            without a path by pLogger, so look for it next to the
+//            alog file. Each chunk keeps its own handle on the file.
+//            Returns empty string on failure.
+
+string SplitHandler::readBinaryEntry(const string& entry, 
+				     SplitChunk& chunk) const
+{
+  string spec = findReplace(entry, "<MOOS_BINARY>", "");
+  spec = findReplace(spec, "</MOOS_BINARY>", "");
+  
+  string file = tokStringParse(spec, "File", ',', '=');
+  string offs = tokStringParse(spec, "Offset", ',', '=');
+  string size = tokStringParse(spec, "Bytes", ',', '=');
+  if((file == "") || !isNumber(offs) || !isNumber(size))
+    return("");
+  
+  if(file != chunk.blog_name) {
+    if(chunk.blog_file)
+      fclose(chunk.blog_file);
+    chunk.blog_name = file;
+    string alog_dir;
+    string::size_type pos = m_alog_file.rfind('/');
+    if((pos != string::npos) && (file.find('/') == string::npos))
+      alog_dir = m_alog_file.substr(0, pos+1);
+    chunk.blog_file = fopen((alog_dir + file).c_str(), "rb");
+    if(!chunk.blog_file && m_verbose)
+      cout << "Unable to open binary log: " << alog_dir + file << endl;
+  }
+  if(!chunk.blog_file)
+    return("");
+
+  long offset = atol(offs.c_str());
+  size_t bytes = (size_t)(atol(size.c_str()));
+  if((offset < 0) || (bytes == 0) || 
+     (fseek(chunk.blog_file, offset, SEEK_SET) != 0))
+    return("");
+
+  string rstr(bytes, '\0');
+  if(fread(&rstr[0], 1, bytes, chunk.blog_file) != bytes)
+    return("");
+  return(rstr);
+}
+
 //--------------------------------------------------------
 // Procedure: handleMakeSplitSummary()
 
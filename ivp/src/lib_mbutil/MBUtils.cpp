@@ -28,6 +28,7 @@
 #include <ctype.h>
 #include <iostream>
 #include "MBUtils.h"
+#include "StrView.h"
 
 //added for time support in W32 platforms PMN  - 18 July 2005
 #ifdef _WIN32
@@ -48,26 +49,13 @@ using namespace std;
 
 vector<string> parseString(const string& string_str, char separator)
 {
-  const char *str = string_str.c_str();
-
-  char *buff = new char[strlen(str)+1];
-
   vector<string> rvector;
 
-  while(str[0] != '\0') {    
-    int i=0;
-    while((str[i]!=separator)&&(str[i]!='\0'))
-      i++;
-    strncpy(buff, str, i);
-    buff[i] = '\0';
-    string nstr = buff;
+  StrSplitter splitter(string_str.c_str(), separator);
+  StrView tok;
+  while(splitter.next(tok))
+    rvector.push_back(tok.str());
 
-    rvector.push_back(nstr);
-    str += i;
-    if(str[0]==separator)
-      str++;
-  }
-  delete [] buff;
   return(rvector);
 }
 
@@ -89,36 +77,13 @@ vector<string> parseString(const string& string_str, char separator)
 
 vector<string> parseStringQ(const string& string_str, char separator)
 {
-  bool in_quotes = false;
-
-  unsigned int  brace_count = 0;
-
-  const char *str = string_str.c_str();
-  char *buff = new char[strlen(str)+1];
   vector<string> rvector;
-  while(str[0] != '\0') {    
-    int i=0;
-    while(((str[i]!=separator) || in_quotes || (brace_count>0)) && (str[i]!='\0')) {
-      if(str[i]=='"')
-	in_quotes = !in_quotes;
-      else if(str[i]=='{')
-	brace_count++;
-      else if(str[i]=='}') {
-	if(brace_count > 0)
-	  brace_count--;
-      }
-      i++;
-    }
-    strncpy(buff, str, i);
-    buff[i] = '\0';
-    string nstr = buff;
 
-    rvector.push_back(nstr);
-    str += i;
-    if(str[0]==separator)
-      str++;
-  }
-  delete [] buff;
+  StrSplitter splitter(string_str.c_str(), separator, true);
+  StrView tok;
+  while(splitter.next(tok))
+    rvector.push_back(tok.str());
+
   return(rvector);
 }
 
@@ -243,13 +208,29 @@ vector<string> parseStringQ(const string& string_str, char separator,
 vector<string> parseString(const string& string_str, 
 			   const string& separator)
 {
-  string new_separator;
-  char   unique_char = (char)129;
-  new_separator += unique_char;
+  char unique_char = (char)129;
 
-  string new_string = findReplace(string_str, separator, new_separator);
+  // The separators were once replaced by a unique char before the 
+  // split. Keep that behavior for the odd cases it affects.
+  if((separator.length() == 0) || strContains(string_str, unique_char)) {
+    string new_separator;
+    new_separator += unique_char;
+    string new_string = findReplace(string_str, separator, new_separator);
+    return(parseString(new_string, unique_char));
+  }
 
-  vector<string> rvector = parseString(new_string, unique_char);
+  vector<string> rvector;
+
+  string::size_type len  = strlen(string_str.c_str());
+  string::size_type slen = separator.length();
+  string::size_type posn = 0;
+  while(posn < len) {
+    string::size_type ix = string_str.find(separator, posn);
+    if((ix == string::npos) || (ix > len))
+      ix = len;
+    rvector.push_back(string_str.substr(posn, ix-posn));
+    posn = ix + slen;
+  }
 
   return(rvector);
 }
@@ -1180,6 +1161,22 @@ string svectorToString(const vector<string>& svector, char separator)
 }
     
 
+//----------------------------------------------------------------
+// Procedure: tokPair
+//      Note: Split a token of tokParse() into its left and right
+//            parts. True only if parseString(tok, lsep) would give
+//            exactly two parts, as tokParse() has always required.
+
+static bool tokPair(const StrView& tok, char lsep, 
+		    StrView& tok_left, StrView& tok_right)
+{
+  StrSplitter splitter(tok, lsep);
+  StrView extra;
+  if(!splitter.next(tok_left) || !splitter.next(tok_right))
+    return(false);
+  return(!splitter.next(extra));
+}
+
 //----------------------------------------------------------------
 // Procedure: tokParse
 //   Example: info  = "fruit=apple, drink=water, temp=98.6";
@@ -1190,14 +1187,13 @@ bool tokParse(const string& str, const string& left,
 	       char gsep, char lsep, string& rstr)
 {
   rstr = "error";
-  vector<string> svector1 = parseStringQ(str, gsep);
-  for(vector<string>::size_type i=0; i<svector1.size(); i++) {
-    vector<string> svector2 = parseString(svector1[i], lsep);
-    if(svector2.size() != 2)
+  StrSplitter splitter(str.c_str(), gsep, true);
+  StrView tok, tok_left, tok_right;
+  while(splitter.next(tok)) {
+    if(!tokPair(tok, lsep, tok_left, tok_right))
       return(false);
-    svector2[0] = stripBlankEnds(svector2[0]);
-    if(svector2[0] == left) {
-      rstr = svector2[1];
+    if(tok_left.stripBlankEnds() == left) {
+      rstr = tok_right.str();
       return(true);
     }
   }
@@ -1216,14 +1212,13 @@ bool tokParse(const string& str, const string& left,
 string tokStringParse(const string& str, const string& left, 
 		      char gsep, char lsep)
 {
-  vector<string> svector1 = parseStringQ(str, gsep);
-  for(vector<string>::size_type i=0; i<svector1.size(); i++) {
-    vector<string> svector2 = parseString(svector1[i], lsep);
-    if(svector2.size() != 2)
+  StrSplitter splitter(str.c_str(), gsep, true);
+  StrView tok, tok_left, tok_right;
+  while(splitter.next(tok)) {
+    if(!tokPair(tok, lsep, tok_left, tok_right))
       return("");
-    svector2[0] = stripBlankEnds(svector2[0]);
-    if(svector2[0] == left)
-      return(stripBlankEnds(svector2[1]));
+    if(tok_left.stripBlankEnds() == left)
+      return(tok_right.stripBlankEnds().str());
   }
   return("");
 }
@@ -1240,14 +1235,13 @@ string tokStringParse(const string& str, const string& left,
 double tokDoubleParse(const string& str, const string& left, 
 		      char gsep, char lsep)
 {
-  vector<string> svector1 = parseString(str, gsep);
-  for(vector<string>::size_type i=0; i<svector1.size(); i++) {
-    vector<string> svector2 = parseString(svector1[i], lsep);
-    if(svector2.size() != 2)
+  StrSplitter splitter(str.c_str(), gsep);
+  StrView tok, tok_left, tok_right;
+  while(splitter.next(tok)) {
+    if(!tokPair(tok, lsep, tok_left, tok_right))
       return(0);
-    svector2[0] = stripBlankEnds(svector2[0]);
-    if(svector2[0] == left)
-      return(atof(svector2[1].c_str()));
+    if(tok_left.stripBlankEnds() == left)
+      return(tok_right.atof());
   }
   return(0);
 }
@@ -1455,6 +1449,66 @@ bool isNumber(const string& str, bool blanks_allowed)
   return(ok);
 }
 
+//----------------------------------------------------------------
+// Procedure: parseDouble
+//   Purpose: Fast conversion of the numbers found in logs and
+//            reports, e.g., 1234.567, without a string copy. Handles
+//            an optional minus sign, digits and one decimal point.
+//            When all the digits fit exactly in a double the result
+//            is a single correctly rounded division, identical to
+//            atof(). Any other form falls back to isNumber() and
+//            atof().
+//   Returns: false if the text is not a number per isNumber().
+
+bool parseDouble(const char *str, unsigned int len, double& val)
+{
+  static const double pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6,
+				 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13,
+				 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+				 1e20, 1e21, 1e22};
+
+  unsigned int i = 0;
+  bool negative = false;
+  if((len > 0) && (str[0] == '-')) {
+    negative = true;
+    i++;
+  }
+
+  unsigned long long mant = 0;
+  unsigned int digits = 0;
+  unsigned int fdigits = 0;
+  bool decimal = false;
+  bool simple  = true;
+  for(; (i<len) && simple; i++) {
+    char c = str[i];
+    if((c >= '0') && (c <= '9')) {
+      mant = (mant * 10) + (unsigned long long)(c - '0');
+      digits++;
+      if(decimal)
+	fdigits++;
+    }
+    else if((c == '.') && !decimal)
+      decimal = true;
+    else
+      simple = false;
+  }
+
+  // 2^53: the largest range over which every integer is exact
+  if(simple && (digits > 0) && (digits <= 18) && (fdigits <= 22) &&
+     (mant <= 9007199254740992ULL)) {
+    val = (double)(mant) / pow10[fdigits];
+    if(negative)
+      val = -val;
+    return(true);
+  }
+
+  string sval(str, len);
+  if(!isNumber(sval))
+    return(false);
+  val = atof(sval.c_str());
+  return(true);
+}
+
 //----------------------------------------------------------------
 // Procedure: isQuoted
 //      Note: Returns true if the given string begins and ends w/
@@ -1558,6 +1612,57 @@ string doubleToHex(double g_val)
   return(str);
 }
 
+//----------------------------------------------------------------
+// Procedure: binaryToHex
+//     Notes: Convert arbitrary bytes to a string of hex digit pairs
+//            so binary data may be stored in a line oriented text 
+//            file. Two characters per byte, upper case.
+//  Examples: "AB" --> "4142"
+
+string binaryToHex(const string& str)
+{
+  static const char *digits = "0123456789ABCDEF";
+
+  string rstr(str.length() * 2, '0');
+  for(string::size_type i=0; i<str.length(); i++) {
+    unsigned char c = (unsigned char)(str[i]);
+    rstr[i*2]   = digits[c >> 4];
+    rstr[i*2+1] = digits[c & 0x0F];
+  }
+  return(rstr);
+}
+
+//----------------------------------------------------------------
+// Procedure: hexToBinary
+//     Notes: Inverse of binaryToHex. Returns an empty string if the
+//            input has odd length or a non hex digit.
+
+string hexToBinary(const string& str)
+{
+  string::size_type len = str.length();
+  if((len % 2) != 0)
+    return("");
+
+  string rstr(len / 2, '\0');
+  for(string::size_type i=0; i<len; i++) {
+    char c = str[i];
+    int  val = 0;
+    if((c >= '0') && (c <= '9'))
+      val = c - '0';
+    else if((c >= 'A') && (c <= 'F'))
+      val = c - 'A' + 10;
+    else if((c >= 'a') && (c <= 'f'))
+      val = c - 'a' + 10;
+    else
+      return("");
+    if((i % 2) == 0)
+      rstr[i/2] = (char)(val << 4);
+    else
+      rstr[i/2] = (char)(rstr[i/2] | val);
+  }
+  return(rstr);
+}
+
 //----------------------------------------------------------------
 // Procedure: getArg
 //     Note1: Searches the array of stings (argv) looking for a 
@@ -88,6 +88,8 @@ std::string stripComment(const std::string&, const std::string&);
 std::string stripQuotes(const std::string&);
 std::string stripBraces(const std::string&);
 std::string doubleToHex(double);
+std::string binaryToHex(const std::string&);
+std::string hexToBinary(const std::string&);
 
 std::string svectorToString(const std::vector<std::string>&, char=',');
 
@@ -119,6 +121,7 @@ double randomDouble(double min=0, double max=1);
 
 bool  isBoolean(const std::string&);
 bool  isNumber(const std::string&, bool=true);
+bool  parseDouble(const char*, unsigned int len, double&);
 bool  isAlphaNum(const std::string&, const std::string& s="");
 bool  isQuoted(const std::string&);
 bool  isBraced(const std::string&);
@@ -0,0 +1,241 @@
+/*****************************************************************/
+/*    NAME: agent                                                */
+/*    FILE: StrView.cpp                                          */
+/*    DATE: Oct 18th, 2026                                       */
+/*                                                               */
+/* This file is part of MOOS-IvP                                 */
+/*                                                               */
+/* MOOS-IvP is free software: you can redistribute it and/or     */
+/* modify it under the terms of the GNU General Public License   */
+/* as published by the Free Software Foundation, either version  */
+/* 3 of the License, or (at your option) any later version.      */
+/*                                                               */
+/* MOOS-IvP is distributed in the hope that it will be useful,   */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty   */
+/* of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See  */
+/* the GNU General Public License for more details.              */
+/*                                                               */
+/* You should have received a copy of the GNU General Public     */
+/* License along with MOOS-IvP.  If not, see                     */
+/* <http://www.gnu.org/licenses/>.                               */
+/*****************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include "StrView.h"
+#include "MBUtils.h"
+
+using namespace std;
+
+//----------------------------------------------------------------
+// Constructor
+
+StrView::StrView(const char *str)
+{
+  m_str = str;
+  m_len = strlen(str);
+}
+
+//----------------------------------------------------------------
+// Procedure: operator==
+
+bool StrView::operator==(const StrView& sv) const
+{
+  if(m_len != sv.m_len)
+    return(false);
+  return(memcmp(m_str, sv.m_str, m_len) == 0);
+}
+
+//----------------------------------------------------------------
+// Procedure: equalsNoCase
+
+bool StrView::equalsNoCase(const StrView& sv) const
+{
+  if(m_len != sv.m_len)
+    return(false);
+  for(unsigned int i=0; i<m_len; i++) {
+    char c1 = m_str[i];
+    char c2 = sv.m_str[i];
+    if((c1 >= 'A') && (c1 <= 'Z'))
+      c1 += ('a' - 'A');
+    if((c2 >= 'A') && (c2 <= 'Z'))
+      c2 += ('a' - 'A');
+    if(c1 != c2)
+      return(false);
+  }
+  return(true);
+}
+
+//----------------------------------------------------------------
+// Procedure: contains
+
+bool StrView::contains(char c) const
+{
+  return(memchr(m_str, c, m_len) != 0);
+}
+
+//----------------------------------------------------------------
+// Procedure: find
+//   Returns: Index of the first c at or after start, or -1.
+
+int StrView::find(char c, unsigned int start) const
+{
+  for(unsigned int i=start; i<m_len; i++)
+    if(m_str[i] == c)
+      return((int)(i));
+  return(-1);
+}
+
+//----------------------------------------------------------------
+// Procedure: substr
+
+StrView StrView::substr(unsigned int ix, unsigned int len) const
+{
+  if(ix >= m_len)
+    return(StrView(m_str + m_len, 0));
+  if(len > (m_len - ix))
+    len = m_len - ix;
+  return(StrView(m_str + ix, len));
+}
+
+//----------------------------------------------------------------
+// Procedure: stripBlankEnds
+
+StrView StrView::stripBlankEnds() const
+{
+  unsigned int beg = 0;
+  unsigned int end = m_len;
+  while((beg < end) && ((m_str[beg] == ' ') || (m_str[beg] == '\t')))
+    beg++;
+  while((end > beg) && ((m_str[end-1] == ' ') || (m_str[end-1] == '\t')))
+    end--;
+  return(StrView(m_str + beg, end - beg));
+}
+
+//----------------------------------------------------------------
+// Procedure: biteString
+//   Example: sv = "apples, pears, bananas"
+//            front = sv.biteString(',')
+//            front = "apples"
+//            sv = " pears, bananas"
+
+StrView StrView::biteString(char separator)
+{
+  int ix = find(separator);
+  if(ix < 0) {
+    StrView front = *this;
+    m_str += m_len;
+    m_len = 0;
+    return(front);
+  }
+
+  StrView front(m_str, ix);
+  m_str += ix + 1;
+  m_len -= ix + 1;
+  return(front);
+}
+
+//----------------------------------------------------------------
+// Procedure: biteStringX
+//      Note: Same as biteString except blank ends will be removed
+//            from both the returned and remaining value.
+
+StrView StrView::biteStringX(char separator)
+{
+  StrView front = biteString(separator).stripBlankEnds();
+  *this = stripBlankEnds();
+  return(front);
+}
+
+//----------------------------------------------------------------
+// Procedure: toDouble
+
+bool StrView::toDouble(double& val) const
+{
+  return(parseDouble(m_str, m_len, val));
+}
+
+//----------------------------------------------------------------
+// Procedure: atof
+
+double StrView::atof() const
+{
+  double val = 0;
+  if(parseDouble(m_str, m_len, val))
+    return(val);
+  return(::atof(str().c_str()));
+}
+
+//----------------------------------------------------------------
+// Constructor
+
+StrSplitter::StrSplitter(const StrView& str, char sep, bool protect)
+{
+  m_str         = str;
+  m_sep         = sep;
+  m_protect     = protect;
+  m_pos         = 0;
+  m_in_quotes   = false;
+  m_brace_count = 0;
+}
+
+//----------------------------------------------------------------
+// Procedure: next
+//      Note: As in parseString(), a separator at the very end does
+//            not begin an empty final token, but two in a row give
+//            an empty token between them.
+
+bool StrSplitter::next(StrView& tok)
+{
+  unsigned int len = m_str.length();
+  if(m_pos >= len)
+    return(false);
+
+  const char *str = m_str.data();
+  unsigned int i = m_pos;
+  if(!m_protect) {
+    while((i < len) && (str[i] != m_sep))
+      i++;
+  }
+  else {
+    while((i < len) && 
+	  ((str[i] != m_sep) || m_in_quotes || (m_brace_count > 0))) {
+      if(str[i] == '"')
+	m_in_quotes = !m_in_quotes;
+      else if(str[i] == '{')
+	m_brace_count++;
+      else if((str[i] == '}') && (m_brace_count > 0))
+	m_brace_count--;
+      i++;
+    }
+  }
+
+  tok = StrView(str + m_pos, i - m_pos);
+  m_pos = i;
+  if(m_pos < len)
+    m_pos++;
+  return(true);
+}
+
+//----------------------------------------------------------------
+// Constructor
+
+StrParamIter::StrParamIter(const StrView& str, char sep, char eq,
+			   bool protect) : m_splitter(str, sep, protect)
+{
+  m_eq = eq;
+}
+
+//----------------------------------------------------------------
+// Procedure: next
+
+bool StrParamIter::next(StrView& param, StrView& value)
+{
+  StrView tok;
+  if(!m_splitter.next(tok))
+    return(false);
+
+  param = tok.biteStringX(m_eq);
+  value = tok;
+  return(true);
+}
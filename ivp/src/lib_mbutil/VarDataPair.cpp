@@ -37,6 +37,7 @@ VarDataPair::VarDataPair()
   m_ddata     = 0;
   m_is_string = false;
   m_is_quoted = false;
+  m_is_binary = false;
 }
 
 //------------------------------------------------------------------
@@ -49,6 +50,7 @@ VarDataPair::VarDataPair(const string& var, double ddata)
   m_ddata     = ddata;
   m_is_string = false;
   m_is_quoted = false;
+  m_is_binary = false;
 }
 
 //------------------------------------------------------------------
@@ -61,6 +63,7 @@ VarDataPair::VarDataPair(const string& var, const string& sdata)
   m_ddata     = 0;
   m_is_string = true;
   m_is_quoted = false;
+  m_is_binary = false;
   if(isQuoted(sdata))
     m_is_quoted = true;
 }
@@ -76,6 +79,7 @@ VarDataPair::VarDataPair(const string& var, const string& sdata,
   m_var   = stripBlankEnds(var);
   m_ddata = 0;
   m_is_quoted = false;
+  m_is_binary = false;
 
   string data = stripBlankEnds(sdata);
 
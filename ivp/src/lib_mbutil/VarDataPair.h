@@ -47,12 +47,15 @@ public:
   void        set_ptype(const std::string& s) {m_ptype=s;}
   void        set_sdata(const std::string& s) {m_sdata=s; m_is_string=true;}
   void        set_ddata(double v)             {m_ddata=v; m_is_string=false;}
+  void        set_bdata(const std::string& s) 
+    {m_sdata=s; m_is_string=true; m_is_binary=true;}
 
   std::string get_var()   const {return(m_var);}
   std::string get_sdata() const {return(m_sdata);}
   double      get_ddata() const {return(m_ddata);}
   bool        is_string() const {return(m_is_string);}
   bool        is_quoted() const {return(m_is_quoted);}
+  bool        is_binary() const {return(m_is_binary);}
   std::string get_key()   const {return(m_key);}
   std::string get_ptype() const {return(m_ptype);}
 
@@ -64,6 +67,7 @@ protected:
   double      m_ddata;
   bool        m_is_string;
   bool        m_is_quoted;
+  bool        m_is_binary;
   std::string m_key;
   std::string m_ptype;
 };
@@ -145,21 +145,19 @@ void DataGrid::handleNodeReport(string str)
   double posy = record.getY();
   double depth = record.getDepth();
 
-  unsigned index, gsize = m_grid.size();
-  for(index=0; index<gsize; index++) {
-    bool contained = m_grid.ptIntersect(index, posx, posy);
-    if(contained) {
-    	double numDepths=m_grid.getVal(index,1);
-    	if(numDepths<.5){
-    		m_grid.setVal(index,depth,0);
-    	}else{
-    		double depthAvgOld=m_grid.getVal(index,0);
-    		double depthAvgNew=(depthAvgOld*numDepths+depth)/(numDepths+1.0);
-    		m_grid.setVal(index,depthAvgNew,0);
-    	}
-    	m_grid.incVal(index,1,1);
-      //m_grid.setVal(index,depth,0);
+  vector<unsigned int> cells = m_grid.ptIntersectCells(posx, posy);
+  for(unsigned int i=0; i<cells.size(); i++) {
+    unsigned int index = cells[i];
+    double numDepths=m_grid.getVal(index,1);
+    if(numDepths<.5){
+      m_grid.setVal(index,depth,0);
+    }else{
+      double depthAvgOld=m_grid.getVal(index,0);
+      double depthAvgNew=(depthAvgOld*numDepths+depth)/(numDepths+1.0);
+      m_grid.setVal(index,depthAvgNew,0);
     }
+    m_grid.incVal(index,1,1);
+    //m_grid.setVal(index,depth,0);
   }
 
 }
@@ -27,15 +27,54 @@
 
 #include <iostream>
 #include <string>
+#include <ctime>
+#ifndef _WIN32
+#include <sys/time.h>
+#endif
 #include "HelmEngine.h"
 #include "MBUtils.h"
 #include "MBTimer.h"
 #include "IO_Utilities.h"
 #include "IvPProblem.h"
+#include "IvPProblem_Par.h"
 #include "BehaviorSet.h"
 
 using namespace std;
 
+//-----------------------------------------------------------
+// Procedure: getWallTime
+//   Purpose: Wall clock time in seconds, fine-grained enough to time
+//            individual behaviors.
+
+static double getWallTime()
+{
+#ifndef _WIN32
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  return((double)(tv.tv_sec) + ((double)(tv.tv_usec) / 1000000.0));
+#else
+  return((double)(clock()) / CLOCKS_PER_SEC);
+#endif
+}
+
+//-----------------------------------------------------------
+// Procedure: getThreadCPUTime
+//   Purpose: CPU time in seconds used by the calling thread. The 
+//            MBTimer cpu time covers the whole process and so is 
+//            not meaningful for behaviors produced concurrently.
+//            Used for every behavior, produced concurrently or not,
+//            so the times in the helm report compare.
+
+static double getThreadCPUTime()
+{
+#if !defined(_WIN32) && defined(CLOCK_THREAD_CPUTIME_ID)
+  struct timespec ts;
+  if(clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+    return((double)(ts.tv_sec) + ((double)(ts.tv_nsec) / 1000000000.0));
+#endif
+  return((double)(clock()) / CLOCKS_PER_SEC);
+}
+
 //-----------------------------------------------------------
 // Procedure: Constructor
 
@@ -52,6 +91,14 @@ HelmEngine::HelmEngine(IvPDomain g_ivp_domain,
   m_max_loop_time   = 0;
   m_max_solve_time  = 0;
   m_max_create_time = 0;
+
+  m_solver_threads  = 1;
+  m_bhv_threads     = 1;
+  m_par_next        = 0;
+
+  m_solver_warm_start = false;
+  m_warm_problem      = 0;
+  m_warm_reused       = 0;
 }
 
 //-----------------------------------------------------------
@@ -60,6 +107,8 @@ HelmEngine::HelmEngine(IvPDomain g_ivp_domain,
 HelmEngine::~HelmEngine()
 {
   delete(m_ivp_problem);
+  delete(m_warm_problem);
+  clearPreparedOFs();
 }
 
 //------------------------------------------------------------------
@@ -74,6 +123,7 @@ HelmReport HelmEngine::determineNextDecision(BehaviorSet *bhv_set,
   m_curr_time   = curr_time;
   m_helm_report.clear();
   m_ivp_functions.clear();
+  m_ivp_sources.clear();
 
   bool filter_behaviors_present = bhv_set->filterBehaviorsPresent();
 
@@ -88,7 +138,12 @@ HelmReport HelmEngine::determineNextDecision(BehaviorSet *bhv_set,
     handled = handled && part3_VerifyFunctionDomains();
   }
 
-  handled = handled && part4_BuildAndSolveIvPProblem();
+  // Warm starting is not used when filter behaviors are present
+  // since the functions are then shared by two problems.
+  if(m_solver_warm_start && !filter_behaviors_present)
+    handled = handled && part4_SolveWarmStart();
+  else
+    handled = handled && part4_BuildAndSolveIvPProblem();
   handled = handled && part6_FinishHelmReport();
   return(m_helm_report);
 }
@@ -130,6 +185,10 @@ bool HelmEngine::part1_PreliminaryBehaviorSetHandling()
 // Procedure: part2_GetFunctionsFromBehaviorSet()
 //     Notes: Gets the IvP functions from behaviors and adds them 
 //            to the m_ivp_functions
+//     Notes: Functions of parallel-safe behaviors may have been 
+//            produced ahead of time on worker threads. Everything
+//            else - the remaining behaviors, report lines, state 
+//            bookkeeping - is handled here in behavior order.
 //
 //    Inputs: m_bhv_set, filter_level
 //   Outputs: m_ivp_functions, m_helm_report, timers
@@ -140,11 +199,27 @@ bool HelmEngine::part2_GetFunctionsFromBehaviorSet(int filter_level)
 
   // get all the objective functions and add time info to helm report
   m_create_timer.start();
+  part2_ProduceConcurrently(filter_level);
   for(bhv_ix=0; bhv_ix<bhv_cnt; bhv_ix++) {
     if(m_bhv_set->getFilterLevel(bhv_ix) == filter_level) {
       string bhv_state;
-      m_ipf_timer.start();
-      IvPFunction *newof = m_bhv_set->produceOF(bhv_ix, m_iteration, bhv_state);
+      IvPFunction *newof = 0;
+      double of_time   = 0;
+      double wall_time = 0;
+      if(m_par_done[bhv_ix]) {
+	newof     = m_par_ipf[bhv_ix];
+	bhv_state = m_par_state[bhv_ix];
+	of_time   = m_par_cpu[bhv_ix];
+	wall_time = m_par_wall[bhv_ix];
+	m_par_ipf[bhv_ix] = 0;
+      }
+      else {
+	double wall_start = getWallTime();
+	double cpu_start  = getThreadCPUTime();
+	newof = m_bhv_set->produceOF(bhv_ix, m_iteration, bhv_state);
+	of_time   = getThreadCPUTime() - cpu_start;
+	wall_time = getWallTime() - wall_start;
+      }
 #if 1
       BehaviorReport bhv_report;
 #endif     
@@ -152,7 +227,6 @@ bool HelmEngine::part2_GetFunctionsFromBehaviorSet(int filter_level)
       BehaviorReport bhv_report = m_bhv_set->produceOFX(bhv_ix, m_iteration, 
 							bhv_state);
 #endif
-      m_ipf_timer.stop();
   
       // Determine the amt of time the bhv has been in this state
       // double state_elapsed = m_bhv_set->getStateElapsed(bhv_ix);
@@ -166,6 +240,11 @@ bool HelmEngine::part2_GetFunctionsFromBehaviorSet(int filter_level)
 	if(!ok)
 	  bhv_error_str = " - unknown - ";
 	m_helm_report.setHaltMsg("BHV_ERROR: " + bhv_error_str);
+	delete(newof);
+	for(unsigned int i=0; i<m_par_ipf.size(); i++) {
+	  delete(m_par_ipf[i]);
+	  m_par_ipf[i] = 0;
+	}
 	m_create_timer.stop();
 	return(false);
       }
@@ -174,7 +253,6 @@ bool HelmEngine::part2_GetFunctionsFromBehaviorSet(int filter_level)
       string descriptor  = m_bhv_set->getDescriptor(bhv_ix);
       string report_line = descriptor;
       if(!bhv_report.isEmpty()) {
-	double of_time  = m_ipf_timer.get_float_cpu_time();
 	double pieces   = bhv_report.getAvgPieces();
 	double pwt      = bhv_report.getPriority();
 	string timestr  = doubleToString(of_time,2);
@@ -183,25 +261,20 @@ bool HelmEngine::part2_GetFunctionsFromBehaviorSet(int filter_level)
 	report_line += " pwt: " + doubleToString(pwt);
       }
 
-      if(newof) {
-	double of_time  = m_ipf_timer.get_float_cpu_time();
-	int    pieces   = newof->size();
-	string timestr  = doubleToString(of_time,2);
-	report_line += " produces obj-function - time:" + timestr;
-	report_line += " pcs: " + doubleToString(pieces);
-	report_line += " pwt: " + doubleToString(newof->getPWT());
-      }
+      // The rest of the line is only made if the messages are used
+      if(newof)
+	m_helm_report.addBhvMsg(report_line, of_time, newof->size(), 
+				newof->getPWT());
       else
-	report_line += " did NOT produce an obj-function";
-      m_helm_report.addMsg(report_line);
+	m_helm_report.addBhvMsg(report_line);
       
       if(newof) {
-	double of_time  = m_ipf_timer.get_float_cpu_time();
 	double pwt = newof->getPWT();
 	int    pcs = newof->size();
 	m_helm_report.addActiveBHV(descriptor, state_time_entered, pwt,
-				   pcs, of_time, upd_summary, 1);
+				   pcs, of_time, upd_summary, 1, wall_time);
 	m_ivp_functions.push_back(newof);
+	m_ivp_sources.push_back(descriptor);
       }
 
       if(bhv_state=="running")
@@ -222,6 +295,86 @@ bool HelmEngine::part2_GetFunctionsFromBehaviorSet(int filter_level)
   return(true);
 }
 
+//------------------------------------------------------------------
+// Procedure: part2_ProduceConcurrently()
+//   Purpose: Produce the functions of all parallel-safe behaviors at
+//            the given filter level on m_bhv_threads workers of the
+//            engine's thread pool. Each behavior posts only to its 
+//            own message queue, so the postings are still collected
+//            in behavior order later.
+//      Note: The rule: while the workers run, the info_buffer is 
+//            only read. Behaviors hold it by const pointer and no 
+//            const InfoBuffer method writes to it. Nothing else may
+//            set values or intern names until the run is done. A
+//            behavior may only ask to be run here if its type is
+//            declared parallel-safe, checked when it is built.
+//      Note: With fewer than two such behaviors, a single thread, or
+//            on a platform without pthreads, nothing is done here
+//            and all behaviors are produced in the ordered pass.
+
+void HelmEngine::part2_ProduceConcurrently(int filter_level)
+{
+  unsigned int i, bhv_cnt = m_bhv_set->size();
+  m_par_done.assign(bhv_cnt, 0);
+  m_par_ipf.assign(bhv_cnt, 0);
+  m_par_state.assign(bhv_cnt, "");
+  m_par_wall.assign(bhv_cnt, 0);
+  m_par_cpu.assign(bhv_cnt, 0);
+
+#ifndef _WIN32
+  if(m_bhv_threads <= 1)
+    return;
+
+  m_par_ix.clear();
+  for(i=0; i<bhv_cnt; i++) {
+    if((m_bhv_set->getFilterLevel(i) == filter_level) && 
+       m_bhv_set->parallelOK(i))
+      m_par_ix.push_back(i);
+  }
+  if(m_par_ix.size() <= 1)
+    return;
+
+  unsigned int threads = m_bhv_threads;
+  if(threads > m_par_ix.size())
+    threads = m_par_ix.size();
+
+  // Pool threads are started on first use and kept between 
+  // iterations. The calling thread acts as worker zero.
+  threads = m_bhv_pool.start(threads);
+  m_par_next = 0;
+  m_bhv_pool.run(threads, bhvWorkerEntry, this);
+#endif
+}
+
+//------------------------------------------------------------------
+// Procedure: part2_WorkerLoop()
+//   Purpose: Claim and produce behaviors until none remain. Results
+//            are written only to the slots of the claimed behavior.
+
+void HelmEngine::part2_WorkerLoop()
+{
+  unsigned int k = __sync_fetch_and_add(&m_par_next, 1);
+  while(k < m_par_ix.size()) {
+    unsigned int ix = m_par_ix[k];
+    double wall_start = getWallTime();
+    double cpu_start  = getThreadCPUTime();
+    m_par_ipf[ix]  = m_bhv_set->produceOF(ix, m_iteration, m_par_state[ix]);
+    m_par_cpu[ix]  = getThreadCPUTime() - cpu_start;
+    m_par_wall[ix] = getWallTime() - wall_start;
+    m_par_done[ix] = 1;
+    k = __sync_fetch_and_add(&m_par_next, 1);
+  }
+}
+
+//------------------------------------------------------------------
+// Procedure: bhvWorkerEntry()
+//   Purpose: Pool work function. Hands the worker to its engine.
+
+void HelmEngine::bhvWorkerEntry(void *arg, unsigned int)
+{
+  HelmEngine *engine = (HelmEngine*)(arg);
+  engine->part2_WorkerLoop();
+}
 
 //-----------------------------------------------------------
 // Procedure: part3_VerifyFunctionDomains()
@@ -320,8 +473,17 @@ bool HelmEngine::part4_BuildAndSolveIvPProblem(string phase)
     return(false);
   }
 
-  // Create, Prepare, and Solve the IvP problem
-  m_ivp_problem = new IvPProblem;
+  // Create (on the first iteration), Prepare, and Solve the IvP 
+  // problem. The problem is kept between iterations so its per-level
+  // working storage, and the threads of a parallel solver, are only
+  // set up once. Its functions and solution are cleared each time.
+  if(!m_ivp_problem) {
+    if(m_solver_threads > 1)
+      m_ivp_problem = new IvPProblem_Par(m_solver_threads);
+    else
+      m_ivp_problem = new IvPProblem;
+  }
+  m_ivp_problem->clearSolution();
   m_solve_timer.start();
   for(i=0; i<ipfs; i++)
       m_ivp_problem->addOF(m_ivp_functions[i]);
@@ -345,15 +507,233 @@ bool HelmEngine::part4_BuildAndSolveIvPProblem(string phase)
     }
   }    
   
+  // The prefilter functions are solved again after filtering
   if(phase == "prefilter")
-    m_ivp_problem->setOwnerIPFs(false);
-
-  delete(m_ivp_problem);
-  m_ivp_problem = 0;
+    m_ivp_problem->releaseIPFs();
+  else
+    m_ivp_problem->clearIPFs();
   
   return(true);
 }
 
+//------------------------------------------------------------------
+// Class: IPFSnapshot
+//   Purpose: Either record values to a snapshot, or check values 
+//            against a snapshot recorded before, in the same order,
+//            without copying them.
+
+class IPFSnapshot {
+public:
+  IPFSnapshot(vector<double>& snap, bool check) 
+    : m_snap(snap), m_check(check), m_ix(0) {if(!check) snap.clear();}
+
+  // Returns false at the first value differing from the snapshot
+  bool add(double val) {
+    if(!m_check) {
+      m_snap.push_back(val);
+      return(true);
+    }
+    if((m_ix >= m_snap.size()) || (m_snap[m_ix] != val))
+      return(false);
+    m_ix++;
+    return(true);
+  }
+  bool complete() const {return(!m_check || (m_ix == m_snap.size()));}
+
+protected:
+  vector<double>& m_snap;
+  bool            m_check;
+  unsigned int    m_ix;
+};
+
+//------------------------------------------------------------------
+// Procedure: snapshotIPF
+//   Purpose: Fill the given vector with all numeric content of the
+//            given IvP function: priority weight, domain extents and
+//            the bounds and interior weights of every piece. Two raw
+//            functions with equal snapshots (and domain var names)
+//            are the same function.
+//      Note: If check is true the vector is left unchanged, and true
+//            is returned only if the function matches it. The check
+//            stops at the first difference.
+
+static bool snapshotIPF(IvPFunction *ipf, vector<double>& snap, 
+			bool check=false)
+{
+  IPFSnapshot snapshot(snap, check);
+  PDMap *pdmap = ipf->getPDMap();
+  IvPDomain domain = pdmap->getDomain();
+
+  int dim = pdmap->getDim();
+  int pcs = pdmap->size();
+  bool ok = snapshot.add(ipf->getPWT()) && snapshot.add(dim) &&
+    snapshot.add(pdmap->getDegree()) && snapshot.add(pcs);
+  for(int d=0; ok && (d<dim); d++) {
+    ok = (snapshot.add(domain.getVarLow(d)) && 
+	  snapshot.add(domain.getVarHigh(d)) &&
+	  snapshot.add(domain.getVarPoints(d)));
+  }
+
+  for(int i=0; ok && (i<pcs); i++) {
+    const IvPBox *box = pdmap->getBox(i);
+    if(!box) {
+      ok = snapshot.add(-1);
+      continue;
+    }
+    for(int d=0; ok && (d<dim); d++) {
+      ok = (snapshot.add(box->pt(d,0)) && snapshot.add(box->pt(d,1)) &&
+	    snapshot.add(box->bd(d,0)) && snapshot.add(box->bd(d,1)));
+    }
+    int wtc = box->getWtc();
+    for(int k=0; ok && (k<wtc); k++)
+      ok = snapshot.add(box->wt(k));
+  }
+  return(ok && snapshot.complete());
+}
+
+//------------------------------------------------------------------
+// Procedure: part4_SolveWarmStart()
+//   Purpose: Same as part4_BuildAndSolveIvPProblem() except the IvP
+//            problem and the prepared functions are kept between
+//            iterations:
+//            (1) If a behavior produces the same function as on the 
+//                prior iteration, the new function is discarded and
+//                the prior one, already normalized, weighted, aligned
+//                to the domain and gridded, is used in its place.
+//            (2) The prior decision is given to the solver as an
+//                initial solution, so pruning starts from a good
+//                bound. If the prior decision is still among the 
+//                best, it is kept, i.e., ties favor the prior one.
+
+bool HelmEngine::part4_SolveWarmStart()
+{
+  unsigned int i, ipfs = m_ivp_functions.size(); 
+  m_helm_report.addMsg("Number of IvP Functions: " + intToString(ipfs)); 
+  m_helm_report.setOFNUM(ipfs);
+  if(ipfs == 0) {
+    m_helm_report.addMsg("No Decision due to zero IvP functions");
+    return(false);
+  }
+
+  if(!m_warm_problem) {
+    if(m_solver_threads > 1)
+      m_warm_problem = new IvPProblem_Par(m_solver_threads);
+    else
+      m_warm_problem = new IvPProblem;
+    m_warm_problem->setOwnerIPFs(false);
+  }
+
+  m_solve_timer.start();
+
+  // Prepared functions, and the prior decision, are only good for
+  // the domain they were prepared in.
+  if(!(m_sub_domain == m_prev_domain)) {
+    clearPreparedOFs();
+    m_prev_decision = IvPBox();
+  }
+
+  m_warm_problem->releaseIPFs();
+  m_warm_problem->clearSolution();
+
+  // The prepared functions are keyed on the source and domain vars.
+  // A key given by more than one function this iteration has no one
+  // prior function to be matched with, so those functions are not
+  // compared or kept. They are deleted once solved.
+  vector<string> keys(ipfs);
+  map<string, unsigned int> key_count;
+  for(i=0; i<ipfs; i++) {
+    IvPFunction *ipf = m_ivp_functions[i];
+    keys[i] = m_ivp_sources[i];
+    for(int j=0; j<ipf->getDim(); j++)
+      keys[i] += ":" + ipf->getVarName(j);
+    key_count[keys[i]]++;
+  }
+
+  map<string, IvPFunction*>    new_prep_ofs;
+  map<string, vector<double> > new_prep_snaps;
+  vector<IvPFunction*>         unkept_ofs;
+  m_warm_reused = 0;
+  for(i=0; i<ipfs; i++) {
+    IvPFunction *ipf = m_ivp_functions[i];
+    const string& key = keys[i];
+    if(key_count[key] > 1) {
+      m_warm_problem->addOF(ipf, false);
+      unkept_ofs.push_back(ipf);
+      continue;
+    }
+
+    // A function matching the snapshot of the prior one is replaced
+    // by the prior one, and the snapshot carried over. Otherwise the
+    // new function is snapshot for the next iteration.
+    bool reuse = false;
+    map<string, IvPFunction*>::iterator p = m_prep_ofs.find(key);
+    map<string, vector<double> >::iterator q = m_prep_snaps.find(key);
+    if((p != m_prep_ofs.end()) && (q != m_prep_snaps.end()) &&
+       snapshotIPF(ipf, q->second, true)) {
+      delete(ipf);
+      ipf = p->second;
+      m_prep_ofs.erase(p);
+      m_ivp_functions[i] = ipf;
+      m_warm_reused++;
+      reuse = true;
+      new_prep_snaps[key].swap(q->second);
+    }
+    else
+      snapshotIPF(ipf, new_prep_snaps[key]);
+
+    m_warm_problem->addOF(ipf, reuse);
+    new_prep_ofs[key] = ipf;
+  }
+
+  // Functions from the prior iteration not re-used are done with
+  clearPreparedOFs();
+  m_prep_ofs.swap(new_prep_ofs);
+  m_prep_snaps.swap(new_prep_snaps);
+
+  m_warm_problem->setDomain(m_sub_domain);
+  m_warm_problem->alignOFs();
+  if(m_prev_decision.getDim() == (int)(m_sub_domain.size()))
+    m_warm_problem->solve(&m_prev_decision);
+  else
+    m_warm_problem->solve();
+  m_solve_timer.stop();
+
+  unsigned int dsize = m_sub_domain.size();
+  for(i=0; i<dsize; i++) {
+    string dom_name = m_sub_domain.getVarName(i);
+    double decision = m_warm_problem->getResult(dom_name);
+    string post_str = "DESIRED_" + toupper(dom_name);
+    m_helm_report.addDecision(dom_name, decision);
+    m_helm_report.addMsg(post_str+": " + doubleToString(decision,2));
+  }    
+  m_helm_report.addMsg("Warm start re-used " + uintToString(m_warm_reused)
+		       + " of " + uintToString(ipfs) + " IvP functions");
+
+  const IvPBox *maxbox = m_warm_problem->getMaxBox();
+  if(maxbox)
+    m_prev_decision = maxbox->maxPt();
+  else
+    m_prev_decision = IvPBox();
+  m_prev_domain = m_sub_domain;
+
+  m_warm_problem->releaseIPFs();
+  for(i=0; i<unkept_ofs.size(); i++)
+    delete(unkept_ofs[i]);
+  return(true);
+}
+
+//------------------------------------------------------------------
+// Procedure: clearPreparedOFs()
+
+void HelmEngine::clearPreparedOFs()
+{
+  map<string, IvPFunction*>::iterator p;
+  for(p=m_prep_ofs.begin(); p!=m_prep_ofs.end(); p++)
+    delete(p->second);
+  m_prep_ofs.clear();
+  m_prep_snaps.clear();
+}
+
 //------------------------------------------------------------------
 // Procedure: part6_FinishHelmReport()
 
@@ -383,6 +763,11 @@ bool HelmEngine::part6_FinishHelmReport()
   m_helm_report.setMaxSolveTime(m_max_solve_time);
   m_helm_report.setMaxLoopTime(m_max_loop_time);
 
+  if(m_bhv_set) {
+    m_helm_report.setOFCacheHits(m_bhv_set->getOFCacheHits());
+    m_helm_report.setOFCacheMisses(m_bhv_set->getOFCacheMisses());
+  }
+
   return(true);
 }
 
@@ -25,9 +25,13 @@
 #define HELM_ENGINE_HEADER
 
 #include <vector>
+#include <map>
+#include <string>
 #include "IvPDomain.h"
+#include "IvPBox.h"
 #include "HelmReport.h"
 #include "MBTimer.h"
+#include "IvPThreadPool.h"
 
 class InfoBuffer;
 class IvPFunction;
@@ -40,15 +44,25 @@ public:
 
   HelmReport determineNextDecision(BehaviorSet *bset, double curr_time);
 
+  void setSolverThreads(unsigned int v) {m_solver_threads=v;}
+  void setSolverWarmStart(bool v)       {m_solver_warm_start=v;}
+  void setBehaviorThreads(unsigned int v) {m_bhv_threads=v;}
+
 protected:
   bool   checkOFDomains(std::vector<IvPFunction*>);
 
   bool   part1_PreliminaryBehaviorSetHandling();
   bool   part2_GetFunctionsFromBehaviorSet(int filter_level);
+  void   part2_ProduceConcurrently(int filter_level);
+  void   part2_WorkerLoop();
   bool   part3_VerifyFunctionDomains();
   bool   part4_BuildAndSolveIvPProblem(std::string phase="direct");
+  bool   part4_SolveWarmStart();
+  void   clearPreparedOFs();
   bool   part6_FinishHelmReport();
 
+  static void bhvWorkerEntry(void*, unsigned int);
+
 protected:
   IvPDomain  m_ivp_domain;
   IvPDomain  m_sub_domain;
@@ -65,10 +79,39 @@ protected:
   double       m_max_solve_time;
   double       m_max_loop_time;
 
+  unsigned int m_solver_threads;
+
+  // Functions of parallel-safe behaviors are produced on worker 
+  // threads ahead of the ordered pass in part2. Results are held
+  // per behavior index until that pass consumes them.
+  unsigned int               m_bhv_threads;
+  IvPThreadPool              m_bhv_pool;
+  std::vector<unsigned int>  m_par_ix;
+  unsigned int               m_par_next;
+  std::vector<int>           m_par_done;
+  std::vector<IvPFunction*>  m_par_ipf;
+  std::vector<std::string>   m_par_state;
+  std::vector<double>        m_par_wall;
+  std::vector<double>        m_par_cpu;
+
   std::vector<IvPFunction*> m_ivp_functions;
+  std::vector<std::string>  m_ivp_sources;
+
+  // Warm start state kept between iterations. The prepared (i.e., 
+  // normalized, weighted and aligned) function from each behavior
+  // is kept, keyed on the behavior descriptor, along with a snapshot
+  // of the raw function it was prepared from. The last decision is
+  // kept to seed the next search.
+  bool         m_solver_warm_start;
+  IvPProblem  *m_warm_problem;
+  IvPDomain    m_prev_domain;
+  IvPBox       m_prev_decision;
+  unsigned int m_warm_reused;
+
+  std::map<std::string, IvPFunction*>         m_prep_ofs;
+  std::map<std::string, std::vector<double> > m_prep_snaps;
 
   MBTimer  m_create_timer;
-  MBTimer  m_ipf_timer;
   MBTimer  m_solve_timer;
 };
 
@@ -74,6 +74,11 @@ HelmIvP::HelmIvP()
   m_curr_time      = 0;
   m_start_time     = 0;
   m_no_decisions   = 0;
+  m_solver_threads = 1;
+  m_bhv_threads    = 1;
+  m_solver_warm_start = false;
+  m_helm_summary      = true;
+  m_ipf_binary = false;
 
   // The m_has_control correlates to helm status
   m_has_control     = false;
@@ -344,31 +349,40 @@ bool HelmIvP::Iterate()
   unsigned int warning_count = getWarningCount("all"); 
   m_helm_report.setWarningCount(warning_count);
   
-  string report;
-  if(m_rejournal_requested) {    
-    report = m_helm_report.getReportAsString();
-    m_rejournal_requested = false;
+  if(m_helm_summary) {
+    string report;
+    if(m_rejournal_requested) {    
+      report = m_helm_report.getReportAsString();
+      m_rejournal_requested = false;
+    }
+    else
+      report = m_helm_report.getReportAsString(m_prev_helm_report); 
+    Notify("IVPHELM_SUMMARY", report);
   }
-  else
-    report = m_helm_report.getReportAsString(m_prev_helm_report); 
-  
-  Notify("IVPHELM_SUMMARY", report);
   Notify("IVPHELM_IPF_CNT", m_helm_report.getOFNUM());
 
-  string bhvs_active_list = m_helm_report.getActiveBehaviors(false);
-  if(m_bhvs_active_list != bhvs_active_list) {
-    Notify("IVPHELM_BHV_ACTIVE", bhvs_active_list); 
-    m_bhvs_active_list = bhvs_active_list;
+  // The behavior lists are only made if they may have changed. The
+  // lists last posted are those of the prior report.
+  if(m_helm_report.changedActiveBHVs(m_prev_helm_report)) {
+    string bhvs_active_list = m_helm_report.getActiveBehaviors(false);
+    if(m_bhvs_active_list != bhvs_active_list) {
+      Notify("IVPHELM_BHV_ACTIVE", bhvs_active_list); 
+      m_bhvs_active_list = bhvs_active_list;
+    }
   }
-  string bhvs_running_list = m_helm_report.getRunningBehaviors(false);
-  if(m_bhvs_running_list != bhvs_running_list) {
-    Notify("IVPHELM_BHV_RUNNING", bhvs_running_list); 
-    m_bhvs_running_list = bhvs_running_list;
+  if(m_helm_report.changedRunningBHVs(m_prev_helm_report)) {
+    string bhvs_running_list = m_helm_report.getRunningBehaviors(false);
+    if(m_bhvs_running_list != bhvs_running_list) {
+      Notify("IVPHELM_BHV_RUNNING", bhvs_running_list); 
+      m_bhvs_running_list = bhvs_running_list;
+    }
   }
-  string bhvs_idle_list = m_helm_report.getIdleBehaviors(false);
-  if(m_bhvs_idle_list != bhvs_idle_list) {
-    Notify("IVPHELM_BHV_IDLE", bhvs_idle_list); 
-    m_bhvs_idle_list = bhvs_idle_list;
+  if(m_helm_report.changedIdleBHVs(m_prev_helm_report)) {
+    string bhvs_idle_list = m_helm_report.getIdleBehaviors(false);
+    if(m_bhvs_idle_list != bhvs_idle_list) {
+      Notify("IVPHELM_BHV_IDLE", bhvs_idle_list); 
+      m_bhvs_idle_list = bhvs_idle_list;
+    }
   }
 
   m_prev_helm_report = m_helm_report;
@@ -483,8 +497,13 @@ void HelmIvP::postBehaviorMessages()
       else if(var == "BHV_ERROR")
 	reportRunWarning("BHV_ERROR: " + sdata);
 
+      // A binary IvP Function is compact enough to post whole as a
+      // MOOS binary string, with the behavior as the source aux.
+      if((var == "BHV_IPF") && msg.is_binary())
+	Notify("BHV_IPF", (void*)(sdata.data()), sdata.length(), 
+	       bhv_descriptor);
       // If posting an IvP Function, mux first and post the parts.
-      if(var == "BHV_IPF") { // mikerb
+      else if(var == "BHV_IPF") { // mikerb
 
 #if 0
 	Notify("BHV_IPF", sdata);
@@ -1084,6 +1103,16 @@ bool HelmIvP::OnStartUp()
     }
     else if(param == "OTHER_OVERRIDE_VAR") 
       handled = setNonWhiteVarOnString(m_additional_override, value);
+    else if(param == "SOLVER_THREADS") 
+      handled = handleConfigThreads(value, m_solver_threads);
+    else if(param == "BEHAVIOR_THREADS") 
+      handled = handleConfigThreads(value, m_bhv_threads);
+    else if(param == "SOLVER_WARM_START") 
+      handled = setBooleanOnString(m_solver_warm_start, value);
+    else if(param == "IPF_BINARY") 
+      handled = setBooleanOnString(m_ipf_binary, value);
+    else if(param == "HELM_SUMMARY") 
+      handled = setBooleanOnString(m_helm_summary, value);
 
     if(!handled)
       reportUnhandledConfigWarning(orig);
@@ -1097,6 +1126,9 @@ bool HelmIvP::OnStartUp()
   }
 
   m_hengine = new HelmEngine(m_ivp_domain, m_info_buffer);
+  m_hengine->setSolverThreads(m_solver_threads);
+  m_hengine->setBehaviorThreads(m_bhv_threads);
+  m_hengine->setSolverWarmStart(m_solver_warm_start);
 
   Populator_BehaviorSet *p_bset;
   p_bset = new Populator_BehaviorSet(m_ivp_domain, m_info_buffer);
@@ -1127,6 +1159,7 @@ bool HelmIvP::OnStartUp()
     MOOSTrace("NULL Behavior Set \n");
     return(false);
   }
+  m_bhv_set->setReportIPFBinary(m_ipf_binary);
 
   // Set the "ownship" parameter for all behaviors
   unsigned int i, bsize = m_bhv_set->size();
@@ -1236,6 +1269,24 @@ bool HelmIvP::handleConfigDomain(const string& g_entry)
   return(ok);
 }
 
+//--------------------------------------------------------------------
+// Procedure: handleConfigThreads
+//   Example: SOLVER_THREADS = 4
+//   Example: BEHAVIOR_THREADS = 4
+//      Note: A value of 1 (the default) means the work is serial.
+
+bool HelmIvP::handleConfigThreads(const string& value, 
+				  unsigned int& threads)
+{
+  if(!isNumber(value))
+    return(false);
+  int ival = atoi(value.c_str());
+  if((ival < 1) || (ival > 64))
+    return(false);
+  threads = (unsigned int)(ival);
+  return(true);
+}
+
 //--------------------------------------------------------------------
 // Procedure: addBehaviorFile
 //     Notes: More then one behavior file can be used to 
@@ -67,6 +67,7 @@ public:
   bool handleConfigSkewAny(const std::string&);
   bool handleConfigStandBy(const std::string&);
   bool handleConfigDomain(const std::string&);
+  bool handleConfigThreads(const std::string&, unsigned int&);
   
  protected:
   bool handleHeartBeat(const std::string&);
@@ -145,6 +146,11 @@ protected:
   HelmReport    m_helm_report;
   HelmReport    m_prev_helm_report;
   HelmEngine*   m_hengine;
+  unsigned int  m_solver_threads;
+  unsigned int  m_bhv_threads;
+  bool          m_solver_warm_start;
+  bool          m_helm_summary;
+  bool          m_ipf_binary;
 
   std::string   m_bhvs_active_list;
   std::string   m_bhvs_running_list;
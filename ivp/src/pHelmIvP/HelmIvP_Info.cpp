@@ -128,6 +128,26 @@ void showExampleConfigAndExit()
   blk("  node_skew            = charlie,45  ","// vehicle_name, secs   ");
   blk("  ok_skew              = 60          ","// or {any}             ");
   blk("                                                                ");
+  blk("  // Number of threads used by the IvP solver (1 is serial)     ");
+  blk("  solver_threads       = 1                                      ");
+  blk("                                                                ");
+  blk("  // Number of threads producing functions of parallel-safe     ");
+  blk("  // behaviors, e.g., BHV_AvoidCollision, configured with       ");
+  blk("  // parallel=true (1 is serial)                                ");
+  blk("  behavior_threads     = 1                                      ");
+  blk("                                                                ");
+  blk("  // If true, re-use unchanged functions and seed the solver     ");
+  blk("  // with the prior decision (default is false)                  ");
+  blk("  solver_warm_start    = false                                  ");
+  blk("                                                                ");
+  blk("  // If true, post BHV_IPF as a compact binary string rather     ");
+  blk("  // than muxed text packets (default is false)                  ");
+  blk("  ipf_binary           = false                                  ");
+  blk("                                                                ");
+  blk("  // If false, do not post IVPHELM_SUMMARY, e.g., when no tool   ");
+  blk("  // such as uHelmScope or alogview uses it (default is true)    ");
+  blk("  helm_summary         = true                                   ");
+  blk("                                                                ");
   blk("  // Configure the verbosity of terminal output.                ");
   blk("  verbose              = terse  "," // or {true,false,quiet}    ");
 
@@ -175,6 +195,7 @@ void showInterfaceAndExit()
   blk("  +                                                             ");
   blk("  BHV_ERROR             = Error description gen'ed by behavior  ");
   blk("  BHV_IPF               = Serialization of an IvP function      ");
+  blk("                          (binary string if ipf_binary=true)    ");
   blk("  BHV_WARNING           = Warning description gen'ed by behavior");
   blk("                                                                ");
   blk("  IVPHELM_STATE         = PARK, DRIVE, STANDBY, DISABLED        ");
@@ -144,13 +144,9 @@ void SearchGrid::handleNodeReport(string str)
   double posx = record.getX();
   double posy = record.getY();
 
-  unsigned index, gsize = m_grid.size();
-  for(index=0; index<gsize; index++) {
-    bool contained = m_grid.ptIntersect(index, posx, posy);
-    if(contained) {
-      m_grid.incVal(index, 1);
-    }
-  }
+  vector<unsigned int> cells = m_grid.ptIntersectCells(posx, posy);
+  for(unsigned int i=0; i<cells.size(); i++)
+    m_grid.incVal(cells[i], 1);
 
 }
 
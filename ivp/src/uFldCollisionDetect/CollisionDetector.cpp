@@ -140,143 +140,189 @@ bool CollisionDetector::Iterate()
     m_check_string = "ON";
   }
 
+  // Index the latest positions. A pair can only come within the
+  // preferred CPA distance before the next report if it is already
+  // within that distance plus what both can close in the meantime.
+  double max_speed = 0;
+  m_node_grid.clear();
+  m_node_grid.setCellSize(m_preferred_min_cpa_distance > 1 ? 
+			  m_preferred_min_cpa_distance : 1);
+  map<string,NodeRecord>::iterator p;
+  for(p=m_moos_map.begin(); p!=m_moos_map.end(); p++) {
+    m_node_grid.addNode(p->first, p->second.getX(), p->second.getY());
+    if(fabs(p->second.getSpeed()) > max_speed)
+      max_speed = fabs(p->second.getSpeed());
+  }
+
   // check positions relative to other vehicles
+  vector<string> nearby;
   for (map<string,NodeRecord>::iterator it1=m_moos_map.begin(); it1!=m_moos_map.end(); ++it1){
-    
-    //check only vehicles that have not yet been checked
-    for (map<string,NodeRecord>::iterator it2=m_moos_map.find(it1->first);it2!=m_moos_map.end(); ++it2){
-      //vehicle names
-      string v1 = it1->first;
-      string v2 = it2->first;
-      //      string collision_string = "";
-
-      if(v1 != v2){
-	bool collisionKnown = false;
-	double clear_time = MOOSTime() - 5; // ensures default of clearing screen case below if no prior collision existed.
-	bool posted = false;
-
-	if(! ( m_col_bools.find(make_pair(v1,v2)) == m_col_bools.end() )) {
-	  // v1, v2 pair found => this pair has already had at least one interaction.  
-	  // Determine if they are in an existing interaction condition. 
-	  // If not in existing interaction, then the false from initialization will hold and a new interaction will be processed.
-	  collisionKnown = (m_col_bools.find(make_pair(v1,v2))->second).getInteracting();
-	  clear_time = (m_col_bools.find(make_pair(v1,v2))->second).getDisplayClearTime();
-	  posted =  (m_col_bools.find(make_pair(v1,v2))->second).getPosted();
-	}
-	 // variables to be posted to MOOSDB
-	const string name_string = "VEHICLE_INTERACTION_REPORT_" + toupper(v1) + "_" + toupper(v2);
-	const string name_string_immediate = "VEHICLE_INTERACTION_IMMEDIATE_" + toupper(v1) + "_" + toupper(v2);
-
-	// os is first alphabetically; cn is other vessel
-	NodeRecord os = m_moos_map[v1];
-	NodeRecord cn = m_moos_map[v2];
-
-	double cnx = cn.getX();
-	double cny = cn.getY();
-	double cnh = cn.getHeading();
-	double cnv = cn.getSpeed();
-	  
-	double osx = os.getX();
-	double osy = os.getY();
-	double osh = os.getHeading();
-	double osv = os.getSpeed();
-	double ostol = os.getElapsedTime(MOOSTime());
-	  
-	CPAEngine cpaengine = CPAEngine(cny,cnx,cnh,cnv,osy,osx);
-	double distance = cpaengine.evalCPA(osh,osv,ostol);
-	
-	// if within interaction threshold distance AND interaction not already known
-	if((distance < m_preferred_min_cpa_distance) && (!collisionKnown) && (m_check_collisions)){ 
-	  // this is a new interaction
-	  // keep track of current interaction in m_col_bools for appcasting
-	  // a interaction is known to exist between v1 and v2.
-
-	  CollisionRecord cr;
-	  cr.set2Vehicles(v1, v2);
-	  cr.setParameters(m_collision_distance, m_near_miss_distance, m_preferred_min_cpa_distance);
-	  cr.setInteracting(true);// = true;
-	  cr.setMinDistance(distance);
-	  cr.setDetectionDistance(distance);
-	  cr.setDisplayClearTime((MOOSTime()+m_delay_time_to_clear));
-	  cr.setPosted(false);
-	  cr.updateCollisionType();
-	  cr.setInteractionTime(MOOSTime());
-	  storeVehicleModes(cr,v1,v2);
-	  
-	  if((m_pulse_bool)){
-	    MakeCPAViolationRangePulse((it1->second).getX(),(it1->second).getY());
-	    MakeCPAViolationRangePulse((it2->second).getX(),(it2->second).getY());
-	    cr.cpaRangeRingFired();
-	  }
-
-	  
-	  m_col_bools[make_pair(v1,v2)] = cr;
-	  string info_string = cr.getString();
-	  reportEvent(info_string);
-	  
-	  if(m_post_immediately){
-	      Notify(name_string_immediate,info_string);
-	  }
-	}
-	else if((distance < m_preferred_min_cpa_distance) && (collisionKnown) ){ 
-	  // interaction remains; update the minimum distance and time until appcast is cleared.
-	  // interaction is assumed if any distance is less than preferred cpa distance
-
-	  CollisionRecord& rec =  (m_col_bools[make_pair(v1,v2)]);
-	  rec.setMinDistance(distance);
-	  rec.setDisplayClearTime(MOOSTime() + m_delay_time_to_clear);
-	  storeVehicleModes(rec,v1,v2);
-
-	  string info_string = (rec).getString();
-	  
-	  if((distance < m_collision_distance)){
-	    if(m_post_immediately && ! (rec).getCollisionPosted()){
-	      Notify(name_string_immediate,info_string);
-	      (rec).collisionPosted();
-	    }
-	    if( (m_pulse_bool) &&  (!(rec).getCollisionRangeRingFired())){
-	      MakeCollisionRangePulse((it1->second).getX(),(it1->second).getY());
-	      MakeCollisionRangePulse((it2->second).getX(),(it2->second).getY());
-	      (rec).collisionRangeRingFired();
-	    }
-	  }
-	  else if(distance < m_near_miss_distance){
-	    if(m_post_immediately && !(rec).getNearMissPosted()){
-	      Notify(name_string_immediate,info_string);
-	      (rec).nearMissPosted();
-	    }
-	    if( (m_pulse_bool) && (!(rec).getNearMissRangeRingFired())){
-	      MakeNearMissRangePulse((it1->second).getX(),(it1->second).getY());
-	      MakeNearMissRangePulse((it2->second).getX(),(it2->second).getY());
-	      (rec).nearMissRangeRingFired();
-	    }
-	  }
-	}
-	else if((collisionKnown) && (clear_time >= MOOSTime())){
-	  // interaction no longer exists, but still desire the appcast display to occur
-	  
-	  if((!posted)){
-	    postAndUpdate(v1, v2, name_string);
-	  }
-	  
-	}
-	else if((collisionKnown) && (clear_time < MOOSTime())){
-	  // no interaction exists between these two vehicles and no longer desire appcast display.
-	  if( (!posted)){
-	    postAndUpdate(v1, v2, name_string);
-	  }
-	  (m_col_bools[make_pair(v1,v2)]).clearInteraction();
-	}
-	else{
-	  // no interaction exists and message has already been posted; do not re-post.  Case reserved for future use.
-	}
-      }
+    const string& v1 = it1->first;
+    const NodeRecord& os = it1->second;
+
+    double ostol  = fabs(os.getElapsedTime(MOOSTime()));
+    double reach  = m_preferred_min_cpa_distance;
+    reach += (fabs(os.getSpeed()) + max_speed) * ostol;
+    reach += 1 + (0.01 * reach);  // slack for round-off
+
+    // Partners later alphabetically, true if near enough to evaluate
+    map<string,bool> partners;
+    nearby.clear();
+    m_node_grid.getNodesWithin(os.getX(), os.getY(), reach, nearby);
+    for(unsigned int i=0; i<nearby.size(); i++) {
+      if(nearby[i] > v1)
+	partners[nearby[i]] = true;
+    }
+
+    // Pairs in an interaction must be visited to be cleared/posted
+    map<pair<string,string>,CollisionRecord>::iterator q;
+    q = m_col_bools.lower_bound(make_pair(v1, string("")));
+    for(; (q!=m_col_bools.end()) && (q->first.first == v1); q++) {
+      if(q->second.getInteracting() && (partners.count(q->first.second) == 0))
+	partners[q->first.second] = false;
+    }
+
+    map<string,bool>::iterator r;
+    for(r=partners.begin(); r!=partners.end(); r++) {
+      map<string,NodeRecord>::iterator it2 = m_moos_map.find(r->first);
+      if(it2 != m_moos_map.end())
+	checkPair(it1, it2, r->second);
     }
   } 
   AppCastingMOOSApp::PostReport();
   return(true);
 }
 
+//---------------------------------------------------------
+// Procedure: checkPair()
+//   Purpose: Start, update or clear the interaction between the
+//            two vehicles. If evaluate is false the pair is known
+//            to be too far apart to be within the CPA distance.
+
+void CollisionDetector::checkPair(map<string,NodeRecord>::iterator it1,
+				  map<string,NodeRecord>::iterator it2,
+				  bool evaluate)
+{
+  // os is first alphabetically; cn is other vessel
+  const string& v1 = it1->first;
+  const string& v2 = it2->first;
+  const NodeRecord& os = it1->second;
+  const NodeRecord& cn = it2->second;
+
+  bool collisionKnown = false;
+  double clear_time = MOOSTime() - 5; // ensures default of clearing screen case below if no prior collision existed.
+  bool posted = false;
+
+  if(! ( m_col_bools.find(make_pair(v1,v2)) == m_col_bools.end() )) {
+    // v1, v2 pair found => this pair has already had at least one interaction.  
+    // Determine if they are in an existing interaction condition. 
+    // If not in existing interaction, then the false from initialization will hold and a new interaction will be processed.
+    collisionKnown = (m_col_bools.find(make_pair(v1,v2))->second).getInteracting();
+    clear_time = (m_col_bools.find(make_pair(v1,v2))->second).getDisplayClearTime();
+    posted =  (m_col_bools.find(make_pair(v1,v2))->second).getPosted();
+  }
+
+  // Pairs too far apart to be evaluated are known not to be within
+  // the preferred CPA distance.
+  double distance = m_preferred_min_cpa_distance;
+  if(evaluate) {
+    double ostol = os.getElapsedTime(MOOSTime());
+    CPAEngine cpaengine(cn.getY(), cn.getX(), cn.getHeading(), 
+			cn.getSpeed(), os.getY(), os.getX());
+    distance = cpaengine.evalCPA(os.getHeading(), os.getSpeed(), ostol);
+  }
+  if((distance >= m_preferred_min_cpa_distance) && !collisionKnown)
+    return;
+
+  // variables to be posted to MOOSDB
+  const string pair_tag = toupper(v1) + "_" + toupper(v2);
+  const string name_string = "VEHICLE_INTERACTION_REPORT_" + pair_tag;
+  const string name_string_immediate = "VEHICLE_INTERACTION_IMMEDIATE_" + pair_tag;
+
+  // if within interaction threshold distance AND interaction not already known
+  if((distance < m_preferred_min_cpa_distance) && (!collisionKnown) && (m_check_collisions)){ 
+    // this is a new interaction
+    // keep track of current interaction in m_col_bools for appcasting
+    // a interaction is known to exist between v1 and v2.
+
+    CollisionRecord cr;
+    cr.set2Vehicles(v1, v2);
+    cr.setParameters(m_collision_distance, m_near_miss_distance, m_preferred_min_cpa_distance);
+    cr.setInteracting(true);// = true;
+    cr.setMinDistance(distance);
+    cr.setDetectionDistance(distance);
+    cr.setDisplayClearTime((MOOSTime()+m_delay_time_to_clear));
+    cr.setPosted(false);
+    cr.updateCollisionType();
+    cr.setInteractionTime(MOOSTime());
+    storeVehicleModes(cr,v1,v2);
+    
+    if((m_pulse_bool)){
+      MakeCPAViolationRangePulse((it1->second).getX(),(it1->second).getY());
+      MakeCPAViolationRangePulse((it2->second).getX(),(it2->second).getY());
+      cr.cpaRangeRingFired();
+    }
+
+    
+    m_col_bools[make_pair(v1,v2)] = cr;
+    string info_string = cr.getString();
+    reportEvent(info_string);
+    
+    if(m_post_immediately){
+	Notify(name_string_immediate,info_string);
+    }
+  }
+  else if((distance < m_preferred_min_cpa_distance) && (collisionKnown) ){ 
+    // interaction remains; update the minimum distance and time until appcast is cleared.
+    // interaction is assumed if any distance is less than preferred cpa distance
+
+    CollisionRecord& rec =  (m_col_bools[make_pair(v1,v2)]);
+    rec.setMinDistance(distance);
+    rec.setDisplayClearTime(MOOSTime() + m_delay_time_to_clear);
+    storeVehicleModes(rec,v1,v2);
+
+    string info_string = (rec).getString();
+    
+    if((distance < m_collision_distance)){
+      if(m_post_immediately && ! (rec).getCollisionPosted()){
+	Notify(name_string_immediate,info_string);
+	(rec).collisionPosted();
+      }
+      if( (m_pulse_bool) &&  (!(rec).getCollisionRangeRingFired())){
+	MakeCollisionRangePulse((it1->second).getX(),(it1->second).getY());
+	MakeCollisionRangePulse((it2->second).getX(),(it2->second).getY());
+	(rec).collisionRangeRingFired();
+      }
+    }
+    else if(distance < m_near_miss_distance){
+      if(m_post_immediately && !(rec).getNearMissPosted()){
+	Notify(name_string_immediate,info_string);
+	(rec).nearMissPosted();
+      }
+      if( (m_pulse_bool) && (!(rec).getNearMissRangeRingFired())){
+	MakeNearMissRangePulse((it1->second).getX(),(it1->second).getY());
+	MakeNearMissRangePulse((it2->second).getX(),(it2->second).getY());
+	(rec).nearMissRangeRingFired();
+      }
+    }
+  }
+  else if((collisionKnown) && (clear_time >= MOOSTime())){
+    // interaction no longer exists, but still desire the appcast display to occur
+    
+    if((!posted)){
+      postAndUpdate(v1, v2, name_string);
+    }
+    
+  }
+  else if((collisionKnown) && (clear_time < MOOSTime())){
+    // no interaction exists between these two vehicles and no longer desire appcast display.
+    if( (!posted)){
+      postAndUpdate(v1, v2, name_string);
+    }
+    (m_col_bools[make_pair(v1,v2)]).clearInteraction();
+  }
+}
+
 void CollisionDetector::postAndUpdate(string v1, string v2, string name_string){
   string info_string = (m_col_bools.find(make_pair(v1,v2))->second).getString();
   Notify(name_string,info_string);
@@ -35,6 +35,7 @@
 #include "XYRangePulse.h"
 #include "CPAEngine.h"
 #include "NodeRecord.h"
+#include "NodeGrid.h"
 #include "CollisionDetector.h"
 #include "CollisionRecord.h"
 
@@ -50,6 +51,8 @@ class CollisionDetector : public AppCastingMOOSApp
    bool OnConnectToServer();
    bool OnStartUp();
    void postAndUpdate(string, string, string);
+   void checkPair(std::map<std::string,NodeRecord>::iterator,
+		  std::map<std::string,NodeRecord>::iterator, bool evaluate);
 
  protected: // Standard AppCastingMOOSApp function to overload 
    bool buildReport();
@@ -59,6 +62,7 @@ class CollisionDetector : public AppCastingMOOSApp
    std::map <std::string,NodeRecord> m_moos_map;  // holds the most recent NodeReport of a given vehicle
    std::map <std::pair<std::string,std::string>,CollisionRecord> m_col_bools; // holds the CollisionRecord associated with a given vehicle pair
    std::map <pair<std::string,std::string>,std::pair<std::string,std::string> > m_colregs_mode_map; //<v_os,v_cn>,<mode,submode>
+   NodeGrid m_node_grid;  // positions from m_moos_map, rebuilt each iteration
 
    // make range pulses
    bool MakeRangePulse(double, double);
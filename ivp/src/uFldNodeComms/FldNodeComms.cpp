@@ -55,6 +55,9 @@ FldNodeComms::FldNodeComms()
   m_max_msg_length   = 1000;    // zero means unlimited length
 
   m_verbose          = false;
+
+  m_earange_lo       = 1;
+  m_earange_hi       = 1;
   m_debug            = false;
 
   m_pulse_duration   = 10;      // zero means no pulses posted.
@@ -130,6 +133,9 @@ bool FldNodeComms::Iterate()
 {
   AppCastingMOOSApp::Iterate();
 
+  if(m_map_newrecord.size() > 0)
+    indexNodeRecords();
+
   map<string, bool>::iterator p;
   for(p=m_map_newrecord.begin(); p!=m_map_newrecord.end(); p++) {
     string uname   = p->first;    
@@ -379,6 +385,40 @@ bool FldNodeComms::handleEarange(const string& str)
 }
 
 
+//------------------------------------------------------------
+// Procedure: indexNodeRecords
+//   Purpose: Rebuild the grid of valid node record positions, in
+//            name order, and note the span of earange factors.
+
+void FldNodeComms::indexNodeRecords()
+{
+  double cell_size = 100;
+  if(m_comms_range > 0)
+    cell_size = m_comms_range;
+  else if(m_critical_range > 0)
+    cell_size = m_critical_range;
+
+  m_node_grid.clear();
+  m_node_grid.setCellSize(cell_size);
+
+  map<string, NodeRecord>::iterator p;
+  for(p=m_map_record.begin(); p!=m_map_record.end(); p++) {
+    if(p->second.valid())
+      m_node_grid.addNode(p->first, p->second.getX(), p->second.getY());
+  }
+
+  // Vehicles without an earange entry use a factor of 1.0
+  m_earange_lo = 1;
+  m_earange_hi = 1;
+  map<string, double>::iterator q;
+  for(q=m_map_earange.begin(); q!=m_map_earange.end(); q++) {
+    if(q->second < m_earange_lo)
+      m_earange_lo = q->second;
+    if(q->second > m_earange_hi)
+      m_earange_hi = q->second;
+  }
+}
+
 //------------------------------------------------------------
 // Procedure: distributeNodeReportInfo
 //   Purpose: Post the node report for vehicle <uname> to all 
@@ -398,9 +438,35 @@ void FldNodeComms::distributeNodeReportInfo(const string& uname)
   // We'll need the same node report sent out to all vehicles.
   string node_report = record.getSpec();
 
-  map<string, NodeRecord>::iterator p;
-  for(p=m_map_record.begin(); p!=m_map_record.end(); p++) {
-    string vname = p->first;
+  // Only vehicles within the larger of the critical range and the
+  // most generous comms range can pass Criteria #3 or the critical
+  // range check. In verbose mode every vehicle is still visited.
+  vector<string> vnames;
+  if(m_verbose) {
+    map<string, NodeRecord>::iterator p;
+    for(p=m_map_record.begin(); p!=m_map_record.end(); p++)
+      vnames.push_back(p->first);
+  }
+  else {
+    double stealth = 1.0;
+    if(m_map_stealth.count(uname))
+      stealth = m_map_stealth[uname];
+    double reach = m_critical_range;
+    double reach_lo = m_comms_range * stealth * m_earange_lo;
+    double reach_hi = m_comms_range * stealth * m_earange_hi;
+    if(reach_lo > reach)
+      reach = reach_lo;
+    if(reach_hi > reach)
+      reach = reach_hi;
+    if(reach >= 0) {
+      reach += 1 + (0.01 * reach);  // slack for round-off
+      m_node_grid.getNodesWithin(record.getX(), record.getY(), 
+				 reach, vnames);
+    }
+  }
+
+  for(unsigned int i=0; i<vnames.size(); i++) {
+    const string& vname = vnames[i];
 
     // Criteria #1: vehicles different
     if(vname == uname)
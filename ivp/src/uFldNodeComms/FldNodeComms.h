@@ -29,6 +29,7 @@
 #include "MOOS/libMOOS/Thirdparty/AppCasting/AppCastingMOOSApp.h"
 #include "NodeRecord.h"
 #include "NodeMessage.h"
+#include "NodeGrid.h"
 
 class FldNodeComms : public AppCastingMOOSApp
 {
@@ -53,6 +54,7 @@ class FldNodeComms : public AppCastingMOOSApp
   bool handleStealth(const std::string&);
   bool handleEarange(const std::string&);
 
+  void indexNodeRecords();
   void distributeNodeReportInfo(const std::string& uname);
   void distributeNodeMessageInfo(const std::string& uname);
   
@@ -116,6 +118,12 @@ class FldNodeComms : public AppCastingMOOSApp
 
   std::vector<std::string> m_colors;
 
+  // Positions of valid node records, rebuilt each iteration, and the
+  // span of earange factors, to bound the range of report recipients
+  NodeGrid m_node_grid;
+  double   m_earange_lo;
+  double   m_earange_hi;
+
  protected: // State (statistics) variables
 
   unsigned int   m_total_reports_rcvd;
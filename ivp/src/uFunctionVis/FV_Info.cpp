@@ -107,7 +107,7 @@ void showInterfaceAndExit()
   blk("                                                                ");
   blk("SUBSCRIPTIONS:                                                  ");
   blk("------------------------------------                            ");
-  blk("  BHV_IPF  = (string representation of an IvP Function)         ");
+  blk("  BHV_IPF  = (string or binary representation of an IvP Function)");
   blk("                                                                ");
   blk("PUBLICATIONS:                                                   ");
   blk("------------------------------------                            ");
@@ -63,7 +63,10 @@ bool FV_MOOSApp::OnNewMail(MOOSMSG_LIST &NewMail)
 	if(key == "BHV_IPF") {
 	  string ipf_str = msg.GetString();
 	  string community = msg.GetCommunity();
-	  m_demuxer.addMuxPacket(ipf_str, timestamp, community);
+	  if(msg.IsBinary())
+	    m_demuxer.addDemuxedString(ipf_str, timestamp, community);
+	  else
+	    m_demuxer.addMuxPacket(ipf_str, timestamp, community);
         }
     }
   }